@@ -5,6 +5,7 @@ TelemetryData latestData = {0};
 bool dataReceived = false;
 std::vector<ESP_NOW_Peer_Class *> masters;
 unsigned long lastDataReceivedTime = 0;
+static espnow_receive_callback_t receiveCallback = nullptr;
 
 // Timeout configuration (5 seconds)
 #define DATA_TIMEOUT_MS 5000
@@ -23,6 +24,7 @@ void ESP_NOW_Peer_Class::onReceive(const uint8_t *data, size_t len, bool broadca
     memcpy(&latestData, data, sizeof(TelemetryData));
     dataReceived = true;
     lastDataReceivedTime = millis();
+    if (receiveCallback) receiveCallback(&latestData);
   }
 }
 
@@ -74,6 +76,11 @@ void espnow_check_timeout() {
   }
 }
 
+/* --- Register a callback for every received packet (fast path) --- */
+void espnow_set_receive_callback(espnow_receive_callback_t callback) {
+  receiveCallback = callback;
+}
+
 /* --- Get telemetry data with automatic timeout check --- */
 TelemetryData espnow_get_data() {
   espnow_check_timeout();
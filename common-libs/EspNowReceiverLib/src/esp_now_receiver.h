@@ -16,6 +16,10 @@ public:
   void onReceive(const uint8_t *data, size_t len, bool broadcast);
 };
 
+// Called from the receive task for every telemetry packet, after latestData is
+// updated. Keep it short and do not call LVGL from it.
+typedef void (*espnow_receive_callback_t)(const TelemetryData *data);
+
 // Global variables
 extern TelemetryData latestData;
 extern bool dataReceived;
@@ -26,5 +30,6 @@ void register_new_master(const esp_now_recv_info_t *info, const uint8_t *data, i
 void espnow_receiver_init();
 void espnow_check_timeout();
 TelemetryData espnow_get_data();
+void espnow_set_receive_callback(espnow_receive_callback_t callback);
 
 #endif // ESP_NOW_RECEIVER_H
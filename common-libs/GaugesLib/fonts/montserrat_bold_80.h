@@ -0,0 +1,3792 @@
+/*******************************************************************************
+ * Size: 80 px
+ * Bpp: 1
+ * Opts: --bpp 1 --size 80 --no-compress --stride 1 --align 1 --font Montserrat-Bold.ttf --symbols 0xF613 --range 32-127 --format lvgl -o montserrat_bold_80.c
+ ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+
+#ifndef MONTSERRAT_BOLD_80
+#define MONTSERRAT_BOLD_80 1
+#endif
+
+#if MONTSERRAT_BOLD_80
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t montserrat_bold_80_glyph_bitmap[] = {
+    /* U+0020 " " */
+    0x0,
+
+    /* U+0021 "!" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xff, 0xcf, 0xff, 0x9f, 0xff, 0x3f, 0xfe, 0x7f,
+    0xfc, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xe7, 0xff,
+    0xcf, 0xff, 0x9f, 0xff, 0x3f, 0xfe, 0x7f, 0xfc,
+    0xff, 0xf9, 0xff, 0xf1, 0xff, 0xe3, 0xff, 0x87,
+    0xff, 0xf, 0xfe, 0x1f, 0xfc, 0x3f, 0xf8, 0x7f,
+    0xf0, 0xff, 0xe1, 0xff, 0xc3, 0xff, 0x87, 0xff,
+    0xf, 0xfe, 0x1f, 0xfc, 0x3f, 0xf8, 0x7f, 0xf0,
+    0xff, 0xe0, 0xff, 0x81, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x1, 0xff, 0x7, 0xff, 0x1f, 0xff,
+    0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xef, 0xff, 0x9f, 0xff, 0x1f,
+    0xfc, 0x1f, 0xe0, 0x2, 0x0,
+
+    /* U+0022 "\"" */
+    0xff, 0xc0, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xfc,
+    0xf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0xf0, 0x3f, 0xff, 0xfc, 0xf, 0xff, 0xff,
+    0x3, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf0, 0x3f,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0x3, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xfc, 0xf,
+    0xff, 0xff, 0x3, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xf0, 0x3f, 0xff, 0xfc, 0xf, 0xff, 0xff, 0x3,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0xf0, 0x3f, 0xff,
+    0xfc, 0xf, 0xfc,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0xff, 0x80, 0x7, 0xfc, 0x0, 0x0,
+    0x1, 0xff, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x3,
+    0xfe, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x7, 0xfc,
+    0x0, 0x7f, 0xc0, 0x0, 0x0, 0xf, 0xf8, 0x0,
+    0xff, 0x80, 0x0, 0x0, 0x3f, 0xe0, 0x1, 0xff,
+    0x0, 0x0, 0x0, 0x7f, 0xc0, 0x3, 0xfe, 0x0,
+    0x0, 0x0, 0xff, 0x80, 0x7, 0xfc, 0x0, 0x0,
+    0x1, 0xff, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x3,
+    0xfe, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x7, 0xfc,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0xf, 0xf8, 0x0,
+    0x7f, 0xc0, 0x0, 0x0, 0x1f, 0xf0, 0x1, 0xff,
+    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x3, 0xfe, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3,
+    0xfe, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x7, 0xfc,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0xf, 0xf8, 0x0,
+    0x7f, 0xc0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0xff,
+    0x80, 0x0, 0x0, 0x3f, 0xe0, 0x1, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xc0, 0x7, 0xfc, 0x0, 0x0,
+    0x0, 0xff, 0x80, 0xf, 0xf8, 0x0, 0x0, 0x3,
+    0xfe, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x7, 0xfc,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0xf, 0xf8, 0x0,
+    0x7f, 0xc0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0xff,
+    0x80, 0x0, 0x0, 0x3f, 0xe0, 0x1, 0xff, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1,
+    0xff, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x3, 0xfe,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0xf, 0xf8, 0x0,
+    0x7f, 0xc0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0xff,
+    0x80, 0x0, 0x0, 0x3f, 0xe0, 0x1, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xc0, 0x3, 0xfe, 0x0, 0x0,
+    0x0, 0xff, 0x80, 0x7, 0xfc, 0x0, 0x0, 0x1,
+    0xff, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x3, 0xfe,
+    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x7, 0xfc, 0x0,
+    0x7f, 0xc0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0xff,
+    0x80, 0x0, 0x0, 0x3f, 0xe0, 0x1, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xc0, 0x3, 0xfe, 0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff,
+    0xfd, 0xff, 0xe0, 0x3f, 0xff, 0x8f, 0xf0, 0x7f,
+    0x80, 0xff, 0xfc, 0x3f, 0xc0, 0x3c, 0x3, 0xff,
+    0xe0, 0xff, 0x0, 0x30, 0x1f, 0xff, 0x3, 0xfc,
+    0x0, 0x40, 0x7f, 0xfc, 0xf, 0xf0, 0x0, 0x1,
+    0xff, 0xf0, 0x3f, 0xc0, 0x0, 0x7, 0xff, 0xc0,
+    0xff, 0x0, 0x0, 0x1f, 0xff, 0x3, 0xfc, 0x0,
+    0x0, 0x7f, 0xfe, 0xf, 0xf0, 0x0, 0x1, 0xff,
+    0xfc, 0x3f, 0xc0, 0x0, 0x7, 0xff, 0xfc, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0xff, 0x7f, 0xff, 0xc0, 0x0,
+    0x3, 0xfc, 0x7f, 0xff, 0x0, 0x0, 0xf, 0xf0,
+    0xff, 0xfc, 0x0, 0x0, 0x3f, 0xc1, 0xff, 0xf0,
+    0x0, 0x0, 0xff, 0x7, 0xff, 0xc0, 0x0, 0x3,
+    0xfc, 0x1f, 0xff, 0xc, 0x0, 0xf, 0xf0, 0x7f,
+    0xfc, 0x7c, 0x0, 0x3f, 0xc1, 0xff, 0xf1, 0xf8,
+    0x0, 0xff, 0xf, 0xff, 0x8f, 0xfc, 0x3, 0xfc,
+    0x7f, 0xfe, 0x3f, 0xfe, 0xf, 0xf7, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xfc, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xf0,
+    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x7, 0xfc,
+    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x3, 0xff,
+    0x0, 0x3, 0xff, 0xf, 0xfc, 0x0, 0x1, 0xff,
+    0x80, 0x0, 0xff, 0x0, 0xff, 0x0, 0x0, 0x7f,
+    0xc0, 0x0, 0x7f, 0xc0, 0x3f, 0xe0, 0x0, 0x3f,
+    0xf0, 0x0, 0x1f, 0xe0, 0x7, 0xf8, 0x0, 0x1f,
+    0xf8, 0x0, 0x7, 0xf8, 0x1, 0xfe, 0x0, 0xf,
+    0xfc, 0x0, 0x3, 0xfc, 0x0, 0x3f, 0xc0, 0x3,
+    0xff, 0x0, 0x0, 0xff, 0x0, 0xf, 0xf0, 0x1,
+    0xff, 0x80, 0x0, 0x3f, 0xc0, 0x3, 0xfc, 0x0,
+    0xff, 0xc0, 0x0, 0xf, 0xf0, 0x0, 0xff, 0x0,
+    0x3f, 0xf0, 0x0, 0x3, 0xfc, 0x0, 0x3f, 0xc0,
+    0x1f, 0xf8, 0x0, 0x0, 0xff, 0x0, 0xf, 0xf0,
+    0xf, 0xfc, 0x0, 0x0, 0x3f, 0xc0, 0x3, 0xfc,
+    0x3, 0xff, 0x0, 0x0, 0xf, 0xf0, 0x0, 0xff,
+    0x1, 0xff, 0x80, 0x0, 0x3, 0xfc, 0x0, 0x3f,
+    0xc0, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0x80, 0x1f,
+    0xe0, 0x3f, 0xf0, 0x0, 0x0, 0x1f, 0xe0, 0x7,
+    0xf8, 0x1f, 0xf8, 0x0, 0x0, 0x7, 0xfc, 0x3,
+    0xfe, 0xf, 0xfc, 0x0, 0x0, 0x0, 0xff, 0x0,
+    0xff, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf0,
+    0xff, 0xc1, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xe0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xf8, 0x1f, 0xf8, 0x3, 0xfc, 0x0, 0x3,
+    0xff, 0xfc, 0xf, 0xfc, 0x7, 0xff, 0xe0, 0x0,
+    0x7f, 0xfe, 0x3, 0xfe, 0x3, 0xff, 0xfc, 0x0,
+    0x3, 0xfc, 0x1, 0xff, 0x81, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xff, 0xc0, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x7f, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x1f, 0xf8, 0x3f, 0xf0, 0xff,
+    0xc0, 0x0, 0x0, 0xf, 0xfc, 0xf, 0xf0, 0xf,
+    0xf0, 0x0, 0x0, 0x3, 0xfe, 0x7, 0xfc, 0x3,
+    0xfe, 0x0, 0x0, 0x1, 0xff, 0x81, 0xfe, 0x0,
+    0x7f, 0x80, 0x0, 0x0, 0xff, 0xc0, 0x7f, 0x80,
+    0x1f, 0xe0, 0x0, 0x0, 0x3f, 0xe0, 0x3f, 0xc0,
+    0x3, 0xfc, 0x0, 0x0, 0x1f, 0xf8, 0xf, 0xf0,
+    0x0, 0xff, 0x0, 0x0, 0xf, 0xfc, 0x3, 0xfc,
+    0x0, 0x3f, 0xc0, 0x0, 0x7, 0xfe, 0x0, 0xff,
+    0x0, 0xf, 0xf0, 0x0, 0x1, 0xff, 0x80, 0x3f,
+    0xc0, 0x3, 0xfc, 0x0, 0x0, 0xff, 0xc0, 0xf,
+    0xf0, 0x0, 0xff, 0x0, 0x0, 0x7f, 0xe0, 0x3,
+    0xfc, 0x0, 0x3f, 0xc0, 0x0, 0x1f, 0xf8, 0x0,
+    0xff, 0x0, 0xf, 0xf0, 0x0, 0xf, 0xfc, 0x0,
+    0x3f, 0xc0, 0x3, 0xfc, 0x0, 0x7, 0xfe, 0x0,
+    0x7, 0xf8, 0x1, 0xfe, 0x0, 0x1, 0xff, 0x80,
+    0x1, 0xfe, 0x0, 0x7f, 0x80, 0x0, 0xff, 0xc0,
+    0x0, 0x7f, 0xc0, 0x3f, 0xe0, 0x0, 0x7f, 0xe0,
+    0x0, 0xf, 0xf8, 0x1f, 0xf0, 0x0, 0x1f, 0xf8,
+    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xfc,
+    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x7, 0xfe,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x1, 0xff,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0, 0xff,
+    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x7f,
+    0xe0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff,
+    0xf8, 0x3f, 0xfe, 0x0, 0x0, 0x3, 0xff, 0x80,
+    0x3f, 0xfc, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x7f,
+    0xf0, 0x0, 0x0, 0x7f, 0xf0, 0x1, 0xff, 0xc0,
+    0x0, 0x1, 0xff, 0xc0, 0x7, 0xff, 0x0, 0x0,
+    0x7, 0xff, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x1f,
+    0xfc, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x7f, 0xf0,
+    0x3, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xe0, 0x1f,
+    0xfe, 0x0, 0x0, 0x3, 0xff, 0xc0, 0xff, 0xf8,
+    0x0, 0x0, 0xf, 0xff, 0x87, 0xff, 0xe0, 0x0,
+    0x0, 0x3f, 0xff, 0x7f, 0xff, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xfe, 0x0, 0x3c, 0x0, 0xf, 0xff, 0xff, 0xfc,
+    0x0, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x7,
+    0xff, 0x3, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xfc,
+    0x1f, 0xff, 0xcf, 0xff, 0xe0, 0x7f, 0xf0, 0xff,
+    0xfc, 0x1f, 0xff, 0xe3, 0xff, 0x83, 0xff, 0xe0,
+    0x3f, 0xff, 0xcf, 0xfe, 0x1f, 0xff, 0x0, 0x7f,
+    0xff, 0xbf, 0xf8, 0x7f, 0xf8, 0x0, 0xff, 0xff,
+    0xff, 0xc1, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff,
+    0xf, 0xff, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x3f,
+    0xfc, 0x0, 0x3, 0xff, 0xff, 0xe0, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xff, 0x83, 0xff, 0xc0, 0x0,
+    0xf, 0xff, 0xfc, 0xf, 0xff, 0x0, 0x0, 0x1f,
+    0xff, 0xf0, 0x3f, 0xfe, 0x0, 0x0, 0x3f, 0xff,
+    0x80, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0x3,
+    0xff, 0xf8, 0x0, 0x7, 0xff, 0xfe, 0x7, 0xff,
+    0xf0, 0x0, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x83, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfc, 0x7,
+    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xe0, 0x7, 0xff,
+    0xff, 0xff, 0xe0, 0x7f, 0x0, 0xf, 0xff, 0xff,
+    0xfe, 0x0, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xe0,
+    0x1, 0xc0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x3,
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0027 "'" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+0028 "(" */
+    0x0, 0x7f, 0xf8, 0x1, 0xff, 0xe0, 0xf, 0xff,
+    0x0, 0x3f, 0xfc, 0x1, 0xff, 0xe0, 0x7, 0xff,
+    0x80, 0x3f, 0xfc, 0x0, 0xff, 0xf0, 0x7, 0xff,
+    0xc0, 0x1f, 0xfe, 0x0, 0x7f, 0xf8, 0x3, 0xff,
+    0xc0, 0xf, 0xff, 0x0, 0x7f, 0xfc, 0x1, 0xff,
+    0xe0, 0x7, 0xff, 0x80, 0x1f, 0xfe, 0x0, 0xff,
+    0xf0, 0x3, 0xff, 0xc0, 0xf, 0xff, 0x0, 0x3f,
+    0xfc, 0x1, 0xff, 0xf0, 0x7, 0xff, 0x80, 0x1f,
+    0xfe, 0x0, 0x7f, 0xf8, 0x1, 0xff, 0xe0, 0x7,
+    0xff, 0x80, 0x1f, 0xfe, 0x0, 0xff, 0xf0, 0x3,
+    0xff, 0xc0, 0xf, 0xff, 0x0, 0x3f, 0xfc, 0x0,
+    0xff, 0xf0, 0x3, 0xff, 0xc0, 0xf, 0xff, 0x0,
+    0x3f, 0xfc, 0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0,
+    0xf, 0xff, 0x0, 0x3f, 0xfc, 0x0, 0xff, 0xf0,
+    0x3, 0xff, 0xc0, 0xf, 0xff, 0x0, 0x3f, 0xfc,
+    0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0xf, 0xff,
+    0x80, 0x1f, 0xfe, 0x0, 0x7f, 0xf8, 0x1, 0xff,
+    0xe0, 0x7, 0xff, 0x80, 0x1f, 0xfe, 0x0, 0x7f,
+    0xf8, 0x1, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0xf,
+    0xff, 0x0, 0x3f, 0xfc, 0x0, 0xff, 0xf0, 0x1,
+    0xff, 0xe0, 0x7, 0xff, 0x80, 0x1f, 0xfe, 0x0,
+    0x7f, 0xfc, 0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0,
+    0x7, 0xff, 0x80, 0x1f, 0xfe, 0x0, 0x7f, 0xfc,
+    0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0x7, 0xff,
+    0x80, 0x1f, 0xfe, 0x0, 0x3f, 0xfc, 0x0, 0xff,
+    0xf0, 0x1, 0xff, 0xe0, 0x7, 0xff, 0x80,
+
+    /* U+0029 ")" */
+    0x7f, 0xf0, 0x1, 0xff, 0xe0, 0x3, 0xff, 0xc0,
+    0xf, 0xff, 0x0, 0x1f, 0xfe, 0x0, 0x7f, 0xf8,
+    0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0xf, 0xff,
+    0x80, 0x1f, 0xfe, 0x0, 0x7f, 0xfc, 0x0, 0xff,
+    0xf0, 0x3, 0xff, 0xc0, 0xf, 0xff, 0x80, 0x1f,
+    0xfe, 0x0, 0x7f, 0xf8, 0x1, 0xff, 0xe0, 0x3,
+    0xff, 0xc0, 0xf, 0xff, 0x0, 0x3f, 0xfc, 0x0,
+    0xff, 0xf0, 0x3, 0xff, 0xe0, 0x7, 0xff, 0x80,
+    0x1f, 0xfe, 0x0, 0x7f, 0xf8, 0x1, 0xff, 0xe0,
+    0x7, 0xff, 0x80, 0x1f, 0xfe, 0x0, 0x3f, 0xfc,
+    0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0xf, 0xff,
+    0x0, 0x3f, 0xfc, 0x0, 0xff, 0xf0, 0x3, 0xff,
+    0xc0, 0xf, 0xff, 0x0, 0x3f, 0xfc, 0x0, 0xff,
+    0xf0, 0x3, 0xff, 0xc0, 0xf, 0xff, 0x0, 0x3f,
+    0xfc, 0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0, 0xf,
+    0xff, 0x0, 0x3f, 0xfc, 0x0, 0xff, 0xf0, 0x7,
+    0xff, 0xc0, 0x1f, 0xfe, 0x0, 0x7f, 0xf8, 0x1,
+    0xff, 0xe0, 0x7, 0xff, 0x80, 0x1f, 0xfe, 0x0,
+    0x7f, 0xf8, 0x3, 0xff, 0xe0, 0xf, 0xff, 0x0,
+    0x3f, 0xfc, 0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0,
+    0x1f, 0xfe, 0x0, 0x7f, 0xf8, 0x1, 0xff, 0xe0,
+    0xf, 0xff, 0x80, 0x3f, 0xfc, 0x0, 0xff, 0xf0,
+    0x7, 0xff, 0x80, 0x1f, 0xfe, 0x0, 0xff, 0xf8,
+    0x3, 0xff, 0xc0, 0xf, 0xff, 0x0, 0x7f, 0xf8,
+    0x1, 0xff, 0xe0, 0xf, 0xff, 0x0, 0x3f, 0xfc,
+    0x1, 0xff, 0xe0, 0xf, 0xff, 0x0, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x7, 0xf0, 0x0, 0x0, 0x3, 0xf8, 0x0,
+    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0xfe, 0x0,
+    0x0, 0x0, 0x7f, 0x0, 0x0, 0x60, 0x3f, 0x80,
+    0x60, 0x78, 0x1f, 0xc0, 0xf0, 0x7f, 0xf, 0xe1,
+    0xfc, 0x3f, 0xe7, 0xf3, 0xff, 0x3f, 0xfb, 0xfb,
+    0xff, 0x9f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
+    0xff, 0xf1, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
+    0xff, 0xc0, 0xf, 0xff, 0xff, 0x80, 0x1, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0x80, 0x1, 0xff,
+    0xff, 0xf0, 0x1, 0xff, 0xff, 0xfe, 0x3, 0xff,
+    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xfb, 0xff,
+    0xff, 0xff, 0xfd, 0xff, 0xdf, 0xdf, 0xfc, 0x7f,
+    0xcf, 0xe7, 0xfe, 0x3f, 0x87, 0xf0, 0xfe, 0xf,
+    0x3, 0xf8, 0x1e, 0x3, 0x1, 0xfc, 0x3, 0x0,
+    0x0, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
+    0x0, 0x3f, 0x80, 0x0, 0x0, 0x1f, 0xc0, 0x0,
+    0x0, 0xf, 0xe0, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
+    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0xff,
+    0xc0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
+    0x3, 0xff, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x1f,
+    0xf8, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
+    0x0, 0x7f, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff,
+    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
+    0xf, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0,
+    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x7f,
+    0xe0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
+    0x1, 0xff, 0x80, 0x0, 0x0, 0x3, 0xff, 0x0,
+    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0xf,
+    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
+    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x0,
+
+    /* U+002C "," */
+    0x7, 0xc0, 0x3f, 0xe0, 0xff, 0xe3, 0xff, 0xe7,
+    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe3, 0xff,
+    0xc3, 0xff, 0x83, 0xfe, 0x7, 0xfc, 0xf, 0xf8,
+    0x3f, 0xe0, 0x7f, 0xc0, 0xff, 0x1, 0xfe, 0x7,
+    0xfc, 0xf, 0xf0, 0x1f, 0xe0, 0x7f, 0x80, 0xff,
+    0x1, 0xfe, 0x0,
+
+    /* U+002D "-" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+002E "." */
+    0x0, 0x0, 0xf, 0xf0, 0x3f, 0xfc, 0x7f, 0xfe,
+    0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe,
+    0x7f, 0xfe, 0x3f, 0xfc, 0xf, 0xf0, 0x1, 0x0,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xf0,
+    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0xf,
+    0xff, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
+    0x0, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0x80,
+    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x7f,
+    0xf0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0xf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
+    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
+    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xf0,
+    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x7,
+    0xff, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
+    0x0, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80,
+    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x7f,
+    0xf0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0xf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
+    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
+    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x7,
+    0xff, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
+    0x0, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80,
+    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x7f,
+    0xf0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0,
+    0xf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
+    0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
+    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0x7f, 0xf0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x7,
+    0xff, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x0, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80,
+    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x7f,
+    0xf0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0,
+    0xf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
+    0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
+    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0x7f, 0xf0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x7,
+    0xff, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0,
+    0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0xf, 0xff, 0xf8, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xe0, 0x7, 0xff, 0xf0, 0x1f, 0xff,
+    0xc0, 0x3, 0xff, 0xf8, 0x1f, 0xff, 0x80, 0x1,
+    0xff, 0xf8, 0x3f, 0xff, 0x0, 0x0, 0xff, 0xfc,
+    0x3f, 0xfe, 0x0, 0x0, 0x7f, 0xfc, 0x3f, 0xfe,
+    0x0, 0x0, 0x7f, 0xfc, 0x7f, 0xfe, 0x0, 0x0,
+    0x7f, 0xfe, 0x7f, 0xfc, 0x0, 0x0, 0x3f, 0xfe,
+    0x7f, 0xfc, 0x0, 0x0, 0x3f, 0xfe, 0x7f, 0xfc,
+    0x0, 0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0x7f, 0xfc, 0x0, 0x0, 0x3f, 0xfe, 0x7f, 0xfc,
+    0x0, 0x0, 0x3f, 0xfe, 0x7f, 0xfc, 0x0, 0x0,
+    0x3f, 0xfe, 0x7f, 0xfc, 0x0, 0x0, 0x3f, 0xfe,
+    0x7f, 0xfe, 0x0, 0x0, 0x7f, 0xfe, 0x3f, 0xfe,
+    0x0, 0x0, 0x7f, 0xfc, 0x3f, 0xff, 0x0, 0x0,
+    0xff, 0xfc, 0x3f, 0xff, 0x0, 0x0, 0xff, 0xfc,
+    0x1f, 0xff, 0x80, 0x1, 0xff, 0xf8, 0x1f, 0xff,
+    0xc0, 0x3, 0xff, 0xf8, 0xf, 0xff, 0xf0, 0xf,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0x80,
+    0x0, 0x0,
+
+    /* U+0031 "1" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
+    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
+    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
+    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
+    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
+    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
+    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
+    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
+    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
+    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
+    0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f,
+    0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x1f, 0xff, 0x0, 0x1f, 0xff,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
+    0x0, 0xff, 0xff, 0x81, 0xff, 0xe0, 0x1, 0xff,
+    0xfc, 0x3, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0xf,
+    0xc0, 0x0, 0x1f, 0xff, 0x80, 0x1c, 0x0, 0x0,
+    0x7f, 0xfc, 0x0, 0x40, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xf8,
+
+    /* U+0033 "3" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f,
+    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
+    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x20,
+    0x0, 0x0, 0x7, 0xff, 0xc1, 0x80, 0x0, 0x0,
+    0x7f, 0xfe, 0x1f, 0x0, 0x0, 0x7, 0xff, 0xe0,
+    0xfe, 0x0, 0x0, 0x7f, 0xff, 0xf, 0xfe, 0x0,
+    0xf, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0x87, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0x1, 0xff, 0xf0, 0x0, 0x3, 0xff,
+    0xf0, 0xf, 0xff, 0x80, 0x0, 0x3f, 0xff, 0x0,
+    0x7f, 0xfc, 0x0, 0x3, 0xff, 0xf0, 0x3, 0xff,
+    0xe0, 0x0, 0x1f, 0xff, 0x80, 0x1f, 0xff, 0x0,
+    0x1, 0xff, 0xf8, 0x0, 0xff, 0xf8, 0x0, 0x1f,
+    0xff, 0x80, 0x7, 0xff, 0xc0, 0x1, 0xff, 0xfc,
+    0x0, 0x3f, 0xfe, 0x0, 0xf, 0xff, 0xc0, 0x1,
+    0xff, 0xf0, 0x0, 0xff, 0xfc, 0x0, 0xf, 0xff,
+    0x80, 0xf, 0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0,
+
+    /* U+0035 "5" */
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xf, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xc1, 0x80, 0x0, 0x0,
+    0x7f, 0xfe, 0xf, 0x0, 0x0, 0x7, 0xff, 0xe0,
+    0xfe, 0x0, 0x0, 0x7f, 0xff, 0x7, 0xfe, 0x0,
+    0xf, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0x87, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x3f, 0xff, 0xf0, 0x7, 0xf0, 0x1,
+    0xff, 0xfe, 0x0, 0x3, 0xc0, 0xf, 0xff, 0xf0,
+    0x0, 0x2, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x80, 0x3f, 0xf0, 0x0, 0x3f, 0xfe, 0xf, 0xff,
+    0xf8, 0x0, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0x3,
+    0xff, 0xe7, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xbf,
+    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfb, 0xff, 0xff,
+    0x0, 0x1f, 0xff, 0xef, 0xff, 0xf8, 0x0, 0x1f,
+    0xff, 0xbf, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x1, 0xff, 0xf7, 0xff, 0xe0, 0x0, 0x7, 0xff,
+    0xdf, 0xff, 0x0, 0x0, 0x1f, 0xff, 0x7f, 0xfc,
+    0x0, 0x0, 0x7f, 0xfd, 0xff, 0xf0, 0x0, 0x1,
+    0xff, 0xf3, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xcf,
+    0xff, 0x80, 0x0, 0x3f, 0xff, 0x3f, 0xfe, 0x0,
+    0x0, 0xff, 0xf8, 0x7f, 0xfc, 0x0, 0x7, 0xff,
+    0xe1, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0x83, 0xff,
+    0xf8, 0x1, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x3f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x1, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0x0, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbf, 0xfc, 0x0, 0x0, 0xff, 0xfd, 0xff, 0xe0,
+    0x0, 0x7, 0xff, 0xcf, 0xff, 0x0, 0x0, 0x7f,
+    0xfe, 0x7f, 0xf8, 0x0, 0x3, 0xff, 0xf3, 0xff,
+    0xc0, 0x0, 0x1f, 0xff, 0x1f, 0xfe, 0x0, 0x1,
+    0xff, 0xf8, 0xff, 0xf0, 0x0, 0xf, 0xff, 0x87,
+    0xff, 0x80, 0x0, 0xff, 0xfc, 0x3f, 0xfc, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xc0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xc0, 0x7f, 0xff,
+    0xc0, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0x83, 0xff,
+    0xf8, 0x0, 0x3f, 0xff, 0x87, 0xff, 0xe0, 0x0,
+    0x3f, 0xff, 0xf, 0xff, 0x80, 0x0, 0x3f, 0xfe,
+    0x1f, 0xff, 0x0, 0x0, 0x7f, 0xfc, 0x3f, 0xfe,
+    0x0, 0x0, 0xff, 0xf8, 0x7f, 0xfc, 0x0, 0x1,
+    0xff, 0xf0, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xe1,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xc1, 0xff, 0xf0,
+    0x0, 0x1f, 0xff, 0x3, 0xff, 0xf0, 0x0, 0x7f,
+    0xfe, 0x3, 0xff, 0xf0, 0x1, 0xff, 0xf8, 0x7,
+    0xff, 0xf8, 0xf, 0xff, 0xf0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xf8, 0x3f,
+    0xff, 0xf0, 0x7f, 0xff, 0x0, 0x7, 0xff, 0xf0,
+    0xff, 0xfc, 0x0, 0x7, 0xff, 0xe3, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xe7, 0xff, 0xc0, 0x0, 0x7,
+    0xff, 0xdf, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xff,
+    0xef, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0x9f, 0xff,
+    0xc0, 0x0, 0x7f, 0xff, 0x3f, 0xff, 0xe0, 0x3,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x0, 0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x3, 0xff, 0xfe, 0x3, 0xff, 0xfc, 0x1f,
+    0xff, 0xe0, 0x3, 0xff, 0xf0, 0x7f, 0xfe, 0x0,
+    0x7, 0xff, 0xe1, 0xff, 0xf0, 0x0, 0xf, 0xff,
+    0x8f, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0x3f, 0xfe,
+    0x0, 0x0, 0x7f, 0xfc, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xf3, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xef,
+    0xff, 0x80, 0x0, 0xf, 0xff, 0xbf, 0xfe, 0x0,
+    0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0, 0x1, 0xff,
+    0xfb, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0x7f, 0xfe, 0x0, 0x7, 0xff, 0xfd,
+    0xff, 0xfe, 0x0, 0x3f, 0xff, 0xf7, 0xff, 0xfe,
+    0x3, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3, 0xff, 0xff, 0xff, 0x7f, 0xfc, 0x7, 0xff,
+    0xff, 0xf9, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xc7,
+    0xff, 0xc0, 0x7, 0xff, 0xfc, 0x1f, 0xfe, 0x0,
+    0x3, 0xff, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x0, 0x18, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf8,
+    0x0, 0x7f, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x0, 0x0, 0xf, 0xf0, 0x3f, 0xfc, 0x7f, 0xfe,
+    0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe,
+    0x7f, 0xfe, 0x3f, 0xfc, 0xf, 0xf0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x3f, 0xfc,
+    0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x7f, 0xfe, 0x7f, 0xfe, 0x3f, 0xfc, 0xf, 0xf0,
+    0x1, 0x0,
+
+    /* U+003B ";" */
+    0x0, 0x0, 0xf, 0xf0, 0x3f, 0xfc, 0x7f, 0xfe,
+    0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe,
+    0x7f, 0xfe, 0x3f, 0xfc, 0xf, 0xf0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xe0, 0x1f, 0xf8, 0x3f, 0xfc,
+    0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x7f, 0xfe, 0x3f, 0xfe, 0x1f, 0xfe, 0xf, 0xfc,
+    0xf, 0xfc, 0xf, 0xf8, 0xf, 0xf8, 0x1f, 0xf8,
+    0x1f, 0xf0, 0x1f, 0xf0, 0x3f, 0xe0, 0x3f, 0xe0,
+    0x3f, 0xe0, 0x3f, 0xc0, 0x7f, 0xc0, 0x7f, 0x80,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
+    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f,
+    0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xf0,
+    0x1, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff,
+    0xf0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff,
+    0xff, 0xe0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x3f,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xf8, 0x0,
+    0x3, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xe0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0,
+    0xf, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
+    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff,
+    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0xf,
+    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x3, 0xfc,
+    0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
+    0x1, 0xc0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003D "=" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+003E ">" */
+    0x80, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
+    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
+    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3,
+    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
+    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff,
+    0xfc, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
+    0x1f, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0xf, 0xff,
+    0xf0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x1f,
+    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
+    0x7f, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xfc,
+    0x0, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
+    0xf8, 0x3, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
+    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
+    0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xfc, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xf8,
+    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x3,
+    0xf0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xfc,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
+    0x1, 0xff, 0xff, 0x1f, 0xff, 0x0, 0xf, 0xff,
+    0xf0, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x7, 0xe0,
+    0x0, 0xf, 0xff, 0xc0, 0x78, 0x0, 0x0, 0xff,
+    0xf8, 0x2, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
+    0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
+    0xf0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xc0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
+    0xf8, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xe0, 0x0, 0x7, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x7f, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x7,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
+    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xc0, 0x3, 0xff, 0x0, 0x1, 0xff, 0x0,
+    0x0, 0x3, 0xff, 0x0, 0x3f, 0xf0, 0x0, 0x7f,
+    0xff, 0x7, 0xff, 0xf, 0xf8, 0x3, 0xff, 0x80,
+    0xf, 0xff, 0xfe, 0x3f, 0xf8, 0x3f, 0xe0, 0x1f,
+    0xf8, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xc0, 0xff,
+    0x81, 0xff, 0x80, 0xf, 0xff, 0xff, 0xef, 0xfe,
+    0x7, 0xfc, 0xf, 0xfc, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x1f, 0xe0, 0x7f, 0xc0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0x87, 0xfe, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xfc, 0x3f,
+    0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f,
+    0xf1, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x7f, 0x9f, 0xf8, 0x7, 0xff, 0xf8, 0x1f,
+    0xff, 0xf8, 0x3, 0xfc, 0xff, 0x80, 0x3f, 0xfe,
+    0x0, 0x3f, 0xff, 0xc0, 0x1f, 0xe7, 0xfc, 0x3,
+    0xff, 0xe0, 0x0, 0x7f, 0xfe, 0x0, 0xff, 0x3f,
+    0xe0, 0x1f, 0xfe, 0x0, 0x1, 0xff, 0xf0, 0x3,
+    0xff, 0xff, 0x0, 0xff, 0xf0, 0x0, 0xf, 0xff,
+    0x80, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x0, 0x0,
+    0x3f, 0xfc, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf8,
+    0x0, 0x1, 0xff, 0xe0, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0x80, 0x0, 0x7, 0xff, 0x0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfc, 0x0, 0x0, 0x3f, 0xf8, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xe0, 0x0, 0x1, 0xff,
+    0xc0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x0, 0x0,
+    0xf, 0xfe, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xf8,
+    0x0, 0x0, 0x7f, 0xf0, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xc0, 0x0, 0x3, 0xff, 0x80, 0x1f, 0xff,
+    0xf0, 0xf, 0xfe, 0x0, 0x0, 0x1f, 0xfc, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xf0, 0x0, 0x1, 0xff,
+    0xe0, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xc0, 0x0,
+    0xf, 0xff, 0x0, 0x7f, 0xbf, 0xe0, 0xf, 0xfe,
+    0x0, 0x0, 0x7f, 0xf8, 0x3, 0xfc, 0xff, 0x80,
+    0x7f, 0xf8, 0x0, 0x7, 0xff, 0xc0, 0x1f, 0xe7,
+    0xfc, 0x3, 0xff, 0xe0, 0x0, 0x7f, 0xfe, 0x0,
+    0xff, 0x3f, 0xe0, 0xf, 0xff, 0x80, 0x7, 0xff,
+    0xf0, 0xf, 0xf1, 0xff, 0x0, 0x7f, 0xfe, 0x0,
+    0x7f, 0xff, 0xc0, 0x7f, 0x8f, 0xfc, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x7, 0xfc, 0x3f, 0xe0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0xff, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xf, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x3f, 0xe0, 0x7, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xfe, 0x1, 0xff, 0x80, 0x1f,
+    0xff, 0xff, 0xf3, 0xff, 0xff, 0xf0, 0x7, 0xfc,
+    0x0, 0x7f, 0xff, 0xff, 0xf, 0xff, 0xff, 0x0,
+    0x3f, 0xf0, 0x1, 0xff, 0xff, 0xf0, 0x3f, 0xff,
+    0xe0, 0x0, 0xff, 0xc0, 0x3, 0xff, 0xfe, 0x0,
+    0xff, 0xfe, 0x0, 0x7, 0xff, 0x0, 0x7, 0xff,
+    0xc0, 0x1, 0xff, 0xc0, 0x0, 0x1f, 0xf8, 0x0,
+    0x0, 0x80, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x7f,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x3e, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0xf,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xe0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xc1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x81, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
+    0xfe, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
+    0xfc, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
+    0xf0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff,
+    0xe0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xc0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x7, 0xff, 0x80,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xe0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x87, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x9f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfe, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfe,
+
+    /* U+0042 "B" */
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
+    0xff, 0xe0, 0x0, 0x7, 0xff, 0xfc, 0x7f, 0xfc,
+    0x0, 0x0, 0x3f, 0xff, 0xcf, 0xff, 0x80, 0x0,
+    0x1, 0xff, 0xf9, 0xff, 0xf0, 0x0, 0x0, 0x3f,
+    0xff, 0x3f, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xe7,
+    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xfc, 0xff, 0xf8,
+    0x0, 0x0, 0xf, 0xff, 0x9f, 0xff, 0x0, 0x0,
+    0x1, 0xff, 0xf3, 0xff, 0xe0, 0x0, 0x0, 0x7f,
+    0xfe, 0x7f, 0xfc, 0x0, 0x0, 0xf, 0xff, 0x8f,
+    0xff, 0x80, 0x0, 0x7, 0xff, 0xf1, 0xff, 0xf0,
+    0x0, 0x3, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x0, 0x0,
+    0xff, 0xff, 0x9f, 0xff, 0x0, 0x0, 0x3, 0xff,
+    0xf3, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0x7f,
+    0xfc, 0x0, 0x0, 0x3, 0xff, 0xef, 0xff, 0x80,
+    0x0, 0x0, 0x3f, 0xfd, 0xff, 0xf0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0xff, 0xff, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x7, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xe0,
+    0x7f, 0xff, 0xe0, 0x0, 0x3f, 0xfe, 0x7, 0xff,
+    0xfc, 0x0, 0x0, 0x7f, 0xc0, 0x3f, 0xff, 0xc0,
+    0x0, 0x0, 0xfc, 0x3, 0xff, 0xfc, 0x0, 0x0,
+    0x3, 0xc0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0xc,
+    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x60, 0x7, 0xff,
+    0xf0, 0x0, 0x0, 0x7, 0x80, 0x3f, 0xff, 0xc0,
+    0x0, 0x0, 0x7e, 0x0, 0xff, 0xff, 0x80, 0x0,
+    0x7, 0xf8, 0x3, 0xff, 0xfe, 0x0, 0x0, 0xff,
+    0xe0, 0x1f, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xf8,
+    0x0, 0x3, 0xff, 0xff, 0xc0, 0xff, 0xf8, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0xff, 0xf8, 0x0, 0x0,
+    0x1f, 0xff, 0xf0, 0xff, 0xf8, 0x0, 0x0, 0xf,
+    0xff, 0xf0, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff,
+    0xf8, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xff, 0xfc, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xff, 0xfc, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff, 0xfc,
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xff, 0xf8, 0xff,
+    0xf8, 0x0, 0x0, 0x3, 0xff, 0xf8, 0xff, 0xf8,
+    0x0, 0x0, 0xf, 0xff, 0xf0, 0xff, 0xf8, 0x0,
+    0x0, 0x1f, 0xff, 0xf0, 0xff, 0xf8, 0x0, 0x0,
+    0x7f, 0xff, 0xe0, 0xff, 0xf8, 0x0, 0x3, 0xff,
+    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff,
+
+    /* U+0046 "F" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xfc, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
+    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xf8, 0x3, 0xff,
+    0xfc, 0x7, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xe0,
+    0x3f, 0xff, 0xe0, 0x0, 0x1, 0xff, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x3, 0xf8, 0x7, 0xff, 0xf8,
+    0x0, 0x0, 0x3, 0xc0, 0x1f, 0xff, 0xc0, 0x0,
+    0x0, 0x6, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x7f, 0xfb, 0xff, 0xe0, 0x0, 0x0,
+    0x1, 0xff, 0xef, 0xff, 0x80, 0x0, 0x0, 0x7,
+    0xff, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xfe,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0xff,
+    0xe0, 0x0, 0x0, 0x1, 0xff, 0xef, 0xff, 0xc0,
+    0x0, 0x0, 0x7, 0xff, 0x9f, 0xff, 0x0, 0x0,
+    0x0, 0x1f, 0xfe, 0x7f, 0xfc, 0x0, 0x0, 0x0,
+    0x7f, 0xf9, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff,
+    0xe7, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0x8f,
+    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xfe, 0x3f, 0xff,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0xff, 0xfe, 0x0,
+    0x0, 0x1, 0xff, 0xe1, 0xff, 0xfc, 0x0, 0x0,
+    0x7, 0xff, 0x87, 0xff, 0xf8, 0x0, 0x0, 0x1f,
+    0xfe, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xf8,
+    0x1f, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xe0, 0x7f,
+    0xff, 0xf8, 0x0, 0x3f, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+0048 "H" */
+    0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x3, 0xff, 0xe0,
+
+    /* U+0049 "I" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff,
+
+    /* U+004A "J" */
+    0x7, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
+    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xc1, 0xff,
+    0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xfc,
+    0x1f, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
+    0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff,
+    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x7f, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x7f, 0xfc, 0x8, 0x0, 0x1, 0xff, 0xf0,
+    0x30, 0x0, 0xf, 0xff, 0xc1, 0xe0, 0x0, 0x3f,
+    0xfe, 0xf, 0xc0, 0x1, 0xff, 0xf8, 0x7f, 0x80,
+    0x7, 0xff, 0xe3, 0xff, 0x80, 0x7f, 0xff, 0xf,
+    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
+    0xf3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
+    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x3f,
+    0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xfc,
+    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
+    0xfc, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0,
+    0x3, 0x80, 0x0, 0x0,
+
+    /* U+004B "K" */
+    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf3, 0xff,
+    0xe0, 0x0, 0x0, 0x3f, 0xff, 0x8f, 0xff, 0x80,
+    0x0, 0x1, 0xff, 0xfc, 0x3f, 0xfe, 0x0, 0x0,
+    0xf, 0xff, 0xe0, 0xff, 0xf8, 0x0, 0x0, 0x3f,
+    0xff, 0x3, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xf8,
+    0xf, 0xff, 0x80, 0x0, 0xf, 0xff, 0xc0, 0x3f,
+    0xfe, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0xff, 0xf8,
+    0x0, 0x3, 0xff, 0xf0, 0x3, 0xff, 0xe0, 0x0,
+    0x1f, 0xff, 0x80, 0xf, 0xff, 0x80, 0x0, 0xff,
+    0xfc, 0x0, 0x3f, 0xfe, 0x0, 0x7, 0xff, 0xe0,
+    0x0, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0x0, 0x3,
+    0xff, 0xe0, 0x1, 0xff, 0xfc, 0x0, 0xf, 0xff,
+    0x80, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xfe, 0x0,
+    0x7f, 0xff, 0x0, 0x0, 0xff, 0xf8, 0x3, 0xff,
+    0xf8, 0x0, 0x3, 0xff, 0xe0, 0x1f, 0xff, 0xc0,
+    0x0, 0xf, 0xff, 0x80, 0xff, 0xfe, 0x0, 0x0,
+    0x3f, 0xfe, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xff,
+    0xf8, 0x1f, 0xff, 0x80, 0x0, 0x3, 0xff, 0xe0,
+    0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0x87, 0xff,
+    0xe0, 0x0, 0x0, 0x3f, 0xfe, 0x3f, 0xff, 0x0,
+    0x0, 0x0, 0xff, 0xf9, 0xff, 0xf8, 0x0, 0x0,
+    0x3, 0xff, 0xef, 0xff, 0xe0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff,
+    0x7f, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xf8, 0xff,
+    0xfe, 0x0, 0x0, 0xff, 0xff, 0xc1, 0xff, 0xfc,
+    0x0, 0x3, 0xff, 0xfe, 0x7, 0xff, 0xf8, 0x0,
+    0xf, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0x0, 0x3f,
+    0xff, 0x80, 0x1f, 0xff, 0xe0, 0x0, 0xff, 0xfc,
+    0x0, 0x3f, 0xff, 0x80, 0x3, 0xff, 0xe0, 0x0,
+    0x7f, 0xff, 0x0, 0xf, 0xff, 0x80, 0x1, 0xff,
+    0xfe, 0x0, 0x3f, 0xfe, 0x0, 0x3, 0xff, 0xfc,
+    0x0, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xf0, 0x3,
+    0xff, 0xe0, 0x0, 0xf, 0xff, 0xe0, 0xf, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xc0, 0x3f, 0xfe, 0x0,
+    0x0, 0x7f, 0xff, 0x80, 0xff, 0xf8, 0x0, 0x0,
+    0xff, 0xff, 0x3, 0xff, 0xe0, 0x0, 0x1, 0xff,
+    0xfc, 0xf, 0xff, 0x80, 0x0, 0x3, 0xff, 0xf8,
+    0x3f, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xf0, 0xff,
+    0xf8, 0x0, 0x0, 0xf, 0xff, 0xe3, 0xff, 0xe0,
+    0x0, 0x0, 0x3f, 0xff, 0xcf, 0xff, 0x80, 0x0,
+    0x0, 0x7f, 0xff, 0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0xff, 0xfe,
+
+    /* U+004C "L" */
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x3f,
+    0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80,
+
+    /* U+004D "M" */
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x3, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+    0x80, 0x7, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff,
+    0x0, 0x1f, 0xfe, 0x7f, 0xff, 0xff, 0x9f, 0xff,
+    0x0, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0x1f, 0xfe,
+    0x0, 0xff, 0xf1, 0xff, 0xff, 0xfe, 0x3f, 0xfe,
+    0x3, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x3f, 0xfc,
+    0x7, 0xff, 0x87, 0xff, 0xff, 0xf8, 0x7f, 0xfc,
+    0x1f, 0xfe, 0xf, 0xff, 0xff, 0xf0, 0x7f, 0xfc,
+    0x3f, 0xfc, 0x1f, 0xff, 0xff, 0xe0, 0x7f, 0xf8,
+    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xc0, 0xff, 0xfb,
+    0xff, 0xc0, 0x7f, 0xff, 0xff, 0x80, 0xff, 0xf7,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0xfc, 0x3, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff,
+    0xf0, 0x7, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xff,
+    0xc0, 0xf, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff,
+    0x80, 0x1f, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xfe,
+    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xfc,
+    0x0, 0x7f, 0xff, 0xff, 0x80, 0x7, 0xff, 0xf0,
+    0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xc0,
+    0x1, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0x80,
+    0x3, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xfe, 0x0,
+    0x7, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xfc, 0x0,
+    0xf, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xf0, 0x0,
+    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xc0, 0x0,
+    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0x80, 0x0,
+    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xfe,
+
+    /* U+004E "N" */
+    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe0, 0x1f,
+    0xff, 0xff, 0xf9, 0xff, 0xfe, 0x3, 0xff, 0xff,
+    0xff, 0x3f, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xe3,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0xfc, 0x3f, 0xff,
+    0xc1, 0xff, 0xff, 0xff, 0x83, 0xff, 0xfc, 0x3f,
+    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xc7, 0xff, 0xff,
+    0xfe, 0x7, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xc0,
+    0x7f, 0xff, 0x9f, 0xff, 0xff, 0xf8, 0x7, 0xff,
+    0xfb, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x7, 0xff,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0x80,
+    0x3f, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xe0, 0x0,
+    0x3f, 0xff, 0xf0, 0x7, 0xff, 0xfc, 0x0, 0x0,
+    0x7f, 0xff, 0x80, 0x3f, 0xff, 0xc0, 0x0, 0x1,
+    0xff, 0xfe, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x7,
+    0xff, 0xf8, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x1f,
+    0xff, 0xc1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
+    0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf9,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xdf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe7, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xff,
+    0xfc, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xe0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x7, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xf0,
+    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0x0,
+    0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x3,
+    0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x1f,
+    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x80, 0x0,
+    0x0, 0x0,
+
+    /* U+0050 "P" */
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfe, 0x0,
+    0x3, 0xff, 0xff, 0x9f, 0xff, 0x0, 0x0, 0x3f,
+    0xff, 0xcf, 0xff, 0x80, 0x0, 0x7, 0xff, 0xf7,
+    0xff, 0xc0, 0x0, 0x1, 0xff, 0xfb, 0xff, 0xe0,
+    0x0, 0x0, 0x7f, 0xfd, 0xff, 0xf0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xbf,
+    0xfe, 0x0, 0x0, 0xf, 0xff, 0xdf, 0xff, 0x0,
+    0x0, 0xf, 0xff, 0xef, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xe7, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x3, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfe, 0x0,
+    0x7, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0x0,
+    0xf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0x80,
+    0xf, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0x80,
+    0x1f, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xc0,
+    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
+    0x3f, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xe0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
+    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
+    0x1f, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xc0,
+    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
+    0xf, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0x80,
+    0xf, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0x80,
+    0x7, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0x0,
+    0x7, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x60,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0xf0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x1, 0xf0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0xf, 0xf8,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
+
+    /* U+0052 "R" */
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0x80, 0x0, 0xff, 0xff, 0xe3, 0xff, 0xe0, 0x0,
+    0x7, 0xff, 0xf8, 0xff, 0xf8, 0x0, 0x0, 0x7f,
+    0xff, 0x3f, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xcf,
+    0xff, 0x80, 0x0, 0x1, 0xff, 0xf3, 0xff, 0xe0,
+    0x0, 0x0, 0x7f, 0xfe, 0xff, 0xf8, 0x0, 0x0,
+    0x1f, 0xff, 0xbf, 0xfe, 0x0, 0x0, 0x3, 0xff,
+    0xef, 0xff, 0x80, 0x0, 0x0, 0xff, 0xfb, 0xff,
+    0xe0, 0x0, 0x0, 0x3f, 0xfe, 0xff, 0xf8, 0x0,
+    0x0, 0xf, 0xff, 0xbf, 0xfe, 0x0, 0x0, 0x3,
+    0xff, 0xef, 0xff, 0x80, 0x0, 0x0, 0xff, 0xfb,
+    0xff, 0xe0, 0x0, 0x0, 0x7f, 0xfe, 0xff, 0xf8,
+    0x0, 0x0, 0x1f, 0xff, 0xbf, 0xfe, 0x0, 0x0,
+    0x7, 0xff, 0xcf, 0xff, 0x80, 0x0, 0x3, 0xff,
+    0xf3, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xfc, 0xff,
+    0xf8, 0x0, 0x1, 0xff, 0xfe, 0x3f, 0xfe, 0x0,
+    0x1, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0xff, 0xf8, 0x0, 0x7f, 0xfe, 0x0,
+    0x3f, 0xfe, 0x0, 0xf, 0xff, 0xc0, 0xf, 0xff,
+    0x80, 0x1, 0xff, 0xf8, 0x3, 0xff, 0xe0, 0x0,
+    0x7f, 0xff, 0x0, 0xff, 0xf8, 0x0, 0xf, 0xff,
+    0xc0, 0x3f, 0xfe, 0x0, 0x1, 0xff, 0xf8, 0xf,
+    0xff, 0x80, 0x0, 0x3f, 0xff, 0x3, 0xff, 0xe0,
+    0x0, 0xf, 0xff, 0xc0, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xf8, 0x3f, 0xfe, 0x0, 0x0, 0x3f, 0xff,
+    0xf, 0xff, 0x80, 0x0, 0xf, 0xff, 0xc3, 0xff,
+    0xe0, 0x0, 0x1, 0xff, 0xf8, 0xff, 0xf8, 0x0,
+    0x0, 0x3f, 0xff, 0x3f, 0xfe, 0x0, 0x0, 0xf,
+    0xff, 0xcf, 0xff, 0x80, 0x0, 0x1, 0xff, 0xfb,
+    0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0x1, 0xff, 0xff, 0x0, 0x7f, 0xf8, 0xf,
+    0xff, 0xe0, 0x0, 0x1f, 0xe0, 0x3f, 0xff, 0x0,
+    0x0, 0xf, 0x0, 0xff, 0xf8, 0x0, 0x0, 0xc,
+    0x7, 0xff, 0xc0, 0x0, 0x0, 0x10, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc3,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x1f, 0x0, 0x0,
+    0x0, 0x7f, 0xfc, 0x7e, 0x0, 0x0, 0x3, 0xff,
+    0xe3, 0xff, 0x0, 0x0, 0x1f, 0xff, 0x8f, 0xff,
+    0x80, 0x1, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x60, 0x0, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0xf, 0xff, 0xdf, 0xff, 0x0, 0x0, 0x1, 0xff,
+    0xf3, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xfe, 0x7f,
+    0xfe, 0x0, 0x0, 0xf, 0xff, 0xcf, 0xff, 0xc0,
+    0x0, 0x1, 0xff, 0xf8, 0xff, 0xfc, 0x0, 0x0,
+    0x7f, 0xfe, 0x1f, 0xff, 0xc0, 0x0, 0x1f, 0xff,
+    0xc3, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf8, 0x3f,
+    0xff, 0xe0, 0x3, 0xff, 0xfe, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0,
+    0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xdf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x7f,
+    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe3, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x1f, 0xff,
+    0x80, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x83, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x7, 0xff, 0xc0, 0x7f, 0xfe, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0x1, 0xff, 0xf8, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x7f, 0xfe, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x1, 0xff, 0xf8, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x3f,
+    0xfe, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x1, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xe0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x7f, 0xf8, 0x0,
+    0x0, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x7, 0xff, 0xe0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x1f, 0xff, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
+    0xff, 0xfc, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x7,
+    0xff, 0xe0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x1f,
+    0xff, 0x80, 0xf, 0xff, 0x80, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x3, 0xff,
+    0xf0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff,
+    0x80, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x81,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x87, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf3, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xdf, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x3,
+    0xff, 0xef, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x1, 0xff, 0xe7, 0xff, 0xc0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf3,
+    0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0,
+    0x0, 0xff, 0xf8, 0xff, 0xf8, 0x0, 0x0, 0x1f,
+    0xff, 0xe0, 0x0, 0x0, 0x7f, 0xf8, 0x7f, 0xfc,
+    0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x3f,
+    0xfc, 0x3f, 0xff, 0x0, 0x0, 0xf, 0xff, 0xfc,
+    0x0, 0x0, 0x3f, 0xfe, 0xf, 0xff, 0x80, 0x0,
+    0x7, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xfe, 0x7,
+    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0,
+    0xf, 0xff, 0x3, 0xff, 0xf0, 0x0, 0x3, 0xff,
+    0xff, 0xc0, 0x0, 0xf, 0xff, 0x80, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xff, 0xe0, 0x0, 0x7, 0xff,
+    0x80, 0x7f, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0x0, 0x3, 0xff, 0xc0, 0x3f, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xe0, 0xf,
+    0xff, 0x80, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x1,
+    0xff, 0xe0, 0x7, 0xff, 0xc0, 0x0, 0x3f, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xf0, 0x3, 0xff, 0xf0,
+    0x0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xf8,
+    0x0, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xe0,
+    0x0, 0x7f, 0xf8, 0x0, 0x7f, 0xfc, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xfc, 0x0, 0x3f,
+    0xff, 0x0, 0xf, 0xff, 0x7f, 0xf8, 0x0, 0x3f,
+    0xfe, 0x0, 0xf, 0xff, 0x80, 0x7, 0xff, 0xbf,
+    0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x7, 0xff, 0xc0,
+    0x3, 0xff, 0xcf, 0xff, 0x0, 0xf, 0xff, 0x0,
+    0x3, 0xff, 0xf0, 0x3, 0xff, 0xc7, 0xff, 0x80,
+    0xf, 0xff, 0x80, 0x0, 0xff, 0xf8, 0x1, 0xff,
+    0xe3, 0xff, 0xe0, 0x7, 0xff, 0xc0, 0x0, 0x7f,
+    0xfc, 0x0, 0xff, 0xf0, 0xff, 0xf0, 0x3, 0xff,
+    0xc0, 0x0, 0x3f, 0xfe, 0x0, 0xff, 0xf0, 0x7f,
+    0xf8, 0x3, 0xff, 0xe0, 0x0, 0xf, 0xff, 0x80,
+    0x7f, 0xf8, 0x3f, 0xfe, 0x1, 0xff, 0xf0, 0x0,
+    0x7, 0xff, 0xc0, 0x3f, 0xfc, 0xf, 0xff, 0x0,
+    0xff, 0xf0, 0x0, 0x3, 0xff, 0xe0, 0x3f, 0xfc,
+    0x7, 0xff, 0x80, 0xff, 0xf8, 0x0, 0x1, 0xff,
+    0xf8, 0x1f, 0xfe, 0x3, 0xff, 0xe0, 0x7f, 0xfc,
+    0x0, 0x0, 0x7f, 0xfc, 0xf, 0xff, 0x0, 0xff,
+    0xf0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfe, 0xf,
+    0xff, 0x0, 0x7f, 0xf8, 0x3f, 0xfe, 0x0, 0x0,
+    0x1f, 0xff, 0x87, 0xff, 0x80, 0x3f, 0xfe, 0x1f,
+    0xff, 0x0, 0x0, 0x7, 0xff, 0xc3, 0xff, 0xc0,
+    0xf, 0xff, 0xf, 0xff, 0x0, 0x0, 0x3, 0xff,
+    0xe3, 0xff, 0xc0, 0x7, 0xff, 0x8f, 0xff, 0x80,
+    0x0, 0x1, 0xff, 0xf9, 0xff, 0xe0, 0x3, 0xff,
+    0xe7, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xfc, 0xff,
+    0xf0, 0x0, 0xff, 0xf3, 0xff, 0xc0, 0x0, 0x0,
+    0x3f, 0xfe, 0xff, 0xf0, 0x0, 0x7f, 0xf9, 0xff,
+    0xe0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x3f, 0xfd, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe,
+    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
+    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
+    0x0, 0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0,
+    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x3,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x7f, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x1f,
+    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xfe, 0x7, 0xff,
+    0xe0, 0x0, 0x0, 0x3f, 0xff, 0x3, 0xff, 0xf8,
+    0x0, 0x0, 0x3f, 0xff, 0x0, 0xff, 0xfe, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x3f, 0xff, 0x80, 0x0,
+    0x3f, 0xff, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x1f,
+    0xff, 0x80, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
+    0x80, 0x1, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0x80,
+    0x0, 0x7f, 0xfe, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x3f, 0xff, 0x80, 0xf, 0xff, 0xc0, 0x0, 0xf,
+    0xff, 0xe0, 0xf, 0xff, 0xc0, 0x0, 0x3, 0xff,
+    0xf8, 0x7, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xfc,
+    0x7, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0x7,
+    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc7, 0xff,
+    0xe0, 0x0, 0x0, 0x7, 0xff, 0xe3, 0xff, 0xe0,
+    0x0, 0x0, 0x3, 0xff, 0xfb, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xbf, 0xff, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x1f,
+    0xff, 0x87, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
+    0xc1, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xc0,
+    0x7f, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x3f,
+    0xff, 0x80, 0x0, 0xf, 0xff, 0xc0, 0xf, 0xff,
+    0xe0, 0x0, 0xf, 0xff, 0xe0, 0x3, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xe0, 0x1, 0xff, 0xfc, 0x0,
+    0x7, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0x0, 0x7,
+    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x7, 0xff,
+    0xf0, 0x0, 0x7, 0xff, 0xe0, 0x3, 0xff, 0xf0,
+    0x0, 0x3, 0xff, 0xf8, 0x3, 0xff, 0xf8, 0x0,
+    0x0, 0xff, 0xfe, 0x3, 0xff, 0xf8, 0x0, 0x0,
+    0x3f, 0xff, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x1f,
+    0xff, 0xc1, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff,
+    0xf1, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xfd,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xfe,
+
+    /* U+0059 "Y" */
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xbf,
+    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0x8f, 0xff,
+    0x80, 0x0, 0x0, 0x7, 0xff, 0xc7, 0xff, 0xe0,
+    0x0, 0x0, 0x7, 0xff, 0xc1, 0xff, 0xf0, 0x0,
+    0x0, 0x3, 0xff, 0xc0, 0xff, 0xfc, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x3f, 0xff, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x1f, 0xff, 0x80, 0x0, 0x1, 0xff,
+    0xf0, 0x7, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xf0,
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xf0, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x3f,
+    0xff, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x1f, 0xff,
+    0x80, 0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff, 0xe0,
+    0x0, 0x7f, 0xfc, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x3f,
+    0xfe, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x1f, 0xfe,
+    0x0, 0x0, 0x1f, 0xff, 0x80, 0x1f, 0xff, 0x0,
+    0x0, 0x7, 0xff, 0xe0, 0x1f, 0xff, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0xf, 0xff, 0x0, 0x0, 0x0,
+    0xff, 0xfc, 0xf, 0xff, 0x80, 0x0, 0x0, 0x3f,
+    0xff, 0x7, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xff,
+    0x87, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xe7,
+    0xff, 0xc0, 0x0, 0x0, 0x1, 0xff, 0xf3, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+
+    /* U+005B "[" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xfe,
+    0x0, 0xff, 0xf8, 0x3, 0xff, 0xe0, 0xf, 0xff,
+    0x80, 0x3f, 0xfe, 0x0, 0xff, 0xf8, 0x3, 0xff,
+    0xe0, 0xf, 0xff, 0x80, 0x3f, 0xfe, 0x0, 0xff,
+    0xf8, 0x3, 0xff, 0xe0, 0xf, 0xff, 0x80, 0x3f,
+    0xfe, 0x0, 0xff, 0xf8, 0x3, 0xff, 0xe0, 0xf,
+    0xff, 0x80, 0x3f, 0xfe, 0x0, 0xff, 0xf8, 0x3,
+    0xff, 0xe0, 0xf, 0xff, 0x80, 0x3f, 0xfe, 0x0,
+    0xff, 0xf8, 0x3, 0xff, 0xe0, 0xf, 0xff, 0x80,
+    0x3f, 0xfe, 0x0, 0xff, 0xf8, 0x3, 0xff, 0xe0,
+    0xf, 0xff, 0x80, 0x3f, 0xfe, 0x0, 0xff, 0xf8,
+    0x3, 0xff, 0xe0, 0xf, 0xff, 0x80, 0x3f, 0xfe,
+    0x0, 0xff, 0xf8, 0x3, 0xff, 0xe0, 0xf, 0xff,
+    0x80, 0x3f, 0xfe, 0x0, 0xff, 0xf8, 0x3, 0xff,
+    0xe0, 0xf, 0xff, 0x80, 0x3f, 0xfe, 0x0, 0xff,
+    0xf8, 0x3, 0xff, 0xe0, 0xf, 0xff, 0x80, 0x3f,
+    0xfe, 0x0, 0xff, 0xf8, 0x3, 0xff, 0xe0, 0xf,
+    0xff, 0x80, 0x3f, 0xfe, 0x0, 0xff, 0xf8, 0x3,
+    0xff, 0xe0, 0xf, 0xff, 0x80, 0x3f, 0xfe, 0x0,
+    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+
+    /* U+005C "\\" */
+    0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
+    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0,
+    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x3f,
+    0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
+    0x7, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
+    0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
+    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0,
+    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x1f,
+    0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
+    0x7, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
+    0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
+    0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0,
+    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x1f,
+    0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
+    0x7, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0,
+    0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff,
+    0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0,
+    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x1f,
+    0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
+    0x3, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0,
+    0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff,
+    0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xf0,
+    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x1f,
+    0xfc, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
+    0x3, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0,
+    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x3, 0xff,
+    0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0x7f, 0xf0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xf0,
+    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x1f,
+    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
+    0x3, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xfc, 0x0,
+    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x3, 0xff,
+    0x80, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
+    0x7f, 0xf0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xf0,
+
+    /* U+005D "]" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xc0, 0x1f,
+    0xff, 0x0, 0x7f, 0xfc, 0x1, 0xff, 0xf0, 0x7,
+    0xff, 0xc0, 0x1f, 0xff, 0x0, 0x7f, 0xfc, 0x1,
+    0xff, 0xf0, 0x7, 0xff, 0xc0, 0x1f, 0xff, 0x0,
+    0x7f, 0xfc, 0x1, 0xff, 0xf0, 0x7, 0xff, 0xc0,
+    0x1f, 0xff, 0x0, 0x7f, 0xfc, 0x1, 0xff, 0xf0,
+    0x7, 0xff, 0xc0, 0x1f, 0xff, 0x0, 0x7f, 0xfc,
+    0x1, 0xff, 0xf0, 0x7, 0xff, 0xc0, 0x1f, 0xff,
+    0x0, 0x7f, 0xfc, 0x1, 0xff, 0xf0, 0x7, 0xff,
+    0xc0, 0x1f, 0xff, 0x0, 0x7f, 0xfc, 0x1, 0xff,
+    0xf0, 0x7, 0xff, 0xc0, 0x1f, 0xff, 0x0, 0x7f,
+    0xfc, 0x1, 0xff, 0xf0, 0x7, 0xff, 0xc0, 0x1f,
+    0xff, 0x0, 0x7f, 0xfc, 0x1, 0xff, 0xf0, 0x7,
+    0xff, 0xc0, 0x1f, 0xff, 0x0, 0x7f, 0xfc, 0x1,
+    0xff, 0xf0, 0x7, 0xff, 0xc0, 0x1f, 0xff, 0x0,
+    0x7f, 0xfc, 0x1, 0xff, 0xf0, 0x7, 0xff, 0xc0,
+    0x1f, 0xff, 0x0, 0x7f, 0xfc, 0x1, 0xff, 0xf0,
+    0x7, 0xff, 0xc0, 0x1f, 0xff, 0x0, 0x7f, 0xfc,
+    0x1, 0xff, 0xf0, 0x7, 0xff, 0xc0, 0x1f, 0xff,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+
+    /* U+005E "^" */
+    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0xf, 0xfc,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x1,
+    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x1, 0xff, 0xfe,
+    0x0, 0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x1f,
+    0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0,
+    0x3, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xf3, 0xfe,
+    0x0, 0x0, 0x7f, 0xcf, 0xf8, 0x0, 0x3, 0xff,
+    0x3f, 0xf0, 0x0, 0xf, 0xf8, 0x7f, 0xc0, 0x0,
+    0x3f, 0xe1, 0xff, 0x0, 0x1, 0xff, 0x3, 0xfe,
+    0x0, 0x7, 0xfc, 0xf, 0xf8, 0x0, 0x3f, 0xf0,
+    0x3f, 0xf0, 0x0, 0xff, 0x80, 0x7f, 0xc0, 0x7,
+    0xfe, 0x1, 0xff, 0x80, 0x1f, 0xf0, 0x3, 0xfe,
+    0x0, 0x7f, 0xc0, 0xf, 0xfc, 0x3, 0xfe, 0x0,
+    0x1f, 0xf0, 0xf, 0xf8, 0x0, 0x7f, 0xc0, 0x7f,
+    0xe0, 0x1, 0xff, 0x81, 0xff, 0x0, 0x3, 0xfe,
+    0xf, 0xfc, 0x0, 0xf, 0xfc, 0x3f, 0xe0, 0x0,
+    0x1f, 0xf1, 0xff, 0x80, 0x0, 0x7f, 0xe7, 0xfe,
+    0x0, 0x1, 0xff, 0x9f, 0xf0, 0x0, 0x3, 0xfe,
+    0xff, 0xc0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
+    0x1f, 0xf0,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff,
+
+    /* U+0060 "`" */
+    0xff, 0xf8, 0x0, 0x7f, 0xfc, 0x0, 0x1f, 0xfe,
+    0x0, 0xf, 0xff, 0x0, 0x7, 0xff, 0x80, 0x3,
+    0xff, 0xc0, 0x0, 0xff, 0xe0, 0x0, 0x7f, 0xf0,
+    0x0, 0x3f, 0xf8, 0x0, 0x1f, 0xfc, 0x0, 0x7,
+    0xfe, 0x0, 0x3, 0xff,
+
+    /* U+0061 "a" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
+    0x7f, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
+    0xf8, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0x81, 0xfe, 0x0, 0x1f, 0xff, 0xe0, 0x78, 0x0,
+    0x7, 0xff, 0xf0, 0x30, 0x0, 0x1, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0xf,
+    0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
+    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc0,
+    0x3, 0xff, 0xef, 0xff, 0x80, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
+    0xe0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x1f,
+    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xfe,
+    0x0, 0x1f, 0xff, 0xef, 0xff, 0xc0, 0x1f, 0xff,
+    0xf7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xff, 0xef, 0xff, 0xf, 0xff, 0xff,
+    0xf7, 0xff, 0x83, 0xff, 0xff, 0xe3, 0xff, 0xc0,
+    0x7f, 0xff, 0xe1, 0xff, 0xe0, 0xf, 0xff, 0xc0,
+    0xff, 0xf0, 0x0, 0x18, 0x0, 0x0, 0x0,
+
+    /* U+0062 "b" */
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
+    0x0, 0x40, 0x0, 0x1, 0xff, 0xe0, 0x3f, 0xfe,
+    0x0, 0x3, 0xff, 0xc1, 0xff, 0xff, 0x80, 0x7,
+    0xff, 0x8f, 0xff, 0xff, 0xc0, 0xf, 0xff, 0x3f,
+    0xff, 0xff, 0xc0, 0x1f, 0xfe, 0xff, 0xff, 0xff,
+    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
+    0xfe, 0x0, 0x7f, 0xff, 0x8f, 0xff, 0xf8, 0x0,
+    0x7f, 0xff, 0x9f, 0xff, 0xe0, 0x0, 0x3f, 0xff,
+    0x3f, 0xff, 0x80, 0x0, 0x7f, 0xff, 0x7f, 0xfe,
+    0x0, 0x0, 0x7f, 0xfe, 0xff, 0xf8, 0x0, 0x0,
+    0x7f, 0xfd, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xe0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff,
+    0xdf, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xbf, 0xff,
+    0x80, 0x0, 0x7f, 0xff, 0x7f, 0xff, 0x80, 0x0,
+    0xff, 0xfc, 0xff, 0xff, 0x80, 0x7, 0xff, 0xf9,
+    0xff, 0xff, 0x80, 0x1f, 0xff, 0xe3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0x1, 0xff,
+    0xe3, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xc3, 0xff,
+    0xff, 0x80, 0x7, 0xff, 0x80, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f,
+    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xe0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xfe, 0x0,
+    0x7f, 0xfe, 0x3f, 0xff, 0xc0, 0x1, 0xff, 0x83,
+    0xff, 0xf0, 0x0, 0xf, 0xe0, 0x7f, 0xfe, 0x0,
+    0x0, 0x7c, 0x7, 0xff, 0xe0, 0x0, 0x7, 0x0,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xe0, 0x0, 0x7, 0x0, 0x7f, 0xff, 0x0,
+    0x0, 0x7c, 0x3, 0xff, 0xf0, 0x0, 0xf, 0xe0,
+    0x3f, 0xff, 0xc0, 0x1, 0xff, 0x81, 0xff, 0xfe,
+    0x0, 0x7f, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
+    0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff,
+    0xfc, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x3, 0xff, 0xe0,
+    0x3f, 0xfc, 0x0, 0x3f, 0xff, 0xf8, 0x7f, 0xf8,
+    0x1, 0xff, 0xff, 0xf8, 0xff, 0xf0, 0x7, 0xff,
+    0xff, 0xf9, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff,
+    0xff, 0x0, 0x3f, 0xff, 0xf3, 0xff, 0xfc, 0x0,
+    0x3f, 0xff, 0xe7, 0xff, 0xe0, 0x0, 0x1f, 0xff,
+    0xdf, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xbf, 0xff,
+    0x0, 0x0, 0x3f, 0xff, 0x7f, 0xfc, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x1, 0xff, 0xf7, 0xff, 0xc0, 0x0, 0x3, 0xff,
+    0xef, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xdf, 0xff,
+    0xc0, 0x0, 0x3f, 0xff, 0x9f, 0xff, 0x80, 0x0,
+    0x7f, 0xff, 0x3f, 0xff, 0xc0, 0x3, 0xff, 0xfe,
+    0x3f, 0xff, 0xc0, 0xf, 0xff, 0xfc, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x7f, 0xff, 0xff, 0xdf, 0xfe, 0x0,
+    0x7f, 0xff, 0xfe, 0x3f, 0xfc, 0x0, 0x3f, 0xff,
+    0xf8, 0x7f, 0xf8, 0x0, 0xf, 0xff, 0x80, 0xff,
+    0xf0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7,
+    0xff, 0xf0, 0x3, 0xff, 0xf8, 0x3f, 0xff, 0x0,
+    0x3, 0xff, 0xf0, 0xff, 0xf8, 0x0, 0x7, 0xff,
+    0xc7, 0xff, 0xc0, 0x0, 0xf, 0xff, 0x9f, 0xfe,
+    0x0, 0x0, 0x1f, 0xfe, 0x7f, 0xf8, 0x0, 0x0,
+    0x7f, 0xfb, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x6, 0x0,
+    0x3f, 0xff, 0x80, 0x0, 0x7c, 0x0, 0x7f, 0xff,
+    0x80, 0x7, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xc0, 0x0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff,
+    0xf0, 0x1, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff,
+    0xf8, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
+    0xfc, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff,
+    0xfe, 0x0, 0x3f, 0xff, 0x83, 0x0, 0x3f, 0xff,
+    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x7f, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x1f, 0xff,
+    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xc7, 0xff,
+    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf1, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0x7f,
+    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x0,
+    0x3f, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xfc, 0x0,
+    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x1, 0xff,
+    0xf0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x7f,
+    0xfc, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x7f, 0xfc, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0xf, 0xff, 0x0, 0xf, 0xff, 0xfe,
+    0xf, 0xff, 0x0, 0x3f, 0xff, 0xff, 0x8f, 0xff,
+    0x0, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x1, 0xff,
+    0xff, 0xff, 0xef, 0xff, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x3f, 0xff, 0xe0, 0x7, 0xff, 0xff,
+    0x3f, 0xff, 0x80, 0x1, 0xff, 0xff, 0x7f, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0x7f, 0xfe, 0x0, 0x0,
+    0x7f, 0xff, 0x7f, 0xfe, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x3f, 0xff, 0x7f, 0xfc, 0x0, 0x0,
+    0x3f, 0xff, 0x7f, 0xfe, 0x0, 0x0, 0x7f, 0xff,
+    0x7f, 0xff, 0x0, 0x0, 0x7f, 0xff, 0x3f, 0xff,
+    0x80, 0x0, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0x3,
+    0xff, 0xff, 0x1f, 0xff, 0xf8, 0xf, 0xff, 0xff,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x0, 0x7f, 0xff, 0xff,
+    0x9f, 0xff, 0x0, 0x1f, 0xff, 0xff, 0x1f, 0xff,
+    0x0, 0x7, 0xff, 0xfc, 0x1f, 0xff, 0x0, 0x0,
+    0x7f, 0xc0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x1, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0x1, 0x80, 0x0, 0x0,
+    0x7f, 0xfe, 0x3, 0xe0, 0x0, 0x0, 0xff, 0xfc,
+    0x3, 0xf8, 0x0, 0x1, 0xff, 0xfc, 0x7, 0xff,
+    0x0, 0x7, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x80, 0x0, 0x0,
+
+    /* U+0068 "h" */
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x20, 0x0, 0xf, 0xff, 0x80,
+    0xff, 0xf8, 0x0, 0xff, 0xf8, 0x7f, 0xff, 0xe0,
+    0xf, 0xff, 0x8f, 0xff, 0xff, 0x80, 0xff, 0xfb,
+    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xef,
+    0xff, 0xf8, 0x0, 0xff, 0xfe, 0xff, 0xff, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
+    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x1f, 0xff,
+
+    /* U+0069 "i" */
+    0x7, 0xe0, 0x1f, 0xf8, 0x3f, 0xfc, 0x7f, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0x3f, 0xfc,
+    0x1f, 0xf8, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+    0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc,
+
+    /* U+006A "j" */
+    0x0, 0x0, 0x7e, 0x0, 0x0, 0x1f, 0xf8, 0x0,
+    0x3, 0xff, 0xc0, 0x0, 0x7f, 0xfe, 0x0, 0xf,
+    0xff, 0xf0, 0x0, 0xff, 0xff, 0x0, 0xf, 0xff,
+    0xf0, 0x0, 0xff, 0xff, 0x0, 0xf, 0xff, 0xf0,
+    0x0, 0xff, 0xff, 0x0, 0x7, 0xff, 0xe0, 0x0,
+    0x3f, 0xfc, 0x0, 0x1, 0xff, 0x80, 0x0, 0x7,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f,
+    0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f,
+    0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x7f, 0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f,
+    0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0xff, 0xfc, 0x10, 0x1f,
+    0xff, 0x81, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+    0x83, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x7,
+    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfc, 0xf, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xfe,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x4, 0x0, 0x0,
+
+    /* U+006B "k" */
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xfc, 0xff, 0xf8, 0x0, 0x3,
+    0xff, 0xf8, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xf0,
+    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xe0, 0xff, 0xf8,
+    0x0, 0x3f, 0xff, 0xc0, 0xff, 0xf8, 0x0, 0x7f,
+    0xff, 0x80, 0xff, 0xf8, 0x0, 0xff, 0xff, 0x0,
+    0xff, 0xf8, 0x1, 0xff, 0xfe, 0x0, 0xff, 0xf8,
+    0x3, 0xff, 0xfc, 0x0, 0xff, 0xf8, 0x7, 0xff,
+    0xf8, 0x0, 0xff, 0xf8, 0xf, 0xff, 0xf0, 0x0,
+    0xff, 0xf8, 0x1f, 0xff, 0xe0, 0x0, 0xff, 0xf8,
+    0x3f, 0xff, 0xc0, 0x0, 0xff, 0xf8, 0x7f, 0xff,
+    0x80, 0x0, 0xff, 0xf8, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xf9, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xfb,
+    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0xff, 0xff, 0xcf, 0xff, 0xf0, 0x0, 0xff, 0xff,
+    0x87, 0xff, 0xf0, 0x0, 0xff, 0xff, 0x3, 0xff,
+    0xf8, 0x0, 0xff, 0xfe, 0x1, 0xff, 0xfc, 0x0,
+    0xff, 0xfc, 0x1, 0xff, 0xfe, 0x0, 0xff, 0xf8,
+    0x0, 0xff, 0xfe, 0x0, 0xff, 0xf8, 0x0, 0x7f,
+    0xff, 0x0, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0x80,
+    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xc0, 0xff, 0xf8,
+    0x0, 0x1f, 0xff, 0xe0, 0xff, 0xf8, 0x0, 0xf,
+    0xff, 0xe0, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xf0,
+    0xff, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xfc, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xfe, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfe,
+
+    /* U+006C "l" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0,
+
+    /* U+006D "m" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x7f, 0xf8, 0xf, 0xff, 0x80, 0x0, 0x3f,
+    0xfe, 0x0, 0x3f, 0xfc, 0x1f, 0xff, 0xf0, 0x0,
+    0xff, 0xff, 0xc0, 0x1f, 0xfe, 0x3f, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0xf8, 0xf, 0xff, 0x3f, 0xff,
+    0xff, 0x81, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xbf,
+    0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0x83, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xe1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfc,
+    0x3, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xf7, 0xff,
+    0xf8, 0x0, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xfb,
+    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xf0, 0x0,
+    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0,
+    0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff,
+    0xf8, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x7f, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0x80, 0x0,
+    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
+    0xe0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
+    0x1, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
+    0x80, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff, 0xfc,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x1,
+    0xff, 0xf0,
+
+    /* U+006E "n" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0xf, 0xff, 0x0,
+    0xff, 0xf8, 0x0, 0xff, 0xf0, 0x7f, 0xff, 0xe0,
+    0xf, 0xff, 0xf, 0xff, 0xff, 0x80, 0xff, 0xf3,
+    0xff, 0xff, 0xfc, 0xf, 0xff, 0x7f, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xef,
+    0xff, 0xf8, 0x0, 0xff, 0xfe, 0xff, 0xff, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
+    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x1f, 0xff,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xc0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0x0, 0x7f, 0xff, 0x83, 0xff,
+    0xf8, 0x0, 0x3f, 0xff, 0x87, 0xff, 0xe0, 0x0,
+    0x3f, 0xff, 0x1f, 0xff, 0x80, 0x0, 0x3f, 0xff,
+    0x3f, 0xff, 0x0, 0x0, 0x7f, 0xfe, 0x7f, 0xfc,
+    0x0, 0x0, 0x7f, 0xfd, 0xff, 0xf8, 0x0, 0x0,
+    0xff, 0xfb, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x3, 0xff, 0xe7, 0xff, 0xc0, 0x0,
+    0x7, 0xff, 0xcf, 0xff, 0xc0, 0x0, 0x1f, 0xff,
+    0x9f, 0xff, 0x80, 0x0, 0x3f, 0xff, 0x1f, 0xff,
+    0x80, 0x0, 0xff, 0xfc, 0x3f, 0xff, 0x80, 0x3,
+    0xff, 0xf8, 0x3f, 0xff, 0xc0, 0x1f, 0xff, 0xe0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0,
+
+    /* U+0070 "p" */
+    0x0, 0x0, 0x0, 0x40, 0x0, 0x1, 0xff, 0xe0,
+    0x3f, 0xfe, 0x0, 0x3, 0xff, 0xc3, 0xff, 0xff,
+    0x80, 0x7, 0xff, 0x8f, 0xff, 0xff, 0xc0, 0xf,
+    0xff, 0x7f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc7, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0x8f, 0xff,
+    0xf8, 0x0, 0x7f, 0xff, 0x9f, 0xff, 0xe0, 0x0,
+    0x3f, 0xff, 0x3f, 0xff, 0x80, 0x0, 0x7f, 0xff,
+    0x7f, 0xfe, 0x0, 0x0, 0x7f, 0xfe, 0xff, 0xf8,
+    0x0, 0x0, 0x7f, 0xfd, 0xff, 0xf0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xc0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x7, 0xff, 0xdf, 0xff, 0x80, 0x0, 0x1f, 0xff,
+    0xbf, 0xff, 0x80, 0x0, 0x7f, 0xff, 0x7f, 0xff,
+    0x80, 0x0, 0xff, 0xfc, 0xff, 0xff, 0x80, 0x7,
+    0xff, 0xf9, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xf3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xfb, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xf3, 0xff, 0xff, 0xfe,
+    0x1, 0xff, 0xe3, 0xff, 0xff, 0xf0, 0x3, 0xff,
+    0xc1, 0xff, 0xff, 0x80, 0x7, 0xff, 0x80, 0xff,
+    0xfc, 0x0, 0xf, 0xff, 0x0, 0xc, 0x0, 0x0,
+    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xe0, 0x3f, 0xfc, 0x0, 0x3f, 0xff, 0xf8,
+    0x7f, 0xf8, 0x1, 0xff, 0xff, 0xf8, 0xff, 0xf0,
+    0x7, 0xff, 0xff, 0xfd, 0xff, 0xe0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xf3, 0xff,
+    0xfc, 0x0, 0x3f, 0xff, 0xe7, 0xff, 0xe0, 0x0,
+    0x1f, 0xff, 0xdf, 0xff, 0x80, 0x0, 0x3f, 0xff,
+    0xbf, 0xff, 0x0, 0x0, 0x3f, 0xff, 0x7f, 0xfc,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x1, 0xff, 0xf7, 0xff, 0xc0, 0x0,
+    0x3, 0xff, 0xef, 0xff, 0xc0, 0x0, 0xf, 0xff,
+    0xdf, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0x9f, 0xff,
+    0x80, 0x0, 0x7f, 0xff, 0x3f, 0xff, 0xc0, 0x3,
+    0xff, 0xfe, 0x7f, 0xff, 0xc0, 0xf, 0xff, 0xfc,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0x9f,
+    0xfe, 0x0, 0x7f, 0xff, 0xfe, 0x3f, 0xfc, 0x0,
+    0x3f, 0xff, 0xf8, 0x7f, 0xf8, 0x0, 0xf, 0xff,
+    0x80, 0xff, 0xf0, 0x0, 0x0, 0x40, 0x1, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf0,
+
+    /* U+0072 "r" */
+    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x1, 0xff, 0xff,
+    0xc1, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0x3f,
+    0xff, 0xc0, 0x7, 0xff, 0xf0, 0x0, 0xff, 0xfc,
+    0x0, 0x1f, 0xff, 0x80, 0x3, 0xff, 0xf0, 0x0,
+    0x7f, 0xfc, 0x0, 0xf, 0xff, 0x80, 0x1, 0xff,
+    0xf0, 0x0, 0x3f, 0xfe, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x7f, 0xfc, 0x0, 0xf, 0xff,
+    0x80, 0x1, 0xff, 0xf0, 0x0, 0x3f, 0xfe, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0xff, 0xf8, 0x0, 0x1f,
+    0xff, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x7f, 0xfc,
+    0x0, 0xf, 0xff, 0x80, 0x1, 0xff, 0xf0, 0x0,
+    0x3f, 0xfe, 0x0, 0x7, 0xff, 0xc0, 0x0, 0xff,
+    0xf8, 0x0, 0x1f, 0xff, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xf8, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
+    0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x3f,
+    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xf0,
+    0x0, 0x7e, 0x7, 0xff, 0xc0, 0x0, 0x1c, 0xf,
+    0xff, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
+    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x1, 0xff,
+    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xf8,
+    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0,
+    0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
+    0xf0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
+    0x3, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0x86,
+    0x0, 0x0, 0xf, 0xff, 0x1f, 0x0, 0x0, 0x3f,
+    0xfe, 0x3f, 0xe0, 0x0, 0xff, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+    0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
+    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xc0,
+    0x3f, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
+    0xf0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x7, 0x0, 0x0, 0x0,
+
+    /* U+0074 "t" */
+    0x1, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xf8, 0x0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x3f, 0xfe, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0xf, 0xff, 0x80,
+    0x0, 0x7, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xf8,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
+    0xff, 0x8f, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
+    0xff, 0xe3, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
+    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0x1f, 0xff,
+    0xff, 0xff, 0x80, 0x1f, 0xff, 0x0, 0x0, 0xf,
+    0xff, 0x80, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x3,
+    0xff, 0xe0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
+    0x3f, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0xf, 0xff, 0x80, 0x0, 0x7, 0xff, 0xc0, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xfc, 0x0,
+    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0xf, 0xff, 0x80, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xf0,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff,
+    0x1, 0x0, 0x1f, 0xff, 0xff, 0x80, 0xf, 0xff,
+    0xff, 0xe0, 0x7, 0xff, 0xff, 0xf0, 0x1, 0xff,
+    0xff, 0xf8, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x3f,
+    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x3,
+    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xe0, 0x0,
+    0xf, 0xff, 0xc0, 0x0, 0x0, 0x18, 0x0,
+
+    /* U+0075 "u" */
+    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
+    0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff,
+    0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff,
+    0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0xff, 0xff, 0x7f, 0xff, 0x0,
+    0x1f, 0xff, 0xf7, 0xff, 0xf8, 0x3, 0xff, 0xff,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x7, 0xff, 0xff, 0xfe, 0xff, 0xf0, 0x3f,
+    0xff, 0xff, 0xcf, 0xff, 0x1, 0xff, 0xff, 0xf8,
+    0xff, 0xf0, 0x7, 0xff, 0xfe, 0xf, 0xff, 0x0,
+    0x1f, 0xff, 0x80, 0xff, 0xf0, 0x0, 0x6, 0x0,
+    0x0, 0x0,
+
+    /* U+0076 "v" */
+    0x7f, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xbf, 0xfe,
+    0x0, 0x0, 0x3, 0xff, 0xdf, 0xff, 0x0, 0x0,
+    0x3, 0xff, 0xc7, 0xff, 0xc0, 0x0, 0x1, 0xff,
+    0xe3, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xf0, 0xff,
+    0xf0, 0x0, 0x0, 0xff, 0xf0, 0x7f, 0xfc, 0x0,
+    0x0, 0x7f, 0xf8, 0x1f, 0xfe, 0x0, 0x0, 0x7f,
+    0xf8, 0xf, 0xff, 0x80, 0x0, 0x3f, 0xfc, 0x7,
+    0xff, 0xc0, 0x0, 0x3f, 0xfc, 0x1, 0xff, 0xf0,
+    0x0, 0x1f, 0xfe, 0x0, 0xff, 0xf8, 0x0, 0xf,
+    0xff, 0x0, 0x3f, 0xfc, 0x0, 0xf, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x7, 0xff, 0x80, 0xf, 0xff,
+    0x80, 0x7, 0xff, 0x80, 0x3, 0xff, 0xe0, 0x3,
+    0xff, 0xc0, 0x1, 0xff, 0xf0, 0x1, 0xff, 0xe0,
+    0x0, 0x7f, 0xf8, 0x1, 0xff, 0xe0, 0x0, 0x3f,
+    0xfe, 0x0, 0xff, 0xf0, 0x0, 0xf, 0xff, 0x0,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xc0, 0x7f, 0xf8,
+    0x0, 0x3, 0xff, 0xe0, 0x7f, 0xf8, 0x0, 0x0,
+    0xff, 0xf0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xfc,
+    0x1f, 0xfe, 0x0, 0x0, 0x1f, 0xfe, 0x1f, 0xfe,
+    0x0, 0x0, 0xf, 0xff, 0x8f, 0xff, 0x0, 0x0,
+    0x7, 0xff, 0xcf, 0xff, 0x0, 0x0, 0x1, 0xff,
+    0xe7, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xff, 0xf0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
+    0xff, 0xef, 0xfe, 0x0, 0x0, 0x1f, 0xfe, 0x0,
+    0x0, 0x3f, 0xf9, 0xff, 0xe0, 0x0, 0x3, 0xff,
+    0xc0, 0x0, 0x7, 0xff, 0x3f, 0xfc, 0x0, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0xff, 0xe3, 0xff, 0x80,
+    0x0, 0x1f, 0xff, 0x80, 0x0, 0x3f, 0xf8, 0x7f,
+    0xf8, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xf, 0xff, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x1,
+    0xff, 0xe0, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xe0,
+    0x0, 0x3f, 0xf8, 0x1f, 0xfe, 0x0, 0x7, 0xff,
+    0xfc, 0x0, 0x7, 0xff, 0x3, 0xff, 0xc0, 0x0,
+    0xff, 0xff, 0x80, 0x1, 0xff, 0xc0, 0x3f, 0xfc,
+    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x3f, 0xf8, 0x7,
+    0xff, 0x80, 0x7, 0xff, 0xff, 0x0, 0x7, 0xff,
+    0x0, 0x7f, 0xf0, 0x0, 0xff, 0xff, 0xf0, 0x1,
+    0xff, 0xc0, 0xf, 0xff, 0x0, 0x1f, 0xff, 0xfe,
+    0x0, 0x3f, 0xf8, 0x1, 0xff, 0xe0, 0x7, 0xff,
+    0xff, 0xc0, 0x7, 0xff, 0x0, 0x1f, 0xfc, 0x0,
+    0xff, 0xff, 0xfc, 0x1, 0xff, 0xc0, 0x3, 0xff,
+    0xc0, 0x1f, 0xfb, 0xff, 0x80, 0x3f, 0xf8, 0x0,
+    0x7f, 0xf8, 0x7, 0xff, 0x7f, 0xf0, 0x7, 0xff,
+    0x0, 0x7, 0xff, 0x0, 0xff, 0xef, 0xff, 0x1,
+    0xff, 0xc0, 0x0, 0xff, 0xf0, 0x3f, 0xf8, 0xff,
+    0xe0, 0x3f, 0xf8, 0x0, 0x1f, 0xfe, 0x7, 0xff,
+    0x1f, 0xfc, 0xf, 0xfe, 0x0, 0x1, 0xff, 0xc0,
+    0xff, 0xe3, 0xff, 0xc1, 0xff, 0xc0, 0x0, 0x3f,
+    0xfc, 0x3f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf8, 0x0,
+    0x3, 0xff, 0x87, 0xff, 0x7, 0xff, 0xf, 0xfe,
+    0x0, 0x0, 0x7f, 0xf0, 0xff, 0xe0, 0x7f, 0xf1,
+    0xff, 0xc0, 0x0, 0xf, 0xff, 0x3f, 0xf8, 0xf,
+    0xfe, 0x3f, 0xf8, 0x0, 0x0, 0xff, 0xe7, 0xff,
+    0x1, 0xff, 0xcf, 0xfe, 0x0, 0x0, 0x1f, 0xfc,
+    0xff, 0xc0, 0x1f, 0xfd, 0xff, 0xc0, 0x0, 0x3,
+    0xff, 0xff, 0xf8, 0x3, 0xff, 0xbf, 0xf8, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xfe,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x7, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xc0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x1f, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xf0, 0x0,
+    0x0, 0x3, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x7f,
+    0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0,
+    0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xfe,
+    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xc0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
+    0x1, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7,
+    0xff, 0x80, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x7f, 0xfe, 0x0, 0x0, 0xff, 0xfc, 0x7f, 0xfe,
+    0x0, 0x1, 0xff, 0xf0, 0xff, 0xfc, 0x0, 0x7,
+    0xff, 0xc0, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0x0,
+    0xff, 0xfc, 0x0, 0x7f, 0xfe, 0x0, 0xff, 0xf8,
+    0x0, 0xff, 0xf8, 0x1, 0xff, 0xf8, 0x3, 0xff,
+    0xe0, 0x1, 0xff, 0xf8, 0xf, 0xff, 0x80, 0x1,
+    0xff, 0xf8, 0x3f, 0xff, 0x0, 0x1, 0xff, 0xf0,
+    0x7f, 0xfc, 0x0, 0x3, 0xff, 0xf1, 0xff, 0xf0,
+    0x0, 0x3, 0xff, 0xf7, 0xff, 0xc0, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x1f, 0xff, 0xbf, 0xfe, 0x0, 0x0, 0x3f,
+    0xfe, 0x7f, 0xfe, 0x0, 0x0, 0xff, 0xf8, 0x7f,
+    0xfe, 0x0, 0x3, 0xff, 0xe0, 0x7f, 0xfe, 0x0,
+    0xf, 0xff, 0xc0, 0x7f, 0xfc, 0x0, 0x1f, 0xff,
+    0x0, 0xff, 0xfc, 0x0, 0x7f, 0xfc, 0x0, 0xff,
+    0xfc, 0x1, 0xff, 0xf8, 0x0, 0xff, 0xfc, 0x7,
+    0xff, 0xe0, 0x1, 0xff, 0xf8, 0xf, 0xff, 0x80,
+    0x1, 0xff, 0xf8, 0x3f, 0xfe, 0x0, 0x1, 0xff,
+    0xf8, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xfb, 0xff,
+    0xf0, 0x0, 0x3, 0xff, 0xf0,
+
+    /* U+0079 "y" */
+    0x7f, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xbf, 0xfe,
+    0x0, 0x0, 0x3, 0xff, 0xdf, 0xff, 0x0, 0x0,
+    0x3, 0xff, 0xc7, 0xff, 0xc0, 0x0, 0x1, 0xff,
+    0xe3, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xf0, 0xff,
+    0xf8, 0x0, 0x0, 0xff, 0xf0, 0x7f, 0xfc, 0x0,
+    0x0, 0x7f, 0xf8, 0x1f, 0xfe, 0x0, 0x0, 0x7f,
+    0xf8, 0xf, 0xff, 0x80, 0x0, 0x3f, 0xfc, 0x7,
+    0xff, 0xc0, 0x0, 0x1f, 0xfc, 0x1, 0xff, 0xf0,
+    0x0, 0x1f, 0xfe, 0x0, 0xff, 0xf8, 0x0, 0xf,
+    0xff, 0x0, 0x3f, 0xfc, 0x0, 0xf, 0xff, 0x0,
+    0x1f, 0xff, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff,
+    0x80, 0x7, 0xff, 0x80, 0x3, 0xff, 0xe0, 0x3,
+    0xff, 0xc0, 0x1, 0xff, 0xf0, 0x1, 0xff, 0xe0,
+    0x0, 0x7f, 0xf8, 0x1, 0xff, 0xe0, 0x0, 0x3f,
+    0xfe, 0x0, 0xff, 0xf0, 0x0, 0xf, 0xff, 0x0,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xc0, 0x7f, 0xf8,
+    0x0, 0x1, 0xff, 0xe0, 0x3f, 0xf8, 0x0, 0x0,
+    0xff, 0xf0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xfc,
+    0x1f, 0xfe, 0x0, 0x0, 0x1f, 0xfe, 0x1f, 0xfe,
+    0x0, 0x0, 0xf, 0xff, 0x8f, 0xff, 0x0, 0x0,
+    0x3, 0xff, 0xc7, 0xff, 0x0, 0x0, 0x1, 0xff,
+    0xf7, 0xff, 0x80, 0x0, 0x0, 0xff, 0xfb, 0xff,
+    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
+    0x18, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xe, 0x0,
+    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x7f, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfd,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
+    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x1, 0xff,
+    0xf8, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
+    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0xff, 0xfe,
+    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x1f,
+    0xff, 0x80, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
+    0x7, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
+    0xe0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x3,
+    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
+    0x0, 0x7f, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0xff,
+    0xfe, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
+    0x3f, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0,
+
+    /* U+007B "{" */
+    0x0, 0x0, 0xff, 0xc0, 0x1, 0xff, 0xf0, 0x1,
+    0xff, 0xfc, 0x0, 0xff, 0xff, 0x0, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xf0, 0xf, 0xff, 0xfc, 0x7,
+    0xff, 0xff, 0x1, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xf0, 0x3f, 0xff, 0xc0, 0xf, 0xff, 0xc0, 0x3,
+    0xff, 0xf0, 0x0, 0xff, 0xf8, 0x0, 0x3f, 0xfe,
+    0x0, 0xf, 0xff, 0x80, 0x3, 0xff, 0xe0, 0x0,
+    0xff, 0xf8, 0x0, 0x3f, 0xfe, 0x0, 0xf, 0xff,
+    0x80, 0x3, 0xff, 0xe0, 0x0, 0xff, 0xf8, 0x0,
+    0x3f, 0xfe, 0x0, 0xf, 0xff, 0x80, 0x3, 0xff,
+    0xe0, 0x0, 0xff, 0xf8, 0x0, 0x3f, 0xfe, 0x0,
+    0xf, 0xff, 0x80, 0x3, 0xff, 0xe0, 0x0, 0xff,
+    0xf8, 0x0, 0x7f, 0xfe, 0x0, 0x3f, 0xff, 0x80,
+    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf0, 0xf, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x0, 0xff, 0xfe, 0x0,
+    0x3f, 0xff, 0x80, 0xf, 0xff, 0xf0, 0x3, 0xff,
+    0xfe, 0x0, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf0,
+    0x0, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0x80, 0x3,
+    0xff, 0xe0, 0x0, 0xff, 0xf8, 0x0, 0x3f, 0xfe,
+    0x0, 0xf, 0xff, 0x80, 0x3, 0xff, 0xe0, 0x0,
+    0xff, 0xf8, 0x0, 0x3f, 0xfe, 0x0, 0xf, 0xff,
+    0x80, 0x3, 0xff, 0xe0, 0x0, 0xff, 0xf8, 0x0,
+    0x3f, 0xfe, 0x0, 0xf, 0xff, 0x80, 0x3, 0xff,
+    0xe0, 0x0, 0xff, 0xf8, 0x0, 0x3f, 0xfe, 0x0,
+    0xf, 0xff, 0x80, 0x3, 0xff, 0xe0, 0x0, 0xff,
+    0xf8, 0x0, 0x3f, 0xff, 0x0, 0xf, 0xff, 0xc0,
+    0x3, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xf0, 0x1f,
+    0xff, 0xfc, 0x7, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0xc0, 0x3f, 0xff, 0xf0, 0x7, 0xff, 0xfc, 0x0,
+    0xff, 0xff, 0x0, 0x1f, 0xff, 0xc0, 0x1, 0xff,
+    0xf0, 0x0, 0xf, 0xfc,
+
+    /* U+007C "|" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+
+    /* U+007D "}" */
+    0xff, 0xe0, 0x0, 0x1f, 0xff, 0x80, 0x3, 0xff,
+    0xfc, 0x0, 0x7f, 0xff, 0xc0, 0xf, 0xff, 0xfc,
+    0x1, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf8, 0x7,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x1f, 0xff,
+    0xfe, 0x0, 0x1f, 0xff, 0xe0, 0x1, 0xff, 0xfc,
+    0x0, 0x1f, 0xff, 0x80, 0x1, 0xff, 0xf0, 0x0,
+    0x3f, 0xfe, 0x0, 0x7, 0xff, 0xc0, 0x0, 0xff,
+    0xf8, 0x0, 0x1f, 0xff, 0x0, 0x3, 0xff, 0xe0,
+    0x0, 0x7f, 0xfc, 0x0, 0xf, 0xff, 0x80, 0x1,
+    0xff, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0x7, 0xff,
+    0xc0, 0x0, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0x0,
+    0x3, 0xff, 0xe0, 0x0, 0x7f, 0xfc, 0x0, 0xf,
+    0xff, 0x80, 0x1, 0xff, 0xf0, 0x0, 0x3f, 0xfe,
+    0x0, 0x7, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xe0,
+    0xf, 0xff, 0xfc, 0x0, 0xff, 0xff, 0x80, 0x1f,
+    0xff, 0xf0, 0x0, 0xff, 0xfe, 0x0, 0x1f, 0xff,
+    0xc0, 0x7, 0xff, 0xf8, 0x1, 0xff, 0xff, 0x0,
+    0x7f, 0xff, 0xe0, 0xf, 0xff, 0xfc, 0x3, 0xff,
+    0xf0, 0x0, 0x7f, 0xfc, 0x0, 0xf, 0xff, 0x80,
+    0x1, 0xff, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0x7,
+    0xff, 0xc0, 0x0, 0xff, 0xf8, 0x0, 0x1f, 0xff,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x7f, 0xfc, 0x0,
+    0xf, 0xff, 0x80, 0x1, 0xff, 0xf0, 0x0, 0x3f,
+    0xfe, 0x0, 0x7, 0xff, 0xc0, 0x0, 0xff, 0xf8,
+    0x0, 0x1f, 0xff, 0x0, 0x3, 0xff, 0xe0, 0x0,
+    0x7f, 0xfc, 0x0, 0xf, 0xff, 0x80, 0x1, 0xff,
+    0xf0, 0x0, 0x7f, 0xfe, 0x0, 0x1f, 0xff, 0xc0,
+    0x7, 0xff, 0xf8, 0x1f, 0xff, 0xfe, 0x3, 0xff,
+    0xff, 0xc0, 0x7f, 0xff, 0xf8, 0xf, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf0, 0x7,
+    0xff, 0xfc, 0x0, 0xff, 0xff, 0x0, 0x1f, 0xff,
+    0x80, 0x3, 0xff, 0x0, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
+    0x0, 0xff, 0x7, 0xff, 0xe0, 0x0, 0xff, 0xf,
+    0xff, 0xf8, 0x0, 0xff, 0x1f, 0xff, 0xfc, 0x1,
+    0xff, 0x3f, 0xff, 0xfe, 0x3, 0xff, 0x3f, 0xff,
+    0xff, 0x87, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xfe,
+    0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xe1, 0xff,
+    0xff, 0xfc, 0xff, 0x80, 0xff, 0xff, 0xfc, 0xff,
+    0x80, 0x3f, 0xff, 0xf8, 0xff, 0x0, 0x1f, 0xff,
+    0xf0, 0xff, 0x0, 0x7, 0xff, 0xe0, 0xff, 0x0,
+    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t montserrat_bold_80_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 362, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 370, .box_w = 15, .box_h = 58, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 110, .adv_w = 559, .box_w = 26, .box_h = 23, .ofs_x = 4, .ofs_y = 34},
+    {.bitmap_index = 185, .adv_w = 922, .box_w = 55, .box_h = 57, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 577, .adv_w = 817, .box_w = 46, .box_h = 76, .ofs_x = 2, .ofs_y = -9},
+    {.bitmap_index = 1014, .adv_w = 1123, .box_w = 66, .box_h = 58, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 1493, .adv_w = 932, .box_w = 54, .box_h = 58, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 1885, .adv_w = 294, .box_w = 10, .box_h = 23, .ofs_x = 4, .ofs_y = 34},
+    {.bitmap_index = 1914, .adv_w = 457, .box_w = 22, .box_h = 75, .ofs_x = 6, .ofs_y = -16},
+    {.bitmap_index = 2121, .adv_w = 458, .box_w = 22, .box_h = 75, .ofs_x = 1, .ofs_y = -16},
+    {.bitmap_index = 2328, .adv_w = 556, .box_w = 33, .box_h = 32, .ofs_x = 1, .ofs_y = 28},
+    {.bitmap_index = 2460, .adv_w = 767, .box_w = 39, .box_h = 38, .ofs_x = 5, .ofs_y = 9},
+    {.bitmap_index = 2646, .adv_w = 335, .box_w = 15, .box_h = 27, .ofs_x = 3, .ofs_y = -12},
+    {.bitmap_index = 2697, .adv_w = 494, .box_w = 23, .box_h = 10, .ofs_x = 4, .ofs_y = 18},
+    {.bitmap_index = 2726, .adv_w = 335, .box_w = 16, .box_h = 16, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 2758, .adv_w = 502, .box_w = 38, .box_h = 76, .ofs_x = -3, .ofs_y = -8},
+    {.bitmap_index = 3119, .adv_w = 869, .box_w = 48, .box_h = 59, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 3473, .adv_w = 502, .box_w = 24, .box_h = 56, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3641, .adv_w = 755, .box_w = 45, .box_h = 57, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3962, .adv_w = 758, .box_w = 45, .box_h = 58, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4289, .adv_w = 882, .box_w = 53, .box_h = 57, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4667, .adv_w = 762, .box_w = 45, .box_h = 58, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4994, .adv_w = 815, .box_w = 46, .box_h = 59, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 5334, .adv_w = 794, .box_w = 45, .box_h = 56, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5649, .adv_w = 845, .box_w = 47, .box_h = 59, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 5996, .adv_w = 815, .box_w = 46, .box_h = 59, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6336, .adv_w = 335, .box_w = 16, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 6426, .adv_w = 335, .box_w = 16, .box_h = 56, .ofs_x = 3, .ofs_y = -12},
+    {.bitmap_index = 6538, .adv_w = 767, .box_w = 38, .box_h = 40, .ofs_x = 5, .ofs_y = 8},
+    {.bitmap_index = 6728, .adv_w = 767, .box_w = 38, .box_h = 30, .ofs_x = 5, .ofs_y = 13},
+    {.bitmap_index = 6871, .adv_w = 767, .box_w = 38, .box_h = 40, .ofs_x = 5, .ofs_y = 8},
+    {.bitmap_index = 7061, .adv_w = 754, .box_w = 43, .box_h = 58, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7373, .adv_w = 1325, .box_w = 77, .box_h = 74, .ofs_x = 3, .ofs_y = -17},
+    {.bitmap_index = 8086, .adv_w = 980, .box_w = 63, .box_h = 57, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8535, .adv_w = 979, .box_w = 51, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 8892, .adv_w = 927, .box_w = 53, .box_h = 59, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 9283, .adv_w = 1057, .box_w = 56, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 9675, .adv_w = 859, .box_w = 44, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 9983, .adv_w = 818, .box_w = 43, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 10284, .adv_w = 987, .box_w = 54, .box_h = 59, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 10683, .adv_w = 1034, .box_w = 51, .box_h = 57, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 11047, .adv_w = 420, .box_w = 13, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 11138, .adv_w = 692, .box_w = 38, .box_h = 58, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 11414, .adv_w = 947, .box_w = 54, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 11792, .adv_w = 773, .box_w = 41, .box_h = 57, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 12085, .adv_w = 1222, .box_w = 63, .box_h = 57, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 12534, .adv_w = 1034, .box_w = 51, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 12891, .adv_w = 1080, .box_w = 61, .box_h = 59, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 13341, .adv_w = 937, .box_w = 49, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 13684, .adv_w = 1080, .box_w = 64, .box_h = 71, .ofs_x = 3, .ofs_y = -13},
+    {.bitmap_index = 14252, .adv_w = 941, .box_w = 50, .box_h = 56, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 14602, .adv_w = 817, .box_w = 46, .box_h = 59, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 14942, .adv_w = 791, .box_w = 49, .box_h = 56, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15285, .adv_w = 1009, .box_w = 51, .box_h = 58, .ofs_x = 6, .ofs_y = -1},
+    {.bitmap_index = 15655, .adv_w = 955, .box_w = 61, .box_h = 57, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16090, .adv_w = 1489, .box_w = 89, .box_h = 57, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16725, .adv_w = 914, .box_w = 57, .box_h = 56, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17124, .adv_w = 865, .box_w = 57, .box_h = 57, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 17531, .adv_w = 859, .box_w = 49, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 17874, .adv_w = 471, .box_w = 22, .box_h = 75, .ofs_x = 7, .ofs_y = -16},
+    {.bitmap_index = 18081, .adv_w = 502, .box_w = 37, .box_h = 76, .ofs_x = -3, .ofs_y = -8},
+    {.bitmap_index = 18433, .adv_w = 471, .box_w = 22, .box_h = 75, .ofs_x = 1, .ofs_y = -16},
+    {.bitmap_index = 18640, .adv_w = 768, .box_w = 38, .box_h = 34, .ofs_x = 5, .ofs_y = 11},
+    {.bitmap_index = 18802, .adv_w = 640, .box_w = 40, .box_h = 7, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 18837, .adv_w = 768, .box_w = 24, .box_h = 12, .ofs_x = 7, .ofs_y = 49},
+    {.bitmap_index = 18873, .adv_w = 790, .box_w = 41, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 19104, .adv_w = 883, .box_w = 47, .box_h = 61, .ofs_x = 6, .ofs_y = -1},
+    {.bitmap_index = 19463, .adv_w = 756, .box_w = 44, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 19711, .adv_w = 886, .box_w = 47, .box_h = 61, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 20070, .adv_w = 808, .box_w = 46, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 20329, .adv_w = 495, .box_w = 33, .box_h = 60, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20577, .adv_w = 896, .box_w = 48, .box_h = 61, .ofs_x = 3, .ofs_y = -17},
+    {.bitmap_index = 20943, .adv_w = 884, .box_w = 44, .box_h = 60, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 21273, .adv_w = 385, .box_w = 16, .box_h = 63, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 21399, .adv_w = 393, .box_w = 28, .box_h = 80, .ofs_x = -7, .ofs_y = -17},
+    {.bitmap_index = 21679, .adv_w = 838, .box_w = 48, .box_h = 60, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 22039, .adv_w = 385, .box_w = 13, .box_h = 60, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 22137, .adv_w = 1343, .box_w = 73, .box_h = 44, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 22539, .adv_w = 884, .box_w = 44, .box_h = 44, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 22781, .adv_w = 838, .box_w = 47, .box_h = 45, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 23046, .adv_w = 883, .box_w = 47, .box_h = 60, .ofs_x = 6, .ofs_y = -16},
+    {.bitmap_index = 23399, .adv_w = 883, .box_w = 47, .box_h = 60, .ofs_x = 3, .ofs_y = -16},
+    {.bitmap_index = 23752, .adv_w = 552, .box_w = 27, .box_h = 44, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 23901, .adv_w = 680, .box_w = 39, .box_h = 45, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 24121, .adv_w = 557, .box_w = 33, .box_h = 54, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 24344, .adv_w = 879, .box_w = 44, .box_h = 44, .ofs_x = 6, .ofs_y = -1},
+    {.bitmap_index = 24586, .adv_w = 765, .box_w = 49, .box_h = 43, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 24850, .adv_w = 1199, .box_w = 75, .box_h = 43, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25254, .adv_w = 762, .box_w = 47, .box_h = 43, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25507, .adv_w = 765, .box_w = 49, .box_h = 60, .ofs_x = -1, .ofs_y = -17},
+    {.bitmap_index = 25875, .adv_w = 695, .box_w = 38, .box_h = 43, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 26080, .adv_w = 500, .box_w = 26, .box_h = 75, .ofs_x = 4, .ofs_y = -16},
+    {.bitmap_index = 26324, .adv_w = 396, .box_w = 11, .box_h = 75, .ofs_x = 7, .ofs_y = -16},
+    {.bitmap_index = 26428, .adv_w = 500, .box_w = 27, .box_h = 75, .ofs_x = 1, .ofs_y = -16},
+    {.bitmap_index = 26682, .adv_w = 767, .box_w = 40, .box_h = 16, .ofs_x = 4, .ofs_y = 20}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t montserrat_bold_80_cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+#if LVGL_VERSION_MAJOR >= 8
+static const lv_font_fmt_txt_dsc_t montserrat_bold_80_font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t montserrat_bold_80_font_dsc = {
+#endif
+    .glyph_bitmap = montserrat_bold_80_glyph_bitmap,
+    .glyph_dsc = montserrat_bold_80_glyph_dsc,
+    .cmaps = montserrat_bold_80_cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 1,
+    .bpp = 1,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+
+};
+
+extern const lv_font_t lv_font_montserrat_48;
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t montserrat_bold_80 = {
+#else
+lv_font_t montserrat_bold_80 = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 85,          /*The maximum line height required by the font*/
+    .base_line = 17,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -8,
+    .underline_thickness = 4,
+#endif
+    // .static_bitmap = 0,
+    .dsc = &montserrat_bold_80_font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = &lv_font_montserrat_48,
+#endif
+    .user_data = NULL,
+};
+
+
+
+#endif /*#if MONTSERRAT_BOLD_80*/
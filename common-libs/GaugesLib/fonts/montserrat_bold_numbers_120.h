@@ -0,0 +1,1068 @@
+/*******************************************************************************
+ * Size: 120 px
+ * Bpp: 1
+ * Opts: --bpp 1 --size 120 --no-compress --stride 1 --align 1 --font Montserrat-Bold.ttf --range 48-57,46 --format lvgl -o montserrat_bold_numbers_120.c
+ ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+
+#ifndef MONTSERRAT_BOLD_NUMBERS_120
+#define MONTSERRAT_BOLD_NUMBERS_120 1
+#endif
+
+#if MONTSERRAT_BOLD_NUMBERS_120
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t mont_120_glyph_bitmap[] = {
+    /* U+002E "." */
+    0x0, 0xfe, 0x0, 0x7, 0xff, 0x0, 0x3f, 0xff,
+    0x80, 0xff, 0xff, 0x83, 0xff, 0xff, 0x8f, 0xff,
+    0xff, 0x9f, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0x7f, 0xff,
+    0xfc, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0x80, 0xff, 0xfe, 0x0, 0x7f, 0xf0, 0x0,
+    0x3f, 0x80, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x1, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
+    0x80, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff,
+    0xff, 0xc0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0xf,
+    0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xc0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0x80,
+    0x0, 0x1, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x1f,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
+    0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf8, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf8, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x7f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x7f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
+    0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfe, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfe, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfe, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x7f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfe, 0x7f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x7f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x7f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
+    0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfe, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xfe, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x1f, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x1f,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
+    0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xc0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xf0,
+    0x0, 0xf, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff,
+    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x3, 0xff,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x80, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+0031 "1" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f,
+    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x7,
+    0xff, 0xff,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
+    0xff, 0xe0, 0x7, 0xff, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x1f,
+    0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0,
+    0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
+    0xf, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0,
+    0x0, 0x7f, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe,
+    0x0, 0x7, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xc0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0,
+
+    /* U+0033 "3" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc,
+    0x6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0x3, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x80, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xe0, 0x7f, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf8, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x3, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff,
+    0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x1f,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc,
+    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xf8, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x1, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
+    0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff,
+    0xfc, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xfe, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
+    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
+    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfe,
+    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff,
+    0xc0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x3,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
+    0xfc, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc,
+    0x6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
+    0x3, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x80, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xe0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf8, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0xf, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0x3, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff,
+    0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x7f, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x3f, 0x80, 0x0, 0x7f, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x38, 0x0, 0x7, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x3f, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
+    0x1, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xfc,
+    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
+    0xe0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xfe, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7f,
+    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3,
+    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x1f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xfd,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfb, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xef, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0xf, 0xff, 0xff, 0x7f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfb, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xfe, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf3, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x3, 0xff, 0xff, 0x9f, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xf8, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0x87, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f,
+    0xff, 0xfc, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xe0, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xc0, 0x0,
+    0x1, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xfe,
+    0x0, 0x3, 0xff, 0xff, 0xfc, 0x3, 0xff, 0xff,
+    0xfe, 0x0, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xcf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x3f, 0xff, 0xfe, 0xf, 0xff, 0xf8, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x7f, 0xff, 0xfc, 0xf, 0xff, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xf8,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0xff, 0xff, 0xf8, 0xf, 0xff,
+    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0x80,
+    0x3f, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xf0,
+    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x7, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xfc, 0x1f,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xc1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xfc, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xf0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x7, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x1f, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x3f, 0xff,
+    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x3,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
+    0x7, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff, 0xff,
+    0xc0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xff,
+    0xff, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x3, 0xff,
+    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
+    0xe0, 0x1, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0xfc, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x3f,
+    0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf1,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xfe, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfb, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf, 0xff, 0xff,
+    0xf0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff,
+    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x0,
+    0x0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff,
+    0xff, 0x80, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x7f,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0x80, 0x0,
+    0x3, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf8, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0x7, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x3f, 0xff, 0xf8,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xe3, 0xff, 0xff,
+    0xc0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x1f, 0xff,
+    0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe7,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xf9, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xcf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfb, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xfe, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0x1, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0x9f, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xbf,
+    0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
+    0xe7, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf8, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xc0,
+    0x3, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xfe,
+    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
+    0xe0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x7, 0xff,
+    0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x3f,
+    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x1,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfc, 0x0, 0x3, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xe0, 0x0, 0x1c, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xfe, 0x0, 0x1, 0xfc, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xfe, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t mont_120_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 503, .box_w = 23, .box_h = 23, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 67, .adv_w = 1304, .box_w = 72, .box_h = 87, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 850, .adv_w = 753, .box_w = 36, .box_h = 84, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1228, .adv_w = 1133, .box_w = 67, .box_h = 86, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1949, .adv_w = 1137, .box_w = 66, .box_h = 86, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2659, .adv_w = 1323, .box_w = 79, .box_h = 85, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3499, .adv_w = 1142, .box_w = 66, .box_h = 86, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4209, .adv_w = 1223, .box_w = 69, .box_h = 88, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 4968, .adv_w = 1190, .box_w = 68, .box_h = 85, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5691, .adv_w = 1267, .box_w = 70, .box_h = 88, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 6461, .adv_w = 1223, .box_w = 69, .box_h = 88, .ofs_x = 2, .ofs_y = -1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint8_t glyph_id_ofs_list_0[] = {
+    0, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t mont_120_cmaps[] =
+{
+    {
+        .range_start = 46, .range_length = 12, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    }
+};
+
+
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+#if LVGL_VERSION_MAJOR >= 8
+static const lv_font_fmt_txt_dsc_t mont_120_font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t mont_120_font_dsc = {
+#endif
+    .glyph_bitmap = mont_120_glyph_bitmap,
+    .glyph_dsc = mont_120_glyph_dsc,
+    .cmaps = mont_120_cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 1,
+    .bpp = 1,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+
+};
+
+extern const lv_font_t lv_font_montserrat_48;
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t montserrat_bold_numbers_120 = {
+#else
+lv_font_t montserrat_bold_numbers_120 = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 88,          /*The maximum line height required by the font*/
+    .base_line = 1,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -12,
+    .underline_thickness = 6,
+#endif
+    // .static_bitmap = 0,
+    .dsc = &mont_120_font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = &lv_font_montserrat_48,
+#endif
+    .user_data = NULL,
+};
+
+
+
+#endif /*#if MONTSERRAT_BOLD_NUMBERS_120*/
@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""
+Generates src/gauges/gauge_geometry.h and src/gauges/gauge_arc_spans.h from
+screen_profiles.json.
+
+Every dimension, the arc scale marker angles / label positions and the font
+choices are emitted as integer constants per screen profile, so nothing is
+scaled with floats or computed with cosf/sinf on the target at init time.
+gauge_arc_spans.h holds the scanline spans and edge coverage of the value arc
+ring, used by the span rasterizer in gauge_common.c.
+
+Add a resolution by adding an entry to "profiles" in screen_profiles.json and
+re-running this script:
+
+    python3 scripts/gen_gauge_geometry.py
+"""
+import json
+import math
+import os
+import struct
+
+LIB_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+PROFILES_PATH = os.path.join(LIB_DIR, "screen_profiles.json")
+OUTPUT_PATH = os.path.join(LIB_DIR, "src", "gauges", "gauge_geometry.h")
+SPANS_PATH = os.path.join(LIB_DIR, "src", "gauges", "gauge_arc_spans.h")
+
+
+def f32(value):
+    """Round to single precision, as the former GAUGE_SCALE float macros did."""
+    return struct.unpack("f", struct.pack("f", value))[0]
+
+
+def scaled(base, scale):
+    """Same result as the former ((int)(base * GAUGE_SCALE)) macros."""
+    return int(f32(f32(float(base)) * f32(scale)))
+
+
+def pick_font(catalog, role, target_size):
+    """Nearest catalog font allowed for the role (ties go to the smaller font)."""
+    candidates = [(abs(info["size"] - target_size), info["size"], name)
+                  for name, info in catalog.items()
+                  if not name.startswith("_") and role in info["roles"]]
+    if not candidates:
+        raise SystemExit(f"No font in the catalog can be used as '{role}'")
+    return min(candidates)[2]
+
+
+def marker_points(start_angle, sweep, max_markers, radius):
+    """
+    Tick angle and label center (relative to the scale center) of every marker,
+    for every marker spacing from 1 to max_markers - 1 segments.
+    Entries for N segments start at index (N - 1) * (N + 2) / 2.
+    """
+    points = []
+    for segments in range(1, max_markers):
+        gap = f32(float(sweep) / segments)
+        for i in range(segments + 1):
+            angle = f32(start_angle + f32(i * gap))
+            rad = f32(f32(angle * f32(3.14159)) / 180.0)
+            x = int(f32(radius * math.cos(rad)))
+            y = int(f32(radius * math.sin(rad)))
+            points.append((int(angle) % 360, x, y))
+    return points
+
+
+def ring_spans(radius, width):
+    """
+    Scanline spans of a ring of outer radius `radius` centered between four
+    pixels, for one quadrant (the others are mirrors).
+
+    Row k and column c are the pixel whose center is (c + 0.5, k + 0.5) from the
+    ring center. Each row gives {lo, s0, s1, hi, aa}: columns lo..hi-1 are
+    covered, s0..s1-1 fully; the coverage of lo..s0-1 then s1..hi-1 is stored
+    from alpha[aa]. Coverage is clamp(radius + 0.5 - d) at the outer edge and
+    clamp(d - inner + 0.5) at the inner edge, d being the pixel center distance.
+    """
+    inner = radius - width
+    rows, alpha = [], []
+    for k in range(radius):
+        y = k + 0.5
+        cover = []
+        for c in range(radius):
+            d = math.hypot(c + 0.5, y)
+            a = min(1.0, max(0.0, radius + 0.5 - d), max(0.0, d - inner + 0.5))
+            cover.append(int(a * 255 + 0.5))
+        covered = [c for c, a in enumerate(cover) if a > 0]
+        if not covered:
+            rows.append((0, 0, 0, 0, len(alpha)))
+            continue
+        lo, hi = covered[0], covered[-1] + 1
+        full = [c for c in range(lo, hi) if cover[c] == 255]
+        s0, s1 = (full[0], full[-1] + 1) if full else (hi, hi)
+        rows.append((lo, s0, s1, hi, len(alpha)))
+        alpha += cover[lo:s0] + cover[s1:hi]
+    return rows, alpha
+
+
+def emit_spans(out, config, profile):
+    res = profile["resolution"]
+    scale = profile.get("scale", res / config["base_resolution"])
+    line_width = scaled(config["dimensions"]["LINE_WIDTH"], scale)
+    arc_width = scaled(config["dimensions"]["ARC_WIDTH"], scale)
+    arc_size = res - line_width * 12
+    if arc_size % 2 or arc_size // 2 > 255:
+        raise SystemExit(f"Profile {res}: the span table needs an even ARC_SIZE of at most 510 px")
+
+    radius = arc_size // 2
+    rows, alpha = ring_spans(radius, arc_width)
+    max_aa = max(max(s0 - lo, hi - s1) for lo, s0, s1, hi, _ in rows)
+
+    out.append(f"    // {len(rows)} rows x 6 B + {len(alpha)} B of edge coverage")
+    out.append(f"    #define GAUGE_ARC_SPAN_RADIUS {radius}")
+    out.append(f"    #define GAUGE_ARC_SPAN_WIDTH {arc_width}")
+    out.append(f"    #define GAUGE_ARC_SPAN_MAX_AA {max_aa}")
+    out.append("    #define GAUGE_ARC_SPAN_ROWS { \\")
+    for i in range(0, len(rows), 6):
+        out.append("        " + ", ".join("{%d, %d, %d, %d, %d}" % row for row in rows[i:i + 6]) + ", \\")
+    out.append("    }")
+    out.append("    #define GAUGE_ARC_SPAN_ALPHA { \\")
+    for i in range(0, len(alpha), 16):
+        out.append("        " + ", ".join(str(a) for a in alpha[i:i + 16]) + ", \\")
+    out.append("    }")
+
+
+def emit_profile(out, config, profile):
+    res = profile["resolution"]
+    scale = profile.get("scale", res / config["base_resolution"])
+    catalog = config["fonts"]
+    roles = {k: v for k, v in config["font_roles"].items() if not k.startswith("_")}
+    dims = {k: v for k, v in config["dimensions"].items() if not k.startswith("_")}
+
+    fonts = dict(profile.get("fonts", {}))
+    for role, (_, base_size) in roles.items():
+        if role not in fonts:
+            fonts[role] = pick_font(catalog, role, base_size * scale)
+    for role, name in fonts.items():
+        if name not in catalog:
+            raise SystemExit(f"Profile {res}: unknown font '{name}'")
+
+    values = {name: scaled(base, scale) for name, base in dims.items()}
+
+    # Derived exactly like gauges_config.h does, so gauge_common.c can check the table
+    arc_size = res - values["LINE_WIDTH"] * 12
+    label_radius = arc_size // 2 - values["ARC_WIDTH"] - values["MARKER_LABEL_OFFSET"]
+
+    out.append(f"    // {profile.get('comment', f'{res}px')} - scale {scale:.4f}")
+    out.append(f"    #define LCD_RES {res}")
+    out.append("")
+
+    # Fonts
+    out.append("    // Fonts")
+    for name in sorted(set(fonts.values())):
+        out.append(f"    extern const lv_font_t {name};")
+    for role, (macro, base_size) in roles.items():
+        name = fonts[role]
+        # Custom fonts may come from the font partition (GAUGE_FONT_PARTITION), see gauges_config.h
+        ref = f"GAUGE_CUSTOM_FONT({name})" if "header" in catalog[name] else f"&{name}"
+        out.append(f"    #define {macro:<28} {ref:<47}// {catalog[name]['size']}px (target {base_size * scale:.0f}px)")
+    for name in sorted(set(fonts.values())):
+        if "header" in catalog[name]:
+            out.append(f"    #define GAUGE_FONT_{name.upper()} 1")
+    out.append(f"    #define USE_CUSTOM_ICON_FONT {1 if 'header' in catalog[fonts['icon']] else 0}")
+    out.append("")
+
+    # Dimensions
+    out.append("    // Dimensions (px)")
+    for name, base in dims.items():
+        out.append(f"    #define {name:<32} {values[name]:>4}   // base {base}")
+    out.append("")
+
+    # Arc scale markers
+    points = marker_points(config["arc_start_angle"], config["arc_sweep"],
+                           config["max_markers"], label_radius)
+    out.append("    // Arc scale markers: {angle, label x, label y} for 1..N-1 segments")
+    out.append(f"    #define GAUGE_MARKER_LABEL_RADIUS {label_radius}")
+    out.append("    #define GAUGE_MARKER_POINTS { \\")
+    for segments in range(1, config["max_markers"]):
+        first = (segments - 1) * (segments + 2) // 2
+        row = ", ".join(f"{{{a}, {x}, {y}}}" for a, x, y in points[first:first + segments + 1])
+        out.append(f"        {row}, \\")
+    out.append("    }")
+
+
+def main():
+    with open(PROFILES_PATH, "r") as f:
+        config = json.load(f)
+
+    out = [
+        "// Generated by scripts/gen_gauge_geometry.py from screen_profiles.json - DO NOT EDIT",
+        "#ifndef GAUGE_GEOMETRY_H",
+        "#define GAUGE_GEOMETRY_H",
+        "",
+        "#include \"lvgl.h\"",
+        "",
+        f"#define GAUGE_GEOMETRY_MAX_MARKERS {config['max_markers']}",
+        "",
+        "// Index of the first GAUGE_MARKER_POINTS entry for a scale split in n segments",
+        "#define GAUGE_MARKER_INDEX(n) (((n) - 1) * ((n) + 2) / 2)",
+        "",
+    ]
+
+    resolutions = []
+    for i, profile in enumerate(config["profiles"]):
+        res = profile["resolution"]
+        resolutions.append(str(res))
+        out.append(f"#{'if' if i == 0 else 'elif'} GAUGE_SCREEN_RES == {res}")
+        emit_profile(out, config, profile)
+        out.append("")
+
+    out.append("#else")
+    out.append(f"    #error \"No geometry for GAUGE_SCREEN_RES (available: {', '.join(resolutions)}). "
+               "Add it to screen_profiles.json and run scripts/gen_gauge_geometry.py\"")
+    out.append("#endif")
+    out.append("")
+    out.append("#endif // GAUGE_GEOMETRY_H")
+
+    with open(OUTPUT_PATH, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print(f"Wrote {os.path.relpath(OUTPUT_PATH, LIB_DIR)} ({', '.join(resolutions)} px)")
+
+    spans = [
+        "// Generated by scripts/gen_gauge_geometry.py from screen_profiles.json - DO NOT EDIT",
+        "// Value arc ring scanlines for the span rasterizer (gauge_common.c), one quadrant",
+        "#ifndef GAUGE_ARC_SPANS_H",
+        "#define GAUGE_ARC_SPANS_H",
+        "",
+    ]
+    for i, profile in enumerate(config["profiles"]):
+        spans.append(f"#{'if' if i == 0 else 'elif'} GAUGE_SCREEN_RES == {profile['resolution']}")
+        emit_spans(spans, config, profile)
+        spans.append("")
+    spans.append("#endif")
+    spans.append("")
+    spans.append("#endif // GAUGE_ARC_SPANS_H")
+
+    with open(SPANS_PATH, "w") as f:
+        f.write("\n".join(spans) + "\n")
+    print(f"Wrote {os.path.relpath(SPANS_PATH, LIB_DIR)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""
+Packs the custom fonts of src/fonts into one binary image for the "fonts" flash
+partition (GAUGE_FONT_PARTITION = 1). The firmware maps the partition and uses
+the glyph data in place, see src/gauges/gauge_fonts.h for the format.
+
+    python3 scripts/pack_fonts.py fonts.bin              # every custom font
+    python3 scripts/pack_fonts.py fonts.bin --res 240    # fonts of one screen profile
+
+The PlatformIO script scripts/pio_fonts.py builds the pack for environments with
+GAUGE_FONT_PARTITION = 1 and adds it to the upload. Flash only the pack with:
+
+    pio run -e <env> -t upload_fonts
+
+Font fallbacks (.fallback = &lv_font_...) are pointers into the firmware and
+are not carried by the pack.
+"""
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import subset_fonts  # noqa: E402
+
+MAGIC = 0x544E4647  # "GFNT"
+VERSION = 1
+NAME_LEN = 32
+MAX_CMAPS = 4       # GAUGE_FONTS_MAX_CMAPS
+
+PACK_HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct(f"<{NAME_LEN}sI")
+CMAP = struct.Struct("<IHHHBBII")
+FONT_HEADER = struct.Struct("<hhbbBBIIII")
+GLYPH_DSC = struct.Struct("<IBBbb")
+
+CMAP_FORMAT0_TINY = 2
+CMAP_SPARSE_FULL = 1
+CMAP_SPARSE_TINY = 3
+
+
+def align4(blob):
+    blob += b"\0" * (-len(blob) % 4)
+    return blob
+
+
+def font_metrics(text, path):
+    def field(name):
+        match = re.search(r"\.%s = (-?\d+)" % name, text)
+        if not match:
+            raise SystemExit(f"{path}: missing .{name}")
+        return int(match.group(1))
+    return {name: field(name) for name in ("line_height", "base_line", "underline_position",
+                                           "underline_thickness", "bpp")}
+
+
+def font_name(text, path):
+    match = re.search(r"^(?:const )?lv_font_t (\w+) = \{", text, re.M)
+    if not match:
+        raise SystemExit(f"{path}: no lv_font_t definition")
+    if len(match.group(1)) >= NAME_LEN:
+        raise SystemExit(f"{path}: font name longer than {NAME_LEN - 1} characters")
+    return match.group(1)
+
+
+def pack_font(text, path, base):
+    """Font header, cmaps and data of one font placed at pack offset `base`."""
+    _, glyphs, _ = subset_fonts.parse_font(text, path)
+    metrics = font_metrics(text, path)
+    codepoints = sorted(glyphs)
+    gid = {cp: n + 1 for n, cp in enumerate(codepoints)}
+
+    runs, sparse = subset_fonts.cmap_groups(codepoints)
+    cmap_count = len(runs) + (1 if sparse else 0)
+    if not 0 < cmap_count <= MAX_CMAPS:
+        raise SystemExit(f"{path}: {cmap_count} character maps, the loader takes 1 to {MAX_CMAPS}")
+
+    # Data blocks follow the header and the cmaps; offsets are absolute in the pack
+    data = bytearray()
+    data_start = base + FONT_HEADER.size + cmap_count * CMAP.size
+
+    glyph_dsc_offset = data_start + len(data)
+    data += GLYPH_DSC.pack(0, 0, 0, 0, 0)
+    bitmap = bytearray()
+    for cp in codepoints:
+        dsc, pixels = glyphs[cp]
+        if len(bitmap) >= 1 << 20 or dsc["adv_w"] >= 1 << 12:
+            raise SystemExit(f"{path}: glyph U+{cp:04X} needs LV_FONT_FMT_TXT_LARGE")
+        data += GLYPH_DSC.pack(len(bitmap) | dsc["adv_w"] << 20, dsc["box_w"], dsc["box_h"],
+                               dsc["ofs_x"], dsc["ofs_y"])
+        bitmap += bytes(pixels)
+    align4(data)
+
+    cmaps = [CMAP.pack(run[0], len(run), gid[run[0]], 0, CMAP_FORMAT0_TINY, 0, 0, 0) for run in runs]
+    if sparse:
+        if sparse[-1] - sparse[0] >= 0x10000:
+            raise SystemExit(f"{path}: sparse glyphs span more than 64K codepoints")
+        unicode_list_offset = data_start + len(data)
+        data += struct.pack(f"<{len(sparse)}H", *[cp - sparse[0] for cp in sparse])
+        align4(data)
+        offsets = [gid[cp] - gid[sparse[0]] for cp in sparse]
+        if offsets == list(range(len(sparse))):
+            kind, ofs_list_offset = CMAP_SPARSE_TINY, 0
+        else:
+            kind, ofs_list_offset = CMAP_SPARSE_FULL, data_start + len(data)
+            data += struct.pack(f"<{len(offsets)}H", *offsets)
+            align4(data)
+        cmaps.append(CMAP.pack(sparse[0], sparse[-1] - sparse[0] + 1, gid[sparse[0]], len(sparse), kind, 0,
+                               unicode_list_offset, ofs_list_offset))
+
+    bitmap_offset = data_start + len(data)
+    data += bitmap
+    align4(data)
+
+    header = FONT_HEADER.pack(metrics["line_height"], metrics["base_line"], metrics["underline_position"],
+                              metrics["underline_thickness"], metrics["bpp"], cmap_count,
+                              len(codepoints) + 1, glyph_dsc_offset, bitmap_offset, len(bitmap))
+    return header + b"".join(cmaps) + bytes(data)
+
+
+def profile_fonts(resolution):
+    """Custom fonts compiled in by a screen profile (GAUGE_FONT_<NAME> 1 in gauge_geometry.h)."""
+    with open(os.path.join(subset_fonts.GAUGES_DIR, "gauge_geometry.h")) as f:
+        geometry = f.read()
+    match = re.search(r"#(?:el)?if GAUGE_SCREEN_RES == %d\n(.*?)\n#(?:elif|else)" % resolution, geometry, re.S)
+    if not match:
+        raise SystemExit(f"pack_fonts.py: no {resolution}px profile in gauge_geometry.h")
+    return {name.lower() for name in re.findall(r"#define GAUGE_FONT_(\w+) 1", match.group(1))}
+
+
+def build(out_path, resolution=None):
+    """Write the pack, return {font name: bytes} of the fonts it holds."""
+    wanted = profile_fonts(resolution) if resolution else None
+    fonts = []
+    for path in sorted(glob.glob(os.path.join(subset_fonts.OUTPUT_DIR, "*.h"))):
+        if wanted is not None and os.path.splitext(os.path.basename(path))[0] not in wanted:
+            continue
+        with open(path) as f:
+            text = f.read()
+        fonts.append((font_name(text, path), text, path))
+
+    offset = PACK_HEADER.size + len(fonts) * ENTRY.size
+    entries, blobs, sizes = [], [], {}
+    for name, text, path in fonts:
+        blob = pack_font(text, path, offset)
+        entries.append(ENTRY.pack(name.encode(), offset))
+        blobs.append(blob)
+        sizes[name] = len(blob)
+        offset += len(blob)
+
+    pack = PACK_HEADER.pack(MAGIC, VERSION, len(fonts), offset, 0) + b"".join(entries) + b"".join(blobs)
+    if not os.path.exists(out_path) or open(out_path, "rb").read() != pack:
+        with open(out_path, "wb") as f:
+            f.write(pack)
+    return sizes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("output", help="pack file to write")
+    parser.add_argument("--res", type=int, help="only the fonts of this screen profile")
+    args = parser.parse_args()
+
+    sizes = build(args.output, args.res)
+    for name, size in sizes.items():
+        print(f"  {name:<32} {size:>8} B")
+    print(f"{args.output}: {len(sizes)} fonts, {os.path.getsize(args.output)} B")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""
+Packs a JSON gauge layout into the binary layout pack read by the firmware
+(src/gauges/gauge_layout.h for the format). The pack goes either to the
+"layouts" data partition (GAUGE_LAYOUT_PARTITION = 1) or to
+gauge_manager_load_layout() at runtime.
+
+    python3 scripts/pack_layout.py layouts/mx5_nc.json layout.bin
+    esptool.py write_flash <offset of the "layouts" partition> layout.bin
+
+Reflashing the partition changes the gauges without rebuilding the firmware.
+
+JSON description: {"screens": [{"elements": [element, ...]}, ...]}, up to
+GAUGE_LAYOUT_MAX_SCREENS screens of up to GAUGE_LAYOUT_MAX_ELEMENTS elements.
+Element fields:
+
+    channel          oil_temp | water_temp | oil_pressure | rpm
+    style            arc | needle | bar | digital
+    decimals         digits after the point (0-2), default 0
+    min, max         range, in channel units
+    zones            [green, orange, red] thresholds, in channel units
+    alert            arc, needle: background blinks at or above (default: off)
+    redline          arc: start of the redline indicator (default: red zone)
+    marker_interval  arc: step of the labelled markers, in channel units
+    ticks            needle: labelled major ticks, falling on the minor ticks
+    x, y             bar, digital: center offset from the screen center, per mille
+    width, height    bar: size, per mille; digital: height picks the readout font
+
+Positions and sizes are per mille of the screen size, so one pack fits every
+screen profile.
+"""
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x59414C47  # "GLAY"
+VERSION = 1
+MAX_SCREENS = 4     # GAUGE_LAYOUT_MAX_SCREENS
+MAX_MARKERS = 12    # GAUGE_SCALE_MAX_MARKERS (gauge_geometry.h)
+NEEDLE_MINOR_TICK_MULTIPLIER = 2    # gauges_config.h
+NEEDLE_MINOR_TICK_DIVISOR = 10
+MAX_ELEMENTS = 6    # GAUGE_LAYOUT_MAX_ELEMENTS
+
+HEADER = struct.Struct("<IHHII")
+SCREEN = struct.Struct("<B3x")
+ELEMENT = struct.Struct("<BBBB12h")
+
+CHANNELS = ["oil_temp", "water_temp", "oil_pressure", "rpm"]   # gauge_channel_t
+STYLES = ["arc", "needle", "bar", "digital"]                     # gauge_layout_style_t
+INT16_MAX = 0x7FFF
+
+
+def fail(where, message):
+    raise SystemExit(f"pack_layout.py: {where}: {message}")
+
+
+def pack_element(el, where):
+    def choice(name, values):
+        if el.get(name) not in values:
+            fail(where, f"{name} must be one of {', '.join(values)}")
+        return values.index(el[name])
+
+    channel = choice("channel", CHANNELS)
+    style = choice("style", STYLES)
+    decimals = el.get("decimals", 0)
+    if decimals not in (0, 1, 2):
+        fail(where, "decimals must be 0, 1 or 2")
+
+    def fixed(name, value):
+        if value is None:
+            fail(where, f"missing {name}")
+        scaled = round(value * 10 ** decimals)
+        if not -INT16_MAX <= scaled <= INT16_MAX:
+            fail(where, f"{name} = {value} does not fit 16 bits with {decimals} decimals")
+        return scaled
+
+    def permille(name, default=0):
+        value = el.get(name, default)
+        if not -1000 <= value <= 1000:
+            fail(where, f"{name} is per mille of the screen, -1000 to 1000")
+        return value
+
+    zones = el.get("zones")
+    if not isinstance(zones, list) or len(zones) != 3:
+        fail(where, "zones must be [green, orange, red]")
+    zone_green, zone_orange, zone_red = (fixed("zones", value) for value in zones)
+    lo, hi = fixed("min", el.get("min")), fixed("max", el.get("max"))
+    if hi <= lo:
+        fail(where, "max must be above min")
+    if not lo <= zone_green <= zone_orange <= zone_red <= hi:
+        fail(where, "zones must be in order and between min and max")
+
+    ticks = el.get("ticks", 0)
+    if style == STYLES.index("needle"):
+        if not 2 <= ticks <= 255:
+            fail(where, "a needle needs 2 to 255 ticks")
+        if el["min"] != int(el["min"]) or el["max"] != int(el["max"]):
+            fail(where, "a needle scale starts and ends on whole units")
+        units = int(el["max"]) - int(el["min"])
+        minor = units * NEEDLE_MINOR_TICK_MULTIPLIER if decimals else units // NEEDLE_MINOR_TICK_DIVISOR
+        if minor < ticks - 1 or minor % (ticks - 1):
+            fail(where, f"{ticks} labelled ticks do not fall on the {minor + 1} minor ticks")
+    marker_interval = fixed("marker_interval", el.get("marker_interval", 0))
+    redline = fixed("redline", el.get("redline", zones[2]))
+    if style == STYLES.index("arc"):
+        if marker_interval <= 0:
+            fail(where, "an arc needs a marker_interval")
+        if (hi - lo) // marker_interval + 1 > MAX_MARKERS:
+            fail(where, f"more than {MAX_MARKERS} markers, use a larger marker_interval")
+        if not lo <= redline <= hi:
+            fail(where, "redline must be between min and max")
+    x, y = permille("x"), permille("y")
+    width, height = permille("width"), permille("height")
+    if style == STYLES.index("bar") and (width <= 0 or height <= 0):
+        fail(where, "a bar needs a width and a height")
+    if style in (STYLES.index("bar"), STYLES.index("digital")):
+        size_x = width if style == STYLES.index("bar") else 0
+        if width < 0 or height < 0 or 2 * abs(x) + size_x > 1000 or 2 * abs(y) + height > 1000:
+            fail(where, "does not fit on the screen")
+
+    alert = fixed("alert", el["alert"]) if "alert" in el else INT16_MAX
+
+    return ELEMENT.pack(channel, style, decimals, ticks,
+                        x, y, width, height,
+                        lo, hi, zone_green, zone_orange, zone_red,
+                        alert, redline, marker_interval)
+
+
+def build(layout):
+    screens = layout.get("screens", [])
+    if not 0 < len(screens) <= MAX_SCREENS:
+        raise SystemExit(f"pack_layout.py: 1 to {MAX_SCREENS} screens expected")
+
+    body = bytearray()
+    for s, screen in enumerate(screens):
+        elements = screen.get("elements", [])
+        if not 0 < len(elements) <= MAX_ELEMENTS:
+            fail(f"screen {s + 1}", f"1 to {MAX_ELEMENTS} elements expected")
+        if sum(el.get("style") in ("arc", "needle") for el in elements) > 1:
+            fail(f"screen {s + 1}", "at most one arc or needle per screen")
+        body += SCREEN.pack(len(elements))
+        for e, el in enumerate(elements):
+            body += pack_element(el, f"screen {s + 1}, element {e + 1}")
+
+    return HEADER.pack(MAGIC, VERSION, len(screens), HEADER.size + len(body), 0) + bytes(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("layout", help="JSON layout description")
+    parser.add_argument("output", help="pack file to write")
+    args = parser.parse_args()
+
+    with open(args.layout) as f:
+        pack = build(json.load(f))
+    with open(args.output, "wb") as f:
+        f.write(pack)
+    print(f"{args.output}: {pack[6]} screens, {len(pack)} B")
+
+
+if __name__ == "__main__":
+    sys.exit(main())
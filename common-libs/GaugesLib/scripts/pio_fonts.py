@@ -0,0 +1,225 @@
+"""
+PlatformIO pre-build script: font subsets, per-environment font enables and a
+font size report.
+
+    extra_scripts = pre:../common-libs/GaugesLib/scripts/pio_fonts.py
+
+Before the build:
+  - regenerates the custom font subsets in src/fonts (scripts/subset_fonts.py);
+  - finds the LVGL built-in fonts the environment actually references: the
+    fonts of its screen profile in gauge_geometry.h, the fallbacks of the custom
+    fonts that profile uses, and any lv_font_* reference in the gauge library,
+    the project sources and lv_conf.h (LV_FONT_DEFAULT);
+  - defines GAUGE_FONT_ENABLES and LV_FONT_<NAME>=1 for exactly those fonts.
+    lv_conf.h skips its own enable list when GAUGE_FONT_ENABLES is set.
+
+With GAUGE_FONT_PARTITION=1 in build_flags, the custom fonts are not compiled
+in: the profile's fonts are packed into <build dir>/fonts.bin
+(scripts/pack_fonts.py), which is flashed with the firmware at the offset of
+the "fonts" partition of board_build.partitions. `pio run -t upload_fonts`
+flashes only the pack, to swap fonts without reflashing the application.
+A board flashed with another partition table needs one full `pio run -t upload`
+first (partition table, application and pack); the option is off by default
+(esp-tft-128-2424S01c: env tft_128_esp32-c3_fonts).
+
+After the firmware image is built, prints the font data and image sizes and
+writes them to <build dir>/font_report.txt.
+
+Set `custom_font_subset = no` in an environment to keep the full lv_conf.h
+font list (e.g. to compare both reports).
+"""
+Import("env")  # noqa: F821 - provided by PlatformIO
+
+import glob
+import os
+import re
+import subprocess
+import sys
+
+# Built-in LVGL fonts, by symbol name (lv_font_montserrat_14 -> LV_FONT_MONTSERRAT_14)
+BUILTIN_FONT_RE = re.compile(r"\blv_font_(montserrat_\d+(?:_subpx|_compressed)?|simsun_16_cjk|"
+                             r"unscii_(?:8|16)|dejavu_16_persian_hebrew)\b")
+DEFAULT_RESOLUTION = 466  # Same default as gauges_config.h
+
+
+def find_lib_dir():
+    project_dir = env.subst("$PROJECT_DIR")
+    for extra in env.GetProjectOption("lib_extra_dirs", []):
+        candidate = os.path.join(project_dir, env.subst(extra).strip(), "GaugesLib")
+        if os.path.isdir(os.path.join(candidate, "scripts")):
+            return os.path.normpath(candidate)
+    sys.exit("pio_fonts.py: GaugesLib not found in lib_extra_dirs")
+
+
+LIB_DIR = find_lib_dir()
+sys.path.insert(0, os.path.join(LIB_DIR, "scripts"))
+import pack_fonts  # noqa: E402
+import subset_fonts  # noqa: E402
+
+
+def strip_comments(source):
+    return re.sub(r"/\*.*?\*/|//[^\n]*", "", source, flags=re.S)
+
+
+def read(path):
+    with open(path, "r", errors="replace") as f:
+        return f.read()
+
+
+def build_defines():
+    defines = {}
+    for define in env.ParseFlags(env.get("BUILD_FLAGS", [])).get("CPPDEFINES", []):
+        name, value = (define if isinstance(define, (list, tuple)) else (define, None))[:2]
+        defines[name] = value
+    return defines
+
+
+def screen_resolution():
+    """GAUGE_SCREEN_RES of this environment, resolved like gauges_config.h does."""
+    defines = build_defines()
+    if "GAUGE_SCREEN_RES" in defines:
+        return int(defines["GAUGE_SCREEN_RES"])
+    if "USE_SCREEN_240PX" in defines:
+        return 240
+    return DEFAULT_RESOLUTION
+
+
+def profile_block(resolution):
+    geometry = read(os.path.join(LIB_DIR, "src", "gauges", "gauge_geometry.h"))
+    match = re.search(r"#(?:el)?if GAUGE_SCREEN_RES == %d\n(.*?)\n#(?:elif|else)" % resolution, geometry, re.S)
+    if not match:
+        sys.exit(f"pio_fonts.py: no {resolution}px profile in gauge_geometry.h")
+    return match.group(1)
+
+
+def used_builtin_fonts(resolution):
+    """Built-in fonts referenced by this environment -> set of names (montserrat_14, ...)."""
+    block = profile_block(resolution)
+    fonts = set(BUILTIN_FONT_RE.findall(block))
+
+    # Fallbacks of the custom fonts the profile compiles in
+    for custom in re.findall(r"#define GAUGE_FONT_(\w+) 1", block):
+        path = os.path.join(LIB_DIR, "src", "fonts", custom.lower() + ".h")
+        if os.path.exists(path):
+            fonts |= set(BUILTIN_FONT_RE.findall(strip_comments(read(path))))
+
+    # Direct references everywhere else (the geometry table holds every profile, skip it)
+    project_dir = env.subst("$PROJECT_DIR")
+    sources = glob.glob(os.path.join(LIB_DIR, "src", "gauges", "*.[ch]"))
+    sources += glob.glob(os.path.join(project_dir, "src", "**", "*.[ch]*"), recursive=True)
+    sources += glob.glob(os.path.join(project_dir, "include", "*.h"))
+    for path in sources:
+        if os.path.basename(path) != "gauge_geometry.h":
+            fonts |= set(BUILTIN_FONT_RE.findall(strip_comments(read(path))))
+    return fonts
+
+
+def fonts_partition_offset():
+    """Offset of the "fonts" partition in board_build.partitions, None if it has none."""
+    table = env.GetProjectOption("board_build.partitions", "")
+    path = os.path.join(env.subst("$PROJECT_DIR"), table)
+    if not table or not os.path.exists(path):
+        return None
+    for line in read(path).splitlines():
+        fields = [f.strip() for f in line.split("#")[0].split(",")]
+        if len(fields) >= 4 and fields[0] == "fonts":
+            return fields[3]
+    return None
+
+
+def font_sort_key(name):
+    size = re.search(r"\d+", name)
+    return (name.split("_")[0], int(size.group(0)) if size else 0, name)
+
+
+# ============================================================================
+# PRE-BUILD
+# ============================================================================
+
+subset_enabled = env.GetProjectOption("custom_font_subset", "yes").strip().lower() not in ("no", "0", "false")
+resolution = screen_resolution()
+
+subset_fonts.generate(verbose=False)
+
+if subset_enabled:
+    builtin_fonts = sorted(used_builtin_fonts(resolution), key=font_sort_key)
+    env.Append(CPPDEFINES=["GAUGE_FONT_ENABLES"] + [("LV_FONT_" + name.upper(), 1) for name in builtin_fonts])
+    enabled_text = ", ".join(builtin_fonts)
+else:
+    enabled_text = "all (lv_conf.h list, custom_font_subset = no)"
+print(f"Fonts [{env.subst('$PIOENV')}, {resolution}px]: built-in fonts enabled: {enabled_text}")
+
+# Font pack for the "fonts" partition
+pack_path = None
+if build_defines().get("GAUGE_FONT_PARTITION", "0") not in (None, "0"):
+    pack_offset = fonts_partition_offset()
+    if pack_offset is None:
+        sys.exit("pio_fonts.py: GAUGE_FONT_PARTITION needs a \"fonts\" partition in board_build.partitions")
+    os.makedirs(env.subst("$BUILD_DIR"), exist_ok=True)
+    pack_path = os.path.join(env.subst("$BUILD_DIR"), "fonts.bin")
+    pack_sizes = pack_fonts.build(pack_path, resolution)
+    print(f"Fonts [{env.subst('$PIOENV')}]: font pack {', '.join(pack_sizes)} -> {pack_offset}")
+
+    env.Append(FLASH_EXTRA_IMAGES=[(pack_offset, pack_path)])
+    env.AddCustomTarget(
+        name="upload_fonts",
+        dependencies=None,
+        actions=[
+            env.VerboseAction(env.AutodetectUploadPort, "Looking for upload port..."),
+            '"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED '
+            f'write_flash {pack_offset} "{pack_path}"',
+        ],
+        title="Upload fonts",
+        description="Flash only the font pack to the \"fonts\" partition",
+    )
+
+
+# ============================================================================
+# SIZE REPORT
+# ============================================================================
+
+# Font data symbols: the public font objects and the arrays of lv_font_conv output
+FONT_SYMBOL_RE = re.compile(r"^(lv_font_\w+|fa_icons_\d+|montserrat_bold_\w+|\w*glyph_bitmap|\w*glyph_dsc|"
+                            r"\w*cmaps|\w*unicode_list_\d+|\w*glyph_id_ofs_list_\d+|\w*kern_\w+|\w*font_dsc)$")
+
+
+def font_report(target, source, env):
+    build_dir = env.subst("$BUILD_DIR")
+    elf = os.path.join(build_dir, env.subst("${PROGNAME}.elf"))
+    image = os.path.join(build_dir, env.subst("${PROGNAME}.bin"))
+    nm = re.sub(r"(gcc|g\+\+)$", "nm", env.subst("$CC"))
+
+    builtin = custom = 0
+    try:
+        symbols = subprocess.run([nm, "--print-size", "--radix=d", elf],
+                                 capture_output=True, text=True, check=True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        print(f"Font report skipped: cannot run {nm} ({e})")
+        return
+    for line in symbols.splitlines():
+        parts = line.split()
+        if len(parts) != 4 or parts[2].lower() not in ("r", "d", "t"):
+            continue
+        size, name = int(parts[1]), parts[3]
+        if not FONT_SYMBOL_RE.match(name):
+            continue
+        if name.startswith(("fa_", "montserrat_bold", "mont_")):
+            custom += size
+        else:
+            builtin += size
+
+    lines = [
+        f"Font report [{env.subst('$PIOENV')}] ({resolution}px profile)",
+        f"  built-in fonts enabled : {enabled_text}",
+        f"  built-in font data     : {builtin} B",
+        f"  custom font data       : {custom} B",
+        f"  font pack (partition)  : {os.path.getsize(pack_path) if pack_path else 0} B",
+        f"  firmware image         : {os.path.getsize(image) if os.path.exists(image) else 0} B",
+    ]
+    report = "\n".join(lines)
+    print(report)
+    with open(os.path.join(build_dir, "font_report.txt"), "w") as f:
+        f.write(report + "\n")
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.bin", font_report)
@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+"""
+Generates the font subsets in src/fonts from the full fonts in fonts/.
+
+The big custom fonts are only ever drawn by a few widgets, and those widgets
+only show a handful of glyphs:
+  - numeric readouts (gauge_digits) accept the characters of its glyph_chars[]
+    table (digits, '.' and '-'), so the "value" / "needle_value" fonts need
+    nothing else;
+  - icon fonts only show the *_SYMBOL icons defined in the gauge sources.
+Both sets are scanned from the sources and every other glyph is dropped.
+Fonts with a role that cannot be scanned are copied unchanged.
+
+The full fonts in fonts/ are the lv_font_conv output (uncompressed, no kerning).
+Edit or replace those, never the generated files, then re-run:
+
+    python3 scripts/subset_fonts.py
+
+The PlatformIO script scripts/pio_fonts.py runs this before every build.
+"""
+import glob
+import json
+import math
+import os
+import re
+import sys
+
+LIB_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+PROFILES_PATH = os.path.join(LIB_DIR, "screen_profiles.json")
+FULL_FONTS_DIR = os.path.join(LIB_DIR, "fonts")
+OUTPUT_DIR = os.path.join(LIB_DIR, "src", "fonts")
+GAUGES_DIR = os.path.join(LIB_DIR, "src", "gauges")
+
+
+# ============================================================================
+# GLYPH USAGE SCAN
+# ============================================================================
+
+def readout_charset():
+    """Characters a gauge_digits readout can display (its glyph_chars[] table)."""
+    with open(os.path.join(GAUGES_DIR, "gauge_digits.c"), "r") as f:
+        source = f.read()
+    table = re.search(r"glyph_chars\[[^\]]*\]\s*=\s*\{(.*?)\};", source, re.S)
+    if not table:
+        raise SystemExit("gauge_digits.c: glyph_chars[] table not found")
+    return set(re.findall(r"'(.)'", table.group(1)))
+
+
+def icon_charset():
+    """Icons referenced by the *_SYMBOL macros of the gauge sources."""
+    chars = set()
+    for path in glob.glob(os.path.join(GAUGES_DIR, "*.[ch]")):
+        with open(path, "r") as f:
+            source = f.read()
+        for escaped in re.findall(r'#define\s+\w+_SYMBOL\s+"((?:\\x[0-9A-Fa-f]{2})+)"', source):
+            utf8 = bytes(int(b, 16) for b in re.findall(r"\\x([0-9A-Fa-f]{2})", escaped))
+            chars.update(utf8.decode("utf-8"))
+    return chars
+
+
+ROLE_CHARSETS = {
+    "value": readout_charset,
+    "needle_value": readout_charset,
+    "icon": icon_charset,
+}
+
+
+def font_charset(info):
+    """Glyphs a catalog font needs, or None if one of its roles cannot be scanned."""
+    chars = set()
+    for role in info["roles"]:
+        if role not in ROLE_CHARSETS:
+            return None
+        chars |= ROLE_CHARSETS[role]()
+    return chars
+
+
+# ============================================================================
+# LV_FONT_CONV FORMAT
+# ============================================================================
+
+def int_list(body):
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    return [int(v, 0) for v in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", body)]
+
+
+def parse_font(text, path):
+    """Array prefix, glyphs {codepoint: (dsc, bitmap bytes)} and bitmap size of an lv_font_conv font."""
+    def need(pattern, flags=0):
+        match = re.search(pattern, text, flags)
+        if not match:
+            raise SystemExit(f"{path}: unsupported font format ({pattern})")
+        return match
+
+    if need(r"\.kern_dsc = (\w+)").group(1) != "NULL":
+        raise SystemExit(f"{path}: fonts with kerning are not supported")
+    if need(r"\.bitmap_format = (\d+)").group(1) != "0":
+        raise SystemExit(f"{path}: compressed fonts are not supported")
+    bpp = int(need(r"\.bpp = (\d+)").group(1))
+
+    bitmap_match = need(r"const uint8_t (\w+)_glyph_bitmap\[\] = \{(.*?)\n\};", re.S)
+    prefix = bitmap_match.group(1)
+    bitmap = int_list(bitmap_match.group(2))
+
+    dscs = [dict(zip(("bitmap_index", "adv_w", "box_w", "box_h", "ofs_x", "ofs_y"), map(int, m)))
+            for m in re.findall(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), "
+                                r"\.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", text)]
+
+    lists = {name: int_list(body)
+             for name, body in re.findall(r"static const uint(?:8|16)_t (\w+)\[\] = \{(.*?)\};", text, re.S)}
+
+    glyph_ids = {}
+    for start, length, gid_start, ulist, olist, count, kind in re.findall(
+            r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+            r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), "
+            r"\.type = LV_FONT_FMT_TXT_CMAP_(\w+)", text):
+        start, length, gid_start = int(start), int(length), int(gid_start)
+        if kind == "FORMAT0_TINY":
+            pairs = [(start + i, gid_start + i) for i in range(length)]
+        elif kind == "FORMAT0_FULL":
+            pairs = [(start + i, gid_start + ofs) for i, ofs in enumerate(lists[olist][:length])]
+        elif kind == "SPARSE_TINY":
+            pairs = [(start + u, gid_start + i) for i, u in enumerate(lists[ulist][:int(count)])]
+        else:  # SPARSE_FULL
+            pairs = [(start + u, gid_start + lists[olist][i]) for i, u in enumerate(lists[ulist][:int(count)])]
+        glyph_ids.update(pairs)
+
+    glyphs = {}
+    for cp, gid in glyph_ids.items():
+        dsc = dscs[gid]
+        size = math.ceil(dsc["box_w"] * dsc["box_h"] * bpp / 8)
+        glyphs[cp] = (dsc, bitmap[dsc["bitmap_index"]:dsc["bitmap_index"] + size])
+    return prefix, glyphs, len(bitmap)
+
+
+def cmap_groups(codepoints):
+    """Runs of 3+ consecutive codepoints become dense ranges, the rest one sparse list."""
+    runs, sparse = [], []
+    i = 0
+    while i < len(codepoints):
+        j = i
+        while j + 1 < len(codepoints) and codepoints[j + 1] == codepoints[j] + 1:
+            j += 1
+        if j - i + 1 >= 3:
+            runs.append(codepoints[i:j + 1])
+        else:
+            sparse.extend(codepoints[i:j + 1])
+        i = j + 1
+    return runs, sparse
+
+
+def hex_rows(values, fmt, per_row=8):
+    rows = []
+    for i in range(0, len(values), per_row):
+        rows.append("    " + ", ".join(fmt(v) for v in values[i:i + per_row]))
+    return rows
+
+
+def glyph_label(cp):
+    return f'U+{cp:04X} "{chr(cp)}"' if cp > 32 else f'U+{cp:04X} " "'
+
+
+def subset_font(text, path, charset):
+    prefix, glyphs, full_size = parse_font(text, path)
+    codepoints = sorted(cp for cp in glyphs if chr(cp) in charset)
+    missing = sorted(c for c in charset if ord(c) not in glyphs)
+
+    # Bitmaps and glyph descriptors, glyph ids in codepoint order
+    bitmap_rows, dsc_rows = [], []
+    dsc_rows.append("    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */")
+    index = 0
+    for n, cp in enumerate(codepoints):
+        dsc, data = glyphs[cp]
+        if n:
+            bitmap_rows[-1] += ","
+            bitmap_rows.append("")
+        bitmap_rows.append(f"    /* {glyph_label(cp)} */")
+        rows = hex_rows(data, lambda v: f"0x{v:x}")
+        bitmap_rows.extend(row + "," for row in rows[:-1])
+        bitmap_rows.extend(rows[-1:])
+        dsc_rows.append(f"    {{.bitmap_index = {index}, .adv_w = {dsc['adv_w']}, .box_w = {dsc['box_w']}, "
+                        f".box_h = {dsc['box_h']}, .ofs_x = {dsc['ofs_x']}, .ofs_y = {dsc['ofs_y']}}}")
+        index += len(data)
+    gid = {cp: n + 1 for n, cp in enumerate(codepoints)}
+
+    # Character mapping
+    runs, sparse = cmap_groups(codepoints)
+    lists, cmaps = [], []
+    for run in runs:
+        cmaps.append(f"        .range_start = {run[0]}, .range_length = {len(run)}, .glyph_id_start = {gid[run[0]]},\n"
+                     f"        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                     f".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY")
+    if sparse:
+        name = f"{prefix}_unicode_list_{len(runs)}"
+        lists.append(f"static const uint16_t {name}[] = {{\n"
+                     + ",\n".join(hex_rows([cp - sparse[0] for cp in sparse], lambda v: f"0x{v:x}"))
+                     + "\n};\n")
+        if sparse[-1] - sparse[0] >= 0x10000:
+            raise SystemExit(f"{path}: sparse glyphs span more than 64K codepoints")
+        # Sparse glyph ids are not consecutive: list their offsets from the first one
+        name_ofs = f"{prefix}_glyph_id_ofs_list_{len(runs)}"
+        offsets = [gid[cp] - gid[sparse[0]] for cp in sparse]
+        if offsets == list(range(len(sparse))):
+            kind, ofs_ref = "SPARSE_TINY", "NULL"
+        else:
+            lists.append(f"static const uint16_t {name_ofs}[] = {{\n"
+                         + ",\n".join(hex_rows(offsets, str)) + "\n};\n")
+            kind, ofs_ref = "SPARSE_FULL", name_ofs
+        cmaps.append(f"        .range_start = {sparse[0]}, .range_length = {sparse[-1] - sparse[0] + 1}, "
+                     f".glyph_id_start = {gid[sparse[0]]},\n"
+                     f"        .unicode_list = {name}, .glyph_id_ofs_list = {ofs_ref}, .list_length = {len(sparse)}, "
+                     f".type = LV_FONT_FMT_TXT_CMAP_{kind}")
+
+    mapping = ("/*---------------------\n *  CHARACTER MAPPING\n *--------------------*/\n\n"
+               + "\n".join(lists) + ("\n" if lists else "")
+               + f"/*Collect the unicode lists and glyph_id offsets*/\n"
+               f"static const lv_font_fmt_txt_cmap_t {prefix}_cmaps[] =\n{{\n"
+               + ",\n".join("    {\n" + c + "\n    }" for c in cmaps) + "\n};\n")
+
+    # Splice the new sections into the original file
+    out = re.sub(r"(const uint8_t \w+_glyph_bitmap\[\] = \{\n).*?(\n\};)",
+                 lambda m: m.group(1) + "\n".join(bitmap_rows) + m.group(2), text, count=1, flags=re.S)
+    out = re.sub(r"(const lv_font_fmt_txt_glyph_dsc_t \w+_glyph_dsc\[\] = \{\n).*?(\n\};)",
+                 lambda m: m.group(1) + ",\n".join(dsc_rows) + m.group(2), out, count=1, flags=re.S)
+    out = re.sub(r"/\*-+\n \*  CHARACTER MAPPING\n \*-+\*/\n.*?_cmaps\[\] =\n\{\n.*?\n\};\n",
+                 lambda m: mapping, out, count=1, flags=re.S)
+    out = re.sub(r"\.cmap_num = \d+", f".cmap_num = {len(cmaps)}", out, count=1)
+
+    subset = " ".join(glyph_label(cp).split(" ")[0] for cp in codepoints)
+    out = out.replace(" ******************************************************************************/",
+                      f" * Subset: {subset}\n"
+                      f" * Generated by scripts/subset_fonts.py from fonts/{os.path.basename(path)} - DO NOT EDIT\n"
+                      " ******************************************************************************/", 1)
+    return out, len(codepoints), len(glyphs), index, full_size, missing
+
+
+# ============================================================================
+# ENTRY POINTS
+# ============================================================================
+
+def generate(verbose=True):
+    """Regenerate every subset; files are only rewritten when their content changes."""
+    with open(PROFILES_PATH, "r") as f:
+        catalog = json.load(f)["fonts"]
+
+    report = []
+    for name, info in catalog.items():
+        if name.startswith("_") or "header" not in info:
+            continue
+        src = os.path.join(FULL_FONTS_DIR, info["header"])
+        dst = os.path.join(OUTPUT_DIR, info["header"])
+        with open(src, "r", newline="") as f:
+            text = f.read()
+
+        charset = font_charset(info)
+        if charset is None:
+            out, kept, total, size, full_size, missing = text, None, None, None, None, []
+        else:
+            out, kept, total, size, full_size, missing = subset_font(text, src, charset)
+        for c in missing if verbose else []:
+            print(f"Warning: {name} has no glyph for U+{ord(c):04X}", file=sys.stderr)
+
+        old = None
+        if os.path.exists(dst):
+            with open(dst, "r", newline="") as f:
+                old = f.read()
+        if old != out:
+            os.makedirs(OUTPUT_DIR, exist_ok=True)
+            with open(dst, "w", newline="") as f:
+                f.write(out)
+        report.append((name, kept, total, size, full_size))
+
+    if verbose:
+        for name, kept, total, size, full_size in report:
+            if kept is None:
+                print(f"{name:<30} copied unchanged (role not scanned)")
+            else:
+                print(f"{name:<30} {kept:>3}/{total:<3} glyphs, bitmap {size:>6} B (full font {full_size} B)")
+    return report
+
+
+if __name__ == "__main__":
+    generate()
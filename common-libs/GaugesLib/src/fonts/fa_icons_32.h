@@ -2,6 +2,8 @@
  * Size: 32 px
  * Bpp: 1
  * Opts: --bpp 1 --size 32 --no-compress --stride 1 --align 1 --font fa-light-300.ttf --range 62767,62995,62996,62867,62153,62016,62461,61613,62943 --format lvgl -o fa_icons_32.c
+ * Subset: U+F2C9 U+F52F U+F613 U+F614
+ * Generated by scripts/subset_fonts.py from fonts/fa_icons_32.h - DO NOT EDIT
  ******************************************************************************/
 
 #ifdef __has_include
@@ -32,39 +34,6 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_32_glyph_bitmap[] = {
-    /* U+F0AD "" */
-    0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0xf1, 0xc0, 0x0, 0x1, 0xc3, 0x80,
-    0x0, 0x1, 0x87, 0x0, 0x0, 0x3, 0xe, 0x0,
-    0x0, 0x3, 0xc, 0x6, 0x0, 0x6, 0xc, 0xf,
-    0x0, 0x6, 0xc, 0x1f, 0x0, 0x6, 0xc, 0x3b,
-    0x0, 0x6, 0xf, 0xf3, 0x0, 0x7, 0xf, 0xe3,
-    0x0, 0x7, 0x0, 0x6, 0x0, 0xe, 0x0, 0x6,
-    0x0, 0x1c, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1c,
-    0x0, 0x70, 0x18, 0x78, 0x0, 0xe0, 0x3f, 0xe0,
-    0x1, 0xc0, 0x7f, 0x80, 0x3, 0x80, 0xe0, 0x0,
-    0x7, 0x1, 0xc0, 0x0, 0xe, 0x3, 0x80, 0x0,
-    0x1c, 0x7, 0x0, 0x0, 0x38, 0xe, 0x0, 0x0,
-    0x70, 0x1c, 0x0, 0x0, 0xe0, 0x38, 0x0, 0x0,
-    0xcc, 0x70, 0x0, 0x0, 0xcc, 0xe0, 0x0, 0x0,
-    0xc1, 0xc0, 0x0, 0x0, 0x63, 0x80, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x1e, 0x0, 0x0, 0x0,
-
-    /* U+F240 "" */
-    0x7f, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xc0, 0x0, 0x0, 0x0, 0xc, 0xc0,
-    0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xc3, 0x33,
-    0x33, 0x33, 0x3, 0xc3, 0x33, 0x33, 0x33, 0x3,
-    0xc3, 0x33, 0x33, 0x33, 0x3, 0xc3, 0x33, 0x33,
-    0x33, 0x3, 0xc3, 0x33, 0x33, 0x33, 0x3, 0xc3,
-    0x33, 0x33, 0x33, 0x3, 0xc3, 0x33, 0x33, 0x33,
-    0x3, 0xc3, 0x33, 0x33, 0x33, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xf8,
-
     /* U+F2C9 "" */
     0x3, 0xc0, 0xf, 0xf0, 0x1c, 0x38, 0x18, 0x18,
     0x30, 0xc, 0x30, 0xc, 0x30, 0xc, 0x30, 0xc,
@@ -75,24 +44,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_32_glyph_bitmap[] = {
     0xc7, 0xe3, 0xc7, 0xe3, 0xe3, 0xc7, 0x60, 0x6,
     0x70, 0xe, 0x3c, 0x3c, 0x1f, 0xf8, 0x7, 0xe0,
 
-    /* U+F3FD "" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x70,
-    0x6, 0x0, 0xe0, 0xe, 0x0, 0x62, 0x7, 0x1,
-    0xc0, 0x0, 0x60, 0x38, 0x18, 0xe0, 0x6, 0x71,
-    0x83, 0xe, 0x0, 0x67, 0xc, 0x30, 0xe0, 0xc,
-    0x70, 0xc6, 0x0, 0x0, 0xc0, 0x6, 0x60, 0x0,
-    0xc, 0x0, 0x66, 0x0, 0x1, 0x80, 0x6, 0xc0,
-    0x0, 0x18, 0x0, 0x3c, 0x0, 0x1, 0x80, 0x3,
-    0xc0, 0x0, 0x30, 0x0, 0x3c, 0xe0, 0x1f, 0x80,
-    0x63, 0xce, 0x3, 0xfc, 0xf, 0x3c, 0xe0, 0x30,
-    0xc0, 0x63, 0xc0, 0x3, 0xc, 0x0, 0x3c, 0x0,
-    0x39, 0xc0, 0x3, 0x60, 0x1, 0xf8, 0x0, 0x66,
-    0x0, 0xf, 0x0, 0x6, 0x60, 0x0, 0x0, 0x0,
-    0x63, 0x0, 0x0, 0x0, 0xc, 0x3f, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xf8,
-
     /* U+F52F "" */
     0xf, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xe0, 0x0,
     0x38, 0x0, 0x70, 0xc0, 0x30, 0x0, 0x30, 0x60,
@@ -111,38 +62,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_32_glyph_bitmap[] = {
     0x30, 0x0, 0x30, 0x0, 0x30, 0x0, 0x30, 0x0,
     0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xfc, 0x0,
 
-    /* U+F593 "" */
-    0x1e, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x61, 0x80, 0xc3, 0x0, 0x61, 0x80, 0xc3, 0x0,
-    0xe1, 0xc0, 0xc3, 0x0, 0x61, 0x80, 0xe1, 0x80,
-    0x61, 0x80, 0x61, 0x80, 0x3f, 0x0, 0x30, 0xc0,
-    0x1e, 0x0, 0x38, 0xe0, 0x0, 0x0, 0x1c, 0x70,
-    0x3f, 0xc0, 0xc, 0x30, 0x7f, 0xe0, 0x6, 0x18,
-    0xe0, 0x70, 0x6, 0x18, 0xc0, 0x3c, 0x6, 0x18,
-    0xc0, 0xe, 0x0, 0x0, 0xc0, 0x7, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc3, 0xc, 0x30, 0xc3, 0xc3, 0xc, 0x30, 0xc3,
-    0xc3, 0xc, 0x30, 0xc3, 0xc3, 0xc, 0x30, 0xc3,
-    0xc3, 0xc, 0x30, 0xc3, 0xc3, 0xc, 0x30, 0xc3,
-    0xc3, 0xc, 0x30, 0xc3, 0xc3, 0xc, 0x30, 0xc3,
-    0xc0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x7,
-    0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc,
-
-    /* U+F5DF "" */
-    0xf, 0xfc, 0x3f, 0xf0, 0xf, 0xfc, 0x3f, 0xf0,
-    0xc, 0xc, 0x30, 0x30, 0xc, 0xc, 0x30, 0x30,
-    0x7f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x3, 0x3,
-    0xc0, 0x0, 0x3, 0x3, 0xc0, 0x0, 0x3, 0x3,
-    0xc7, 0xf8, 0x1f, 0xe3, 0xc7, 0xf8, 0x1f, 0xe3,
-    0xc0, 0x0, 0x3, 0x3, 0xc0, 0x0, 0x3, 0x3,
-    0xc0, 0x0, 0x3, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xfe,
-
     /* U+F613 "" */
     0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xfc,
     0x0, 0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x0,
@@ -188,15 +107,10 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_32_glyph_bitmap[] = {
 
 static const lv_font_fmt_txt_glyph_dsc_t fa_32_glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 512, .box_w = 32, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 128, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 228, .adv_w = 256, .box_w = 16, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 292, .adv_w = 576, .box_w = 36, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 418, .adv_w = 512, .box_w = 32, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 546, .adv_w = 512, .box_w = 32, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 674, .adv_w = 512, .box_w = 32, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 770, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 870, .adv_w = 640, .box_w = 40, .box_h = 32, .ofs_x = 0, .ofs_y = -4}
+    {.bitmap_index = 0, .adv_w = 256, .box_w = 16, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 64, .adv_w = 512, .box_w = 32, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 192, .adv_w = 640, .box_w = 40, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 292, .adv_w = 640, .box_w = 40, .box_h = 32, .ofs_x = 0, .ofs_y = -4}
 };
 
 /*---------------------
@@ -204,16 +118,15 @@ static const lv_font_fmt_txt_glyph_dsc_t fa_32_glyph_dsc[] = {
  *--------------------*/
 
 static const uint16_t fa_32_unicode_list_0[] = {
-    0x0, 0x193, 0x21c, 0x350, 0x482, 0x4e6, 0x532, 0x566,
-    0x567
+    0x0, 0x266, 0x34a, 0x34b
 };
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t fa_32_cmaps[] =
 {
     {
-        .range_start = 61613, .range_length = 1384, .glyph_id_start = 1,
-        .unicode_list = fa_32_unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 9, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+        .range_start = 62153, .range_length = 844, .glyph_id_start = 1,
+        .unicode_list = fa_32_unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 4, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
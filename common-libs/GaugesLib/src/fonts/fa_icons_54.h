@@ -2,6 +2,8 @@
  * Size: 54 px
  * Bpp: 1
  * Opts: --bpp 1 --size 54 --no-compress --stride 1 --align 1 --font fa-light-300.ttf --range 62767,62995,62996,62867,62153,62016,62461,61613,62943 --format lvgl -o fa_icons_54.c
+ * Subset: U+F2C9 U+F52F U+F613 U+F614
+ * Generated by scripts/subset_fonts.py from fonts/fa_icons_54.h - DO NOT EDIT
  ******************************************************************************/
 
 #ifdef __has_include
@@ -43,91 +45,6 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_54_glyph_bitmap[] = {
-    /* U+F0AD "" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x81,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x7, 0xc0, 0x7c, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x80, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x7,
-    0xc0, 0x7, 0x0, 0x0, 0x0, 0x70, 0x1e, 0x0,
-    0x3e, 0x0, 0x0, 0x3, 0xc0, 0x70, 0x1, 0xf8,
-    0x0, 0x0, 0xf, 0x1, 0xe0, 0xf, 0xf0, 0x0,
-    0x0, 0x38, 0x7, 0x80, 0x7f, 0xc0, 0x0, 0x0,
-    0xe0, 0xe, 0x3, 0xef, 0x0, 0x0, 0x3, 0x80,
-    0x38, 0x1f, 0x3c, 0x0, 0x0, 0xe, 0x0, 0xfe,
-    0xf8, 0xf0, 0x0, 0x0, 0x3c, 0x3, 0xff, 0xc3,
-    0xc0, 0x0, 0x0, 0x70, 0xf, 0xfe, 0xe, 0x0,
-    0x0, 0x3, 0xc0, 0x1, 0xf0, 0x38, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x7, 0xc0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x1,
-    0xe0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x3, 0xe0,
-    0x0, 0xf0, 0xff, 0x0, 0x0, 0x1f, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf8, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x7, 0xc0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x3e, 0x0, 0xf, 0x80, 0x0, 0x0, 0x1,
-    0xf0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x3, 0xe0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x1f,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x1f, 0x0, 0x7, 0xc0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x7, 0x80, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x0, 0xe1, 0xc0, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0x87, 0x7, 0xc0, 0x0, 0x0, 0x0, 0xe, 0x1c,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x38, 0x1, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf0, 0xf, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xc0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xc3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F240 "" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x8e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x71, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0xe1, 0xc3, 0x8e,
-    0x1c, 0x38, 0x70, 0x3, 0xf0, 0x1c, 0x38, 0x71,
-    0xc3, 0x87, 0xe, 0x0, 0x7e, 0x3, 0x87, 0xe,
-    0x38, 0x70, 0xe1, 0xc0, 0xf, 0xc0, 0x70, 0xe1,
-    0xc7, 0xe, 0x1c, 0x38, 0x1, 0xf8, 0xe, 0x1c,
-    0x38, 0xe1, 0xc3, 0x87, 0x0, 0x3f, 0x1, 0xc3,
-    0x87, 0x1c, 0x38, 0x70, 0xe0, 0x7, 0xe0, 0x38,
-    0x70, 0xe3, 0x87, 0xe, 0x1c, 0x0, 0xfc, 0x7,
-    0xe, 0x1c, 0x70, 0xe1, 0xc3, 0x80, 0x1f, 0x80,
-    0xe1, 0xc3, 0x8e, 0x1c, 0x38, 0x70, 0x3, 0xf0,
-    0x1c, 0x38, 0x71, 0xc3, 0x87, 0xe, 0x0, 0x7e,
-    0x3, 0x87, 0xe, 0x38, 0x70, 0xe1, 0xc0, 0xf,
-    0xc0, 0x70, 0xe1, 0xc7, 0xe, 0x1c, 0x38, 0x1,
-    0xf8, 0xe, 0x1c, 0x38, 0xe1, 0xc3, 0x87, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x71, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0,
-
     /* U+F2C9 "" */
     0x0, 0x3f, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x3f,
     0xff, 0x0, 0x1f, 0x83, 0xe0, 0x7, 0x80, 0x78,
@@ -152,53 +69,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_54_glyph_bitmap[] = {
     0xc0, 0xf, 0x80, 0xfc, 0xf, 0xc0, 0xf, 0xff,
     0xe0, 0x1, 0xff, 0xe0, 0x0, 0xf, 0xe0, 0x0,
 
-    /* U+F3FD "" */
-    0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x1, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x7e,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xe0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0, 0x7,
-    0x0, 0x3, 0xe0, 0x0, 0xf, 0x80, 0x0, 0xf8,
-    0x0, 0x1f, 0x0, 0x1, 0xe0, 0x0, 0xf, 0x86,
-    0x0, 0xf8, 0x0, 0x3c, 0x0, 0x0, 0xf8, 0x70,
-    0x7, 0xc0, 0x3, 0xc0, 0x0, 0x7, 0xf, 0x0,
-    0x3c, 0x0, 0x78, 0x0, 0x0, 0x0, 0xe0, 0x1,
-    0xe0, 0xf, 0x3, 0x80, 0x0, 0xe, 0x1c, 0xf,
-    0x0, 0xe0, 0x7c, 0x0, 0x1, 0xe3, 0xe0, 0x70,
-    0x1e, 0x7, 0xc0, 0x0, 0x1c, 0x3e, 0x7, 0x81,
-    0xc0, 0x7c, 0x0, 0x3, 0xc3, 0xe0, 0x38, 0x3c,
-    0x3, 0x80, 0x0, 0x3c, 0x1c, 0x3, 0xc3, 0x80,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x1c, 0x38, 0x0,
-    0x0, 0x0, 0x78, 0x0, 0x1, 0xc7, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0xe, 0x70, 0x0, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0xe,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x7, 0xe0, 0xe0, 0x0, 0x3f, 0xe0, 0x0,
-    0x70, 0x7e, 0x1f, 0x0, 0x7, 0xff, 0x0, 0xf,
-    0x87, 0xe1, 0xf0, 0x0, 0x7f, 0xf0, 0x0, 0xf8,
-    0x7e, 0x1f, 0x0, 0xf, 0x7, 0x80, 0xf, 0x87,
-    0xe0, 0xe0, 0x0, 0xe0, 0x38, 0x0, 0x70, 0x7e,
-    0x0, 0x0, 0xe, 0x3, 0x80, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0xe0, 0x38, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0xf, 0x7, 0x80, 0x0, 0x7, 0x70, 0x0,
-    0x0, 0x78, 0xf0, 0x0, 0x0, 0xe7, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0xe7, 0x80, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0xe, 0x38, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xc3, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0x1c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x81, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0,
-
     /* U+F52F "" */
     0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xf,
     0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff,
@@ -247,90 +117,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_54_glyph_bitmap[] = {
     0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
     0xff, 0xff, 0xe0, 0x0, 0x0,
 
-    /* U+F593 "" */
-    0x7, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0x0, 0x7,
-    0x1, 0xc0, 0x0, 0x78, 0x1e, 0x0, 0x1c, 0x7,
-    0x0, 0x1, 0xc0, 0x38, 0x0, 0x70, 0x1c, 0x0,
-    0x7, 0x0, 0xf0, 0x1, 0xc0, 0x70, 0x0, 0x1c,
-    0x3, 0xc0, 0x7, 0x81, 0xe0, 0x0, 0x70, 0xf,
-    0x0, 0xe, 0x3, 0x80, 0x1, 0xc0, 0x38, 0x0,
-    0x3c, 0xf, 0x0, 0x7, 0x81, 0xe0, 0x0, 0xf0,
-    0x1c, 0x0, 0xf, 0xf, 0x80, 0x1, 0xe0, 0x78,
-    0x0, 0x1f, 0xfc, 0x0, 0x3, 0xc0, 0xf8, 0x0,
-    0x3f, 0xe0, 0x0, 0xf, 0x81, 0xf0, 0x0, 0x7e,
-    0x0, 0x0, 0x1f, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x1f, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0xe0,
-    0x3c, 0x3, 0xff, 0xf8, 0x0, 0x3, 0xc0, 0x70,
-    0x1f, 0xff, 0xf0, 0x0, 0x7, 0x1, 0xe0, 0x78,
-    0x3, 0xf0, 0x0, 0x1c, 0x7, 0x83, 0xc0, 0x3,
-    0xe0, 0x0, 0x70, 0x1e, 0xe, 0x0, 0x7, 0xc0,
-    0x1, 0xc0, 0x38, 0x38, 0x0, 0xf, 0xc0, 0x3,
-    0x0, 0xc0, 0xe0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x3, 0x80, 0x0, 0x1f, 0x0, 0x0, 0x0, 0xe,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x3, 0x80,
-    0xe0, 0x38, 0xf, 0x1, 0xf8, 0xe, 0x3, 0x80,
-    0xe0, 0x3c, 0x7, 0xe0, 0x38, 0xe, 0x3, 0x80,
-    0xf0, 0x1f, 0x80, 0xe0, 0x38, 0xe, 0x3, 0xc0,
-    0x7e, 0x3, 0x80, 0xe0, 0x38, 0xf, 0x1, 0xf8,
-    0xe, 0x3, 0x80, 0xe0, 0x3c, 0x7, 0xe0, 0x38,
-    0xe, 0x3, 0x80, 0xf0, 0x1f, 0x80, 0xe0, 0x38,
-    0xe, 0x3, 0xc0, 0x7e, 0x3, 0x80, 0xe0, 0x38,
-    0xf, 0x1, 0xf8, 0xe, 0x3, 0x80, 0xe0, 0x3c,
-    0x7, 0xe0, 0x38, 0xe, 0x3, 0x80, 0xf0, 0x1f,
-    0x80, 0xe0, 0x38, 0xe, 0x3, 0xc0, 0x7e, 0x3,
-    0x80, 0xe0, 0x38, 0xf, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0,
-
-    /* U+F5DF "" */
-    0x1, 0xff, 0xfe, 0x3, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xf8, 0xf, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0xe0, 0x3f, 0xff, 0xe0, 0x0, 0x70, 0x3, 0x80,
-    0xe0, 0x3, 0x80, 0x1, 0xc0, 0xe, 0x3, 0x80,
-    0xe, 0x0, 0x7, 0x0, 0x38, 0xe, 0x0, 0x38,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x1, 0xc0, 0x7, 0xe0, 0x0, 0x0, 0x0,
-    0x7, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x1c,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x70, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xc0, 0x7, 0xe0,
-    0x7f, 0xf8, 0x0, 0xff, 0xf8, 0x1f, 0x83, 0xff,
-    0xf0, 0x7, 0xff, 0xf0, 0x7e, 0x7, 0xff, 0x80,
-    0xf, 0xff, 0x81, 0xf8, 0x0, 0x0, 0x0, 0x1,
-    0xc0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x7, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x7e,
-    0x0, 0x0, 0x0, 0x0, 0x70, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x1, 0xc0, 0x7, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
     /* U+F613 "" */
     0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0,
     0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
@@ -436,15 +222,10 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t fa_54_glyph_bitmap[] = {
 
 static const lv_font_fmt_txt_glyph_dsc_t fa_54_glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 864, .box_w = 54, .box_h = 54, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 365, .adv_w = 1080, .box_w = 67, .box_h = 33, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 642, .adv_w = 432, .box_w = 26, .box_h = 54, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 818, .adv_w = 972, .box_w = 60, .box_h = 47, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1171, .adv_w = 864, .box_w = 54, .box_h = 54, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 1536, .adv_w = 864, .box_w = 54, .box_h = 54, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 1901, .adv_w = 864, .box_w = 54, .box_h = 40, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2171, .adv_w = 1080, .box_w = 67, .box_h = 33, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 2448, .adv_w = 1080, .box_w = 68, .box_h = 54, .ofs_x = 0, .ofs_y = -7}
+    {.bitmap_index = 0, .adv_w = 432, .box_w = 26, .box_h = 54, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 176, .adv_w = 864, .box_w = 54, .box_h = 54, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 541, .adv_w = 1080, .box_w = 67, .box_h = 33, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 818, .adv_w = 1080, .box_w = 68, .box_h = 54, .ofs_x = 0, .ofs_y = -7}
 };
 
 /*---------------------
@@ -452,16 +233,15 @@ static const lv_font_fmt_txt_glyph_dsc_t fa_54_glyph_dsc[] = {
  *--------------------*/
 
 static const uint16_t fa_54_unicode_list_0[] = {
-    0x0, 0x193, 0x21c, 0x350, 0x482, 0x4e6, 0x532, 0x566,
-    0x567
+    0x0, 0x266, 0x34a, 0x34b
 };
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t fa_54_cmaps[] =
 {
     {
-        .range_start = 61613, .range_length = 1384, .glyph_id_start = 1,
-        .unicode_list = fa_54_unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 9, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+        .range_start = 62153, .range_length = 844, .glyph_id_start = 1,
+        .unicode_list = fa_54_unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 4, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -2,6 +2,8 @@
  * Size: 120 px
  * Bpp: 1
  * Opts: --bpp 1 --size 120 --no-compress --stride 1 --align 1 --font Montserrat-Bold.ttf --range 48-57,46 --format lvgl -o montserrat_bold_numbers_120.c
+ * Subset: U+002E U+0030 U+0031 U+0032 U+0033 U+0034 U+0035 U+0036 U+0037 U+0038 U+0039
+ * Generated by scripts/subset_fonts.py from fonts/montserrat_bold_numbers_120.h - DO NOT EDIT
  ******************************************************************************/
 
 #ifdef __has_include
@@ -986,17 +988,20 @@ static const lv_font_fmt_txt_glyph_dsc_t mont_120_glyph_dsc[] = {
  *  CHARACTER MAPPING
  *--------------------*/
 
-static const uint8_t glyph_id_ofs_list_0[] = {
-    0, 0, 1, 2, 3, 4, 5, 6,
-    7, 8, 9, 10
+static const uint16_t mont_120_unicode_list_1[] = {
+    0x0
 };
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t mont_120_cmaps[] =
 {
     {
-        .range_start = 46, .range_length = 12, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 12, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+        .range_start = 48, .range_length = 10, .glyph_id_start = 2,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 46, .range_length = 1, .glyph_id_start = 1,
+        .unicode_list = mont_120_unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 1, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -1021,7 +1026,7 @@ static lv_font_fmt_txt_dsc_t mont_120_font_dsc = {
     .cmaps = mont_120_cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 1,
+    .cmap_num = 2,
     .bpp = 1,
     .kern_classes = 0,
     .bitmap_format = 0,
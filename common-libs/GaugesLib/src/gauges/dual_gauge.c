@@ -0,0 +1,230 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "dual_gauge.h"
+#include "gauge_stats.h"
+#include "gauge_digits.h"
+#include "gauge_theme.h"
+#include <string.h>
+
+// ============================================================================
+// SHARED STYLES
+// ============================================================================
+
+// Styles of the shared widgets, one per mode, initialized once and swapped on mode change.
+// Their colors follow the day/night theme (gauge_theme.h).
+static lv_style_t style_value_racing;
+static lv_style_t style_value_normal;
+static lv_style_t style_unit;
+static lv_style_t style_icon_racing;
+static lv_style_t style_icon_normal;
+static bool styles_initialized = false;
+
+static void dual_gauge_init_styles(void) {
+    if (styles_initialized) return;
+
+    lv_style_init(&style_value_racing);
+    lv_style_set_text_font(&style_value_racing, FONT_TEMP_MAIN);
+    gauge_theme_bind(&style_value_racing, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT);
+
+    lv_style_init(&style_value_normal);
+    lv_style_set_text_font(&style_value_normal, FONT_NEEDLE_VALUE);
+    gauge_theme_bind(&style_value_normal, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_ACCENT);
+
+    lv_style_init(&style_unit);
+    lv_style_set_text_font(&style_unit, FONT_TEMP_UNIT);
+    gauge_theme_bind(&style_unit, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_ACCENT);
+
+    lv_style_init(&style_icon_racing);
+    lv_style_set_text_font(&style_icon_racing, FONT_ICON);
+    gauge_theme_bind(&style_icon_racing, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_ACCENT);
+
+    lv_style_init(&style_icon_normal);
+    #if USE_CUSTOM_ICON_FONT
+        lv_style_set_text_font(&style_icon_normal, FONT_ICON);
+    #else
+        lv_style_set_text_font(&style_icon_normal, FONT_MARKERS);  // Smaller font for text fallback
+    #endif
+    gauge_theme_bind(&style_icon_normal, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_ACCENT);
+
+    styles_initialized = true;
+}
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+static const char* dual_gauge_icon_text(const char *icon_symbol) {
+    #if USE_CUSTOM_ICON_FONT
+        // Use Font Awesome icon symbol
+        return icon_symbol;
+    #else
+        // Use text fallback from global configuration
+        if (icon_symbol == OIL_TEMP_SYMBOL) return OIL_TEMP_TEXT_LABEL;
+        if (icon_symbol == OIL_PRESSURE_SYMBOL) return OIL_PRES_TEXT_LABEL;
+        if (icon_symbol == WATER_SYMBOL) return WATER_TEXT_LABEL;
+        return "---";
+    #endif
+}
+
+/**
+ * @brief Restyle and re-align the shared widgets for the current mode
+ */
+static void dual_gauge_apply_layout(dual_gauge_t *gauge) {
+    if (gauge->mode == GAUGE_MODE_RACING) {
+        lv_obj_remove_style(gauge->value_label, &style_value_normal, 0);
+        lv_obj_add_style(gauge->value_label, &style_value_racing, 0);
+        lv_obj_align(gauge->value_label, LV_ALIGN_CENTER, 0, TEMP_LABEL_Y_OFFSET);
+
+        lv_obj_clear_flag(gauge->unit_label, LV_OBJ_FLAG_HIDDEN);
+
+        lv_obj_remove_style(gauge->icon, &style_icon_normal, 0);
+        lv_obj_add_style(gauge->icon, &style_icon_racing, 0);
+        lv_obj_align(gauge->icon, LV_ALIGN_BOTTOM_MID, 0, ICON_Y_OFFSET);
+    } else {
+        lv_obj_remove_style(gauge->value_label, &style_value_racing, 0);
+        lv_obj_add_style(gauge->value_label, &style_value_normal, 0);
+        lv_obj_align(gauge->value_label, LV_ALIGN_CENTER,
+                     NEEDLE_VALUE_LABEL_X_OFFSET,
+                     NEEDLE_VALUE_LABEL_Y_OFFSET);
+
+        // The needle face shows the number only
+        lv_obj_add_flag(gauge->unit_label, LV_OBJ_FLAG_HIDDEN);
+
+        lv_obj_remove_style(gauge->icon, &style_icon_racing, 0);
+        lv_obj_add_style(gauge->icon, &style_icon_normal, 0);
+        int padding_offset_value = (int)15 / NEEDLE_ICON_PADDING_DIVISOR;
+        lv_obj_align(gauge->icon, LV_ALIGN_CENTER, padding_offset_value, NEEDLE_ICON_Y_OFFSET);
+    }
+}
+
+/**
+ * @brief Build the mode-specific widgets into the (empty) scale layer
+ */
+static void dual_gauge_build_layer(dual_gauge_t *gauge, const dual_gauge_config_t *config) {
+    uint32_t mem_before = gauge_stats_lvgl_mem_used();
+
+    if (gauge->mode == GAUGE_MODE_RACING) {
+        gauge_state_t *state = &gauge->racing;
+        state->screen_bg = gauge->screen_bg;
+        state->label = gauge->value_label;
+        state->icon = gauge->icon;
+
+        state->arc = gauge_create_arc(gauge->layer, config->racing);
+        gauge_motion_attach(&state->arc_motion, gauge_arc_anim_cb, state->arc, config->racing->temp_min);
+        gauge_create_border_and_markers(gauge->layer, config->racing);
+        gauge_create_redline(gauge->layer, config->racing);
+    } else {
+        needle_gauge_state_t *state = &gauge->normal;
+        state->screen_bg = gauge->screen_bg;
+        state->value_label = gauge->value_label;
+        state->icon_label = gauge->icon;
+
+        needle_gauge_create_meter(gauge->layer, config->normal, state);
+    }
+
+    uint32_t mem_after = gauge_stats_lvgl_mem_used();
+    gauge_stats_set_mode_heap(gauge->mode, mem_after > mem_before ? mem_after - mem_before : 0);
+}
+
+/**
+ * @brief Release the state of the current mode (the layer widgets are deleted by the caller)
+ */
+static void dual_gauge_release_layer(dual_gauge_t *gauge) {
+    if (gauge->mode == GAUGE_MODE_RACING) {
+        gauge_release(&gauge->racing);
+    } else {
+        needle_gauge_release(&gauge->normal);
+    }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void dual_gauge_create(dual_gauge_t *gauge, const dual_gauge_config_t *config, lv_obj_t *parent, uint8_t mode) {
+    if (!gauge || !config || !parent) return;
+
+    dual_gauge_init_styles();
+    memset(gauge, 0, sizeof(*gauge));
+    gauge->mode = (mode < GAUGE_MODE_COUNT) ? mode : GAUGE_MODE_RACING;
+
+    // Background (blinks red on a full-screen alert, gauge_alert.h)
+    gauge->screen_bg = lv_obj_create(parent);
+    lv_obj_set_size(gauge->screen_bg, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_color(gauge->screen_bg, COLOR_BLACK, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(gauge->screen_bg, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_border_width(gauge->screen_bg, 0, LV_PART_MAIN);
+    lv_obj_clear_flag(gauge->screen_bg, LV_OBJ_FLAG_CLICKABLE);  // Taps reach the screen (peak recall)
+
+    // Transparent full-screen container for the mode-specific widgets
+    gauge->layer = lv_obj_create(parent);
+    lv_obj_remove_style_all(gauge->layer);
+    lv_obj_set_size(gauge->layer, LV_PCT(100), LV_PCT(100));
+    lv_obj_center(gauge->layer);
+    lv_obj_clear_flag(gauge->layer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    // Shared labels, drawn above the layer
+    gauge->value_label = gauge_digits_create(parent);
+    gauge_digits_set_text(gauge->value_label, "0");
+
+    gauge->unit_label = lv_label_create(parent);
+    lv_label_set_text(gauge->unit_label, config->normal->unit_text ? config->normal->unit_text : "");
+    lv_obj_add_style(gauge->unit_label, &style_unit, 0);
+    lv_obj_align(gauge->unit_label, LV_ALIGN_CENTER, 0, TEMP_UNIT_Y_OFFSET);
+
+    gauge->icon = lv_label_create(parent);
+    lv_label_set_text(gauge->icon, dual_gauge_icon_text(config->normal->icon_symbol));
+
+    dual_gauge_build_layer(gauge, config);
+    dual_gauge_apply_layout(gauge);
+}
+
+bool dual_gauge_set_mode(dual_gauge_t *gauge, const dual_gauge_config_t *config, uint8_t mode) {
+    if (!gauge || !gauge->layer || mode >= GAUGE_MODE_COUNT || mode == gauge->mode) return false;
+
+    // Drop the old presentation; a running alert blink restarts on the next
+    // update (the new state has nothing shown yet)
+    dual_gauge_release_layer(gauge);
+    lv_obj_set_style_bg_color(gauge->screen_bg, COLOR_BLACK, LV_PART_MAIN);
+    lv_obj_clean(gauge->layer);
+
+    gauge->mode = mode;
+    dual_gauge_build_layer(gauge, config);
+    dual_gauge_apply_layout(gauge);
+    return true;
+}
+
+void dual_gauge_apply_model(dual_gauge_t *gauge, const gauge_model_t *model) {
+    if (!gauge || !gauge->layer) return;
+
+    if (gauge->mode == GAUGE_MODE_RACING) {
+        gauge_apply_model(&gauge->racing, model);
+    } else {
+        needle_gauge_apply_model(&gauge->normal, model);
+    }
+}
+
+void dual_gauge_show_peak(dual_gauge_t *gauge, const dual_gauge_config_t *config, gauge_peak_t peak) {
+    if (!gauge || !gauge->layer) return;
+
+    float value = 0.0f;
+    bool show = gauge_peaks_get(peak, &value);
+    if (gauge->mode == GAUGE_MODE_RACING) {
+        gauge_arc_set_marker(gauge->racing.arc, show, (int32_t)(value * (float)config->racing->value_scale));
+    } else {
+        needle_gauge_set_marker(&gauge->normal, show, value);
+    }
+}
+
+void dual_gauge_release(dual_gauge_t *gauge) {
+    if (!gauge || !gauge->layer) return;
+
+    dual_gauge_release_layer(gauge);
+    memset(gauge, 0, sizeof(*gauge));
+}
+
+#ifdef __cplusplus
+}
+#endif
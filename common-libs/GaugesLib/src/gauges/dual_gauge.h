@@ -0,0 +1,118 @@
+#ifndef DUAL_GAUGE_H
+#define DUAL_GAUGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+#include "gauges_config.h"
+#include "gauge_common.h"
+#include "needle_gauge_common.h"
+#include "gauge_peaks.h"
+
+// ============================================================================
+// DUAL MODE GAUGE STRUCTURES
+// ============================================================================
+
+/**
+ * @brief Configuration of a single-value gauge in both display modes
+ */
+typedef struct {
+    const gauge_config_t *racing;           // Arc presentation
+    const needle_gauge_config_t *normal;    // Needle presentation (also gives unit and icon)
+} dual_gauge_config_t;
+
+/**
+ * @brief One widget tree shared by the normal and racing presentations
+ *
+ * The background, value label, unit label and icon are created once and only
+ * restyled / re-aligned on a mode change. Everything that differs between the
+ * modes (arc, scale, redline or meter, needle) lives in the scale layer, which
+ * is the only part rebuilt:
+ *
+ *   screen
+ *   ├── screen_bg     (shared, blinks on alert)
+ *   ├── layer         (per mode: arc + scale + redline | meter / scale image + needle)
+ *   ├── value_label   (shared gauge_digits readout, restyled)
+ *   ├── unit_label    (shared, racing mode only)
+ *   └── icon          (shared, re-aligned)
+ *
+ * The racing and normal states point at the shared widgets, so
+ * gauge_apply_model() / needle_gauge_apply_model() drive them unchanged.
+ */
+typedef struct {
+    lv_obj_t *screen_bg;
+    lv_obj_t *layer;
+    lv_obj_t *value_label;
+    lv_obj_t *unit_label;
+    lv_obj_t *icon;
+    uint8_t mode;                   // GAUGE_MODE_NORMAL or GAUGE_MODE_RACING
+    gauge_state_t racing;           // Valid while mode == GAUGE_MODE_RACING
+    needle_gauge_state_t normal;    // Valid while mode == GAUGE_MODE_NORMAL
+} dual_gauge_t;
+
+// ============================================================================
+// LIFECYCLE
+// ============================================================================
+
+/**
+ * @brief Build the shared widgets and the scale layer of the given mode
+ * @param gauge Gauge storage (owned by the gauge module)
+ * @param config Gauge configuration
+ * @param parent Screen the gauge is built on
+ * @param mode Initial display mode
+ */
+void dual_gauge_create(dual_gauge_t *gauge, const dual_gauge_config_t *config, lv_obj_t *parent, uint8_t mode);
+
+/**
+ * @brief Switch display mode in place
+ *
+ * Releases and deletes the current scale layer content, builds the other
+ * one and restyles the shared widgets. Only the screen area covered by the
+ * layer and the moved labels is redrawn; the screen itself is not reloaded.
+ * The heap taken by the new layer is recorded with gauge_stats_set_mode_heap().
+ *
+ * @param gauge Gauge built with dual_gauge_create()
+ * @param config Gauge configuration
+ * @param mode New display mode
+ * @return true if the mode changed (the caller should re-apply its last value)
+ */
+bool dual_gauge_set_mode(dual_gauge_t *gauge, const dual_gauge_config_t *config, uint8_t mode);
+
+/**
+ * @brief Show an evaluated value (gauge_model.h) in the current mode
+ *
+ * Each mode keeps the state it shows: after a mode change the next call
+ * applies everything, only the changed parts otherwise.
+ *
+ * @param gauge Gauge built with dual_gauge_create()
+ * @param model Value evaluated with the configuration of the gauge
+ */
+void dual_gauge_apply_model(dual_gauge_t *gauge, const gauge_model_t *model);
+
+/**
+ * @brief Move the held value marker of the current mode to a gauge_peaks value
+ *
+ * Call on every update: the marker is only redrawn when it moves (or appears /
+ * disappears after gauge_peaks_reset()).
+ *
+ * @param gauge Gauge built with dual_gauge_create()
+ * @param config Gauge configuration (arc value scale)
+ * @param peak Channel shown by this gauge
+ */
+void dual_gauge_show_peak(dual_gauge_t *gauge, const dual_gauge_config_t *config, gauge_peak_t peak);
+
+/**
+ * @brief Release a gauge before its screen is deleted
+ * @param gauge Gauge state
+ */
+void dual_gauge_release(dual_gauge_t *gauge);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DUAL_GAUGE_H
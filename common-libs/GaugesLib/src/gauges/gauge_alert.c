@@ -0,0 +1,297 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_alert.h"
+#include "gauge_stats.h"
+#include "gauge_theme.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+// A full invalidation buffer turns into a full-screen refresh: leave room for the gauges
+_Static_assert(GAUGE_ALERT_RING_SEGMENTS % 4 == 0 && GAUGE_ALERT_RING_SEGMENTS <= LV_INV_BUF_SIZE - 8,
+               "Ring segments must split the quadrants and leave room in the invalidation buffer");
+
+static lv_obj_t *alert_bgs[GAUGE_ALERT_MAX_ACTIVE];  // Backgrounds of the gauges in alert
+static lv_timer_t *alert_timer = NULL;
+static bool phase_on = false;                        // Flash shown in the current half period
+static gauge_alert_style_t alert_style = (gauge_alert_style_t)GAUGE_ALERT_STYLE;
+static gauge_alert_panel_cb_t panel_hooks[GAUGE_ALERT_STYLE_COUNT] = {NULL};
+static bool panel_flashed = false;                   // Panel currently inverted / dimmed
+static uint32_t panel_commands = 0;                  // Hook calls (benchmark)
+static bool force_panel = false;                     // Benchmark: panel styles without hook
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+static gauge_alert_style_t effective_style(void) {
+    if ((alert_style == GAUGE_ALERT_PANEL_INVERT || alert_style == GAUGE_ALERT_PANEL_DIM) &&
+        !panel_hooks[alert_style] && !force_panel) {
+        return GAUGE_ALERT_RING;
+    }
+    return alert_style;
+}
+
+static bool is_panel_style(gauge_alert_style_t style) {
+    return style == GAUGE_ALERT_PANEL_INVERT || style == GAUGE_ALERT_PANEL_DIM;
+}
+
+/**
+ * @brief Ring geometry of a screen: center and outer radius
+ */
+static void ring_geometry(const lv_obj_t *screen, lv_point_t *center, uint16_t *radius) {
+    lv_area_t coords;
+    lv_obj_get_coords(screen, &coords);
+    lv_coord_t w = lv_area_get_width(&coords);
+    lv_coord_t h = lv_area_get_height(&coords);
+    center->x = coords.x1 + w / 2;
+    center->y = coords.y1 + h / 2;
+    *radius = (uint16_t)((w < h ? w : h) / 2);
+}
+
+/**
+ * @brief Invalidate the ring band only
+ *
+ * A full-screen object would invalidate its whole bounding box, so the ring is
+ * drawn by its screen (LV_EVENT_DRAW_POST, above every child) and refreshed as
+ * GAUGE_ALERT_RING_SEGMENTS small areas hugging the band.
+ */
+static void ring_invalidate(lv_obj_t *screen) {
+    lv_point_t center;
+    uint16_t radius;
+    ring_geometry(screen, &center, &radius);
+
+    for (int i = 0; i < GAUGE_ALERT_RING_SEGMENTS; i++) {
+        lv_area_t area;
+        lv_draw_arc_get_area(center.x, center.y, radius,
+                             (uint16_t)(i * 360 / GAUGE_ALERT_RING_SEGMENTS),
+                             (uint16_t)((i + 1) * 360 / GAUGE_ALERT_RING_SEGMENTS),
+                             GAUGE_ALERT_RING_WIDTH, false, &area);
+        lv_obj_invalidate_area(screen, &area);
+    }
+}
+
+static void ring_draw_cb(lv_event_t *e) {
+    if (!phase_on || effective_style() != GAUGE_ALERT_RING) return;
+
+    lv_obj_t *screen = lv_event_get_target(e);
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    lv_point_t center;
+    uint16_t radius;
+    ring_geometry(screen, &center, &radius);
+
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.color = gauge_theme_color(GAUGE_COLOR_ALERT);
+    dsc.width = GAUGE_ALERT_RING_WIDTH;
+    lv_draw_arc(draw_ctx, &dsc, &center, radius, 0, 360);
+}
+
+static void panel_set(gauge_alert_style_t style, bool on) {
+    if (on == panel_flashed) return;
+    if (panel_hooks[style]) panel_hooks[style](on);
+    panel_flashed = on;
+    panel_commands++;
+}
+
+/**
+ * @brief Show the current phase of an alert in the given style
+ */
+static void apply_phase(lv_obj_t *bg, gauge_alert_style_t style, bool on) {
+    if (style == GAUGE_ALERT_FULL_SCREEN) {
+        lv_obj_set_style_bg_color(bg, on ? gauge_theme_color(GAUGE_COLOR_ALERT) : COLOR_BLACK, LV_PART_MAIN);
+    } else if (style == GAUGE_ALERT_RING) {
+        ring_invalidate(lv_obj_get_screen(bg));  // No-op on hidden screens
+    }
+}
+
+/**
+ * @brief Flash the panel while an alert of the visible screen is on
+ */
+static void update_panel(gauge_alert_style_t style) {
+    bool visible_alert = false;
+    lv_obj_t *active = lv_scr_act();
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i] && lv_obj_get_screen(alert_bgs[i]) == active) visible_alert = true;
+    }
+    panel_set(style, phase_on && visible_alert);
+}
+
+static void alert_toggle(void) {
+    gauge_alert_style_t style = effective_style();
+    phase_on = !phase_on;
+
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i]) apply_phase(alert_bgs[i], style, phase_on);
+    }
+    if (is_panel_style(style)) update_panel(style);
+}
+
+static void alert_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    alert_toggle();
+}
+
+/**
+ * @brief Another alert drawn by the same screen
+ */
+static bool screen_has_other_alert(const lv_obj_t *screen, const lv_obj_t *bg) {
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i] && alert_bgs[i] != bg && lv_obj_get_screen(alert_bgs[i]) == screen) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Remove what a style shows for an alert
+ */
+static void clear_alert(lv_obj_t *bg, gauge_alert_style_t style) {
+    if (style == GAUGE_ALERT_FULL_SCREEN) {
+        lv_obj_set_style_bg_color(bg, COLOR_BLACK, LV_PART_MAIN);
+    } else if (style == GAUGE_ALERT_RING && phase_on) {
+        ring_invalidate(lv_obj_get_screen(bg));
+    }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void gauge_alert_start(lv_obj_t *screen_bg) {
+    if (!screen_bg) return;
+
+    int free_slot = -1;
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i] == screen_bg) return;
+        if (!alert_bgs[i] && free_slot < 0) free_slot = i;
+    }
+    if (free_slot < 0) return;
+
+    lv_obj_t *screen = lv_obj_get_screen(screen_bg);
+    if (!screen_has_other_alert(screen, screen_bg)) {
+        lv_obj_add_event_cb(screen, ring_draw_cb, LV_EVENT_DRAW_POST, NULL);
+    }
+    alert_bgs[free_slot] = screen_bg;
+
+    if (!alert_timer) {
+        alert_timer = lv_timer_create(alert_timer_cb, BLINK_ANIM_TIME, NULL);
+        phase_on = false;
+        alert_toggle();  // Flash at once, like the first half of the old blink
+    } else if (phase_on) {
+        gauge_alert_style_t style = effective_style();
+        apply_phase(screen_bg, style, true);
+        if (is_panel_style(style)) update_panel(style);
+    }
+}
+
+void gauge_alert_stop(lv_obj_t *screen_bg) {
+    if (!screen_bg) return;
+
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i] != screen_bg) continue;
+
+        gauge_alert_style_t style = effective_style();
+        lv_obj_t *screen = lv_obj_get_screen(screen_bg);
+        clear_alert(screen_bg, style);
+        if (!screen_has_other_alert(screen, screen_bg)) {
+            lv_obj_remove_event_cb(screen, ring_draw_cb);
+        }
+        alert_bgs[i] = NULL;
+        if (is_panel_style(style)) update_panel(style);
+    }
+
+    bool any = false;
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i]) any = true;
+    }
+    if (!any && alert_timer) {
+        lv_timer_del(alert_timer);
+        alert_timer = NULL;
+        phase_on = false;
+    }
+}
+
+void gauge_alert_set_style(gauge_alert_style_t style) {
+    if (style >= GAUGE_ALERT_STYLE_COUNT) return;
+
+    gauge_alert_style_t old_style = effective_style();
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i]) clear_alert(alert_bgs[i], old_style);
+    }
+    if (is_panel_style(old_style)) panel_set(old_style, false);
+
+    alert_style = style;
+
+    gauge_alert_style_t new_style = effective_style();
+    for (int i = 0; i < GAUGE_ALERT_MAX_ACTIVE; i++) {
+        if (alert_bgs[i] && phase_on) apply_phase(alert_bgs[i], new_style, true);
+    }
+    if (is_panel_style(new_style)) update_panel(new_style);
+}
+
+gauge_alert_style_t gauge_alert_get_style(void) {
+    return effective_style();
+}
+
+void gauge_alert_set_panel_hook(gauge_alert_style_t style, gauge_alert_panel_cb_t cb) {
+    if (!is_panel_style(style)) return;
+
+    // Restore the panel before its hook goes away
+    if (!cb && panel_flashed && effective_style() == style) panel_set(style, false);
+    panel_hooks[style] = cb;
+}
+
+#if GAUGE_ALERT_BENCHMARK
+void gauge_alert_benchmark(gauge_alert_bench_t *result) {
+    lv_obj_t *prev_screen = lv_scr_act();
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, COLOR_SCREEN_BG, 0);
+    lv_scr_load(screen);
+
+    lv_obj_t *bg = lv_obj_create(screen);
+    lv_obj_set_size(bg, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_color(bg, COLOR_BLACK, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(bg, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_border_width(bg, 0, LV_PART_MAIN);
+
+    gauge_alert_style_t saved_style = alert_style;
+    gauge_stats_t stats;
+    force_panel = true;
+
+    for (int s = 0; s < GAUGE_ALERT_STYLE_COUNT; s++) {
+        gauge_alert_set_style((gauge_alert_style_t)s);
+        gauge_alert_start(bg);
+        lv_timer_pause(alert_timer);  // Toggled by hand below
+        lv_refr_now(NULL);
+        gauge_stats_get(&stats, true);
+        panel_commands = 0;
+
+        uint32_t start = lv_tick_get();
+        for (int t = 0; t < 1000 / BLINK_ANIM_TIME; t++) {
+            alert_toggle();
+            lv_refr_now(NULL);
+        }
+
+        if (result) {
+            result->render_ms[s] = lv_tick_elaps(start);
+            gauge_stats_get(&stats, true);
+            result->flushed_bytes[s] = stats.rendered_px * sizeof(lv_color_t);  // Needs gauge_stats_monitor_cb registered
+            result->panel_commands[s] = panel_commands;
+        }
+        lv_timer_resume(alert_timer);
+        gauge_alert_stop(bg);
+    }
+
+    force_panel = false;
+    gauge_alert_set_style(saved_style);
+    lv_scr_load(prev_screen);
+    lv_obj_del(screen);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+#ifndef GAUGE_ALERT_H
+#define GAUGE_ALERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+#include "gauges_config.h"
+
+// ============================================================================
+// ALERT PRESENTATION
+// ============================================================================
+
+/**
+ * @brief How an alerting gauge flashes
+ *
+ * Every alert blinks on one shared BLINK_ANIM_TIME timer, in phase.
+ *
+ * FULL_SCREEN repaints the gauge background: a whole frame per toggle.
+ * RING repaints only a GAUGE_ALERT_RING_WIDTH band along the screen edge.
+ * PANEL_INVERT and PANEL_DIM flash the panel itself through a board hook
+ * (gauge_alert_set_panel_hook()): one command per toggle, nothing rendered.
+ * A panel style without a hook falls back to RING.
+ */
+typedef enum {
+    GAUGE_ALERT_FULL_SCREEN = 0,
+    GAUGE_ALERT_RING,
+    GAUGE_ALERT_PANEL_INVERT,
+    GAUGE_ALERT_PANEL_DIM,
+    GAUGE_ALERT_STYLE_COUNT
+} gauge_alert_style_t;
+
+/**
+ * @brief Board hook of a panel style
+ * @param on true to invert / dim the panel, false to restore it
+ */
+typedef void (*gauge_alert_panel_cb_t)(bool on);
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Start flashing for a gauge (no-op if already started)
+ *
+ * Only the alert of the visible screen reaches the panel hooks; a gauge in
+ * alert on a hidden screen costs nothing until shown.
+ *
+ * @param screen_bg Full-screen background of the gauge, identifies the alert
+ */
+void gauge_alert_start(lv_obj_t *screen_bg);
+
+/**
+ * @brief Stop flashing for a gauge and restore its screen
+ * @param screen_bg Background given to gauge_alert_start()
+ */
+void gauge_alert_stop(lv_obj_t *screen_bg);
+
+/**
+ * @brief Change the alert style; running alerts continue in the new style
+ * @param style Style (GAUGE_ALERT_STYLE at startup)
+ */
+void gauge_alert_set_style(gauge_alert_style_t style);
+
+/**
+ * @brief Style currently used, after the fallback of a panel style without hook
+ */
+gauge_alert_style_t gauge_alert_get_style(void);
+
+/**
+ * @brief Register the board hook of a panel style
+ *
+ * Called from the LVGL context (timer), with the LVGL lock held.
+ *
+ * @param style GAUGE_ALERT_PANEL_INVERT or GAUGE_ALERT_PANEL_DIM
+ * @param cb Hook, NULL to remove
+ */
+void gauge_alert_set_panel_hook(gauge_alert_style_t style, gauge_alert_panel_cb_t cb);
+
+#if GAUGE_ALERT_BENCHMARK
+/**
+ * @brief Cost of one alert second per style
+ */
+typedef struct {
+    uint32_t flushed_bytes[GAUGE_ALERT_STYLE_COUNT];   // Pixel data flushed to the panel
+    uint32_t panel_commands[GAUGE_ALERT_STYLE_COUNT];  // Hook calls (panel styles)
+    uint32_t render_ms[GAUGE_ALERT_STYLE_COUNT];       // Toggle + refresh time
+} gauge_alert_bench_t;
+
+/**
+ * @brief Measure the bytes flushed per alert second of every style
+ *
+ * Shows a temporary screen with a full-screen background and, per style,
+ * runs one second of toggles (1000 / BLINK_ANIM_TIME), forcing a refresh
+ * (lv_refr_now) after each. Panel styles are measured whether or not their
+ * hook is registered. Flushed bytes come from gauge_stats_monitor_cb (zero
+ * if not registered); the stats frame counters are reset. Must be called
+ * with the LVGL lock held.
+ *
+ * @param result Bytes, commands and timings per style
+ */
+void gauge_alert_benchmark(gauge_alert_bench_t *result);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_ALERT_H
@@ -0,0 +1,285 @@
+// Generated by scripts/gen_gauge_geometry.py from screen_profiles.json - DO NOT EDIT
+// Value arc ring scanlines for the span rasterizer (gauge_common.c), one quadrant
+#ifndef GAUGE_ARC_SPANS_H
+#define GAUGE_ARC_SPANS_H
+
+#if GAUGE_SCREEN_RES == 466
+    // 209 rows x 6 B + 620 B of edge coverage
+    #define GAUGE_ARC_SPAN_RADIUS 209
+    #define GAUGE_ARC_SPAN_WIDTH 24
+    #define GAUGE_ARC_SPAN_MAX_AA 19
+    #define GAUGE_ARC_SPAN_ROWS { \
+        {185, 185, 209, 209, 0}, {184, 185, 208, 209, 0}, {184, 185, 208, 209, 2}, {184, 185, 208, 209, 4}, {184, 185, 208, 209, 6}, {184, 185, 208, 209, 8}, \
+        {184, 185, 208, 209, 10}, {184, 185, 208, 209, 12}, {184, 185, 208, 209, 14}, {184, 185, 208, 209, 16}, {184, 185, 208, 209, 18}, {184, 185, 208, 209, 20}, \
+        {184, 185, 208, 209, 22}, {184, 185, 208, 209, 24}, {184, 185, 208, 209, 26}, {184, 185, 208, 209, 28}, {184, 185, 208, 209, 30}, {184, 185, 208, 209, 32}, \
+        {184, 185, 208, 209, 34}, {183, 184, 208, 209, 36}, {183, 184, 207, 208, 38}, {183, 184, 207, 208, 40}, {183, 184, 207, 208, 42}, {183, 184, 207, 208, 44}, \
+        {183, 184, 207, 208, 46}, {183, 184, 207, 208, 48}, {183, 184, 207, 208, 50}, {182, 183, 207, 208, 52}, {182, 183, 207, 208, 54}, {182, 183, 206, 207, 56}, \
+        {182, 183, 206, 207, 58}, {182, 183, 206, 207, 60}, {182, 183, 206, 207, 62}, {181, 182, 206, 207, 64}, {181, 182, 206, 207, 66}, {181, 182, 205, 206, 68}, \
+        {181, 182, 205, 206, 70}, {181, 182, 205, 206, 72}, {180, 181, 205, 206, 74}, {180, 181, 205, 206, 76}, {180, 181, 205, 206, 78}, {180, 181, 204, 205, 80}, \
+        {180, 181, 204, 205, 82}, {179, 180, 204, 205, 84}, {179, 180, 204, 205, 86}, {179, 180, 203, 204, 88}, {179, 180, 203, 204, 90}, {178, 179, 203, 204, 92}, \
+        {178, 179, 203, 204, 94}, {178, 179, 203, 204, 96}, {177, 178, 202, 203, 98}, {177, 178, 202, 203, 100}, {177, 178, 202, 203, 102}, {177, 178, 202, 203, 104}, \
+        {176, 177, 201, 202, 106}, {176, 177, 201, 202, 108}, {176, 177, 201, 202, 110}, {175, 176, 200, 201, 112}, {175, 176, 200, 201, 114}, {175, 176, 200, 201, 116}, \
+        {174, 175, 200, 201, 118}, {174, 175, 199, 200, 120}, {174, 175, 199, 200, 122}, {173, 174, 199, 200, 124}, {173, 174, 198, 199, 126}, {172, 174, 198, 199, 128}, \
+        {172, 173, 198, 199, 131}, {172, 173, 197, 198, 133}, {171, 172, 197, 198, 135}, {171, 172, 197, 198, 137}, {171, 172, 196, 197, 139}, {170, 171, 196, 197, 141}, \
+        {170, 171, 195, 197, 143}, {169, 170, 195, 196, 146}, {169, 170, 195, 196, 148}, {168, 169, 194, 195, 150}, {168, 169, 194, 195, 152}, {167, 169, 194, 195, 154}, \
+        {167, 168, 193, 194, 157}, {166, 168, 193, 194, 159}, {166, 167, 192, 193, 162}, {166, 167, 192, 193, 164}, {165, 166, 191, 193, 166}, {165, 166, 191, 192, 169}, \
+        {164, 165, 191, 192, 171}, {163, 165, 190, 191, 173}, {163, 164, 190, 191, 176}, {162, 164, 189, 190, 178}, {162, 163, 189, 190, 181}, {161, 162, 188, 189, 183}, \
+        {161, 162, 188, 189, 185}, {160, 161, 187, 188, 187}, {160, 161, 187, 188, 189}, {159, 160, 186, 187, 191}, {158, 160, 186, 187, 193}, {158, 159, 185, 186, 196}, \
+        {157, 158, 185, 186, 198}, {157, 158, 184, 185, 200}, {156, 157, 184, 185, 202}, {155, 157, 183, 184, 204}, {155, 156, 183, 184, 207}, {154, 155, 182, 183, 209}, \
+        {153, 155, 182, 183, 211}, {153, 154, 181, 182, 214}, {152, 153, 180, 182, 216}, {151, 153, 180, 181, 219}, {151, 152, 179, 180, 222}, {150, 151, 179, 180, 224}, \
+        {149, 150, 178, 179, 226}, {148, 150, 177, 179, 228}, {148, 149, 177, 178, 232}, {147, 148, 176, 177, 234}, {146, 147, 176, 177, 236}, {145, 147, 175, 176, 238}, \
+        {145, 146, 174, 175, 241}, {144, 145, 174, 175, 243}, {143, 144, 173, 174, 245}, {142, 144, 172, 173, 247}, {141, 143, 172, 173, 250}, {141, 142, 171, 172, 253}, \
+        {140, 141, 170, 171, 255}, {139, 140, 169, 171, 257}, {138, 139, 169, 170, 260}, {137, 138, 168, 169, 262}, {136, 138, 167, 168, 264}, {135, 137, 167, 168, 267}, \
+        {134, 136, 166, 167, 270}, {133, 135, 165, 166, 273}, {132, 134, 164, 165, 276}, {131, 133, 163, 165, 279}, {130, 132, 163, 164, 283}, {129, 131, 162, 163, 286}, \
+        {128, 130, 161, 162, 289}, {127, 129, 160, 161, 292}, {126, 128, 159, 161, 295}, {125, 127, 158, 160, 299}, {124, 126, 158, 159, 303}, {123, 125, 157, 158, 306}, \
+        {122, 123, 156, 157, 309}, {121, 122, 155, 156, 311}, {120, 121, 154, 155, 313}, {118, 120, 153, 154, 315}, {117, 119, 152, 154, 318}, {116, 118, 151, 153, 322}, \
+        {115, 116, 150, 152, 326}, {113, 115, 149, 151, 329}, {112, 114, 148, 150, 333}, {111, 112, 147, 149, 337}, {109, 111, 146, 148, 340}, {108, 110, 145, 147, 344}, \
+        {107, 108, 144, 146, 348}, {105, 107, 143, 145, 351}, {104, 106, 142, 144, 355}, {102, 104, 141, 143, 359}, {101, 103, 140, 141, 363}, {99, 101, 139, 140, 366}, \
+        {98, 100, 138, 139, 369}, {96, 98, 137, 138, 372}, {94, 96, 135, 137, 375}, {93, 95, 134, 136, 379}, {91, 93, 133, 135, 383}, {89, 91, 132, 133, 387}, \
+        {87, 89, 131, 132, 390}, {85, 88, 129, 131, 393}, {84, 86, 128, 130, 398}, {82, 84, 127, 128, 402}, {79, 82, 126, 127, 405}, {77, 80, 124, 126, 409}, \
+        {75, 78, 123, 124, 414}, {73, 75, 121, 123, 418}, {71, 73, 120, 122, 422}, {68, 71, 119, 120, 426}, {65, 68, 117, 119, 430}, {63, 66, 116, 117, 435}, \
+        {60, 63, 114, 116, 439}, {57, 60, 113, 114, 444}, {54, 57, 111, 113, 448}, {50, 54, 109, 111, 453}, {47, 50, 108, 110, 459}, {43, 47, 106, 108, 464}, \
+        {38, 43, 104, 106, 470}, {33, 38, 103, 105, 477}, {27, 33, 101, 103, 484}, {19, 27, 99, 101, 492}, {1, 19, 97, 99, 502}, {0, 0, 95, 97, 522}, \
+        {0, 0, 93, 95, 524}, {0, 0, 91, 93, 526}, {0, 0, 89, 91, 528}, {0, 0, 87, 89, 530}, {0, 0, 85, 87, 532}, {0, 0, 82, 85, 534}, \
+        {0, 0, 80, 83, 537}, {0, 0, 78, 80, 540}, {0, 0, 75, 78, 542}, {0, 0, 72, 75, 545}, {0, 0, 70, 73, 548}, {0, 0, 67, 70, 551}, \
+        {0, 0, 64, 67, 554}, {0, 0, 61, 64, 557}, {0, 0, 57, 61, 560}, {0, 0, 54, 57, 564}, {0, 0, 50, 54, 567}, {0, 0, 45, 50, 571}, \
+        {0, 0, 41, 45, 576}, {0, 0, 35, 41, 580}, {0, 0, 29, 35, 586}, {0, 0, 20, 29, 592}, {0, 0, 1, 20, 601}, \
+    }
+    #define GAUGE_ARC_SPAN_ALPHA { \
+        2, 254, 4, 251, 8, 248, 14, 243, 21, 237, 29, 229, 39, 221, 50, 211, \
+        62, 200, 76, 188, 91, 174, 108, 160, 126, 144, 145, 127, 166, 108, 188, 89, \
+        211, 68, 236, 46, 8, 23, 36, 252, 65, 227, 95, 200, 127, 172, 160, 142, \
+        195, 112, 230, 80, 15, 47, 54, 13, 94, 230, 135, 194, 178, 156, 222, 117, \
+        17, 77, 64, 35, 112, 244, 162, 200, 213, 155, 15, 108, 69, 61, 124, 12, \
+        181, 212, 239, 161, 50, 108, 111, 55, 173, 249, 236, 193, 54, 135, 120, 77, \
+        188, 17, 11, 204, 82, 141, 153, 78, 226, 13, 57, 194, 133, 127, 210, 58, \
+        46, 234, 126, 163, 207, 91, 49, 18, 133, 188, 218, 112, 65, 35, 153, 200, \
+        4, 243, 120, 95, 40, 188, 200, 44, 117, 140, 33, 236, 188, 98, 101, 197, \
+        252, 13, 64, 163, 166, 73, 36, 219, 141, 127, 15, 247, 33, 123, 174, 2, \
+        232, 78, 112, 216, 224, 117, 108, 251, 17, 222, 150, 111, 47, 2, 228, 177, \
+        120, 72, 15, 240, 197, 137, 90, 36, 212, 160, 102, 64, 221, 191, 108, 98, \
+        223, 8, 228, 108, 140, 219, 54, 102, 188, 210, 106, 90, 28, 243, 194, 166, \
+        72, 91, 172, 20, 232, 47, 162, 144, 94, 238, 17, 29, 239, 110, 175, 200, \
+        115, 69, 57, 156, 2, 207, 240, 23, 153, 106, 102, 186, 54, 50, 8, 210, \
+        127, 166, 201, 124, 61, 86, 131, 50, 247, 200, 17, 213, 56, 181, 120, 152, \
+        183, 126, 243, 35, 102, 94, 82, 150, 64, 252, 204, 49, 236, 51, 36, 222, \
+        101, 26, 211, 149, 20, 203, 194, 15, 197, 237, 36, 14, 195, 78, 15, 195, \
+        117, 20, 197, 153, 26, 203, 188, 36, 211, 219, 24, 49, 222, 249, 55, 64, \
+        236, 83, 82, 252, 108, 102, 131, 126, 152, 152, 171, 17, 181, 186, 50, 213, \
+        200, 13, 86, 247, 211, 25, 124, 219, 35, 8, 166, 226, 42, 54, 210, 229, \
+        47, 102, 230, 50, 2, 153, 229, 50, 57, 207, 226, 47, 115, 219, 42, 29, \
+        175, 211, 35, 94, 239, 200, 25, 20, 162, 186, 13, 91, 232, 171, 28, 166, \
+        152, 106, 243, 131, 54, 188, 108, 8, 140, 249, 83, 98, 228, 219, 55, 64, \
+        191, 188, 24, 36, 160, 153, 15, 137, 117, 2, 120, 240, 237, 78, 111, 228, \
+        194, 36, 108, 222, 149, 2, 112, 224, 101, 15, 123, 232, 204, 51, 36, 141, \
+        247, 150, 64, 166, 243, 94, 98, 197, 183, 35, 44, 140, 236, 120, 4, 95, \
+        188, 200, 56, 65, 153, 243, 131, 49, 133, 218, 201, 61, 46, 126, 207, 127, \
+        57, 133, 210, 186, 50, 11, 82, 153, 226, 240, 106, 54, 120, 188, 156, 23, \
+        50, 111, 173, 236, 200, 69, 15, 69, 124, 181, 239, 238, 110, 17, 64, 112, \
+        162, 213, 144, 17, 15, 54, 94, 135, 178, 222, 172, 47, 8, 36, 65, 95, \
+        127, 160, 195, 230, 194, 72, 2, 4, 8, 14, 21, 29, 39, 50, 62, 76, \
+        91, 108, 126, 145, 166, 188, 211, 236, 210, 90, 219, 102, 223, 108, 221, 108, \
+        212, 102, 197, 90, 177, 72, 251, 150, 47, 216, 117, 17, 174, 78, 219, 127, \
+        33, 252, 163, 73, 188, 101, 13, 200, 117, 33, 200, 120, 40, 188, 112, 35, \
+        234, 163, 91, 18, 194, 127, 58, 204, 141, 78, 13, 249, 193, 135, 77, 17, \
+        212, 161, 108, 55, 244, 200, 155, 108, 61, 12, 230, 194, 156, 117, 77, 35, \
+        252, 227, 200, 172, 142, 112, 80, 47, 13, 254, 251, 248, 243, 237, 229, 221, \
+        211, 200, 188, 174, 160, 144, 127, 108, 89, 68, 46, 23, \
+    }
+
+#elif GAUGE_SCREEN_RES == 240
+    // 108 rows x 6 B + 323 B of edge coverage
+    #define GAUGE_ARC_SPAN_RADIUS 108
+    #define GAUGE_ARC_SPAN_WIDTH 12
+    #define GAUGE_ARC_SPAN_MAX_AA 14
+    #define GAUGE_ARC_SPAN_ROWS { \
+        {96, 96, 108, 108, 0}, {95, 96, 107, 108, 0}, {95, 96, 107, 108, 2}, {95, 96, 107, 108, 4}, {95, 96, 107, 108, 6}, {95, 96, 107, 108, 8}, \
+        {95, 96, 107, 108, 10}, {95, 96, 107, 108, 12}, {95, 96, 107, 108, 14}, {95, 96, 107, 108, 16}, {95, 96, 107, 108, 18}, {95, 96, 107, 108, 20}, \
+        {95, 96, 107, 108, 22}, {95, 96, 107, 108, 24}, {94, 95, 107, 108, 26}, {94, 95, 106, 107, 28}, {94, 95, 106, 107, 30}, {94, 95, 106, 107, 32}, \
+        {94, 95, 106, 107, 34}, {93, 95, 106, 107, 36}, {93, 94, 106, 107, 39}, {93, 94, 105, 106, 41}, {93, 94, 105, 106, 43}, {93, 94, 105, 106, 45}, \
+        {92, 93, 105, 106, 47}, {92, 93, 104, 105, 49}, {92, 93, 104, 105, 51}, {91, 92, 104, 105, 53}, {91, 92, 104, 105, 55}, {91, 92, 103, 104, 57}, \
+        {91, 92, 103, 104, 59}, {90, 91, 103, 104, 61}, {90, 91, 102, 104, 63}, {89, 90, 102, 103, 66}, {89, 90, 102, 103, 68}, {89, 90, 101, 103, 70}, \
+        {88, 89, 101, 102, 73}, {88, 89, 101, 102, 75}, {87, 88, 100, 101, 77}, {87, 88, 100, 101, 79}, {86, 88, 100, 101, 81}, {86, 87, 99, 100, 84}, \
+        {86, 87, 99, 100, 86}, {85, 86, 98, 99, 88}, {85, 86, 98, 99, 90}, {84, 85, 97, 98, 92}, {83, 85, 97, 98, 94}, {83, 84, 96, 98, 97}, \
+        {82, 83, 96, 97, 100}, {82, 83, 95, 97, 102}, {81, 82, 95, 96, 105}, {80, 82, 94, 95, 107}, {80, 81, 94, 95, 110}, {79, 80, 93, 94, 112}, \
+        {78, 80, 93, 94, 114}, {78, 79, 92, 93, 117}, {77, 78, 91, 93, 119}, {76, 77, 91, 92, 122}, {75, 77, 90, 91, 124}, {75, 76, 90, 91, 127}, \
+        {74, 75, 89, 90, 129}, {73, 74, 88, 89, 131}, {72, 74, 87, 89, 133}, {71, 73, 87, 88, 137}, {70, 72, 86, 87, 140}, {70, 71, 85, 86, 143}, \
+        {69, 70, 84, 86, 145}, {68, 69, 84, 85, 148}, {67, 68, 83, 84, 150}, {66, 67, 82, 83, 152}, {64, 66, 81, 82, 154}, {63, 65, 80, 82, 157}, \
+        {62, 64, 79, 81, 161}, {61, 63, 78, 80, 165}, {60, 61, 78, 79, 169}, {58, 60, 77, 78, 171}, {57, 59, 76, 77, 174}, {56, 57, 75, 76, 177}, \
+        {54, 56, 73, 75, 179}, {53, 55, 72, 74, 183}, {51, 53, 71, 73, 187}, {50, 52, 70, 72, 191}, {48, 50, 69, 70, 195}, {46, 48, 68, 69, 198}, \
+        {45, 47, 66, 68, 201}, {43, 45, 65, 67, 205}, {40, 43, 64, 65, 209}, {38, 41, 62, 64, 213}, {36, 38, 61, 63, 218}, {33, 36, 60, 61, 222}, \
+        {31, 33, 58, 60, 226}, {27, 31, 56, 58, 230}, {24, 27, 55, 57, 236}, {19, 24, 53, 55, 241}, {14, 20, 51, 53, 248}, {1, 14, 49, 51, 256}, \
+        {0, 0, 47, 50, 271}, {0, 0, 45, 48, 274}, {0, 0, 43, 45, 277}, {0, 0, 41, 43, 279}, {0, 0, 38, 41, 281}, {0, 0, 35, 38, 284}, \
+        {0, 0, 32, 36, 287}, {0, 0, 29, 33, 291}, {0, 0, 25, 29, 295}, {0, 0, 21, 25, 299}, {0, 0, 15, 21, 303}, {0, 0, 1, 15, 309}, \
+    }
+    #define GAUGE_ARC_SPAN_ALPHA { \
+        3, 252, 8, 248, 16, 240, 27, 231, 40, 219, 56, 205, 75, 188, 96, 169, \
+        120, 148, 147, 125, 176, 99, 208, 70, 242, 40, 27, 7, 67, 224, 110, 186, \
+        155, 146, 202, 103, 3, 253, 59, 56, 11, 112, 212, 171, 160, 232, 106, 48, \
+        49, 115, 238, 184, 177, 11, 113, 86, 47, 163, 224, 242, 153, 83, 80, 168, \
+        248, 4, 16, 169, 107, 89, 200, 248, 7, 59, 162, 157, 75, 24, 224, 128, \
+        132, 3, 234, 37, 112, 177, 224, 77, 110, 210, 226, 106, 120, 231, 19, 242, \
+        122, 144, 240, 11, 51, 127, 181, 238, 11, 96, 120, 16, 232, 224, 155, 101, \
+        83, 198, 16, 226, 70, 163, 160, 104, 245, 28, 51, 110, 3, 205, 188, 160, \
+        49, 120, 120, 86, 186, 56, 250, 248, 40, 32, 224, 99, 14, 202, 153, 187, \
+        203, 176, 248, 47, 171, 89, 171, 127, 176, 160, 14, 187, 188, 32, 202, 212, \
+        21, 56, 224, 231, 42, 86, 250, 245, 59, 120, 70, 3, 160, 77, 51, 205, \
+        80, 104, 77, 16, 163, 245, 70, 83, 226, 231, 59, 16, 155, 212, 42, 96, \
+        232, 188, 21, 51, 181, 160, 19, 144, 127, 120, 242, 248, 89, 110, 226, 203, \
+        47, 3, 112, 224, 153, 24, 128, 234, 248, 99, 59, 157, 186, 40, 16, 107, \
+        200, 120, 83, 168, 188, 49, 11, 86, 163, 242, 245, 110, 48, 115, 184, 160, \
+        28, 3, 56, 112, 171, 232, 198, 70, 27, 67, 110, 155, 202, 253, 224, 101, \
+        3, 8, 16, 27, 40, 56, 75, 96, 120, 147, 176, 208, 242, 238, 120, 240, \
+        127, 11, 231, 122, 11, 210, 106, 177, 77, 224, 132, 37, 248, 162, 75, 248, \
+        169, 89, 7, 224, 153, 80, 4, 238, 177, 113, 47, 212, 160, 106, 49, 224, \
+        186, 146, 103, 59, 11, 252, 248, 240, 231, 219, 205, 188, 169, 148, 125, 99, \
+        70, 40, 7, \
+    }
+
+#elif GAUGE_SCREEN_RES == 360
+    // 162 rows x 6 B + 468 B of edge coverage
+    #define GAUGE_ARC_SPAN_RADIUS 162
+    #define GAUGE_ARC_SPAN_WIDTH 18
+    #define GAUGE_ARC_SPAN_MAX_AA 17
+    #define GAUGE_ARC_SPAN_ROWS { \
+        {144, 144, 162, 162, 0}, {143, 144, 161, 162, 0}, {143, 144, 161, 162, 2}, {143, 144, 161, 162, 4}, {143, 144, 161, 162, 6}, {143, 144, 161, 162, 8}, \
+        {143, 144, 161, 162, 10}, {143, 144, 161, 162, 12}, {143, 144, 161, 162, 14}, {143, 144, 161, 162, 16}, {143, 144, 161, 162, 18}, {143, 144, 161, 162, 20}, \
+        {143, 144, 161, 162, 22}, {143, 144, 161, 162, 24}, {143, 144, 161, 162, 26}, {143, 144, 161, 162, 28}, {143, 144, 161, 162, 30}, {142, 143, 161, 162, 32}, \
+        {142, 143, 160, 161, 34}, {142, 143, 160, 161, 36}, {142, 143, 160, 161, 38}, {142, 143, 160, 161, 40}, {142, 143, 160, 161, 42}, {142, 143, 160, 161, 44}, \
+        {141, 142, 160, 161, 46}, {141, 142, 159, 160, 48}, {141, 142, 159, 160, 50}, {141, 142, 159, 160, 52}, {141, 142, 159, 160, 54}, {140, 141, 159, 160, 56}, \
+        {140, 141, 159, 160, 58}, {140, 141, 158, 159, 60}, {140, 141, 158, 159, 62}, {140, 141, 158, 159, 64}, {139, 140, 158, 159, 66}, {139, 140, 158, 159, 68}, \
+        {139, 140, 157, 158, 70}, {139, 140, 157, 158, 72}, {138, 139, 157, 158, 74}, {138, 139, 157, 158, 76}, {138, 139, 156, 157, 78}, {137, 138, 156, 157, 80}, \
+        {137, 138, 156, 157, 82}, {137, 138, 156, 157, 84}, {136, 137, 155, 156, 86}, {136, 137, 155, 156, 88}, {136, 137, 155, 156, 90}, {135, 136, 154, 155, 92}, \
+        {135, 136, 154, 155, 94}, {135, 136, 154, 155, 96}, {134, 135, 153, 154, 98}, {134, 135, 153, 154, 100}, {134, 135, 153, 154, 102}, {133, 134, 152, 153, 104}, \
+        {133, 134, 152, 153, 106}, {132, 133, 152, 153, 108}, {132, 133, 151, 152, 110}, {131, 133, 151, 152, 112}, {131, 132, 151, 152, 115}, {131, 132, 150, 151, 117}, \
+        {130, 131, 150, 151, 119}, {130, 131, 149, 150, 121}, {129, 130, 149, 150, 123}, {129, 130, 148, 150, 125}, {128, 129, 148, 149, 128}, {128, 129, 148, 149, 130}, \
+        {127, 128, 147, 148, 132}, {127, 128, 147, 148, 134}, {126, 127, 146, 147, 136}, {126, 127, 146, 147, 138}, {125, 126, 145, 146, 140}, {124, 126, 145, 146, 142}, \
+        {124, 125, 144, 145, 145}, {123, 124, 144, 145, 147}, {123, 124, 143, 144, 149}, {122, 123, 143, 144, 151}, {121, 123, 142, 143, 153}, {121, 122, 142, 143, 156}, \
+        {120, 121, 141, 142, 158}, {119, 121, 141, 142, 160}, {119, 120, 140, 141, 163}, {118, 119, 139, 141, 165}, {117, 119, 139, 140, 168}, {117, 118, 138, 139, 171}, \
+        {116, 117, 138, 139, 173}, {115, 116, 137, 138, 175}, {115, 116, 136, 138, 177}, {114, 115, 136, 137, 180}, {113, 114, 135, 136, 182}, {112, 113, 134, 136, 184}, \
+        {111, 113, 134, 135, 187}, {111, 112, 133, 134, 190}, {110, 111, 132, 134, 192}, {109, 110, 132, 133, 195}, {108, 109, 131, 132, 197}, {107, 108, 130, 131, 199}, \
+        {106, 108, 130, 131, 201}, {105, 107, 129, 130, 204}, {104, 106, 128, 129, 207}, {103, 105, 127, 128, 210}, {102, 104, 126, 128, 213}, {101, 103, 126, 127, 217}, \
+        {100, 102, 125, 126, 220}, {99, 101, 124, 125, 223}, {98, 100, 123, 124, 226}, {97, 99, 122, 124, 229}, {96, 98, 121, 123, 233}, {95, 97, 121, 122, 237}, \
+        {94, 95, 120, 121, 240}, {93, 94, 119, 120, 242}, {92, 93, 118, 119, 244}, {90, 92, 117, 118, 246}, {89, 91, 116, 117, 249}, {88, 89, 115, 116, 252}, \
+        {87, 88, 114, 115, 254}, {85, 87, 113, 114, 256}, {84, 85, 112, 113, 259}, {82, 84, 111, 112, 261}, {81, 83, 110, 111, 264}, {79, 81, 109, 110, 267}, \
+        {78, 80, 108, 109, 270}, {76, 78, 106, 108, 273}, {75, 77, 105, 107, 277}, {73, 75, 104, 106, 281}, {71, 73, 103, 104, 285}, {70, 72, 102, 103, 288}, \
+        {68, 70, 100, 102, 291}, {66, 68, 99, 101, 295}, {64, 66, 98, 99, 299}, {62, 64, 97, 98, 302}, {60, 62, 95, 97, 305}, {57, 60, 94, 95, 309}, \
+        {55, 58, 92, 94, 313}, {53, 55, 91, 93, 318}, {50, 53, 89, 91, 322}, {47, 50, 88, 90, 327}, {44, 47, 86, 88, 332}, {41, 44, 85, 87, 337}, \
+        {38, 41, 83, 85, 342}, {34, 38, 81, 83, 347}, {29, 34, 80, 82, 353}, {24, 29, 78, 80, 360}, {17, 24, 76, 78, 367}, {1, 17, 74, 76, 376}, \
+        {0, 0, 72, 74, 394}, {0, 0, 70, 72, 396}, {0, 0, 68, 70, 398}, {0, 0, 66, 68, 400}, {0, 0, 63, 66, 402}, {0, 0, 61, 64, 405}, \
+        {0, 0, 59, 61, 408}, {0, 0, 56, 59, 410}, {0, 0, 53, 56, 413}, {0, 0, 50, 53, 416}, {0, 0, 47, 50, 419}, {0, 0, 44, 47, 422}, \
+        {0, 0, 40, 44, 425}, {0, 0, 36, 40, 429}, {0, 0, 31, 36, 433}, {0, 0, 25, 31, 438}, {0, 0, 18, 25, 444}, {0, 0, 1, 18, 451}, \
+    }
+    #define GAUGE_ARC_SPAN_ALPHA { \
+        2, 253, 6, 250, 11, 245, 18, 239, 27, 231, 38, 222, 50, 211, 64, 198, \
+        80, 184, 98, 168, 117, 151, 139, 132, 162, 111, 186, 89, 213, 66, 241, 41, \
+        18, 14, 50, 239, 84, 209, 119, 178, 156, 144, 195, 110, 236, 74, 27, 36, \
+        71, 248, 117, 207, 165, 165, 215, 121, 16, 75, 69, 28, 124, 230, 181, 179, \
+        239, 127, 52, 74, 114, 19, 177, 211, 243, 152, 64, 92, 133, 31, 204, 215, \
+        32, 151, 107, 85, 183, 17, 18, 193, 98, 122, 179, 50, 22, 220, 107, 144, \
+        193, 67, 43, 231, 133, 151, 225, 69, 82, 226, 177, 141, 39, 55, 139, 206, \
+        6, 239, 116, 108, 25, 213, 170, 87, 75, 195, 215, 75, 118, 186, 253, 19, \
+        71, 152, 186, 50, 77, 179, 195, 74, 91, 198, 213, 89, 114, 209, 18, 239, \
+        97, 146, 212, 55, 97, 186, 207, 101, 89, 20, 236, 195, 156, 74, 80, 174, \
+        7, 220, 50, 149, 146, 82, 239, 19, 18, 227, 110, 165, 198, 107, 66, 52, \
+        149, 204, 230, 14, 154, 92, 108, 168, 66, 241, 28, 27, 225, 99, 188, 166, \
+        154, 231, 22, 124, 85, 98, 144, 75, 201, 55, 245, 50, 39, 227, 102, 27, \
+        213, 151, 18, 202, 196, 13, 195, 239, 39, 11, 192, 80, 13, 192, 118, 18, \
+        195, 152, 27, 202, 184, 39, 213, 212, 19, 55, 227, 237, 45, 75, 245, 69, \
+        98, 89, 124, 107, 154, 121, 27, 188, 132, 66, 225, 140, 108, 144, 154, 146, \
+        52, 204, 144, 107, 140, 18, 165, 132, 82, 227, 121, 7, 149, 107, 80, 220, \
+        89, 20, 156, 237, 69, 101, 236, 212, 45, 55, 186, 184, 19, 18, 146, 152, \
+        114, 239, 118, 91, 213, 239, 80, 77, 195, 196, 39, 71, 186, 151, 75, 186, \
+        102, 87, 195, 201, 50, 6, 108, 213, 144, 39, 139, 239, 231, 85, 82, 177, \
+        166, 22, 43, 133, 225, 241, 99, 22, 107, 193, 168, 28, 18, 98, 179, 230, \
+        92, 32, 107, 183, 149, 14, 64, 133, 204, 198, 66, 52, 114, 177, 243, 239, \
+        110, 16, 69, 124, 181, 239, 146, 19, 27, 71, 117, 165, 215, 174, 50, 18, \
+        50, 84, 119, 156, 195, 236, 195, 74, 2, 6, 11, 18, 27, 38, 50, 64, \
+        80, 98, 117, 139, 162, 186, 213, 241, 207, 89, 212, 97, 209, 97, 198, 89, \
+        179, 74, 253, 152, 50, 215, 118, 19, 170, 75, 206, 116, 25, 226, 141, 55, \
+        231, 151, 69, 220, 144, 67, 193, 122, 50, 215, 151, 85, 17, 211, 152, 92, \
+        31, 230, 179, 127, 74, 19, 248, 207, 165, 121, 75, 28, 239, 209, 178, 144, \
+        110, 74, 36, 253, 250, 245, 239, 231, 222, 211, 198, 184, 168, 151, 132, 111, \
+        89, 66, 41, 14, \
+    }
+
+#elif GAUGE_SCREEN_RES == 412
+    // 188 rows x 6 B + 546 B of edge coverage
+    #define GAUGE_ARC_SPAN_RADIUS 188
+    #define GAUGE_ARC_SPAN_WIDTH 21
+    #define GAUGE_ARC_SPAN_MAX_AA 18
+    #define GAUGE_ARC_SPAN_ROWS { \
+        {167, 167, 188, 188, 0}, {166, 167, 187, 188, 0}, {166, 167, 187, 188, 2}, {166, 167, 187, 188, 4}, {166, 167, 187, 188, 6}, {166, 167, 187, 188, 8}, \
+        {166, 167, 187, 188, 10}, {166, 167, 187, 188, 12}, {166, 167, 187, 188, 14}, {166, 167, 187, 188, 16}, {166, 167, 187, 188, 18}, {166, 167, 187, 188, 20}, \
+        {166, 167, 187, 188, 22}, {166, 167, 187, 188, 24}, {166, 167, 187, 188, 26}, {166, 167, 187, 188, 28}, {166, 167, 187, 188, 30}, {166, 167, 187, 188, 32}, \
+        {165, 166, 187, 188, 34}, {165, 166, 186, 187, 36}, {165, 166, 186, 187, 38}, {165, 166, 186, 187, 40}, {165, 166, 186, 187, 42}, {165, 166, 186, 187, 44}, \
+        {165, 166, 186, 187, 46}, {165, 166, 186, 187, 48}, {164, 165, 186, 187, 50}, {164, 165, 185, 186, 52}, {164, 165, 185, 186, 54}, {164, 165, 185, 186, 56}, \
+        {164, 165, 185, 186, 58}, {163, 165, 185, 186, 60}, {163, 164, 185, 186, 63}, {163, 164, 184, 185, 65}, {163, 164, 184, 185, 67}, {163, 164, 184, 185, 69}, \
+        {162, 163, 184, 185, 71}, {162, 163, 184, 185, 73}, {162, 163, 184, 185, 75}, {162, 163, 183, 184, 77}, {162, 163, 183, 184, 79}, {161, 162, 183, 184, 81}, \
+        {161, 162, 183, 184, 83}, {161, 162, 182, 183, 85}, {160, 161, 182, 183, 87}, {160, 161, 182, 183, 89}, {160, 161, 182, 183, 91}, {160, 161, 181, 182, 93}, \
+        {159, 160, 181, 182, 95}, {159, 160, 181, 182, 97}, {159, 160, 181, 182, 99}, {158, 159, 180, 181, 101}, {158, 159, 180, 181, 103}, {158, 159, 180, 181, 105}, \
+        {157, 158, 179, 180, 107}, {157, 158, 179, 180, 109}, {157, 158, 179, 180, 111}, {156, 157, 178, 180, 113}, {156, 157, 178, 179, 116}, {156, 157, 178, 179, 118}, \
+        {155, 156, 177, 179, 120}, {155, 156, 177, 178, 123}, {154, 155, 177, 178, 125}, {154, 155, 176, 177, 127}, {154, 155, 176, 177, 129}, {153, 154, 176, 177, 131}, \
+        {153, 154, 175, 176, 133}, {152, 153, 175, 176, 135}, {152, 153, 175, 176, 137}, {151, 152, 174, 175, 139}, {151, 152, 174, 175, 141}, {150, 151, 173, 174, 143}, \
+        {150, 151, 173, 174, 145}, {149, 151, 172, 174, 147}, {149, 150, 172, 173, 151}, {148, 150, 172, 173, 153}, {148, 149, 171, 172, 156}, {147, 148, 171, 172, 158}, \
+        {147, 148, 170, 171, 160}, {146, 147, 170, 171, 162}, {146, 147, 169, 170, 164}, {145, 146, 169, 170, 166}, {145, 146, 168, 169, 168}, {144, 145, 168, 169, 170}, \
+        {143, 145, 167, 168, 172}, {143, 144, 167, 168, 175}, {142, 143, 166, 167, 177}, {142, 143, 166, 167, 179}, {141, 142, 165, 166, 181}, {140, 142, 165, 166, 183}, \
+        {140, 141, 164, 165, 186}, {139, 140, 164, 165, 188}, {138, 140, 163, 164, 190}, {138, 139, 163, 164, 193}, {137, 138, 162, 163, 195}, {136, 138, 161, 163, 197}, \
+        {136, 137, 161, 162, 201}, {135, 136, 160, 161, 203}, {134, 135, 160, 161, 205}, {134, 135, 159, 160, 207}, {133, 134, 158, 159, 209}, {132, 133, 158, 159, 211}, \
+        {131, 132, 157, 158, 213}, {130, 132, 156, 158, 215}, {130, 131, 156, 157, 219}, {129, 130, 155, 156, 221}, {128, 129, 154, 156, 223}, {127, 128, 154, 155, 226}, \
+        {126, 128, 153, 154, 228}, {125, 127, 152, 153, 231}, {125, 126, 151, 153, 234}, {124, 125, 151, 152, 237}, {123, 124, 150, 151, 239}, {122, 123, 149, 150, 241}, \
+        {121, 122, 148, 150, 243}, {120, 121, 148, 149, 246}, {119, 120, 147, 148, 248}, {118, 119, 146, 147, 250}, {117, 118, 145, 147, 252}, {116, 117, 144, 146, 255}, \
+        {115, 116, 144, 145, 258}, {114, 115, 143, 144, 260}, {113, 114, 142, 143, 262}, {112, 113, 141, 142, 264}, {111, 112, 140, 142, 266}, {109, 111, 139, 141, 269}, \
+        {108, 110, 138, 140, 273}, {107, 109, 137, 139, 277}, {106, 107, 137, 138, 281}, {105, 106, 136, 137, 283}, {103, 105, 135, 136, 285}, {102, 104, 134, 135, 288}, \
+        {101, 102, 133, 134, 291}, {100, 101, 132, 133, 293}, {98, 100, 131, 132, 295}, {97, 98, 130, 131, 298}, {95, 97, 129, 130, 300}, {94, 96, 127, 129, 303}, \
+        {92, 94, 126, 128, 307}, {91, 93, 125, 127, 311}, {89, 91, 124, 126, 315}, {88, 90, 123, 125, 319}, {86, 88, 122, 123, 323}, {84, 86, 121, 122, 326}, \
+        {83, 85, 119, 121, 329}, {81, 83, 118, 120, 333}, {79, 81, 117, 119, 337}, {77, 79, 116, 117, 341}, {75, 77, 114, 116, 344}, {73, 76, 113, 115, 348}, \
+        {71, 74, 112, 113, 353}, {69, 71, 110, 112, 357}, {67, 69, 109, 111, 361}, {65, 67, 108, 109, 365}, {62, 65, 106, 108, 368}, {60, 62, 105, 107, 373}, \
+        {57, 60, 103, 105, 377}, {54, 57, 102, 104, 382}, {51, 54, 100, 102, 387}, {48, 51, 99, 100, 392}, {44, 48, 97, 99, 396}, {41, 44, 95, 97, 402}, \
+        {36, 41, 94, 96, 407}, {31, 36, 92, 94, 414}, {26, 32, 90, 92, 421}, {18, 26, 88, 90, 429}, {1, 18, 86, 88, 439}, {0, 0, 84, 86, 458}, \
+        {0, 0, 82, 84, 460}, {0, 0, 80, 82, 462}, {0, 0, 78, 80, 464}, {0, 0, 76, 78, 466}, {0, 0, 73, 76, 468}, {0, 0, 71, 74, 471}, \
+        {0, 0, 69, 71, 474}, {0, 0, 66, 69, 476}, {0, 0, 63, 66, 479}, {0, 0, 60, 63, 482}, {0, 0, 57, 61, 485}, {0, 0, 54, 58, 489}, \
+        {0, 0, 51, 54, 493}, {0, 0, 47, 51, 496}, {0, 0, 43, 47, 500}, {0, 0, 39, 43, 504}, {0, 0, 33, 39, 508}, {0, 0, 27, 33, 514}, \
+        {0, 0, 19, 27, 520}, {0, 0, 1, 19, 528}, \
+    }
+    #define GAUGE_ARC_SPAN_ALPHA { \
+        2, 253, 5, 251, 9, 247, 16, 241, 23, 234, 32, 226, 43, 217, 55, 206, \
+        69, 194, 84, 180, 101, 165, 119, 149, 139, 131, 161, 112, 184, 92, 208, 70, \
+        234, 47, 8, 23, 37, 251, 68, 224, 100, 195, 133, 165, 168, 134, 205, 101, \
+        243, 68, 31, 32, 72, 248, 115, 210, 159, 171, 205, 130, 2, 252, 88, 51, \
+        44, 101, 251, 153, 205, 206, 157, 12, 108, 69, 58, 127, 7, 187, 203, 248, \
+        149, 63, 93, 127, 36, 193, 226, 14, 167, 83, 105, 153, 43, 225, 226, 54, \
+        161, 129, 95, 205, 27, 40, 203, 119, 133, 200, 61, 42, 232, 126, 157, 211, \
+        81, 58, 247, 4, 147, 168, 237, 88, 90, 248, 7, 184, 165, 42, 81, 138, \
+        236, 235, 149, 100, 61, 200, 210, 69, 119, 173, 27, 46, 171, 153, 76, 31, \
+        215, 141, 118, 23, 252, 253, 19, 136, 153, 23, 251, 51, 139, 181, 31, 77, \
+        150, 203, 46, 96, 168, 218, 69, 108, 194, 226, 100, 114, 8, 228, 228, 138, \
+        112, 51, 222, 184, 104, 101, 210, 22, 237, 89, 159, 191, 84, 68, 12, 225, \
+        165, 155, 39, 87, 133, 23, 232, 224, 4, 170, 93, 110, 180, 54, 47, 205, \
+        130, 153, 210, 104, 73, 58, 149, 16, 216, 222, 9, 174, 81, 136, 150, 101, \
+        217, 7, 69, 72, 40, 234, 134, 14, 206, 194, 182, 251, 44, 161, 100, 142, \
+        153, 127, 203, 115, 251, 49, 106, 95, 100, 138, 97, 179, 97, 217, 19, 100, \
+        252, 55, 106, 89, 115, 120, 127, 149, 142, 175, 161, 198, 7, 14, 182, 218, \
+        28, 40, 206, 236, 47, 69, 234, 251, 63, 101, 77, 136, 88, 16, 174, 96, \
+        58, 216, 101, 104, 104, 153, 104, 54, 205, 101, 110, 96, 23, 170, 88, 87, \
+        232, 251, 77, 12, 155, 236, 63, 84, 225, 218, 47, 22, 159, 198, 28, 101, \
+        237, 175, 7, 51, 184, 149, 8, 138, 120, 100, 228, 252, 89, 69, 194, 217, \
+        55, 46, 168, 179, 19, 31, 150, 138, 23, 139, 251, 95, 23, 136, 251, 203, \
+        49, 31, 141, 252, 153, 46, 153, 251, 100, 69, 173, 194, 44, 100, 200, 134, \
+        42, 138, 235, 217, 72, 90, 184, 150, 7, 58, 147, 237, 222, 81, 42, 126, \
+        211, 149, 9, 40, 119, 200, 210, 73, 54, 129, 205, 130, 14, 83, 153, 225, \
+        180, 47, 63, 127, 193, 224, 93, 12, 69, 127, 187, 248, 133, 4, 2, 51, \
+        101, 153, 206, 165, 39, 31, 72, 115, 159, 205, 252, 191, 68, 8, 37, 68, \
+        100, 133, 168, 205, 243, 210, 89, 2, 5, 9, 16, 23, 32, 43, 55, 69, \
+        84, 101, 119, 139, 161, 184, 208, 234, 222, 104, 228, 112, 226, 114, 218, 108, \
+        203, 96, 181, 77, 253, 153, 51, 215, 118, 19, 171, 76, 210, 119, 27, 236, \
+        149, 61, 248, 165, 81, 247, 168, 88, 7, 232, 157, 81, 4, 203, 133, 61, \
+        226, 161, 95, 27, 226, 167, 105, 43, 203, 149, 93, 36, 251, 205, 157, 108, \
+        58, 7, 248, 210, 171, 130, 88, 44, 251, 224, 195, 165, 134, 101, 68, 32, \
+        253, 251, 247, 241, 234, 226, 217, 206, 194, 180, 165, 149, 131, 112, 92, 70, \
+        47, 23, \
+    }
+
+#endif
+
+#endif // GAUGE_ARC_SPANS_H
@@ -0,0 +1,69 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_channels.h"
+#include "gauges_config.h"
+#include "gauge_peaks.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+// Oil pressure is green from the bottom of the scale: too low is relative to the
+// RPM (low_rpm_divisor) and shown red instead
+static const gauge_channel_info_t channel_info[GAUGE_CHANNEL_COUNT] = {
+    [GAUGE_CHANNEL_OIL_TEMP]     = {OIL_TEMP_SYMBOL, OIL_TEMP_TEXT_LABEL, "°C", GAUGE_PEAK_OIL_TEMP,
+                                    {0, OIL_TEMP_MIN, OIL_TEMP_MAX,
+                                     OIL_TEMP_ZONE_GREEN, OIL_TEMP_ZONE_ORANGE, OIL_TEMP_ZONE_RED,
+                                     OIL_TEMP_ALERT_THRESHOLD, 0.0f, 0.0f}},
+    [GAUGE_CHANNEL_WATER_TEMP]   = {WATER_SYMBOL, WATER_TEXT_LABEL, "°C", GAUGE_PEAK_WATER_TEMP,
+                                    {0, WATER_TEMP_MIN, WATER_TEMP_MAX,
+                                     WATER_TEMP_ZONE_GREEN, WATER_TEMP_ZONE_ORANGE, WATER_TEMP_ZONE_RED,
+                                     WATER_TEMP_ALERT_THRESHOLD, 0.0f, 0.0f}},
+    [GAUGE_CHANNEL_OIL_PRESSURE] = {OIL_PRESSURE_SYMBOL, OIL_PRES_TEXT_LABEL, "bar", GAUGE_PEAK_OIL_PRESSURE,
+                                    {1, GAUGE_MODEL_FIXED(OIL_PRESSURE_MIN, 1), GAUGE_MODEL_FIXED(OIL_PRESSURE_MAX, 1),
+                                     GAUGE_MODEL_FIXED(OIL_PRESSURE_MIN, 1),
+                                     GAUGE_MODEL_FIXED(OIL_PRESSURE_ZONE_ORANGE, 1),
+                                     GAUGE_MODEL_FIXED(OIL_PRESSURE_ZONE_RED, 1),
+                                     GAUGE_MODEL_FIXED(OIL_PRESSURE_ALERT_HIGH, 1),
+                                     OIL_PRESSURE_RPM_DIVISOR, OIL_PRESSURE_MIN_IDLE}},
+    [GAUGE_CHANNEL_RPM]          = {NULL, "RPM", "rpm", -1,
+                                    {0, 0, RPM_GAUGE_MAX,
+                                     0, RPM_GAUGE_ZONE_ORANGE, RPM_GAUGE_REDLINE,
+                                     RPM_GAUGE_REDLINE, 0.0f, 0.0f}},
+};
+
+static const gauge_model_config_t *const channel_models[GAUGE_CHANNEL_COUNT] = {
+    &channel_info[GAUGE_CHANNEL_OIL_TEMP].model,
+    &channel_info[GAUGE_CHANNEL_WATER_TEMP].model,
+    &channel_info[GAUGE_CHANNEL_OIL_PRESSURE].model,
+    &channel_info[GAUGE_CHANNEL_RPM].model,
+};
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+const gauge_channel_info_t* gauge_channel_info(gauge_channel_t channel) {
+    return &channel_info[channel];
+}
+
+const char* gauge_channel_caption(gauge_channel_t channel, const lv_font_t **font) {
+    #if USE_CUSTOM_ICON_FONT
+    if (channel_info[channel].icon_symbol) {
+        *font = FONT_ICON;
+        return channel_info[channel].icon_symbol;
+    }
+    #endif
+    *font = FONT_MARKERS;
+    return channel_info[channel].text_label;
+}
+
+const gauge_model_config_t *const * gauge_channel_models(void) {
+    return channel_models;
+}
+
+#ifdef __cplusplus
+}
+#endif
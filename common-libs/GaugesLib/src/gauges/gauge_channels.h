@@ -0,0 +1,57 @@
+#ifndef GAUGE_CHANNELS_H
+#define GAUGE_CHANNELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lvgl.h"
+#include "gauge_model.h"
+
+// ============================================================================
+// TELEMETRY CHANNELS
+// ============================================================================
+// gauge_channel_t is defined with the model (gauge_model.h).
+
+/**
+ * @brief Fixed presentation data of a channel
+ */
+typedef struct {
+    const char *icon_symbol;        // Icon font symbol, NULL if the channel has none
+    const char *text_label;         // Shown instead of the icon without USE_CUSTOM_ICON_FONT
+    const char *unit_text;
+    int8_t peak;                    // gauge_peak_t held for the channel, -1 if none
+    gauge_model_config_t model;     // Default range, zones and alerts (gauges_config.h)
+} gauge_channel_info_t;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Presentation data of a channel
+ * @param channel Channel, must be below GAUGE_CHANNEL_COUNT
+ */
+const gauge_channel_info_t* gauge_channel_info(gauge_channel_t channel);
+
+/**
+ * @brief Caption of a channel: its icon symbol, or its text label when the
+ *        icon font is disabled or the channel has no icon
+ * @param channel Channel
+ * @param font Font to show the caption with (FONT_ICON or FONT_MARKERS)
+ * @return Caption text
+ */
+const char* gauge_channel_caption(gauge_channel_t channel, const lv_font_t **font);
+
+/**
+ * @brief Model configurations of every channel, by channel, for gauge_model_update_all()
+ */
+const gauge_model_config_t *const * gauge_channel_models(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_CHANNELS_H
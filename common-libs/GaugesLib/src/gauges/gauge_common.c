@@ -3,24 +3,36 @@ extern "C" {
 #endif
 
 #include "gauge_common.h"
+#include "gauge_alert.h"
+#include "gauge_digits.h"
+#include "gauge_theme.h"
+#include "gauge_zones.h"
 #include <stdio.h>
-#include <math.h>
+#include <string.h>
+#include <stdlib.h>
 
-// Include custom font definitions (only in this compilation unit)
-#if USE_CUSTOM_TEMP_FONT
-    #include "../fonts/montserrat_bold_numbers_120.h"
+#if defined(ESP_PLATFORM) && defined(BOARD_HAS_PSRAM)
+#include "esp_heap_caps.h"
 #endif
 
-// Include needle gauge value font (used for needle gauge value labels)
-#ifdef USE_SCREEN_466PX
-    #include "../fonts/montserrat_bold_80.h"
+#if GAUGE_ARC_SPANS
+#include "gauge_arc_spans.h"
+#include "gauge_raster.h"
 #endif
 
-#if USE_CUSTOM_ICON_FONT
-    #ifdef USE_SCREEN_466PX
+// Include the custom fonts picked by the screen profile (only in this compilation unit).
+// With GAUGE_FONT_PARTITION they are mapped from flash at runtime instead (gauge_fonts.c).
+#if !GAUGE_FONT_PARTITION
+    #if GAUGE_FONT_MONTSERRAT_BOLD_NUMBERS_120
+        #include "../fonts/montserrat_bold_numbers_120.h"
+    #endif
+    #if GAUGE_FONT_MONTSERRAT_BOLD_80
+        #include "../fonts/montserrat_bold_80.h"
+    #endif
+    #if GAUGE_FONT_FA_ICONS_54
         #include "../fonts/fa_icons_54.h"
     #endif
-    #ifdef USE_SCREEN_240PX
+    #if GAUGE_FONT_FA_ICONS_32
         #include "../fonts/fa_icons_32.h"
     #endif
 #endif
@@ -30,15 +42,7 @@ extern "C" {
 // ============================================================================
 
 void gauge_arc_anim_cb(void *arc, int32_t value) {
-    lv_arc_set_value((lv_obj_t *)arc, value);
-}
-
-void gauge_bg_blink_anim_cb(void *obj, int32_t value) {
-    if (value == 0) {
-        lv_obj_set_style_bg_color((lv_obj_t *)obj, COLOR_BLACK, LV_PART_MAIN);
-    } else {
-        lv_obj_set_style_bg_color((lv_obj_t *)obj, COLOR_RED, LV_PART_MAIN);
-    }
+    gauge_arc_set_value((lv_obj_t *)arc, value);
 }
 
 // ============================================================================
@@ -48,272 +52,655 @@ void gauge_bg_blink_anim_cb(void *obj, int32_t value) {
 void gauge_start_blink(gauge_state_t *state) {
     if (!state || !state->screen_bg) return;
 
-    lv_anim_init(&state->blink_anim);
-    lv_anim_set_var(&state->blink_anim, state->screen_bg);
-    lv_anim_set_values(&state->blink_anim, 0, 1);
-    lv_anim_set_time(&state->blink_anim, BLINK_ANIM_TIME);
-    lv_anim_set_playback_time(&state->blink_anim, BLINK_PLAYBACK_TIME);
-    lv_anim_set_repeat_count(&state->blink_anim, LV_ANIM_REPEAT_INFINITE);
-    lv_anim_set_exec_cb(&state->blink_anim, gauge_bg_blink_anim_cb);
-    lv_anim_set_path_cb(&state->blink_anim, lv_anim_path_step);
-    lv_anim_start(&state->blink_anim);
+    gauge_alert_start(state->screen_bg);
 }
 
 void gauge_stop_blink(gauge_state_t *state) {
     if (!state || !state->screen_bg) return;
 
-    lv_anim_del(state->screen_bg, NULL);
-    lv_obj_set_style_bg_color(state->screen_bg, COLOR_BLACK, LV_PART_MAIN);
+    gauge_alert_stop(state->screen_bg);
 }
 
 // ============================================================================
 // HELPER FUNCTIONS
 // ============================================================================
 
-float gauge_calc_marker_gap(int32_t temp_min, int32_t temp_max, int32_t marker_interval) {
-    return ((float)(ARC_END_ANGLE - ARC_START_ANGLE)) /
-           ((temp_max - temp_min) / marker_interval);
+
+/**
+ * @brief Precomputed geometry of an arc gauge scale (border, ticks and labels)
+ *
+ * Filled once by gauge_create_border_and_markers(); the draw callback only
+ * reads it. Label areas are relative to the scale center.
+ */
+typedef struct {
+    lv_coord_t border_radius;
+    lv_coord_t tick_radius;
+    lv_coord_t tick_width;
+    uint8_t marker_count;
+    uint16_t tick_angle[GAUGE_SCALE_MAX_MARKERS];
+    lv_area_t label_area[GAUGE_SCALE_MAX_MARKERS];
+    char label_text[GAUGE_SCALE_MAX_MARKERS][8];
+} gauge_scale_geom_t;
+
+/**
+ * @brief One arc scale marker from the generated table
+ */
+typedef struct {
+    uint16_t angle;     // Tick angle (degrees, LVGL orientation)
+    int16_t label_x;    // Label center relative to the scale center
+    int16_t label_y;
+} gauge_marker_point_t;
+
+// Marker angles and label positions for every marker spacing (gauge_geometry.h)
+static const gauge_marker_point_t marker_points[] = GAUGE_MARKER_POINTS;
+
+// Catch a gauge_geometry.h generated from other dimensions than the ones used here
+_Static_assert(GAUGE_MARKER_LABEL_RADIUS == (ARC_SIZE / 2) - ARC_WIDTH - MARKER_LABEL_OFFSET,
+               "gauge_geometry.h is out of date: run scripts/gen_gauge_geometry.py");
+_Static_assert(ARC_START_ANGLE == 135 && ARC_END_ANGLE - ARC_START_ANGLE == 270,
+               "Arc angles changed: update screen_profiles.json and run scripts/gen_gauge_geometry.py");
+
+static void gauge_scale_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    gauge_scale_geom_t *geom = (gauge_scale_geom_t *)lv_obj_get_user_data(obj);
+    if (!geom) return;
+
+    if (code == LV_EVENT_DELETE) {
+        lv_obj_set_user_data(obj, NULL);
+        lv_mem_free(geom);
+        return;
+    }
+    if (code != LV_EVENT_DRAW_MAIN) return;
+
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_point_t center = {
+        (lv_coord_t)(coords.x1 + lv_area_get_width(&coords) / 2),
+        (lv_coord_t)(coords.y1 + lv_area_get_height(&coords) / 2)
+    };
+
+    // Border
+    lv_draw_arc_dsc_t arc_dsc;
+    lv_draw_arc_dsc_init(&arc_dsc);
+    arc_dsc.color = gauge_theme_color(GAUGE_COLOR_SCALE);
+    arc_dsc.width = LINE_WIDTH;
+    lv_draw_arc(draw_ctx, &arc_dsc, &center, geom->border_radius,
+                ARC_START_ANGLE % 360, ARC_END_ANGLE % 360);
+
+    // Ticks and labels
+    arc_dsc.color = gauge_theme_color(GAUGE_COLOR_SCALE);
+    arc_dsc.width = geom->tick_width;
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.font = FONT_MARKERS;
+    label_dsc.color = gauge_theme_color(GAUGE_COLOR_SCALE);
+
+    for (int i = 0; i < geom->marker_count; i++) {
+        uint16_t start = geom->tick_angle[i];
+        lv_draw_arc(draw_ctx, &arc_dsc, &center, geom->tick_radius,
+                    start, (start + ARC_MARKER_ANGLE_OFFSET) % 360);
+
+        lv_area_t label_area = geom->label_area[i];
+        label_area.x1 += center.x;
+        label_area.x2 += center.x;
+        label_area.y1 += center.y;
+        label_area.y2 += center.y;
+        lv_draw_label(draw_ctx, &label_dsc, &label_area, geom->label_text[i], NULL);
+    }
 }
 
-static void position_marker(lv_obj_t *marker, int position, float marker_gap) {
-    lv_obj_set_size(marker, ARC_SIZE + (LINE_WIDTH * ARC_MARKER_SIZE_MULTIPLIER),
-                    ARC_SIZE + (LINE_WIDTH * ARC_MARKER_SIZE_MULTIPLIER));
-    lv_obj_align(marker, LV_ALIGN_CENTER, 0, 0);
+// ============================================================================
+// VALUE ARC
+// ============================================================================
 
-    lv_obj_set_style_arc_width(marker, ARC_WIDTH + (LINE_WIDTH * ARC_MARKER_SIZE_MULTIPLIER), LV_PART_MAIN);
-    lv_obj_set_style_arc_rounded(marker, false, LV_PART_MAIN);
-    lv_obj_set_style_arc_color(marker, COLOR_WHITE, LV_PART_MAIN);
+#define GAUGE_ARC_SLICES ((ARC_END_ANGLE - ARC_START_ANGLE) / GAUGE_ARC_GRADIENT_STEP + 1)
+
+/**
+ * @brief Value arc data: zone segments and the current fill angle
+ *
+ * Angles are degrees in LVGL orientation, unwrapped (angle_end may exceed 360).
+ * The zones are fixed positions on the scale, so the fill is colored by where
+ * it is drawn and a value change never restyles the object.
+ */
+typedef struct {
+    int32_t min;
+    int32_t max;
+    int16_t angle_start;
+    int16_t angle_end;
+    int16_t value_angle;                        // End of the fill (angle_start when empty)
+    int16_t zone_angle[GAUGE_ZONE_COUNT + 1];   // Zone z spans zone_angle[z] .. zone_angle[z + 1]
+    bool alert;                                 // Whole fill in the alert color
+    bool marker_shown;
+    int16_t marker_angle;                       // Peak / minimum marker (one degree wide)
+#if GAUGE_ARC_GRADIENT
+    uint8_t lut_theme;                          // Theme the LUT was built for
+    lv_color_t lut[GAUGE_ARC_SLICES];           // Color of each GAUGE_ARC_GRADIENT_STEP slice
+#endif
+} gauge_arc_t;
+
+/**
+ * @brief Grow an area to contain a point of the arc ring
+ */
+static void gauge_arc_area_add(lv_area_t *area, const lv_point_t *center, int32_t angle, int32_t radius) {
+    lv_coord_t x = (lv_coord_t)(center->x + ((radius * lv_trigo_sin((int16_t)(angle + 90))) >> LV_TRIGO_SHIFT));
+    lv_coord_t y = (lv_coord_t)(center->y + ((radius * lv_trigo_sin((int16_t)angle)) >> LV_TRIGO_SHIFT));
+    if (x < area->x1) area->x1 = x;
+    if (x > area->x2) area->x2 = x;
+    if (y < area->y1) area->y1 = y;
+    if (y > area->y2) area->y2 = y;
+}
 
-    lv_arc_set_bg_angles(marker,
-                        ARC_START_ANGLE + (position * marker_gap),
-                        ARC_START_ANGLE + (position * marker_gap) + ARC_MARKER_ANGLE_OFFSET);
+/**
+ * @brief Bounding box of the ring sector between two angles (a0 < a1)
+ *
+ * Both ends at the inner and outer radius, plus the outer radius on every
+ * axis the sector crosses, padded for anti-aliasing.
+ */
+static void gauge_arc_sector_area(const lv_point_t *center, int32_t a0, int32_t a1, lv_area_t *area) {
+    const int32_t r_out = ARC_SIZE / 2;
+    const int32_t r_in = r_out - ARC_WIDTH;
+
+    lv_area_set(area, LV_COORD_MAX, LV_COORD_MAX, -LV_COORD_MAX, -LV_COORD_MAX);
+    gauge_arc_area_add(area, center, a0, r_out);
+    gauge_arc_area_add(area, center, a0, r_in);
+    gauge_arc_area_add(area, center, a1, r_out);
+    gauge_arc_area_add(area, center, a1, r_in);
+    for (int32_t axis = (a0 / 90 + 1) * 90; axis < a1; axis += 90) {
+        gauge_arc_area_add(area, center, axis, r_out);
+    }
 
-    lv_obj_remove_style(marker, NULL, LV_PART_KNOB);
-    lv_obj_remove_style(marker, NULL, LV_PART_INDICATOR);
+    area->x1 -= GAUGE_ARC_INV_PAD;
+    area->y1 -= GAUGE_ARC_INV_PAD;
+    area->x2 += GAUGE_ARC_INV_PAD;
+    area->y2 += GAUGE_ARC_INV_PAD;
 }
 
-// ============================================================================
-// UI COMPONENT CREATION
-// ============================================================================
+static void gauge_arc_center(const lv_obj_t *obj, lv_point_t *center) {
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    center->x = (lv_coord_t)(coords.x1 + lv_area_get_width(&coords) / 2);
+    center->y = (lv_coord_t)(coords.y1 + lv_area_get_height(&coords) / 2);
+}
+
+/**
+ * @brief Invalidate only the part of the ring between two angles
+ */
+static void gauge_arc_invalidate_sector(lv_obj_t *obj, int32_t a0, int32_t a1) {
+    if (a0 == a1) return;
+    if (a0 > a1) {
+        int32_t tmp = a0;
+        a0 = a1;
+        a1 = tmp;
+    }
+
+    lv_point_t center;
+    gauge_arc_center(obj, &center);
+    lv_area_t area;
+    gauge_arc_sector_area(&center, a0, a1, &area);
+    lv_obj_invalidate_area(obj, &area);
+}
+
+#if GAUGE_ARC_SPANS
+static const gauge_arc_span_t arc_span_rows[GAUGE_ARC_SPAN_RADIUS] = GAUGE_ARC_SPAN_ROWS;
+static const lv_opa_t arc_span_alpha[] = GAUGE_ARC_SPAN_ALPHA;
+static const gauge_arc_ring_t arc_ring = {arc_span_rows, arc_span_alpha, GAUGE_ARC_SPAN_RADIUS};
+
+_Static_assert(GAUGE_ARC_SPAN_RADIUS == ARC_SIZE / 2 && GAUGE_ARC_SPAN_WIDTH == ARC_WIDTH,
+               "gauge_arc_spans.h is out of date: run scripts/gen_gauge_geometry.py");
+
+// Cleared by gauge_arc_benchmark() to time lv_draw_arc
+static bool arc_spans_enabled = true;
+
+typedef struct {
+    lv_draw_ctx_t *draw_ctx;
+    lv_draw_sw_blend_dsc_t dsc;
+} gauge_arc_blend_t;
+
+/**
+ * @brief Blend one run of the span rasterizer (gauge_raster.h)
+ */
+static void gauge_arc_blend_run(void *ctx, int32_t x, int32_t y, int32_t len, const uint8_t *mask) {
+    gauge_arc_blend_t *blend = (gauge_arc_blend_t *)ctx;
+    lv_area_t area;
+    lv_area_set(&area, (lv_coord_t)x, (lv_coord_t)y, (lv_coord_t)(x + len - 1), (lv_coord_t)y);
+
+    blend->dsc.mask_buf = (lv_opa_t *)mask;
+    blend->dsc.mask_res = mask ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+    blend->dsc.blend_area = &area;
+    blend->dsc.mask_area = &area;
+    lv_draw_sw_blend(blend->draw_ctx, &blend->dsc);
+}
+
+/**
+ * @brief Fill the ring between two angles from the span table
+ *
+ * Only the rows of the sector within the redraw area are rasterized, at most
+ * three blends per row and side (gauge_arc_raster()).
+ */
+static void gauge_arc_fill_spans(lv_draw_ctx_t *draw_ctx, const lv_point_t *center,
+                                 int32_t a0, int32_t a1, lv_color_t color) {
+    lv_area_t sector, rows;
+    gauge_arc_sector_area(center, a0, a1, &sector);
+    if (!_lv_area_intersect(&rows, &sector, draw_ctx->clip_area)) return;
+
+    gauge_arc_part_t parts[3];
+    int part_count = gauge_arc_split(a0, a1, lv_trigo_sin, parts);
+
+    gauge_arc_blend_t blend;
+    lv_memset_00(&blend, sizeof(blend));
+    blend.draw_ctx = draw_ctx;
+    blend.dsc.color = color;
+    blend.dsc.opa = LV_OPA_COVER;
+    blend.dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    gauge_arc_raster(&arc_ring, center->x, center->y, rows.y1, rows.y2, parts, part_count, gauge_arc_blend_run, &blend);
+}
+#endif
+
+static void gauge_arc_draw_span(lv_draw_ctx_t *draw_ctx, const lv_point_t *center,
+                                int32_t a0, int32_t a1, lv_color_t color) {
+    if (a1 <= a0) return;
 
-lv_obj_t* gauge_create_background(void) {
-    lv_obj_t *screen_bg = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(screen_bg, LV_PCT(100), LV_PCT(100));
-    lv_obj_set_style_bg_color(screen_bg, COLOR_BLACK, LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(screen_bg, LV_OPA_COVER, LV_PART_MAIN);
-    lv_obj_set_style_border_width(screen_bg, 0, LV_PART_MAIN);
-    lv_obj_move_background(screen_bg);
-    return screen_bg;
+#if GAUGE_ARC_SPANS
+    if (arc_spans_enabled) {
+        gauge_arc_fill_spans(draw_ctx, center, a0, a1, color);
+        return;
+    }
+#endif
+
+    lv_draw_arc_dsc_t arc_dsc;
+    lv_draw_arc_dsc_init(&arc_dsc);
+    arc_dsc.color = color;
+    arc_dsc.width = ARC_WIDTH;
+    arc_dsc.rounded = 0;
+    lv_draw_arc(draw_ctx, &arc_dsc, center, ARC_SIZE / 2, (uint16_t)(a0 % 360), (uint16_t)(a1 % 360));
+}
+
+#if GAUGE_ARC_GRADIENT
+/**
+ * @brief Zone at an angle (zones of zero width are skipped)
+ */
+static gauge_zone_t gauge_arc_zone_at(const gauge_arc_t *arc, int32_t angle) {
+    for (int zone = GAUGE_ZONE_COUNT - 1; zone > 0; zone--) {
+        if (angle >= arc->zone_angle[zone]) return (gauge_zone_t)zone;
+    }
+    return GAUGE_ZONE_GREY;
+}
+
+/**
+ * @brief Color of the fill at an angle: the zone color, blended with the
+ *        neighbouring zone within GAUGE_ARC_GRADIENT_BLEND / 2 of a boundary
+ */
+static lv_color_t gauge_arc_gradient_color(const gauge_arc_t *arc, int32_t angle) {
+    const int32_t half = GAUGE_ARC_GRADIENT_BLEND / 2;
+    gauge_zone_t zone = gauge_arc_zone_at(arc, angle);
+    lv_color_t color = gauge_zone_color(zone);
+
+    gauge_zone_t next = gauge_arc_zone_at(arc, angle + half);
+    if (next != zone) {
+        int32_t dist = arc->zone_angle[next] - angle;
+        return lv_color_mix(color, gauge_zone_color(next), (uint8_t)(128 + (127 * dist) / half));
+    }
+    gauge_zone_t prev = gauge_arc_zone_at(arc, angle - half);
+    if (prev != zone) {
+        int32_t dist = angle - arc->zone_angle[zone];
+        return lv_color_mix(color, gauge_zone_color(prev), (uint8_t)(128 + (127 * dist) / half));
+    }
+    return color;
 }
 
-lv_obj_t* gauge_create_arc(const gauge_config_t *config) {
-    lv_obj_t *arc = lv_arc_create(lv_scr_act());
+static void gauge_arc_build_lut(gauge_arc_t *arc) {
+    for (int i = 0; i < GAUGE_ARC_SLICES; i++) {
+        int32_t mid = arc->angle_start + i * GAUGE_ARC_GRADIENT_STEP + GAUGE_ARC_GRADIENT_STEP / 2;
+        arc->lut[i] = gauge_arc_gradient_color(arc, mid);
+    }
+    arc->lut_theme = (uint8_t)gauge_theme_get();
+}
+#endif
 
-    lv_obj_set_size(arc, ARC_SIZE, ARC_SIZE);
-    lv_obj_align(arc, LV_ALIGN_CENTER, 0, 0);
-    lv_arc_set_bg_angles(arc, ARC_START_ANGLE + ARC_ANGLE_OFFSET_START, ARC_END_ANGLE - ARC_ANGLE_OFFSET_END);
+/**
+ * @brief Draw the fill up to value_angle: zone segments, gradient slices or the
+ *        whole span in the alert color
+ */
+static void gauge_arc_draw_fill(lv_draw_ctx_t *draw_ctx, const lv_point_t *center, gauge_arc_t *arc) {
+    if (arc->alert) {
+        gauge_arc_draw_span(draw_ctx, center, arc->angle_start, arc->value_angle,
+                            gauge_theme_color(GAUGE_COLOR_ALERT));
+        return;
+    }
 
-    lv_obj_set_style_arc_color(arc, COLOR_BLACK, LV_PART_MAIN);
-    lv_obj_set_style_arc_color(arc, COLOR_AMBER, LV_PART_INDICATOR);
-    lv_obj_set_style_arc_rounded(arc, false, LV_PART_INDICATOR);
-    lv_obj_set_style_arc_width(arc, ARC_WIDTH, LV_PART_INDICATOR);
+#if GAUGE_ARC_GRADIENT
+    if (arc->lut_theme != (uint8_t)gauge_theme_get()) gauge_arc_build_lut(arc);
 
-    lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
+    // Slices overlap by one degree so no anti-aliased seam shows between them;
+    // slices outside the area being redrawn are skipped
+    for (int i = 0; i < GAUGE_ARC_SLICES; i++) {
+        int32_t a0 = arc->angle_start + i * GAUGE_ARC_GRADIENT_STEP;
+        if (a0 >= arc->value_angle) break;
+        int32_t a1 = LV_MIN(a0 + GAUGE_ARC_GRADIENT_STEP + 1, arc->value_angle);
 
-    lv_arc_set_range(arc, config->temp_min, config->temp_max);
-    lv_arc_set_value(arc, config->temp_min);
+        lv_area_t slice_area, visible;
+        gauge_arc_sector_area(center, a0, a1, &slice_area);
+        if (!_lv_area_intersect(&visible, &slice_area, draw_ctx->clip_area)) continue;
 
-    return arc;
+        gauge_arc_draw_span(draw_ctx, center, a0, a1, arc->lut[i]);
+    }
+#else
+    // One arc per zone the fill reaches, cut at the fill angle
+    for (int zone = 0; zone < GAUGE_ZONE_COUNT; zone++) {
+        int32_t a0 = arc->zone_angle[zone];
+        if (a0 >= arc->value_angle) break;
+        int32_t a1 = LV_MIN(arc->zone_angle[zone + 1], arc->value_angle);
+
+        gauge_arc_draw_span(draw_ctx, center, a0, a1, gauge_zone_color((gauge_zone_t)zone));
+    }
+#endif
 }
 
-void gauge_create_border_and_markers(const gauge_config_t *config) {
-    // Create border arc
-    lv_obj_t *border = lv_arc_create(lv_scr_act());
+static void gauge_arc_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    gauge_arc_t *arc = (gauge_arc_t *)lv_obj_get_user_data(obj);
+    if (!arc) return;
 
-    lv_obj_set_size(border,
-                    ARC_SIZE - (ARC_WIDTH * ARC_BORDER_WIDTH_MULTIPLIER) - (LINE_WIDTH * ARC_BORDER_LINE_MULTIPLIER),
-                    ARC_SIZE - (ARC_WIDTH * ARC_BORDER_WIDTH_MULTIPLIER) - (LINE_WIDTH * ARC_BORDER_LINE_MULTIPLIER));
-    lv_obj_align(border, LV_ALIGN_CENTER, 0, 0);
-    lv_arc_set_bg_angles(border, ARC_START_ANGLE, ARC_END_ANGLE);
+    if (code == LV_EVENT_DELETE) {
+        lv_obj_set_user_data(obj, NULL);
+        lv_mem_free(arc);
+        return;
+    }
+    if (code != LV_EVENT_DRAW_MAIN) return;
 
-    lv_obj_set_style_arc_width(border, LINE_WIDTH, LV_PART_MAIN);
-    lv_obj_set_style_arc_rounded(border, false, LV_PART_MAIN);
-    lv_obj_set_style_arc_color(border, COLOR_WHITE, LV_PART_MAIN);
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    lv_point_t center;
+    gauge_arc_center(obj, &center);
 
-    lv_obj_remove_style(border, NULL, LV_PART_KNOB);
-    lv_obj_remove_style(border, NULL, LV_PART_INDICATOR);
+    if (arc->value_angle > arc->angle_start) {
+        gauge_arc_draw_fill(draw_ctx, &center, arc);
+    }
+    if (arc->marker_shown) {
+        gauge_arc_draw_span(draw_ctx, &center, arc->marker_angle, arc->marker_angle + ARC_MARKER_ANGLE_OFFSET,
+                            gauge_theme_color(GAUGE_COLOR_TEXT));
+    }
+}
 
-    // Calculate markers
-    int marker_count = ((config->temp_max - config->temp_min) / config->marker_interval) + 1;
-    float marker_gap = gauge_calc_marker_gap(config->temp_min, config->temp_max,
-                                             config->marker_interval);
+void gauge_arc_set_value(lv_obj_t *obj, int32_t value) {
+    gauge_arc_t *arc = obj ? (gauge_arc_t *)lv_obj_get_user_data(obj) : NULL;
+    if (!arc) return;
 
-    // Style for marker labels
-    static lv_style_t style_marker_text;
-    lv_style_init(&style_marker_text);
-    lv_style_set_text_font(&style_marker_text, FONT_MARKERS);
-    lv_style_set_text_color(&style_marker_text, COLOR_WHITE);
+    int16_t angle = (int16_t)lv_map(value, arc->min, arc->max, arc->angle_start, arc->angle_end);
+    if (angle == arc->value_angle) return;
 
-    // Create markers and labels
-    for (int i = 0; i < marker_count; i++) {
-        // Create marker tick
-        lv_obj_t *marker = lv_arc_create(lv_scr_act());
-        position_marker(marker, i, marker_gap);
+    // Only the swept part of the ring changes
+    int16_t old_angle = arc->value_angle;
+    arc->value_angle = angle;
+    gauge_arc_invalidate_sector(obj, old_angle, angle);
+}
 
-        // Calculate label position
-        int temp_value = config->temp_min + (i * config->marker_interval);
-        float angle_rad = (ARC_START_ANGLE + (i * marker_gap)) * MATH_PI / DEGREES_TO_RADIANS;
-        int radius = (ARC_SIZE / 2) - ARC_WIDTH - MARKER_LABEL_OFFSET;
-        int label_x = (int)(radius * cosf(angle_rad));
-        int label_y = (int)(radius * sinf(angle_rad));
+void gauge_arc_set_alert(lv_obj_t *obj, bool alert) {
+    gauge_arc_t *arc = obj ? (gauge_arc_t *)lv_obj_get_user_data(obj) : NULL;
+    if (!arc || arc->alert == alert) return;
+
+    arc->alert = alert;
+    gauge_arc_invalidate_sector(obj, arc->angle_start, arc->value_angle);
+}
+
+void gauge_arc_set_marker(lv_obj_t *obj, bool show, int32_t value) {
+    gauge_arc_t *arc = obj ? (gauge_arc_t *)lv_obj_get_user_data(obj) : NULL;
+    if (!arc) return;
 
-        // Create label
-        lv_obj_t *label = lv_label_create(lv_scr_act());
-        char text[8];
+    // Same degree as the fill would end at, capped so the marker stays on the ring
+    int16_t angle = (int16_t)lv_map(value, arc->min, arc->max, arc->angle_start,
+                                    arc->angle_end - ARC_MARKER_ANGLE_OFFSET);
+    if (show == arc->marker_shown && (!show || angle == arc->marker_angle)) return;
+
+    // Old and new one-degree slices only
+    if (arc->marker_shown) {
+        gauge_arc_invalidate_sector(obj, arc->marker_angle, arc->marker_angle + ARC_MARKER_ANGLE_OFFSET);
+    }
+    arc->marker_shown = show;
+    arc->marker_angle = angle;
+    if (show) {
+        gauge_arc_invalidate_sector(obj, angle, angle + ARC_MARKER_ANGLE_OFFSET);
+    }
+}
+
+// ============================================================================
+// UI COMPONENT CREATION
+// ============================================================================
+
+lv_obj_t* gauge_create_arc(lv_obj_t *parent, const gauge_config_t *config) {
+    gauge_arc_t *arc = (gauge_arc_t *)lv_mem_alloc(sizeof(gauge_arc_t));
+    if (!arc) return NULL;
+    memset(arc, 0, sizeof(*arc));
+
+    arc->min = config->temp_min;
+    arc->max = config->temp_max;
+    arc->angle_start = ARC_START_ANGLE + ARC_ANGLE_OFFSET_START;
+    arc->angle_end = ARC_END_ANGLE - ARC_ANGLE_OFFSET_END;
+    arc->value_angle = arc->angle_start;
+
+    // Zone boundaries on the scale, kept in order if the thresholds are not
+    const int32_t bounds[GAUGE_ZONE_COUNT - 1] = {config->zone_green, config->zone_orange, config->zone_red};
+    arc->zone_angle[0] = arc->angle_start;
+    for (int i = 0; i < GAUGE_ZONE_COUNT - 1; i++) {
+        int16_t angle = (int16_t)lv_map(bounds[i], arc->min, arc->max, arc->angle_start, arc->angle_end);
+        arc->zone_angle[i + 1] = LV_MAX(angle, arc->zone_angle[i]);
+    }
+    arc->zone_angle[GAUGE_ZONE_COUNT] = arc->angle_end;
+#if GAUGE_ARC_GRADIENT
+    arc->lut_theme = GAUGE_THEME_COUNT;  // Built on first draw
+#endif
+
+    // A plain object draws the fill, no lv_arc styles or parts
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(obj, ARC_SIZE, ARC_SIZE);
+    lv_obj_align(obj, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_user_data(obj, arc);
+    lv_obj_add_event_cb(obj, gauge_arc_event_cb, LV_EVENT_ALL, NULL);
+
+    return obj;
+}
+
+lv_obj_t* gauge_create_border_and_markers(lv_obj_t *parent, const gauge_config_t *config) {
+    gauge_scale_geom_t *geom = (gauge_scale_geom_t *)lv_mem_alloc(sizeof(gauge_scale_geom_t));
+    if (!geom) return NULL;
+
+    // Border: same radius and width as the former border arc object
+    geom->border_radius = (ARC_SIZE - (ARC_WIDTH * ARC_BORDER_WIDTH_MULTIPLIER) -
+                           (LINE_WIDTH * ARC_BORDER_LINE_MULTIPLIER)) / 2;
+
+    // Ticks: 1 degree slices of a ring just outside the value arc
+    lv_coord_t scale_size = ARC_SIZE + (LINE_WIDTH * ARC_MARKER_SIZE_MULTIPLIER);
+    geom->tick_radius = scale_size / 2;
+    geom->tick_width = ARC_WIDTH + (LINE_WIDTH * ARC_MARKER_SIZE_MULTIPLIER);
+
+    // Markers: angles and label positions come precomputed for the profile,
+    // so no float math runs here
+    int segments = (config->temp_max - config->temp_min) / config->marker_interval;
+    if (segments < 1) segments = 1;
+    if (segments > GAUGE_SCALE_MAX_MARKERS - 1) segments = GAUGE_SCALE_MAX_MARKERS - 1;
+    const gauge_marker_point_t *points = &marker_points[GAUGE_MARKER_INDEX(segments)];
+    int marker_count = segments + 1;
+
+    geom->marker_count = (uint8_t)marker_count;
+    for (int i = 0; i < marker_count; i++) {
+        geom->tick_angle[i] = points[i].angle;
 
         // Format text based on value scale
+        int temp_value = config->temp_min + (i * config->marker_interval);
+        char *text = geom->label_text[i];
         if (config->value_scale > 1) {
             // Show decimal value (e.g., for pressure: 10 -> 1.0)
-            int scaled_value = temp_value / config->value_scale;
-            snprintf(text, sizeof(text), "%d", scaled_value);
+            snprintf(text, sizeof(geom->label_text[i]), "%d", temp_value / config->value_scale);
         } else {
             // Show integer value (e.g., for temperature: 80 -> 80)
-            snprintf(text, sizeof(text), "%d", temp_value);
+            snprintf(text, sizeof(geom->label_text[i]), "%d", temp_value);
         }
 
-        lv_label_set_text(label, text);
-        lv_obj_add_style(label, &style_marker_text, 0);
-        lv_obj_align(label, LV_ALIGN_CENTER, label_x, label_y);
+        // Label centered on the marker direction, relative to the scale center
+        int label_x = points[i].label_x;
+        int label_y = points[i].label_y;
+
+        lv_point_t text_size;
+        lv_txt_get_size(&text_size, text, FONT_MARKERS, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+        lv_area_t *area = &geom->label_area[i];
+        area->x1 = label_x - text_size.x / 2;
+        area->y1 = label_y - text_size.y / 2;
+        area->x2 = area->x1 + text_size.x - 1;
+        area->y2 = area->y1 + text_size.y - 1;
     }
+
+    // One plain object draws everything from the precomputed geometry
+    lv_obj_t *scale = lv_obj_create(parent);
+    lv_obj_remove_style_all(scale);
+    lv_obj_clear_flag(scale, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(scale, scale_size, scale_size);
+    lv_obj_align(scale, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_user_data(scale, geom);
+    lv_obj_add_event_cb(scale, gauge_scale_event_cb, LV_EVENT_ALL, NULL);
+
+    return scale;
 }
 
-void gauge_create_redline(const gauge_config_t *config) {
-    lv_obj_t *redline = lv_arc_create(lv_scr_act());
+void gauge_create_redline(lv_obj_t *parent, const gauge_config_t *config) {
+    lv_obj_t *redline = lv_arc_create(parent);
 
     lv_obj_set_size(redline, GAUGE_DIMENSION, GAUGE_DIMENSION);
     lv_obj_align(redline, LV_ALIGN_CENTER, 0, 0);
 
-    float redline_angle = ARC_START_ANGLE +
-                         ((ARC_END_ANGLE - ARC_START_ANGLE) *
-                          ((float)(config->redline - config->temp_min) /
-                           (config->temp_max - config->temp_min)));
+    // Integer math: same truncated angle as the float version, no soft-float on the C3
+    int32_t redline_angle = ARC_START_ANGLE +
+                            ((ARC_END_ANGLE - ARC_START_ANGLE) * (config->redline - config->temp_min)) /
+                            (config->temp_max - config->temp_min);
 
     lv_arc_set_bg_angles(redline, redline_angle, ARC_END_ANGLE);
 
-    lv_obj_set_style_arc_color(redline, COLOR_RED, LV_PART_MAIN);
+    gauge_theme_add_color(redline, LV_STYLE_ARC_COLOR, GAUGE_COLOR_ALERT, LV_PART_MAIN);
     lv_obj_set_style_arc_rounded(redline, false, LV_PART_MAIN);
     lv_obj_set_style_arc_width(redline, LINE_WIDTH * ARC_REDLINE_WIDTH_MULTIPLIER, LV_PART_MAIN);
 
     lv_obj_remove_style(redline, NULL, LV_PART_KNOB);
     lv_obj_remove_style(redline, NULL, LV_PART_INDICATOR);
+    lv_obj_clear_flag(redline, LV_OBJ_FLAG_CLICKABLE);  // Decoration only: taps reach the screen
+}
+
+// ============================================================================
+// MEMORY HELPERS
+// ============================================================================
+
+void* gauge_alloc_buffer(uint32_t size) {
+#if defined(ESP_PLATFORM) && defined(BOARD_HAS_PSRAM)
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+    return malloc(size);
+#endif
 }
 
-lv_obj_t* gauge_create_digital_display(void) {
-    // Create main temperature text
-    static lv_style_t style_temp_text;
-    lv_style_init(&style_temp_text);
-    lv_style_set_text_font(&style_temp_text, FONT_TEMP_MAIN);
-    lv_style_set_text_color(&style_temp_text, COLOR_WHITE);
-
-    lv_obj_t *temp_label = lv_label_create(lv_scr_act());
-    lv_label_set_text(temp_label, "0");
-    lv_obj_add_style(temp_label, &style_temp_text, 0);
-    lv_obj_align(temp_label, LV_ALIGN_CENTER, 0, TEMP_LABEL_Y_OFFSET);
-
-    // Create unit text
-    static lv_style_t style_unit_text;
-    lv_style_init(&style_unit_text);
-    lv_style_set_text_font(&style_unit_text, FONT_TEMP_UNIT);
-    lv_style_set_text_color(&style_unit_text, COLOR_AMBER);
-
-    lv_obj_t *temp_unit_label = lv_label_create(lv_scr_act());
-    lv_label_set_text(temp_unit_label, "°C");
-    lv_obj_add_style(temp_unit_label, &style_unit_text, 0);
-    lv_obj_align(temp_unit_label, LV_ALIGN_CENTER, 0, TEMP_UNIT_Y_OFFSET);
-
-    return temp_label;
+void gauge_free_buffer(void *buf) {
+#if defined(ESP_PLATFORM) && defined(BOARD_HAS_PSRAM)
+    heap_caps_free(buf);
+#else
+    free(buf);
+#endif
 }
 
-lv_obj_t* gauge_create_icon(const char *icon_symbol) {
-    static lv_style_t style_icon;
-    lv_style_init(&style_icon);
-    lv_style_set_text_font(&style_icon, FONT_ICON);
-    lv_style_set_text_color(&style_icon, COLOR_AMBER);
-
-    lv_obj_t *icon = lv_label_create(lv_scr_act());
-
-    #if USE_CUSTOM_ICON_FONT
-        // Use Font Awesome icon symbol
-        lv_label_set_text(icon, icon_symbol);
-    #else
-        // Use text fallback from global configuration
-        if (icon_symbol == OIL_TEMP_SYMBOL) {
-            lv_label_set_text(icon, OIL_TEMP_TEXT_LABEL);
-        } else if (icon_symbol == OIL_PRESSURE_SYMBOL) {
-            lv_label_set_text(icon, OIL_PRES_TEXT_LABEL);
-        } else if (icon_symbol == WATER_SYMBOL) {
-            lv_label_set_text(icon, WATER_TEXT_LABEL);
-        } else {
-            lv_label_set_text(icon, "---");
-        }
-    #endif
+// ============================================================================
+// TEARDOWN
+// ============================================================================
 
-    lv_obj_add_style(icon, &style_icon, 0);
-    lv_obj_align(icon, LV_ALIGN_BOTTOM_MID, 0, ICON_Y_OFFSET);
+void gauge_release(gauge_state_t *state) {
+    if (!state) return;
 
-    return icon;
+    if (state->screen_bg) gauge_alert_stop(state->screen_bg);
+    gauge_motion_detach(&state->arc_motion);
+    memset(state, 0, sizeof(*state));
 }
 
 // ============================================================================
 // GAUGE UPDATE
 // ============================================================================
 
-void gauge_update_value(gauge_state_t *state, const gauge_config_t *config, int32_t temperature) {
+void gauge_apply_model(gauge_state_t *state, const gauge_model_t *model) {
     if (!state || !state->arc || !state->label) return;
 
-    // Store actual temperature for display
-    int32_t display_temp = temperature;
-
-    // Constrain temperature to gauge range for arc display
-    int32_t arc_temp = temperature;
-    if (arc_temp < config->temp_min) arc_temp = config->temp_min;
-    if (arc_temp > config->temp_max) arc_temp = config->temp_max;
-
-    // Animate arc to new value (constrained)
-    lv_anim_t a;
-    lv_anim_init(&a);
-    lv_anim_set_var(&a, state->arc);
-    lv_anim_set_values(&a, lv_arc_get_value(state->arc), arc_temp);
-    lv_anim_set_time(&a, GAUGE_ANIM_TIME);
-    lv_anim_set_exec_cb(&a, gauge_arc_anim_cb);
-    lv_anim_set_path_cb(&a, lv_anim_path_linear);
-    lv_anim_start(&a);
-
-    // Set color based on temperature zones (using constrained value)
-    if (arc_temp < config->zone_green) {
-        lv_obj_set_style_arc_color(state->arc, COLOR_GREY, LV_PART_INDICATOR);
-    } else if (arc_temp < config->zone_orange) {
-        lv_obj_set_style_arc_color(state->arc, COLOR_GREEN, LV_PART_INDICATOR);
-    } else if (arc_temp < config->zone_red) {
-        lv_obj_set_style_arc_color(state->arc, COLOR_AMBER, LV_PART_INDICATOR);
-    } else {
-        lv_obj_set_style_arc_color(state->arc, COLOR_RED, LV_PART_INDICATOR);
+    uint8_t changes = gauge_model_sync(&state->shown, model);
+
+    // Move arc towards new value (constrained) on the shared motion timer
+    if (changes & GAUGE_MODEL_POSITION) gauge_motion_set_target(&state->arc_motion, model->position);
+
+    // Too low for the RPM turns the whole fill red
+    if (changes & GAUGE_MODEL_LOW) gauge_arc_set_alert(state->arc, model->low);
+
+    if (changes & GAUGE_MODEL_ALERT) {
+        if (model->alert) {
+            gauge_start_blink(state);
+        } else {
+            gauge_stop_blink(state);
+        }
     }
 
-    // Handle alert animation (using actual temperature)
-    if (display_temp >= config->alert_threshold && !state->is_blinking) {
-        gauge_start_blink(state);
-        state->is_blinking = true;
-    } else if (display_temp < config->alert_threshold && state->is_blinking) {
-        gauge_stop_blink(state);
-        state->is_blinking = false;
+    // Digital display with the actual value (not constrained)
+    if (changes & GAUGE_MODEL_TEXT) gauge_digits_set_text(state->label, model->text);
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+#if GAUGE_ARC_BENCHMARK
+void gauge_arc_benchmark(uint32_t iterations, gauge_arc_bench_t *result) {
+    lv_obj_t *prev_screen = lv_scr_act();
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, COLOR_SCREEN_BG, 0);
+    lv_scr_load(screen);
+
+    // Four zones, value at full scale: the whole ring is drawn
+    static const gauge_config_t bench_config = {
+        .temp_min = 0, .temp_max = 100,
+        .zone_green = 25, .zone_orange = 50, .zone_red = 75,
+        .redline = 90, .marker_interval = 10, .value_scale = 1
+    };
+    lv_obj_t *arc = gauge_create_arc(screen, &bench_config);
+    gauge_arc_set_value(arc, bench_config.temp_max);
+    lv_refr_now(NULL);
+
+    // Run 0 times the refresh without the arc (clear + flush), 1 the spans, 2 lv_draw_arc
+    uint32_t time_ms[3];
+    for (int run = 0; run < 3; run++) {
+        if (run == 0) {
+            lv_obj_add_flag(arc, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_clear_flag(arc, LV_OBJ_FLAG_HIDDEN);
+        }
+#if GAUGE_ARC_SPANS
+        arc_spans_enabled = (run != 2);
+#endif
+
+        uint32_t start = lv_tick_get();
+        for (uint32_t i = 0; i < iterations; i++) {
+            lv_obj_invalidate(arc);
+            lv_refr_now(NULL);
+        }
+        time_ms[run] = lv_tick_elaps(start);
+    }
+#if GAUGE_ARC_SPANS
+    arc_spans_enabled = true;
+#endif
+
+    if (result) {
+        result->refresh_ms = time_ms[0];
+        result->spans_ms = time_ms[1];
+        result->draw_arc_ms = time_ms[2];
     }
 
-    // Update digital display with actual temperature (not constrained)
-    static char temp_text[8];
-    snprintf(temp_text, sizeof(temp_text), "%d", display_temp);
-    lv_label_set_text(state->label, temp_text);
+    lv_scr_load(prev_screen);
+    lv_obj_del(screen);
 }
+#endif
 
 #ifdef __cplusplus
 }
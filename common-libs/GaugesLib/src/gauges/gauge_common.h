@@ -8,6 +8,8 @@ extern "C" {
 #include <stdint.h>
 #include "lvgl.h"
 #include "gauges_config.h"
+#include "gauge_motion.h"
+#include "gauge_model.h"
 
 // ============================================================================
 // GAUGE CONTEXT STRUCTURE
@@ -29,9 +31,8 @@ typedef struct {
     int32_t zone_orange;
     int32_t zone_red;
 
-    // Alert configuration
+    // Redline indicator (the alert itself is in gauge_model_config_t)
     int32_t redline;
-    int32_t alert_threshold;
 
     // Display configuration
     int32_t marker_interval;
@@ -46,11 +47,11 @@ typedef struct {
  */
 typedef struct {
     lv_obj_t *arc;
-    lv_obj_t *label;
+    lv_obj_t *label;            // Numeric readout (gauge_digits)
     lv_obj_t *screen_bg;
     lv_obj_t *icon;
-    lv_anim_t blink_anim;
-    bool is_blinking;
+    gauge_motion_t arc_motion;  // Drives the arc value (see gauge_motion.h)
+    gauge_model_t shown;        // Model state on screen (gauge_model_sync())
 } gauge_state_t;
 
 // ============================================================================
@@ -58,27 +59,24 @@ typedef struct {
 // ============================================================================
 
 /**
- * @brief Animation callback for arc value changes
+ * @brief Motion apply callback for arc value changes
+ *
+ * Pass to gauge_motion_attach() with the arc object as context.
  */
 void gauge_arc_anim_cb(void *arc, int32_t value);
 
-/**
- * @brief Animation callback for background blink effect
- */
-void gauge_bg_blink_anim_cb(void *obj, int32_t value);
-
 // ============================================================================
 // ANIMATION CONTROL
 // ============================================================================
 
 /**
- * @brief Start the alert blink animation
+ * @brief Start the alert blink (gauge_alert.h, shared timer and style)
  * @param state Gauge state containing screen background
  */
 void gauge_start_blink(gauge_state_t *state);
 
 /**
- * @brief Stop the alert blink animation
+ * @brief Stop the alert blink and restore the screen
  * @param state Gauge state containing screen background
  */
 void gauge_stop_blink(gauge_state_t *state);
@@ -87,68 +85,152 @@ void gauge_stop_blink(gauge_state_t *state);
 // UI COMPONENT CREATION
 // ============================================================================
 
-/**
- * @brief Create the gauge background screen
- * @return Background object
- */
-lv_obj_t* gauge_create_background(void);
-
 /**
  * @brief Create the main temperature arc
+ *
+ * The fill is drawn as fixed zone segments (grey / green / amber / red at the
+ * configured thresholds), so it never needs to be recolored.
+ *
+ * @param parent Scale layer the gauge is built on
  * @param config Gauge configuration
- * @return Arc object
+ * @return Arc object, or NULL if out of LVGL memory
  */
-lv_obj_t* gauge_create_arc(const gauge_config_t *config);
+lv_obj_t* gauge_create_arc(lv_obj_t *parent, const gauge_config_t *config);
 
 /**
  * @brief Create the border and markers around the gauge
+ *
+ * The border, every tick and every label are drawn by a single object from
+ * geometry computed here once (instead of one arc per tick and one label per
+ * marker).
+ *
+ * @param parent Scale layer the gauge is built on
  * @param config Gauge configuration
+ * @return Scale object, or NULL if out of LVGL memory
  */
-void gauge_create_border_and_markers(const gauge_config_t *config);
+lv_obj_t* gauge_create_border_and_markers(lv_obj_t *parent, const gauge_config_t *config);
 
 /**
  * @brief Create the redline indicator arc
+ * @param parent Scale layer the gauge is built on
  * @param config Gauge configuration
  */
-void gauge_create_redline(const gauge_config_t *config);
+void gauge_create_redline(lv_obj_t *parent, const gauge_config_t *config);
+
+// ============================================================================
+// VALUE ARC
+// ============================================================================
 
 /**
- * @brief Create the digital temperature display
- * @return Temperature label object
+ * @brief Set the value shown by an arc from gauge_create_arc()
+ *
+ * Invalidates only the ring sector between the previous and the new angle;
+ * does nothing if the value maps to the same angle.
+ *
+ * @param arc Arc object
+ * @param value New value, in the range of the gauge configuration
  */
-lv_obj_t* gauge_create_digital_display(void);
+void gauge_arc_set_value(lv_obj_t *arc, int32_t value);
 
 /**
- * @brief Create the gauge icon at the bottom
- * @param icon_symbol UTF-8 icon symbol to display
- * @return Icon label object
+ * @brief Draw the whole fill in the alert color instead of the zone colors
+ *
+ * For alerts that do not follow the fixed zones (oil pressure too low for the
+ * RPM). Invalidates the filled sector when the flag changes.
+ *
+ * @param arc Arc object
+ * @param alert true for the alert color
  */
-lv_obj_t* gauge_create_icon(const char *icon_symbol);
+void gauge_arc_set_alert(lv_obj_t *arc, bool alert);
+
+/**
+ * @brief Show a held value (peak / minimum) as a one-degree slice of the ring
+ *
+ * Drawn over the fill in the text color. Invalidates the old and new slices
+ * only when the marker moves to another degree or is shown / hidden.
+ *
+ * @param arc Arc object
+ * @param show false hides the marker
+ * @param value Marker value, in the range of the gauge configuration
+ */
+void gauge_arc_set_marker(lv_obj_t *arc, bool show, int32_t value);
+
+// ============================================================================
+// MEMORY HELPERS
+// ============================================================================
+
+/**
+ * @brief Allocate a large pixel buffer outside the LVGL heap
+ *
+ * Uses PSRAM on boards that have it (BOARD_HAS_PSRAM), the system heap otherwise.
+ *
+ * @param size Size in bytes
+ * @return Buffer, or NULL if out of memory
+ */
+void* gauge_alloc_buffer(uint32_t size);
+
+/**
+ * @brief Free a buffer from gauge_alloc_buffer()
+ */
+void gauge_free_buffer(void *buf);
+
+// ============================================================================
+// TEARDOWN
+// ============================================================================
+
+/**
+ * @brief Release a gauge before its screen is deleted
+ *
+ * Stops the alert blink, detaches the arc from the motion engine and
+ * clears the state. The widgets themselves are deleted with their screen.
+ *
+ * @param state Gauge state
+ */
+void gauge_release(gauge_state_t *state);
 
 // ============================================================================
 // GAUGE UPDATE
 // ============================================================================
 
 /**
- * @brief Update gauge value with animation and color changes
+ * @brief Show an evaluated value (gauge_model.h): LVGL calls for the changed parts only
+ *
+ * The position drives the arc, low fills it in the alert color, alert blinks
+ * the background and the text goes to the readout. The zone colors are
+ * positions on the arc, so a zone change needs nothing.
+ *
  * @param state Gauge state
- * @param config Gauge configuration
- * @param temperature New temperature value
+ * @param model Value evaluated with the configuration of this gauge (same fixed point scale)
  */
-void gauge_update_value(gauge_state_t *state, const gauge_config_t *config, int32_t temperature);
+void gauge_apply_model(gauge_state_t *state, const gauge_model_t *model);
 
 // ============================================================================
-// HELPER FUNCTIONS
+// BENCHMARK
 // ============================================================================
 
+#if GAUGE_ARC_BENCHMARK
 /**
- * @brief Calculate marker gap angle based on temperature range
- * @param temp_min Minimum temperature
- * @param temp_max Maximum temperature
- * @param marker_interval Interval between markers in degrees
- * @return Gap angle in degrees
+ * @brief Benchmark results, totals over all iterations
  */
-float gauge_calc_marker_gap(int32_t temp_min, int32_t temp_max, int32_t marker_interval);
+typedef struct {
+    uint32_t refresh_ms;     // Same refreshes with the arc hidden (clear + flush)
+    uint32_t spans_ms;       // Full arc redraws with the span rasterizer
+    uint32_t draw_arc_ms;    // Full arc redraws with lv_draw_arc
+} gauge_arc_bench_t;
+
+/**
+ * @brief Compare the span rasterizer with lv_draw_arc on the value arc
+ *
+ * Shows a temporary screen with a full four-zone arc and invalidates and
+ * refreshes it (lv_refr_now) `iterations` times per renderer. Subtract
+ * refresh_ms for the drawing time alone. With GAUGE_ARC_SPANS 0 both runs use
+ * lv_draw_arc. Must be called with the LVGL lock held.
+ *
+ * @param iterations Redraws per renderer
+ * @param result Timings
+ */
+void gauge_arc_benchmark(uint32_t iterations, gauge_arc_bench_t *result);
+#endif
 
 #ifdef __cplusplus
 }
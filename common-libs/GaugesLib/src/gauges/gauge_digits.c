@@ -0,0 +1,408 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_digits.h"
+#include "gauge_common.h"
+#include "gauge_stats.h"
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// GLYPH ATLAS
+// ============================================================================
+
+#define GAUGE_DIGITS_GLYPH_COUNT  12    // "0123456789.-"
+
+/**
+ * @brief One pre-expanded glyph
+ */
+typedef struct {
+    const lv_opa_t *alpha;   // box_w * box_h alpha values, NULL if the font lacks the glyph
+    lv_coord_t cell_w;       // Advance (px): the widest digit for 0-9, the glyph's own for '.' and '-'
+    lv_coord_t ofs_x;        // Box left relative to the cell left (digits are centered in their cell)
+    lv_coord_t ofs_y;        // Box top relative to the line top
+    lv_coord_t box_w;
+    lv_coord_t box_h;
+} gauge_digit_glyph_t;
+
+/**
+ * @brief Glyphs of one font, built on first use and kept for the program lifetime
+ */
+typedef struct {
+    const lv_font_t *font;
+    bool failed;             // Allocation failed: draw with lv_draw_label instead
+    lv_opa_t *buf;           // Single allocation holding every glyph
+    gauge_digit_glyph_t glyph[GAUGE_DIGITS_GLYPH_COUNT];
+} gauge_digit_atlas_t;
+
+static gauge_digit_atlas_t atlases[GAUGE_DIGITS_MAX_FONTS];
+
+static const char glyph_chars[GAUGE_DIGITS_GLYPH_COUNT] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', '-'
+};
+
+static int glyph_index(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c == '.') return 10;
+    if (c == '-') return 11;
+    return -1;
+}
+
+/**
+ * @brief Expand a glyph bitmap (1, 2, 4 or 8 bpp, rows not padded) to 8-bit alpha
+ */
+static void expand_glyph(lv_opa_t *dst, const uint8_t *src, uint32_t px_count, uint8_t bpp) {
+    static const lv_opa_t opa2[4] = {0, 85, 170, 255};
+
+    for (uint32_t i = 0; i < px_count; i++) {
+        uint32_t bit = i * bpp;
+        uint8_t byte = src[bit >> 3];
+        switch (bpp) {
+            case 1:  dst[i] = (byte & (0x80 >> (bit & 7))) ? LV_OPA_COVER : LV_OPA_TRANSP; break;
+            case 2:  dst[i] = opa2[(byte >> (6 - (bit & 7))) & 0x3]; break;
+            case 4:  dst[i] = (lv_opa_t)(((byte >> (4 - (bit & 7))) & 0xF) * 17); break;
+            default: dst[i] = byte; break;
+        }
+    }
+}
+
+static bool build_atlas(gauge_digit_atlas_t *atlas, const lv_font_t *font) {
+    lv_font_glyph_dsc_t dsc[GAUGE_DIGITS_GLYPH_COUNT];
+    bool present[GAUGE_DIGITS_GLYPH_COUNT];
+    uint32_t total = 0;
+
+    for (int i = 0; i < GAUGE_DIGITS_GLYPH_COUNT; i++) {
+        present[i] = lv_font_get_glyph_dsc(font, &dsc[i], (uint32_t)glyph_chars[i], 0);
+        if (present[i] && dsc[i].bpp != 1 && dsc[i].bpp != 2 && dsc[i].bpp != 4 && dsc[i].bpp != 8) {
+            return false;  // Unsupported format (e.g. 3 bpp or image font)
+        }
+        if (present[i]) total += (uint32_t)dsc[i].box_w * dsc[i].box_h;
+    }
+
+    lv_opa_t *buf = (lv_opa_t *)gauge_alloc_buffer(total ? total : 1);
+    if (!buf) return false;
+
+    // Tabular figures: every digit gets the cell of the widest one, so equal-length
+    // values always have the same width and digits never move sideways
+    lv_coord_t digit_cell = 0;
+    for (int i = 0; i <= 9; i++) {
+        if (present[i] && dsc[i].adv_w > digit_cell) digit_cell = dsc[i].adv_w;
+    }
+
+    lv_coord_t top = font->line_height - font->base_line;
+    lv_opa_t *dst = buf;
+    for (int i = 0; i < GAUGE_DIGITS_GLYPH_COUNT; i++) {
+        gauge_digit_glyph_t *g = &atlas->glyph[i];
+        memset(g, 0, sizeof(*g));
+        if (!present[i]) continue;
+
+        bool is_digit = (i <= 9);
+        g->cell_w = is_digit ? digit_cell : dsc[i].adv_w;
+        g->ofs_x = dsc[i].ofs_x + (is_digit ? (digit_cell - dsc[i].adv_w) / 2 : 0);
+        g->ofs_y = top - dsc[i].box_h - dsc[i].ofs_y;
+        g->box_w = dsc[i].box_w;
+        g->box_h = dsc[i].box_h;
+
+        uint32_t px_count = (uint32_t)g->box_w * g->box_h;
+        const uint8_t *src = lv_font_get_glyph_bitmap(font, (uint32_t)glyph_chars[i]);
+        if (!src || px_count == 0) continue;
+
+        expand_glyph(dst, src, px_count, dsc[i].bpp);
+        g->alpha = dst;
+        dst += px_count;
+    }
+
+    atlas->buf = buf;
+    gauge_stats_add_digit_atlas((int32_t)total);
+    return true;
+}
+
+/**
+ * @brief Atlas of a font, built on first use; NULL if it cannot be built
+ */
+static const gauge_digit_atlas_t* get_atlas(const lv_font_t *font) {
+    if (!GAUGE_DIGIT_ATLAS || !font) return NULL;
+
+    for (int i = 0; i < GAUGE_DIGITS_MAX_FONTS; i++) {
+        gauge_digit_atlas_t *atlas = &atlases[i];
+        if (atlas->font == font) return atlas->failed ? NULL : atlas;
+        if (atlas->font == NULL) {
+            atlas->font = font;
+            atlas->failed = !build_atlas(atlas, font);
+            return atlas->failed ? NULL : atlas;
+        }
+    }
+    return NULL;  // Cache full: fall back to lv_draw_label
+}
+
+// ============================================================================
+// READOUT OBJECT
+// ============================================================================
+
+/**
+ * @brief Per-object data, stored in user_data
+ */
+typedef struct {
+    char text[GAUGE_DIGITS_MAX_LEN + 1];
+} gauge_digits_t;
+
+static lv_coord_t text_width(const lv_font_t *font, const char *text) {
+    const gauge_digit_atlas_t *atlas = get_atlas(font);
+    lv_coord_t width = 0;
+
+    for (const char *c = text; *c; c++) {
+        if (atlas) {
+            width += atlas->glyph[glyph_index(*c)].cell_w;
+        } else {
+            width += lv_font_get_glyph_width(font, (uint32_t)*c, 0);
+        }
+    }
+    return width;
+}
+
+/**
+ * @brief Screen area covered by a glyph drawn in the cell starting at x
+ */
+static void glyph_box(const gauge_digit_glyph_t *g, lv_coord_t x, lv_coord_t y, lv_area_t *box) {
+    box->x1 = x + g->ofs_x;
+    box->y1 = y + g->ofs_y;
+    box->x2 = box->x1 + g->box_w - 1;
+    box->y2 = box->y1 + g->box_h - 1;
+}
+
+/**
+ * @brief Invalidate only the glyphs that differ between two texts of the same layout
+ *
+ * Both texts have the same length and the same non-digit characters at the same
+ * positions, so every cell keeps its place: a changed cell needs the old glyph
+ * erased and the new one drawn, i.e. the union of both glyph boxes.
+ */
+static void invalidate_changed_cells(lv_obj_t *obj, const gauge_digit_atlas_t *atlas,
+                                     const char *old_text, const char *new_text) {
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    lv_coord_t x = coords.x1;
+    for (size_t i = 0; new_text[i]; i++) {
+        const gauge_digit_glyph_t *g_new = &atlas->glyph[glyph_index(new_text[i])];
+
+        if (old_text[i] != new_text[i]) {
+            const gauge_digit_glyph_t *g_old = &atlas->glyph[glyph_index(old_text[i])];
+            lv_area_t area, box;
+            glyph_box(g_new, x, coords.y1, &area);
+            glyph_box(g_old, x, coords.y1, &box);
+            if (!g_new->alpha) area = box;
+            if (g_old->alpha && g_new->alpha) _lv_area_join(&area, &area, &box);
+            if (g_old->alpha || g_new->alpha) lv_obj_invalidate_area(obj, &area);
+        }
+        x += g_new->cell_w;
+    }
+}
+
+/**
+ * @brief True if every cell of both texts has the same width and position
+ */
+static bool same_layout(const char *a, const char *b) {
+    for (; *a && *b; a++, b++) {
+        bool digit_a = (*a >= '0' && *a <= '9');
+        bool digit_b = (*b >= '0' && *b <= '9');
+        if (digit_a != digit_b || (!digit_a && *a != *b)) return false;
+    }
+    return *a == *b;  // Same length
+}
+
+/**
+ * @brief Resize the object to its text (only changes anything when the width changes)
+ */
+static void refresh_size(lv_obj_t *obj, const gauge_digits_t *digits) {
+    const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    if (!font) return;
+
+    lv_obj_set_size(obj, text_width(font, digits->text), font->line_height);
+}
+
+static void draw_digits(lv_obj_t *obj, lv_draw_ctx_t *draw_ctx, const gauge_digits_t *digits) {
+    const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    lv_color_t color = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    lv_opa_t opa = lv_obj_get_style_text_opa(obj, LV_PART_MAIN);
+    if (!font || opa <= LV_OPA_MIN || digits->text[0] == '\0') return;
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    const gauge_digit_atlas_t *atlas = get_atlas(font);
+    if (!atlas) {
+        lv_draw_label_dsc_t label_dsc;
+        lv_draw_label_dsc_init(&label_dsc);
+        label_dsc.font = font;
+        label_dsc.color = color;
+        label_dsc.opa = opa;
+        lv_draw_label(draw_ctx, &label_dsc, &coords, digits->text, NULL);
+        return;
+    }
+
+    // One blend per glyph: the alpha box is the mask, the text color the fill
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = color;
+    blend_dsc.opa = opa;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    lv_coord_t x = coords.x1;
+    for (const char *c = digits->text; *c; c++) {
+        const gauge_digit_glyph_t *g = &atlas->glyph[glyph_index(*c)];
+
+        if (g->alpha) {
+            lv_area_t box;
+            glyph_box(g, x, coords.y1, &box);
+
+            lv_area_t clipped;
+            if (_lv_area_intersect(&clipped, &box, draw_ctx->clip_area)) {
+                blend_dsc.blend_area = &box;
+                blend_dsc.mask_area = &box;
+                blend_dsc.mask_buf = (lv_opa_t *)g->alpha;
+                lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            }
+        }
+        x += g->cell_w;
+    }
+}
+
+static void gauge_digits_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    gauge_digits_t *digits = (gauge_digits_t *)lv_obj_get_user_data(obj);
+    if (!digits) return;
+
+    if (code == LV_EVENT_DRAW_MAIN) {
+        draw_digits(obj, lv_event_get_draw_ctx(e), digits);
+    } else if (code == LV_EVENT_STYLE_CHANGED) {
+        refresh_size(obj, digits);  // Font may have changed
+    } else if (code == LV_EVENT_DELETE) {
+        lv_obj_set_user_data(obj, NULL);
+        lv_mem_free(digits);
+    }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+lv_obj_t* gauge_digits_create(lv_obj_t *parent) {
+    gauge_digits_t *digits = (gauge_digits_t *)lv_mem_alloc(sizeof(gauge_digits_t));
+    if (!digits) return NULL;
+    digits->text[0] = '\0';
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_user_data(obj, digits);
+    lv_obj_add_event_cb(obj, gauge_digits_event_cb, LV_EVENT_ALL, NULL);
+    refresh_size(obj, digits);
+
+    return obj;
+}
+
+void gauge_digits_set_text(lv_obj_t *obj, const char *text) {
+    gauge_digits_t *digits = obj ? (gauge_digits_t *)lv_obj_get_user_data(obj) : NULL;
+    if (!digits || !text) return;
+
+    // Keep only the characters the atlas has
+    char filtered[GAUGE_DIGITS_MAX_LEN + 1];
+    size_t len = 0;
+    for (const char *c = text; *c && len < GAUGE_DIGITS_MAX_LEN; c++) {
+        if (glyph_index(*c) >= 0) filtered[len++] = *c;
+    }
+    filtered[len] = '\0';
+
+    if (strcmp(digits->text, filtered) == 0) return;
+
+    // Same layout (e.g. 109 -> 110): only the changed cells are redrawn
+    const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    const gauge_digit_atlas_t *atlas = get_atlas(font);
+    if (atlas && same_layout(digits->text, filtered)) {
+        invalidate_changed_cells(obj, atlas, digits->text, filtered);
+        memcpy(digits->text, filtered, len + 1);
+        return;
+    }
+
+    lv_coord_t old_width = lv_obj_get_width(obj);
+    memcpy(digits->text, filtered, len + 1);
+
+    // Same width: redraw in place, no layout. Otherwise resize (which also invalidates).
+    if (font && text_width(font, digits->text) != old_width) {
+        refresh_size(obj, digits);
+    } else {
+        lv_obj_invalidate(obj);
+    }
+}
+
+const char* gauge_digits_get_text(const lv_obj_t *obj) {
+    const gauge_digits_t *digits = obj ? (const gauge_digits_t *)lv_obj_get_user_data((lv_obj_t *)obj) : NULL;
+    return digits ? digits->text : "";
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+#if GAUGE_DIGITS_BENCHMARK
+void gauge_digits_benchmark(uint32_t iterations, gauge_digits_bench_t *result) {
+    lv_obj_t *prev_screen = lv_scr_act();
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, COLOR_SCREEN_BG, 0);
+    lv_scr_load(screen);
+
+    lv_obj_t *label = lv_label_create(screen);
+    lv_obj_set_style_text_font(label, FONT_TEMP_MAIN, 0);
+    lv_obj_set_style_text_color(label, COLOR_WHITE, 0);
+    lv_obj_align(label, LV_ALIGN_CENTER, 0, TEMP_LABEL_Y_OFFSET);
+
+    lv_obj_t *digits = gauge_digits_create(screen);
+    lv_obj_set_style_text_font(digits, FONT_TEMP_MAIN, 0);
+    lv_obj_set_style_text_color(digits, COLOR_WHITE, 0);
+    lv_obj_align(digits, LV_ALIGN_CENTER, 0, TEMP_LABEL_Y_OFFSET);
+
+    char text[8];
+    lv_obj_t *widgets[2] = {label, digits};
+    uint32_t time_ms[2], flushed_px[2];
+    gauge_stats_t stats;
+
+    for (int w = 0; w < 2; w++) {
+        lv_obj_add_flag(widgets[1 - w], LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(widgets[w], LV_OBJ_FLAG_HIDDEN);
+        lv_refr_now(NULL);  // Also builds the atlas outside the timed loop
+        gauge_stats_get(&stats, true);
+
+        uint32_t start = lv_tick_get();
+        for (uint32_t i = 0; i < iterations; i++) {
+            snprintf(text, sizeof(text), "%d", (int)(60 + (i % 100)));
+            if (w == 0) {
+                lv_label_set_text(label, text);
+            } else {
+                gauge_digits_set_text(digits, text);
+            }
+            lv_refr_now(NULL);
+        }
+        time_ms[w] = lv_tick_elaps(start);
+        gauge_stats_get(&stats, true);
+        flushed_px[w] = stats.rendered_px;  // Needs gauge_stats_monitor_cb registered
+    }
+
+    if (result) {
+        result->label_ms = time_ms[0];
+        result->digits_ms = time_ms[1];
+        result->label_bytes = flushed_px[0] * sizeof(lv_color_t);
+        result->digits_bytes = flushed_px[1] * sizeof(lv_color_t);
+    }
+
+    lv_scr_load(prev_screen);
+    lv_obj_del(screen);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,86 @@
+#ifndef GAUGE_DIGITS_H
+#define GAUGE_DIGITS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+#include "gauges_config.h"
+
+// ============================================================================
+// NUMERIC READOUT
+// ============================================================================
+
+/**
+ * @brief Create a numeric readout (digits, '.' and '-')
+ *
+ * Drop-in replacement for the big value lv_label: it takes its font and color
+ * from the text_font / text_color styles, but draws from a glyph atlas built
+ * once per font (every glyph pre-expanded to 8-bit alpha) and blends each
+ * glyph with a single call at precomputed advances, instead of re-laying out
+ * the text and decoding 1 bpp glyphs on every refresh.
+ *
+ * Digits are tabular: each sits centered in a cell as wide as the widest digit,
+ * so values of the same length keep the same width and nothing shifts sideways.
+ * When only digits change (109 -> 110), just the boxes of the changed glyphs
+ * are invalidated instead of the whole readout.
+ *
+ * Falls back to lv_draw_label() if the atlas cannot be allocated
+ * (GAUGE_DIGIT_ATLAS = 0 forces the fallback).
+ *
+ * @param parent Parent object
+ * @return Readout object
+ */
+lv_obj_t* gauge_digits_create(lv_obj_t *parent);
+
+/**
+ * @brief Set the displayed text
+ *
+ * Does nothing when the text is unchanged. Characters other than digits, '.'
+ * and '-' are skipped. At most GAUGE_DIGITS_MAX_LEN characters are kept.
+ *
+ * @param obj Readout object
+ * @param text New text
+ */
+void gauge_digits_set_text(lv_obj_t *obj, const char *text);
+
+/**
+ * @brief Get the displayed text
+ * @param obj Readout object
+ * @return Current text ("" if obj is not a readout)
+ */
+const char* gauge_digits_get_text(const lv_obj_t *obj);
+
+#if GAUGE_DIGITS_BENCHMARK
+/**
+ * @brief Benchmark results, totals over all iterations
+ */
+typedef struct {
+    uint32_t label_ms;       // lv_label: update + refresh time
+    uint32_t digits_ms;      // gauge_digits: update + refresh time
+    uint32_t label_bytes;    // lv_label: pixel data flushed to the panel
+    uint32_t digits_bytes;   // gauge_digits: pixel data flushed to the panel
+} gauge_digits_bench_t;
+
+/**
+ * @brief Compare per-update cost of an lv_label and a readout
+ *
+ * Shows a temporary screen and, for each widget, steps the value by one and
+ * forces a refresh (lv_refr_now) `iterations` times with FONT_TEMP_MAIN.
+ * Flushed bytes come from gauge_stats_monitor_cb (zero if not registered);
+ * the stats frame counters are reset. Must be called with the LVGL lock held.
+ * Works on the device and in a host build.
+ *
+ * @param iterations Updates per widget
+ * @param result Timings and flushed bytes
+ */
+void gauge_digits_benchmark(uint32_t iterations, gauge_digits_bench_t *result);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_DIGITS_H
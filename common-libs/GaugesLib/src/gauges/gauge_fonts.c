@@ -0,0 +1,257 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_fonts.h"
+#include "gauges_config.h"
+
+#if GAUGE_FONT_PARTITION
+
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+    #include "esp_partition.h"
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+_Static_assert(sizeof(lv_font_fmt_txt_glyph_dsc_t) == 8,
+               "Font packs need LV_FONT_FMT_TXT_LARGE = 0 glyph descriptors");
+_Static_assert(sizeof(gauge_fonts_cmap_t) == 20 && sizeof(gauge_fonts_font_header_t) == 24,
+               "Font pack structures must match scripts/pack_fonts.py");
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+/**
+ * @brief RAM side of a mapped font: LVGL descriptors pointing into the mapping
+ */
+typedef struct {
+    const char *name;                     // Points into the mapping
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_glyph_cache_t cache;
+    lv_font_fmt_txt_cmap_t cmaps[GAUGE_FONTS_MAX_CMAPS];
+} gauge_font_slot_t;
+
+static gauge_font_slot_t slots[GAUGE_FONTS_MAX];
+static uint8_t slot_count = 0;
+
+static const uint8_t *pack_base = NULL;
+static uint32_t pack_size = 0;
+
+#ifdef ESP_PLATFORM
+static esp_partition_mmap_handle_t mmap_handle;
+#else
+static void *mmap_addr = NULL;
+static size_t mmap_len = 0;
+#endif
+
+// ============================================================================
+// PACK PARSING
+// ============================================================================
+
+static bool in_pack(uint32_t offset, uint32_t len) {
+    return offset <= pack_size && len <= pack_size - offset;
+}
+
+static bool load_cmap(lv_font_fmt_txt_cmap_t *cmap, const gauge_fonts_cmap_t *src) {
+    if (src->type > LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) return false;
+
+    memset(cmap, 0, sizeof(*cmap));
+    cmap->range_start = src->range_start;
+    cmap->range_length = src->range_length;
+    cmap->glyph_id_start = src->glyph_id_start;
+    cmap->list_length = src->list_length;
+    cmap->type = (lv_font_fmt_txt_cmap_type_t)src->type;
+
+    if (src->unicode_list_offset) {
+        if (!in_pack(src->unicode_list_offset, src->list_length * 2U)) return false;
+        cmap->unicode_list = (const uint16_t *)(pack_base + src->unicode_list_offset);
+    }
+    if (src->glyph_id_ofs_list_offset) {
+        uint32_t width = (src->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) ? 1U : 2U;
+        uint32_t count = (src->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) ? src->range_length : src->list_length;
+        if (!in_pack(src->glyph_id_ofs_list_offset, count * width)) return false;
+        cmap->glyph_id_ofs_list = pack_base + src->glyph_id_ofs_list_offset;
+    }
+    return true;
+}
+
+static bool load_font(gauge_font_slot_t *slot, const gauge_fonts_entry_t *entry) {
+    if (!in_pack(entry->offset, sizeof(gauge_fonts_font_header_t))) return false;
+    const gauge_fonts_font_header_t *hdr = (const gauge_fonts_font_header_t *)(pack_base + entry->offset);
+
+    if (hdr->cmap_count == 0 || hdr->cmap_count > GAUGE_FONTS_MAX_CMAPS) return false;
+    if (hdr->bpp != 1 && hdr->bpp != 2 && hdr->bpp != 4 && hdr->bpp != 8) return false;
+    if (!in_pack(entry->offset + sizeof(*hdr), hdr->cmap_count * sizeof(gauge_fonts_cmap_t))) return false;
+    if (!in_pack(hdr->glyph_dsc_offset, hdr->glyph_count * sizeof(lv_font_fmt_txt_glyph_dsc_t))) return false;
+    if (!in_pack(hdr->bitmap_offset, hdr->bitmap_size)) return false;
+
+    // Every glyph bitmap must lie inside the bitmap block (checked once, here)
+    const lv_font_fmt_txt_glyph_dsc_t *glyphs = (const lv_font_fmt_txt_glyph_dsc_t *)(pack_base + hdr->glyph_dsc_offset);
+    for (uint32_t i = 0; i < hdr->glyph_count; i++) {
+        uint32_t bytes = ((uint32_t)glyphs[i].box_w * glyphs[i].box_h * hdr->bpp + 7) / 8;
+        if (glyphs[i].bitmap_index + bytes > hdr->bitmap_size) return false;
+    }
+
+    const gauge_fonts_cmap_t *cmaps = (const gauge_fonts_cmap_t *)(hdr + 1);
+    for (uint8_t i = 0; i < hdr->cmap_count; i++) {
+        if (!load_cmap(&slot->cmaps[i], &cmaps[i])) return false;
+    }
+
+    memset(&slot->dsc, 0, sizeof(slot->dsc));
+    slot->dsc.glyph_bitmap = pack_base + hdr->bitmap_offset;
+    slot->dsc.glyph_dsc = glyphs;
+    slot->dsc.cmaps = slot->cmaps;
+    slot->dsc.cmap_num = hdr->cmap_count;
+    slot->dsc.bpp = hdr->bpp;
+    slot->dsc.cache = &slot->cache;
+    memset(&slot->cache, 0, sizeof(slot->cache));
+
+    memset(&slot->font, 0, sizeof(slot->font));
+    slot->font.get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    slot->font.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    slot->font.line_height = hdr->line_height;
+    slot->font.base_line = hdr->base_line;
+    slot->font.subpx = LV_FONT_SUBPX_NONE;
+    slot->font.underline_position = hdr->underline_position;
+    slot->font.underline_thickness = hdr->underline_thickness;
+    slot->font.dsc = &slot->dsc;
+
+    slot->name = entry->name;
+    return true;
+}
+
+/**
+ * @brief Register the fonts of a mapped pack
+ */
+static bool load_pack(const uint8_t *base, uint32_t size) {
+    const gauge_fonts_pack_header_t *hdr = (const gauge_fonts_pack_header_t *)base;
+    if (size < sizeof(*hdr) || hdr->magic != GAUGE_FONTS_MAGIC || hdr->version != GAUGE_FONTS_VERSION) {
+        LV_LOG_WARN("gauge_fonts: no valid font pack");
+        return false;
+    }
+    if (hdr->size > size) {
+        LV_LOG_WARN("gauge_fonts: font pack truncated");
+        return false;
+    }
+
+    pack_base = base;
+    pack_size = hdr->size;
+    slot_count = 0;
+
+    const gauge_fonts_entry_t *entries = (const gauge_fonts_entry_t *)(hdr + 1);
+    if (!in_pack(sizeof(*hdr), hdr->font_count * sizeof(gauge_fonts_entry_t))) return false;
+
+    for (uint16_t i = 0; i < hdr->font_count && slot_count < GAUGE_FONTS_MAX; i++) {
+        if (memchr(entries[i].name, '\0', GAUGE_FONTS_NAME_LEN) == NULL) continue;
+        if (load_font(&slots[slot_count], &entries[i])) {
+            slot_count++;
+        } else {
+            LV_LOG_WARN("gauge_fonts: invalid font %.*s", GAUGE_FONTS_NAME_LEN, entries[i].name);
+        }
+    }
+    return slot_count > 0;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+#ifdef ESP_PLATFORM
+
+bool gauge_fonts_mount(void) {
+    if (pack_base) return true;
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           (esp_partition_subtype_t)GAUGE_FONTS_PARTITION_SUBTYPE,
+                                                           GAUGE_FONTS_PARTITION_LABEL);
+    if (!part) {
+        LV_LOG_WARN("gauge_fonts: no \"%s\" partition", GAUGE_FONTS_PARTITION_LABEL);
+        return false;
+    }
+
+    const void *addr = NULL;
+    if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &addr, &mmap_handle) != ESP_OK) {
+        LV_LOG_WARN("gauge_fonts: cannot map the font partition");
+        return false;
+    }
+
+    if (!load_pack((const uint8_t *)addr, part->size)) {
+        esp_partition_munmap(mmap_handle);
+        pack_base = NULL;
+        return false;
+    }
+    return true;
+}
+
+void gauge_fonts_unmount(void) {
+    if (!pack_base) return;
+    esp_partition_munmap(mmap_handle);
+    pack_base = NULL;
+    pack_size = 0;
+    slot_count = 0;
+}
+
+#else
+
+bool gauge_fonts_mount_file(const char *path) {
+    if (pack_base) return true;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    void *addr = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (addr == MAP_FAILED) return false;
+
+    mmap_addr = addr;
+    mmap_len = (size_t)st.st_size;
+    if (!load_pack((const uint8_t *)addr, (uint32_t)mmap_len)) {
+        gauge_fonts_unmount();
+        return false;
+    }
+    return true;
+}
+
+bool gauge_fonts_mount(void) {
+    return gauge_fonts_mount_file(GAUGE_FONTS_HOST_FILE);
+}
+
+void gauge_fonts_unmount(void) {
+    if (mmap_addr) munmap(mmap_addr, mmap_len);
+    mmap_addr = NULL;
+    mmap_len = 0;
+    pack_base = NULL;
+    pack_size = 0;
+    slot_count = 0;
+}
+
+#endif
+
+const lv_font_t* gauge_fonts_find(const char *name) {
+    for (uint8_t i = 0; name && i < slot_count; i++) {
+        if (strcmp(slots[i].name, name) == 0) return &slots[i].font;
+    }
+    return NULL;
+}
+
+const lv_font_t* gauge_fonts_get(const char *name) {
+    const lv_font_t *font = gauge_fonts_find(name);
+    return font ? font : LV_FONT_DEFAULT;
+}
+
+#endif // GAUGE_FONT_PARTITION
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,122 @@
+#ifndef GAUGE_FONTS_H
+#define GAUGE_FONTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+// ============================================================================
+// FONT PACK FORMAT
+// ============================================================================
+
+// A font pack is written by scripts/pack_fonts.py and flashed to the "fonts"
+// data partition. All integers are little endian, all offsets are relative to
+// the start of the pack and 4-byte aligned. Glyph descriptors use the layout of
+// lv_font_fmt_txt_glyph_dsc_t (LV_FONT_FMT_TXT_LARGE = 0) so they, the glyph
+// bitmaps and the unicode lists are used in place, straight from the mapping.
+
+#define GAUGE_FONTS_MAGIC        0x544E4647u  // "GFNT"
+#define GAUGE_FONTS_VERSION      1
+#define GAUGE_FONTS_NAME_LEN     32
+
+/**
+ * @brief Pack header, followed by font_count entries
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t font_count;
+    uint32_t size;                        // Bytes of the whole pack
+    uint32_t reserved;
+} gauge_fonts_pack_header_t;
+
+/**
+ * @brief Directory entry
+ */
+typedef struct {
+    char name[GAUGE_FONTS_NAME_LEN];      // Font symbol name, e.g. "fa_icons_32"
+    uint32_t offset;                      // -> gauge_fonts_font_header_t
+} gauge_fonts_entry_t;
+
+/**
+ * @brief Character map, same meaning as lv_font_fmt_txt_cmap_t
+ */
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t list_length;
+    uint8_t type;                         // lv_font_fmt_txt_cmap_type_t
+    uint8_t reserved;
+    uint32_t unicode_list_offset;         // uint16_t[list_length], 0 if none
+    uint32_t glyph_id_ofs_list_offset;    // uint8_t (FORMAT0_FULL) / uint16_t (SPARSE_FULL), 0 if none
+} gauge_fonts_cmap_t;
+
+/**
+ * @brief Font header, followed by cmap_count character maps
+ */
+typedef struct {
+    int16_t line_height;
+    int16_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint8_t bpp;
+    uint8_t cmap_count;
+    uint32_t glyph_count;                 // Including the reserved glyph 0
+    uint32_t glyph_dsc_offset;            // lv_font_fmt_txt_glyph_dsc_t[glyph_count]
+    uint32_t bitmap_offset;
+    uint32_t bitmap_size;
+} gauge_fonts_font_header_t;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Map the font pack and register its fonts
+ *
+ * On the device the "fonts" data partition is mapped with esp_partition_mmap();
+ * elsewhere the file GAUGE_FONTS_HOST_FILE is mapped with mmap(). Nothing is
+ * copied: only a small descriptor per font is kept in RAM. Safe to call again.
+ *
+ * @return true if a valid pack is mounted
+ */
+bool gauge_fonts_mount(void);
+
+#ifndef ESP_PLATFORM
+/**
+ * @brief Host only: map a font pack file
+ * @param path Pack written by scripts/pack_fonts.py
+ * @return true if a valid pack is mounted
+ */
+bool gauge_fonts_mount_file(const char *path);
+#endif
+
+/**
+ * @brief Unmap the pack. Fonts obtained before must no longer be used.
+ */
+void gauge_fonts_unmount(void);
+
+/**
+ * @brief Font of the pack by name
+ * @param name Font symbol name, e.g. "montserrat_bold_80"
+ * @return The font, or NULL if the pack is not mounted or lacks it
+ */
+const lv_font_t* gauge_fonts_find(const char *name);
+
+/**
+ * @brief Font of the pack by name, for styles (GAUGE_CUSTOM_FONT)
+ * @param name Font symbol name, e.g. "montserrat_bold_80"
+ * @return The font, or LV_FONT_DEFAULT if the pack is not mounted or lacks it
+ */
+const lv_font_t* gauge_fonts_get(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_FONTS_H
@@ -0,0 +1,284 @@
+// Generated by scripts/gen_gauge_geometry.py from screen_profiles.json - DO NOT EDIT
+#ifndef GAUGE_GEOMETRY_H
+#define GAUGE_GEOMETRY_H
+
+#include "lvgl.h"
+
+#define GAUGE_GEOMETRY_MAX_MARKERS 12
+
+// Index of the first GAUGE_MARKER_POINTS entry for a scale split in n segments
+#define GAUGE_MARKER_INDEX(n) (((n) - 1) * ((n) + 2) / 2)
+
+#if GAUGE_SCREEN_RES == 466
+    // Waveshare 1.43in AMOLED (baseline, no scaling) - scale 1.0000
+    #define LCD_RES 466
+
+    // Fonts
+    extern const lv_font_t fa_icons_54;
+    extern const lv_font_t lv_font_montserrat_24;
+    extern const lv_font_t lv_font_montserrat_48;
+    extern const lv_font_t montserrat_bold_80;
+    extern const lv_font_t montserrat_bold_numbers_120;
+    #define FONT_TEMP_MAIN               GAUGE_CUSTOM_FONT(montserrat_bold_numbers_120) // 120px (target 120px)
+    #define FONT_TEMP_UNIT               &lv_font_montserrat_48                         // 48px (target 48px)
+    #define FONT_MARKERS                 &lv_font_montserrat_24                         // 24px (target 24px)
+    #define FONT_ICON                    GAUGE_CUSTOM_FONT(fa_icons_54)                 // 54px (target 54px)
+    #define FONT_NEEDLE_VALUE            GAUGE_CUSTOM_FONT(montserrat_bold_80)          // 80px (target 80px)
+    #define GAUGE_FONT_FA_ICONS_54 1
+    #define GAUGE_FONT_MONTSERRAT_BOLD_80 1
+    #define GAUGE_FONT_MONTSERRAT_BOLD_NUMBERS_120 1
+    #define USE_CUSTOM_ICON_FONT 1
+
+    // Dimensions (px)
+    #define ARC_WIDTH                          24   // base 24
+    #define LINE_WIDTH                          4   // base 4
+    #define MARKER_LABEL_OFFSET                40   // base 40
+    #define TEMP_LABEL_Y_OFFSET               -15   // base -15
+    #define TEMP_UNIT_Y_OFFSET                 55   // base 55
+    #define ICON_Y_OFFSET                     -10   // base -10
+    #define NEEDLE_METER_PADDING               30   // base 30
+    #define NEEDLE_WIDTH                        5   // base 5
+    #define NEEDLE_MINOR_TICK_LENGTH            8   // base 8
+    #define NEEDLE_MAJOR_TICK_LENGTH           18   // base 18
+    #define NEEDLE_MAJOR_TICK_LABEL_DIST       29   // base 29
+    #define NEEDLE_RED_ZONE_WIDTH              18   // base 18
+    #define NEEDLE_RED_ZONE_OFFSET              0   // base 0
+    #define NEEDLE_OFFSET                     -20   // base -20
+    #define NEEDLE_VALUE_LABEL_Y_OFFSET       160   // base 160
+    #define NEEDLE_UNIT_LABEL_X_OFFSET        140   // base 140
+    #define NEEDLE_UNIT_LABEL_Y_OFFSET        100   // base 100
+    #define NEEDLE_ICON_Y_OFFSET              -80   // base -80
+    #define MULTI_GAUGE_LEFT_PADDING           30   // base 30
+    #define MULTI_GAUGE_BAR_WIDTH             185   // base 185
+    #define MULTI_GAUGE_BAR_HEIGHT             40   // base 40
+    #define MULTI_GAUGE_ROW_SPACING            85   // base 85
+    #define MULTI_GAUGE_ICON_SIZE              48   // base 48
+    #define MULTI_GAUGE_VALUE_WIDTH           110   // base 110
+    #define MULTI_GAUGE_ICON_BAR_GAP          100   // base 100
+    #define MULTI_GAUGE_BAR_BORDER_WIDTH        2   // base 2
+    #define MULTI_GAUGE_BAR_RADIUS              4   // base 4
+    #define MULTI_GAUGE_INDICATOR_RADIUS        2   // base 2
+    #define MULTI_GAUGE_VALUE_X_OFFSET         25   // base 25
+    #define MULTI_GAUGE_UNIT_SPACING            3   // base 3
+
+    // Arc scale markers: {angle, label x, label y} for 1..N-1 segments
+    #define GAUGE_MARKER_LABEL_RADIUS 145
+    #define GAUGE_MARKER_POINTS { \
+        {135, -102, 102}, {45, 102, 102}, \
+        {135, -102, 102}, {270, 0, -145}, {45, 102, 102}, \
+        {135, -102, 102}, {225, -102, -102}, {315, 102, -102}, {45, 102, 102}, \
+        {135, -102, 102}, {202, -133, -55}, {270, 0, -145}, {337, 133, -55}, {45, 102, 102}, \
+        {135, -102, 102}, {189, -143, -22}, {243, -65, -129}, {297, 65, -129}, {351, 143, -22}, {45, 102, 102}, \
+        {135, -102, 102}, {180, -145, 0}, {225, -102, -102}, {270, 0, -145}, {315, 102, -102}, {0, 145, 0}, {45, 102, 102}, \
+        {135, -102, 102}, {173, -144, 16}, {212, -122, -77}, {250, -47, -136}, {289, 47, -136}, {327, 122, -77}, {6, 144, 16}, {45, 102, 102}, \
+        {135, -102, 102}, {168, -142, 28}, {202, -133, -55}, {236, -80, -120}, {270, 0, -145}, {303, 80, -120}, {337, 133, -55}, {11, 142, 28}, {45, 102, 102}, \
+        {135, -102, 102}, {165, -140, 37}, {195, -140, -37}, {225, -102, -102}, {255, -37, -140}, {285, 37, -140}, {315, 102, -102}, {345, 140, -37}, {15, 140, 37}, {45, 102, 102}, \
+        {135, -102, 102}, {162, -137, 44}, {189, -143, -22}, {216, -117, -85}, {243, -65, -129}, {270, 0, -145}, {297, 65, -129}, {324, 117, -85}, {351, 143, -22}, {18, 137, 44}, {45, 102, 102}, \
+        {135, -102, 102}, {159, -135, 50}, {184, -144, -10}, {208, -127, -69}, {233, -86, -116}, {257, -30, -141}, {282, 30, -141}, {306, 86, -116}, {331, 127, -69}, {355, 144, -10}, {20, 135, 50}, {45, 102, 102}, \
+    }
+
+#elif GAUGE_SCREEN_RES == 240
+    // ESP32-C3 1.28in TFT - scale 0.5150
+    #define LCD_RES 240
+
+    // Fonts
+    extern const lv_font_t fa_icons_32;
+    extern const lv_font_t lv_font_montserrat_14;
+    extern const lv_font_t lv_font_montserrat_24;
+    extern const lv_font_t lv_font_montserrat_48;
+    #define FONT_TEMP_MAIN               &lv_font_montserrat_48                         // 48px (target 62px)
+    #define FONT_TEMP_UNIT               &lv_font_montserrat_24                         // 24px (target 25px)
+    #define FONT_MARKERS                 &lv_font_montserrat_14                         // 14px (target 12px)
+    #define FONT_ICON                    GAUGE_CUSTOM_FONT(fa_icons_32)                 // 32px (target 28px)
+    #define FONT_NEEDLE_VALUE            &lv_font_montserrat_48                         // 48px (target 41px)
+    #define GAUGE_FONT_FA_ICONS_32 1
+    #define USE_CUSTOM_ICON_FONT 1
+
+    // Dimensions (px)
+    #define ARC_WIDTH                          12   // base 24
+    #define LINE_WIDTH                          2   // base 4
+    #define MARKER_LABEL_OFFSET                20   // base 40
+    #define TEMP_LABEL_Y_OFFSET                -7   // base -15
+    #define TEMP_UNIT_Y_OFFSET                 28   // base 55
+    #define ICON_Y_OFFSET                      -5   // base -10
+    #define NEEDLE_METER_PADDING               15   // base 30
+    #define NEEDLE_WIDTH                        2   // base 5
+    #define NEEDLE_MINOR_TICK_LENGTH            4   // base 8
+    #define NEEDLE_MAJOR_TICK_LENGTH            9   // base 18
+    #define NEEDLE_MAJOR_TICK_LABEL_DIST       14   // base 29
+    #define NEEDLE_RED_ZONE_WIDTH               9   // base 18
+    #define NEEDLE_RED_ZONE_OFFSET              0   // base 0
+    #define NEEDLE_OFFSET                     -10   // base -20
+    #define NEEDLE_VALUE_LABEL_Y_OFFSET        82   // base 160
+    #define NEEDLE_UNIT_LABEL_X_OFFSET         72   // base 140
+    #define NEEDLE_UNIT_LABEL_Y_OFFSET         51   // base 100
+    #define NEEDLE_ICON_Y_OFFSET              -41   // base -80
+    #define MULTI_GAUGE_LEFT_PADDING           15   // base 30
+    #define MULTI_GAUGE_BAR_WIDTH              95   // base 185
+    #define MULTI_GAUGE_BAR_HEIGHT             20   // base 40
+    #define MULTI_GAUGE_ROW_SPACING            43   // base 85
+    #define MULTI_GAUGE_ICON_SIZE              24   // base 48
+    #define MULTI_GAUGE_VALUE_WIDTH            56   // base 110
+    #define MULTI_GAUGE_ICON_BAR_GAP           51   // base 100
+    #define MULTI_GAUGE_BAR_BORDER_WIDTH        1   // base 2
+    #define MULTI_GAUGE_BAR_RADIUS              2   // base 4
+    #define MULTI_GAUGE_INDICATOR_RADIUS        1   // base 2
+    #define MULTI_GAUGE_VALUE_X_OFFSET         12   // base 25
+    #define MULTI_GAUGE_UNIT_SPACING            1   // base 3
+
+    // Arc scale markers: {angle, label x, label y} for 1..N-1 segments
+    #define GAUGE_MARKER_LABEL_RADIUS 76
+    #define GAUGE_MARKER_POINTS { \
+        {135, -53, 53}, {45, 53, 53}, \
+        {135, -53, 53}, {270, 0, -76}, {45, 53, 53}, \
+        {135, -53, 53}, {225, -53, -53}, {315, 53, -53}, {45, 53, 53}, \
+        {135, -53, 53}, {202, -70, -29}, {270, 0, -76}, {337, 70, -29}, {45, 53, 53}, \
+        {135, -53, 53}, {189, -75, -11}, {243, -34, -67}, {297, 34, -67}, {351, 75, -11}, {45, 53, 53}, \
+        {135, -53, 53}, {180, -76, 0}, {225, -53, -53}, {270, 0, -76}, {315, 53, -53}, {0, 76, 0}, {45, 53, 53}, \
+        {135, -53, 53}, {173, -75, 8}, {212, -64, -40}, {250, -25, -71}, {289, 25, -71}, {327, 64, -40}, {6, 75, 8}, {45, 53, 53}, \
+        {135, -53, 53}, {168, -74, 14}, {202, -70, -29}, {236, -42, -63}, {270, 0, -76}, {303, 42, -63}, {337, 70, -29}, {11, 74, 14}, {45, 53, 53}, \
+        {135, -53, 53}, {165, -73, 19}, {195, -73, -19}, {225, -53, -53}, {255, -19, -73}, {285, 19, -73}, {315, 53, -53}, {345, 73, -19}, {15, 73, 19}, {45, 53, 53}, \
+        {135, -53, 53}, {162, -72, 23}, {189, -75, -11}, {216, -61, -44}, {243, -34, -67}, {270, 0, -76}, {297, 34, -67}, {324, 61, -44}, {351, 75, -11}, {18, 72, 23}, {45, 53, 53}, \
+        {135, -53, 53}, {159, -71, 26}, {184, -75, -5}, {208, -66, -36}, {233, -45, -60}, {257, -16, -74}, {282, 16, -74}, {306, 45, -60}, {331, 66, -36}, {355, 75, -5}, {20, 71, 26}, {45, 53, 53}, \
+    }
+
+#elif GAUGE_SCREEN_RES == 360
+    // 360px round panels (fonts picked by nearest size) - scale 0.7725
+    #define LCD_RES 360
+
+    // Fonts
+    extern const lv_font_t fa_icons_32;
+    extern const lv_font_t lv_font_montserrat_18;
+    extern const lv_font_t lv_font_montserrat_36;
+    extern const lv_font_t lv_font_montserrat_48;
+    extern const lv_font_t montserrat_bold_80;
+    #define FONT_TEMP_MAIN               GAUGE_CUSTOM_FONT(montserrat_bold_80)          // 80px (target 93px)
+    #define FONT_TEMP_UNIT               &lv_font_montserrat_36                         // 36px (target 37px)
+    #define FONT_MARKERS                 &lv_font_montserrat_18                         // 18px (target 19px)
+    #define FONT_ICON                    GAUGE_CUSTOM_FONT(fa_icons_32)                 // 32px (target 42px)
+    #define FONT_NEEDLE_VALUE            &lv_font_montserrat_48                         // 48px (target 62px)
+    #define GAUGE_FONT_FA_ICONS_32 1
+    #define GAUGE_FONT_MONTSERRAT_BOLD_80 1
+    #define USE_CUSTOM_ICON_FONT 1
+
+    // Dimensions (px)
+    #define ARC_WIDTH                          18   // base 24
+    #define LINE_WIDTH                          3   // base 4
+    #define MARKER_LABEL_OFFSET                30   // base 40
+    #define TEMP_LABEL_Y_OFFSET               -11   // base -15
+    #define TEMP_UNIT_Y_OFFSET                 42   // base 55
+    #define ICON_Y_OFFSET                      -7   // base -10
+    #define NEEDLE_METER_PADDING               23   // base 30
+    #define NEEDLE_WIDTH                        3   // base 5
+    #define NEEDLE_MINOR_TICK_LENGTH            6   // base 8
+    #define NEEDLE_MAJOR_TICK_LENGTH           13   // base 18
+    #define NEEDLE_MAJOR_TICK_LABEL_DIST       22   // base 29
+    #define NEEDLE_RED_ZONE_WIDTH              13   // base 18
+    #define NEEDLE_RED_ZONE_OFFSET              0   // base 0
+    #define NEEDLE_OFFSET                     -15   // base -20
+    #define NEEDLE_VALUE_LABEL_Y_OFFSET       123   // base 160
+    #define NEEDLE_UNIT_LABEL_X_OFFSET        108   // base 140
+    #define NEEDLE_UNIT_LABEL_Y_OFFSET         77   // base 100
+    #define NEEDLE_ICON_Y_OFFSET              -61   // base -80
+    #define MULTI_GAUGE_LEFT_PADDING           23   // base 30
+    #define MULTI_GAUGE_BAR_WIDTH             142   // base 185
+    #define MULTI_GAUGE_BAR_HEIGHT             30   // base 40
+    #define MULTI_GAUGE_ROW_SPACING            65   // base 85
+    #define MULTI_GAUGE_ICON_SIZE              37   // base 48
+    #define MULTI_GAUGE_VALUE_WIDTH            84   // base 110
+    #define MULTI_GAUGE_ICON_BAR_GAP           77   // base 100
+    #define MULTI_GAUGE_BAR_BORDER_WIDTH        1   // base 2
+    #define MULTI_GAUGE_BAR_RADIUS              3   // base 4
+    #define MULTI_GAUGE_INDICATOR_RADIUS        1   // base 2
+    #define MULTI_GAUGE_VALUE_X_OFFSET         19   // base 25
+    #define MULTI_GAUGE_UNIT_SPACING            2   // base 3
+
+    // Arc scale markers: {angle, label x, label y} for 1..N-1 segments
+    #define GAUGE_MARKER_LABEL_RADIUS 114
+    #define GAUGE_MARKER_POINTS { \
+        {135, -80, 80}, {45, 80, 80}, \
+        {135, -80, 80}, {270, 0, -114}, {45, 80, 80}, \
+        {135, -80, 80}, {225, -80, -80}, {315, 80, -80}, {45, 80, 80}, \
+        {135, -80, 80}, {202, -105, -43}, {270, 0, -114}, {337, 105, -43}, {45, 80, 80}, \
+        {135, -80, 80}, {189, -112, -17}, {243, -51, -101}, {297, 51, -101}, {351, 112, -17}, {45, 80, 80}, \
+        {135, -80, 80}, {180, -114, 0}, {225, -80, -80}, {270, 0, -114}, {315, 80, -80}, {0, 114, 0}, {45, 80, 80}, \
+        {135, -80, 80}, {173, -113, 12}, {212, -96, -60}, {250, -37, -107}, {289, 37, -107}, {327, 96, -60}, {6, 113, 12}, {45, 80, 80}, \
+        {135, -80, 80}, {168, -111, 22}, {202, -105, -43}, {236, -63, -94}, {270, 0, -114}, {303, 63, -94}, {337, 105, -43}, {11, 111, 22}, {45, 80, 80}, \
+        {135, -80, 80}, {165, -110, 29}, {195, -110, -29}, {225, -80, -80}, {255, -29, -110}, {285, 29, -110}, {315, 80, -80}, {345, 110, -29}, {15, 110, 29}, {45, 80, 80}, \
+        {135, -80, 80}, {162, -108, 35}, {189, -112, -17}, {216, -92, -67}, {243, -51, -101}, {270, 0, -114}, {297, 51, -101}, {324, 92, -67}, {351, 112, -17}, {18, 108, 35}, {45, 80, 80}, \
+        {135, -80, 80}, {159, -106, 39}, {184, -113, -8}, {208, -100, -54}, {233, -68, -91}, {257, -24, -111}, {282, 24, -111}, {306, 68, -91}, {331, 100, -54}, {355, 113, -8}, {20, 106, 39}, {45, 80, 80}, \
+    }
+
+#elif GAUGE_SCREEN_RES == 412
+    // 412px round panels (fonts picked by nearest size) - scale 0.8841
+    #define LCD_RES 412
+
+    // Fonts
+    extern const lv_font_t fa_icons_54;
+    extern const lv_font_t lv_font_montserrat_20;
+    extern const lv_font_t lv_font_montserrat_40;
+    extern const lv_font_t montserrat_bold_80;
+    extern const lv_font_t montserrat_bold_numbers_120;
+    #define FONT_TEMP_MAIN               GAUGE_CUSTOM_FONT(montserrat_bold_numbers_120) // 120px (target 106px)
+    #define FONT_TEMP_UNIT               &lv_font_montserrat_40                         // 40px (target 42px)
+    #define FONT_MARKERS                 &lv_font_montserrat_20                         // 20px (target 21px)
+    #define FONT_ICON                    GAUGE_CUSTOM_FONT(fa_icons_54)                 // 54px (target 48px)
+    #define FONT_NEEDLE_VALUE            GAUGE_CUSTOM_FONT(montserrat_bold_80)          // 80px (target 71px)
+    #define GAUGE_FONT_FA_ICONS_54 1
+    #define GAUGE_FONT_MONTSERRAT_BOLD_80 1
+    #define GAUGE_FONT_MONTSERRAT_BOLD_NUMBERS_120 1
+    #define USE_CUSTOM_ICON_FONT 1
+
+    // Dimensions (px)
+    #define ARC_WIDTH                          21   // base 24
+    #define LINE_WIDTH                          3   // base 4
+    #define MARKER_LABEL_OFFSET                35   // base 40
+    #define TEMP_LABEL_Y_OFFSET               -13   // base -15
+    #define TEMP_UNIT_Y_OFFSET                 48   // base 55
+    #define ICON_Y_OFFSET                      -8   // base -10
+    #define NEEDLE_METER_PADDING               26   // base 30
+    #define NEEDLE_WIDTH                        4   // base 5
+    #define NEEDLE_MINOR_TICK_LENGTH            7   // base 8
+    #define NEEDLE_MAJOR_TICK_LENGTH           15   // base 18
+    #define NEEDLE_MAJOR_TICK_LABEL_DIST       25   // base 29
+    #define NEEDLE_RED_ZONE_WIDTH              15   // base 18
+    #define NEEDLE_RED_ZONE_OFFSET              0   // base 0
+    #define NEEDLE_OFFSET                     -17   // base -20
+    #define NEEDLE_VALUE_LABEL_Y_OFFSET       141   // base 160
+    #define NEEDLE_UNIT_LABEL_X_OFFSET        123   // base 140
+    #define NEEDLE_UNIT_LABEL_Y_OFFSET         88   // base 100
+    #define NEEDLE_ICON_Y_OFFSET              -70   // base -80
+    #define MULTI_GAUGE_LEFT_PADDING           26   // base 30
+    #define MULTI_GAUGE_BAR_WIDTH             163   // base 185
+    #define MULTI_GAUGE_BAR_HEIGHT             35   // base 40
+    #define MULTI_GAUGE_ROW_SPACING            75   // base 85
+    #define MULTI_GAUGE_ICON_SIZE              42   // base 48
+    #define MULTI_GAUGE_VALUE_WIDTH            97   // base 110
+    #define MULTI_GAUGE_ICON_BAR_GAP           88   // base 100
+    #define MULTI_GAUGE_BAR_BORDER_WIDTH        1   // base 2
+    #define MULTI_GAUGE_BAR_RADIUS              3   // base 4
+    #define MULTI_GAUGE_INDICATOR_RADIUS        1   // base 2
+    #define MULTI_GAUGE_VALUE_X_OFFSET         22   // base 25
+    #define MULTI_GAUGE_UNIT_SPACING            2   // base 3
+
+    // Arc scale markers: {angle, label x, label y} for 1..N-1 segments
+    #define GAUGE_MARKER_LABEL_RADIUS 132
+    #define GAUGE_MARKER_POINTS { \
+        {135, -93, 93}, {45, 93, 93}, \
+        {135, -93, 93}, {270, 0, -132}, {45, 93, 93}, \
+        {135, -93, 93}, {225, -93, -93}, {315, 93, -93}, {45, 93, 93}, \
+        {135, -93, 93}, {202, -121, -50}, {270, 0, -132}, {337, 121, -50}, {45, 93, 93}, \
+        {135, -93, 93}, {189, -130, -20}, {243, -59, -117}, {297, 59, -117}, {351, 130, -20}, {45, 93, 93}, \
+        {135, -93, 93}, {180, -132, 0}, {225, -93, -93}, {270, 0, -132}, {315, 93, -93}, {0, 132, 0}, {45, 93, 93}, \
+        {135, -93, 93}, {173, -131, 14}, {212, -111, -70}, {250, -43, -124}, {289, 43, -124}, {327, 111, -70}, {6, 131, 14}, {45, 93, 93}, \
+        {135, -93, 93}, {168, -129, 25}, {202, -121, -50}, {236, -73, -109}, {270, 0, -132}, {303, 73, -109}, {337, 121, -50}, {11, 129, 25}, {45, 93, 93}, \
+        {135, -93, 93}, {165, -127, 34}, {195, -127, -34}, {225, -93, -93}, {255, -34, -127}, {285, 34, -127}, {315, 93, -93}, {345, 127, -34}, {15, 127, 34}, {45, 93, 93}, \
+        {135, -93, 93}, {162, -125, 40}, {189, -130, -20}, {216, -106, -77}, {243, -59, -117}, {270, 0, -132}, {297, 59, -117}, {324, 106, -77}, {351, 130, -20}, {18, 125, 40}, {45, 93, 93}, \
+        {135, -93, 93}, {159, -123, 46}, {184, -131, -9}, {208, -115, -63}, {233, -79, -105}, {257, -28, -128}, {282, 28, -128}, {306, 79, -105}, {331, 115, -63}, {355, 131, -9}, {20, 123, 46}, {45, 93, 93}, \
+    }
+
+#else
+    #error "No geometry for GAUGE_SCREEN_RES (available: 466, 240, 360, 412). Add it to screen_profiles.json and run scripts/gen_gauge_geometry.py"
+#endif
+
+#endif // GAUGE_GEOMETRY_H
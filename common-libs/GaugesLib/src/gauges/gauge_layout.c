@@ -0,0 +1,479 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_layout.h"
+#include <string.h>
+#include "gauge_channels.h"
+#include "gauge_digits.h"
+#include "gauge_motion.h"
+#include "gauge_theme.h"
+#include "gauge_zones.h"
+#include "dual_gauge.h"
+
+#if GAUGE_LAYOUT_PARTITION
+    #ifdef ESP_PLATFORM
+        #include "esp_partition.h"
+    #else
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <unistd.h>
+    #endif
+#endif
+
+_Static_assert(sizeof(gauge_layout_header_t) == 16 && sizeof(gauge_layout_screen_t) == 4 &&
+               sizeof(gauge_layout_element_t) == 28,
+               "Layout pack structures must match scripts/pack_layout.py");
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+// Positions and sizes of the pack are per mille of the screen
+#define LAYOUT_PX(permille)  ((lv_coord_t)(((int32_t)(permille) * GAUGE_DIMENSION) / 1000))
+
+#define MODE_BIT(mode)       (1U << (mode))
+
+/**
+ * @brief A bar or digital element of a screen
+ */
+typedef struct {
+    const gauge_layout_element_t *src;   // Points into the pack
+    lv_obj_t *obj;                       // Bar (BAR) or NULL
+    lv_obj_t *readout;                   // Value readout (gauge_digits)
+    gauge_motion_t motion;               // Drives the bar value (see gauge_motion.h)
+    gauge_model_config_t config;         // Decoded at load
+    gauge_model_t model;                 // Evaluated and shown state, reset when built
+} layout_item_t;
+
+/**
+ * @brief A screen of the layout: configurations decoded at load, widgets while built
+ */
+typedef struct {
+    uint8_t modes;
+    uint8_t peaks;
+    bool built;
+
+    // Full-screen dial, NULL if the screen has none
+    const gauge_layout_element_t *dial_src;
+    gauge_model_config_t dial_model_config;
+    gauge_model_t dial_model;
+    gauge_config_t arc_config;
+    needle_gauge_config_t needle_config;
+    dual_gauge_config_t dial_config;
+    dual_gauge_t dial;
+
+    layout_item_t items[GAUGE_LAYOUT_MAX_ELEMENTS];
+    uint8_t item_count;
+} layout_screen_t;
+
+static layout_screen_t screens[GAUGE_LAYOUT_MAX_SCREENS];
+static uint8_t screen_count = 0;
+
+#if GAUGE_LAYOUT_PARTITION
+    #ifdef ESP_PLATFORM
+        static esp_partition_mmap_handle_t mmap_handle;
+    #endif
+    static bool mounted = false;
+#endif
+
+// ============================================================================
+// PACK PARSING
+// ============================================================================
+
+// Per mille of the screen: an element centered at offset c with size n stays on it
+#define LAYOUT_FITS(c, n)    ((n) >= 0 && (n) <= 1000 && 2 * ((c) < 0 ? -(c) : (c)) + (n) <= 1000)
+
+/**
+ * @brief Check an element against what its presentation can draw
+ *
+ * Mirrors the checks of scripts/pack_layout.py, so a hand-written or damaged
+ * pack is rejected here instead of being clipped or truncated when drawn.
+ */
+static bool check_element(const gauge_layout_element_t *el) {
+    if (el->channel >= GAUGE_CHANNEL_COUNT || el->style >= GAUGE_LAYOUT_STYLE_COUNT) return false;
+    if (el->decimals > 2 || el->max <= el->min) return false;
+
+    // Zones in order and on the scale
+    if (el->zone_green < el->min || el->zone_green > el->zone_orange ||
+        el->zone_orange > el->zone_red || el->zone_red > el->max) {
+        return false;
+    }
+
+    int32_t range = el->max - el->min;
+    switch (el->style) {
+        case GAUGE_LAYOUT_ARC:
+            // Every marker drawn (gauge_create_border_and_markers() keeps the first GAUGE_SCALE_MAX_MARKERS)
+            if (el->marker_interval <= 0 || range / el->marker_interval + 1 > GAUGE_SCALE_MAX_MARKERS) return false;
+            return el->redline >= el->min && el->redline <= el->max;
+        case GAUGE_LAYOUT_NEEDLE: {
+            // The meter scale is in whole units, with labelled ticks on minor ticks
+            int32_t scale = gauge_value_scale(el->decimals);
+            if (el->min % scale != 0 || el->max % scale != 0 || el->ticks < 2) return false;
+            int32_t units = range / scale;
+            int32_t minor = el->decimals > 0 ? units * NEEDLE_MINOR_TICK_MULTIPLIER : units / NEEDLE_MINOR_TICK_DIVISOR;
+            return minor >= el->ticks - 1 && minor % (el->ticks - 1) == 0;
+        }
+        case GAUGE_LAYOUT_BAR:
+            return el->width > 0 && el->height > 0 && LAYOUT_FITS(el->x, el->width) && LAYOUT_FITS(el->y, el->height);
+        case GAUGE_LAYOUT_DIGITAL:
+            return LAYOUT_FITS(el->x, 0) && LAYOUT_FITS(el->y, el->height);
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Model configuration of an element
+ *
+ * The pack has no field for the RPM-dependent minimum: it comes with the channel.
+ */
+static void decode_model(const gauge_layout_element_t *el, gauge_model_config_t *config) {
+    const gauge_model_config_t *channel = &gauge_channel_info((gauge_channel_t)el->channel)->model;
+
+    *config = (gauge_model_config_t){
+        .decimals = el->decimals,
+        .min = el->min,
+        .max = el->max,
+        .zone_green = el->zone_green,
+        .zone_orange = el->zone_orange,
+        .zone_red = el->zone_red,
+        .alert = el->alert,
+        .low_rpm_divisor = channel->low_rpm_divisor,
+        .low_min = channel->low_min
+    };
+}
+
+/**
+ * @brief Configurations of both dial presentations from one element
+ */
+static void decode_dial(layout_screen_t *ls, const gauge_layout_element_t *el) {
+    const gauge_channel_info_t *info = gauge_channel_info((gauge_channel_t)el->channel);
+    float scale = (float)gauge_value_scale(el->decimals);
+
+    ls->dial_src = el;
+    decode_model(el, &ls->dial_model_config);
+    ls->arc_config = (gauge_config_t){
+        .temp_min = el->min,
+        .temp_max = el->max,
+        .zone_green = el->zone_green,
+        .zone_orange = el->zone_orange,
+        .zone_red = el->zone_red,
+        .redline = el->redline,
+        .marker_interval = el->marker_interval,
+        .icon_symbol = info->icon_symbol ? info->icon_symbol : "",
+        .value_scale = gauge_value_scale(el->decimals)
+    };
+    ls->needle_config = (needle_gauge_config_t){
+        .value_min = el->min / scale,
+        .value_max = el->max / scale,
+        .zone_red = el->zone_red / scale,
+        .major_tick_count = el->ticks,
+        .icon_symbol = ls->arc_config.icon_symbol,
+        .unit_text = info->unit_text,
+        .decimal_places = el->decimals
+    };
+    ls->dial_config.racing = &ls->arc_config;
+    ls->dial_config.normal = &ls->needle_config;
+}
+
+/**
+ * @brief Check a pack and, with apply, decode it into the screen slots
+ *
+ * Run once without apply first, so an invalid pack changes nothing.
+ */
+static bool parse_pack(const uint8_t *base, uint32_t size, bool apply) {
+    const gauge_layout_header_t *hdr = (const gauge_layout_header_t *)base;
+    if (size < sizeof(*hdr) || hdr->magic != GAUGE_LAYOUT_MAGIC || hdr->version != GAUGE_LAYOUT_VERSION) {
+        LV_LOG_WARN("gauge_layout: no valid layout pack");
+        return false;
+    }
+    if (hdr->size > size || hdr->screen_count == 0 || hdr->screen_count > GAUGE_LAYOUT_MAX_SCREENS) {
+        LV_LOG_WARN("gauge_layout: layout pack truncated or with too many screens");
+        return false;
+    }
+
+    uint32_t offset = sizeof(*hdr);
+    for (uint16_t s = 0; s < hdr->screen_count; s++) {
+        if (offset + sizeof(gauge_layout_screen_t) > hdr->size) return false;
+        const gauge_layout_screen_t *screen = (const gauge_layout_screen_t *)(base + offset);
+        offset += sizeof(*screen);
+
+        uint8_t count = screen->element_count;
+        if (count == 0 || count > GAUGE_LAYOUT_MAX_ELEMENTS) return false;
+        if (offset + count * sizeof(gauge_layout_element_t) > hdr->size) return false;
+        const gauge_layout_element_t *elements = (const gauge_layout_element_t *)(base + offset);
+        offset += count * sizeof(gauge_layout_element_t);
+
+        layout_screen_t *ls = &screens[s];
+        if (apply) {
+            memset(ls, 0, sizeof(*ls));
+            ls->modes = MODE_BIT(GAUGE_MODE_NORMAL) | MODE_BIT(GAUGE_MODE_RACING);
+        }
+
+        uint8_t dials = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            const gauge_layout_element_t *el = &elements[i];
+            if (!check_element(el)) {
+                LV_LOG_WARN("gauge_layout: invalid element %d of screen %d", i, s);
+                return false;
+            }
+
+            bool dial = el->style == GAUGE_LAYOUT_ARC || el->style == GAUGE_LAYOUT_NEEDLE;
+            if (dial && ++dials > 1) {
+                LV_LOG_WARN("gauge_layout: more than one dial on screen %d", s);
+                return false;
+            }
+            if (!apply) continue;
+
+            int8_t peak = gauge_channel_info((gauge_channel_t)el->channel)->peak;
+            if (peak >= 0) ls->peaks |= GAUGE_PEAK_BIT(peak);
+
+            if (dial) {
+                decode_dial(ls, el);
+                ls->modes = MODE_BIT(el->style == GAUGE_LAYOUT_ARC ? GAUGE_MODE_RACING : GAUGE_MODE_NORMAL);
+            } else {
+                layout_item_t *item = &ls->items[ls->item_count++];
+                item->src = el;
+                decode_model(el, &item->config);
+            }
+        }
+    }
+
+    if (apply) screen_count = (uint8_t)hdr->screen_count;
+    return true;
+}
+
+// ============================================================================
+// ELEMENTS
+// ============================================================================
+
+/**
+ * @brief Motion apply callback for bar value changes
+ */
+static void bar_motion_apply_cb(void *bar, int32_t value) {
+    lv_bar_set_value((lv_obj_t *)bar, value, LV_ANIM_OFF);
+}
+
+static lv_obj_t* create_caption(lv_obj_t *screen, gauge_channel_t channel) {
+    const lv_font_t *font;
+    lv_obj_t *caption = lv_label_create(screen);
+    lv_label_set_text(caption, gauge_channel_caption(channel, &font));
+    lv_obj_set_style_text_font(caption, font, 0);
+    gauge_theme_add_color(caption, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+    return caption;
+}
+
+/**
+ * @brief Bar at its position, caption on its left, readout on its right
+ */
+static void build_bar(lv_obj_t *screen, layout_item_t *item) {
+    const gauge_layout_element_t *el = item->src;
+
+    lv_obj_t *bar = lv_bar_create(screen);
+    lv_obj_set_size(bar, LAYOUT_PX(el->width), LAYOUT_PX(el->height));
+    lv_obj_align(bar, LV_ALIGN_CENTER, LAYOUT_PX(el->x), LAYOUT_PX(el->y));
+    lv_obj_clear_flag(bar, LV_OBJ_FLAG_CLICKABLE);  // Taps reach the screen (peak recall)
+    lv_obj_set_style_bg_color(bar, MULTI_GAUGE_BAR_BG_COLOR, LV_PART_MAIN);
+    lv_obj_set_style_border_width(bar, MULTI_GAUGE_BAR_BORDER_WIDTH, LV_PART_MAIN);
+    gauge_theme_add_color(bar, LV_STYLE_BORDER_COLOR, GAUGE_COLOR_MUTED, LV_PART_MAIN);
+    lv_obj_set_style_radius(bar, MULTI_GAUGE_BAR_RADIUS, LV_PART_MAIN);
+    lv_obj_set_style_radius(bar, MULTI_GAUGE_INDICATOR_RADIUS, LV_PART_INDICATOR);
+
+    // Range once; the indicator color follows the zone state
+    lv_bar_set_range(bar, el->min, el->max);
+    gauge_zones_bind_bar(bar);
+    gauge_motion_attach(&item->motion, bar_motion_apply_cb, bar, el->min);
+
+    lv_obj_t *caption = create_caption(screen, (gauge_channel_t)el->channel);
+    lv_obj_align_to(caption, bar, LV_ALIGN_OUT_LEFT_MID, -GAUGE_LAYOUT_LABEL_GAP, 0);
+
+    // Left aligned once: a longer value grows to the right
+    item->readout = gauge_digits_create(screen);
+    lv_obj_set_style_text_font(item->readout, FONT_TEMP_UNIT, 0);
+    gauge_theme_add_color(item->readout, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+    gauge_digits_set_text(item->readout, "0");
+    lv_obj_align_to(item->readout, bar, LV_ALIGN_OUT_RIGHT_MID, GAUGE_LAYOUT_LABEL_GAP, 0);
+
+    item->obj = bar;
+}
+
+/**
+ * @brief Readout centered on its position, caption above, unit below
+ */
+static void build_digital(lv_obj_t *screen, layout_item_t *item) {
+    const gauge_layout_element_t *el = item->src;
+
+    // The large numerals when the element is tall enough for them
+    const lv_font_t *font = FONT_TEMP_UNIT;
+    if (LAYOUT_PX(el->height) >= lv_font_get_line_height(FONT_TEMP_MAIN)) font = FONT_TEMP_MAIN;
+
+    item->readout = gauge_digits_create(screen);
+    lv_obj_set_style_text_font(item->readout, font, 0);
+    gauge_zones_bind_text(item->readout);
+    gauge_digits_set_text(item->readout, "0");
+    lv_obj_align(item->readout, LV_ALIGN_CENTER, LAYOUT_PX(el->x), LAYOUT_PX(el->y));
+
+    lv_obj_t *caption = create_caption(screen, (gauge_channel_t)el->channel);
+    lv_obj_align_to(caption, item->readout, LV_ALIGN_OUT_TOP_MID, 0, -GAUGE_LAYOUT_LABEL_GAP);
+
+    lv_obj_t *unit = lv_label_create(screen);
+    lv_label_set_text(unit, gauge_channel_info((gauge_channel_t)el->channel)->unit_text);
+    lv_obj_set_style_text_font(unit, FONT_MARKERS, 0);
+    gauge_theme_add_color(unit, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_MUTED, 0);
+    lv_obj_align_to(unit, item->readout, LV_ALIGN_OUT_BOTTOM_MID, 0, GAUGE_LAYOUT_LABEL_GAP);
+}
+
+/**
+ * @brief Show a value on the dial of a screen
+ */
+static void update_dial(layout_screen_t *ls, float value, float rpm) {
+    gauge_model_update(&ls->dial_model_config, value, rpm, &ls->dial_model);
+    dual_gauge_apply_model(&ls->dial, &ls->dial_model);
+
+    int8_t peak = gauge_channel_info((gauge_channel_t)ls->dial_src->channel)->peak;
+    if (peak >= 0) dual_gauge_show_peak(&ls->dial, &ls->dial_config, (gauge_peak_t)peak);
+}
+
+/**
+ * @brief Show a value on a bar or digital element (no LVGL call while nothing changes)
+ */
+static void update_item(layout_item_t *item, float value, float rpm) {
+    uint8_t changes = gauge_model_update(&item->config, value, rpm, &item->model);
+
+    if (item->obj) {
+        if (changes & GAUGE_MODEL_POSITION) gauge_motion_set_target(&item->motion, item->model.position);
+        if (changes & GAUGE_MODEL_ZONE) gauge_zones_set(item->obj, (gauge_zone_t)item->model.zone);
+    } else if (changes & GAUGE_MODEL_ZONE) {
+        gauge_zones_set(item->readout, (gauge_zone_t)item->model.zone);
+    }
+    if (changes & GAUGE_MODEL_TEXT) gauge_digits_set_text(item->readout, item->model.text);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool gauge_layout_load(const void *data, uint32_t size) {
+    if (!data || !parse_pack((const uint8_t *)data, size, false)) return false;
+
+    screen_count = 0;
+    return parse_pack((const uint8_t *)data, size, true);
+}
+
+#if GAUGE_LAYOUT_PARTITION
+#ifdef ESP_PLATFORM
+
+bool gauge_layout_mount(void) {
+    if (mounted) return true;
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           (esp_partition_subtype_t)GAUGE_LAYOUT_PARTITION_SUBTYPE,
+                                                           GAUGE_LAYOUT_PARTITION_LABEL);
+    if (!part) {
+        LV_LOG_WARN("gauge_layout: no \"%s\" partition", GAUGE_LAYOUT_PARTITION_LABEL);
+        return false;
+    }
+
+    const void *addr = NULL;
+    if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &addr, &mmap_handle) != ESP_OK) {
+        LV_LOG_WARN("gauge_layout: cannot map the layout partition");
+        return false;
+    }
+
+    if (!gauge_layout_load(addr, part->size)) {
+        esp_partition_munmap(mmap_handle);
+        return false;
+    }
+    mounted = true;
+    return true;
+}
+
+#else
+
+bool gauge_layout_mount(void) {
+    if (mounted) return true;
+
+    int fd = open(GAUGE_LAYOUT_HOST_FILE, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    void *addr = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (addr == MAP_FAILED) return false;
+
+    if (!gauge_layout_load(addr, (uint32_t)st.st_size)) {
+        munmap(addr, (size_t)st.st_size);
+        return false;
+    }
+    mounted = true;
+    return true;
+}
+
+#endif
+#endif // GAUGE_LAYOUT_PARTITION
+
+uint8_t gauge_layout_screen_count(void) {
+    return screen_count;
+}
+
+uint8_t gauge_layout_screen_modes(uint8_t index) {
+    return index < screen_count ? screens[index].modes : 0;
+}
+
+uint8_t gauge_layout_screen_peaks(uint8_t index) {
+    return index < screen_count ? screens[index].peaks : 0;
+}
+
+void gauge_layout_build(uint8_t index, lv_obj_t *screen) {
+    if (index >= screen_count || screens[index].built) return;
+    layout_screen_t *ls = &screens[index];
+
+    if (ls->dial_src) {
+        uint8_t mode = ls->dial_src->style == GAUGE_LAYOUT_ARC ? GAUGE_MODE_RACING : GAUGE_MODE_NORMAL;
+        dual_gauge_create(&ls->dial, &ls->dial_config, screen, mode);
+    }
+
+    for (uint8_t i = 0; i < ls->item_count; i++) {
+        gauge_model_reset(&ls->items[i].model);  // Everything applied on the first update
+        if (ls->items[i].src->style == GAUGE_LAYOUT_BAR) {
+            build_bar(screen, &ls->items[i]);
+        } else {
+            build_digital(screen, &ls->items[i]);
+        }
+    }
+    ls->built = true;
+}
+
+void gauge_layout_release(uint8_t index) {
+    if (index >= GAUGE_LAYOUT_MAX_SCREENS || !screens[index].built) return;
+    layout_screen_t *ls = &screens[index];
+
+    if (ls->dial_src) dual_gauge_release(&ls->dial);
+    for (uint8_t i = 0; i < ls->item_count; i++) {
+        layout_item_t *item = &ls->items[i];
+        if (item->obj) gauge_motion_detach(&item->motion);
+        item->obj = NULL;
+        item->readout = NULL;
+    }
+    ls->built = false;
+}
+
+void gauge_layout_update(uint8_t index, const float *values) {
+    if (index >= screen_count || !screens[index].built) return;
+    layout_screen_t *ls = &screens[index];
+
+    float rpm = values[GAUGE_CHANNEL_RPM];
+    if (ls->dial_src) update_dial(ls, values[ls->dial_src->channel], rpm);
+    for (uint8_t i = 0; i < ls->item_count; i++) {
+        update_item(&ls->items[i], values[ls->items[i].src->channel], rpm);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,167 @@
+#ifndef GAUGE_LAYOUT_H
+#define GAUGE_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+#include "gauges_config.h"
+
+// ============================================================================
+// LAYOUT PACK FORMAT
+// ============================================================================
+
+// A layout pack describes gauge screens as data, so another car gets its own
+// channels, ranges and zones without a new firmware. It is written by
+// scripts/pack_layout.py from a JSON description and either flashed to the
+// "layouts" data partition or handed over at runtime (gauge_manager_load_layout()).
+// All integers are little endian. The header is followed by screen_count
+// screens, each a gauge_layout_screen_t followed by its elements.
+//
+// Positions and sizes are per mille of GAUGE_DIMENSION, so one pack fits every
+// screen profile. Values are fixed point: a value of the channel times
+// 10^decimals (oil pressure 3.5 bar with decimals = 1 is 35).
+
+#define GAUGE_LAYOUT_MAGIC       0x59414C47u  // "GLAY"
+#define GAUGE_LAYOUT_VERSION     1
+
+/**
+ * @brief Presentation of an element
+ *
+ * ARC and NEEDLE are full-screen dials (at most one per screen, position and
+ * size ignored) that pin their screen to the racing and the normal mode. BAR
+ * and DIGITAL are placed freely and shown in both modes.
+ */
+typedef enum {
+    GAUGE_LAYOUT_ARC = 0,         // Racing arc (gauge_common.h)
+    GAUGE_LAYOUT_NEEDLE,          // Needle meter (needle_gauge_common.h)
+    GAUGE_LAYOUT_BAR,             // Horizontal zone bar with caption and readout
+    GAUGE_LAYOUT_DIGITAL,         // Readout colored by zone, caption above, unit below
+    GAUGE_LAYOUT_STYLE_COUNT
+} gauge_layout_style_t;
+
+/**
+ * @brief Pack header
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t screen_count;
+    uint32_t size;                // Bytes of the whole pack
+    uint32_t reserved;
+} gauge_layout_header_t;
+
+/**
+ * @brief Screen header, followed by element_count elements
+ */
+typedef struct {
+    uint8_t element_count;
+    uint8_t reserved[3];
+} gauge_layout_screen_t;
+
+/**
+ * @brief One gauge element
+ */
+typedef struct {
+    uint8_t channel;              // gauge_channel_t
+    uint8_t style;                // gauge_layout_style_t
+    uint8_t decimals;             // Digits after the point (0-2), scale of every value below
+    uint8_t ticks;                // NEEDLE: labelled major ticks
+    int16_t x;                    // BAR, DIGITAL: center offset from the screen center (‰)
+    int16_t y;
+    int16_t width;                // BAR: bar size (‰)
+    int16_t height;               // BAR: bar size; DIGITAL: readout height, picks the font (‰)
+    int16_t min;
+    int16_t max;
+    int16_t zone_green;
+    int16_t zone_orange;
+    int16_t zone_red;
+    int16_t alert;                // ARC, NEEDLE: background blinks at or above
+    int16_t redline;              // ARC: start of the redline indicator
+    int16_t marker_interval;      // ARC: step of the labelled markers
+} gauge_layout_element_t;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Use a layout pack
+ *
+ * Checks the whole pack and decodes the gauge configurations of every screen,
+ * so building a screen later is only widget creation. An element is rejected
+ * when its zones are out of order or off the scale, an arc has more markers
+ * than GAUGE_SCALE_MAX_MARKERS, a needle's labelled ticks do not fall on its
+ * minor ticks or a bar / readout does not fit on the screen. Screens of the
+ * previous layout must have been released. An invalid pack leaves the current
+ * layout in place.
+ *
+ * Nothing is copied: the screens keep pointers to the elements of the pack.
+ * The buffer must outlive every screen built from it, i.e. stay valid until
+ * another pack is loaded (a mapped partition or static data, not the stack).
+ *
+ * @param data Pack
+ * @param size Bytes available at data
+ * @return true if the pack is valid and loaded
+ */
+bool gauge_layout_load(const void *data, uint32_t size);
+
+#if GAUGE_LAYOUT_PARTITION
+/**
+ * @brief Load the pack of the "layouts" data partition
+ *
+ * On the device the partition is mapped with esp_partition_mmap(); elsewhere
+ * the file GAUGE_LAYOUT_HOST_FILE is mapped with mmap().
+ *
+ * @return true if a valid pack is loaded
+ */
+bool gauge_layout_mount(void);
+#endif
+
+/**
+ * @brief Number of screens of the loaded layout (0 if none)
+ */
+uint8_t gauge_layout_screen_count(void);
+
+/**
+ * @brief Display modes a screen is shown in
+ * @param index Screen of the layout
+ * @return Bit (1 << GAUGE_MODE_x) per mode, 0 if the layout has no such screen
+ */
+uint8_t gauge_layout_screen_modes(uint8_t index);
+
+/**
+ * @brief Held values (gauge_peaks.h) a tap on a screen recalls
+ * @param index Screen of the layout
+ * @return GAUGE_PEAK_BIT() of the channels shown on the screen
+ */
+uint8_t gauge_layout_screen_peaks(uint8_t index);
+
+/**
+ * @brief Build a screen of the layout
+ * @param index Screen of the layout
+ * @param screen Screen object to build on
+ */
+void gauge_layout_build(uint8_t index, lv_obj_t *screen);
+
+/**
+ * @brief Release a screen before its object is deleted
+ * @param index Screen of the layout
+ */
+void gauge_layout_release(uint8_t index);
+
+/**
+ * @brief Show a telemetry sample on a built screen
+ * @param index Screen of the layout
+ * @param values One value per gauge_channel_t
+ */
+void gauge_layout_update(uint8_t index, const float *values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_LAYOUT_H
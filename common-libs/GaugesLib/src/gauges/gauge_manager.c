@@ -4,13 +4,19 @@ extern "C" {
 
 #include "gauge_manager.h"
 #include "gauges_config.h"
+#include "gauge_motion.h"
+#include "gauge_peaks.h"
+#include "gauge_stats.h"
+#include "gauge_theme.h"
 #include "oil_temp_gauge.h"
 #include "water_temp_gauge.h"
 #include "multi_gauge.h"
 #include "oil_pressure_gauge.h"
-#include "oil_temp_needle_gauge.h"
-#include "water_temp_needle_gauge.h"
-#include "oil_pressure_needle_gauge.h"
+#include "trend_gauge.h"
+#include "rpm_gauge.h"
+#include "pedal_gauge.h"
+#include "gauge_channels.h"
+#include "gauge_layout.h"
 
 // For millis() function
 #ifdef ARDUINO
@@ -24,12 +30,90 @@ extern unsigned long millis(void);
 // PRIVATE STATE
 // ============================================================================
 
+#define MODE_BIT(mode)     (1U << (mode))
+
+/**
+ * @brief Build, mode switch and release functions of one gauge screen
+ */
+typedef struct {
+    void (*init)(lv_obj_t *screen, uint8_t mode);
+    void (*set_mode)(uint8_t mode);   // NULL if the gauge has a single presentation
+    void (*deinit)(void);
+    uint8_t modes;                    // MODE_BIT() of every mode the gauge is shown in
+    uint8_t peaks;                    // GAUGE_PEAK_BIT() of the held values a tap recalls
+} gauge_screen_ops_t;
+
+static void multi_gauge_build(lv_obj_t *screen, uint8_t mode) {
+    (void)mode;
+    multi_gauge_init(screen);
+}
+
+static void trend_gauge_build(lv_obj_t *screen, uint8_t mode) {
+    (void)mode;
+    trend_gauge_init(screen);
+}
+
+static void rpm_gauge_build(lv_obj_t *screen, uint8_t mode) {
+    (void)mode;
+    rpm_gauge_init(screen);
+}
+
+static void pedal_gauge_build(lv_obj_t *screen, uint8_t mode) {
+    (void)mode;
+    pedal_gauge_init(screen);
+}
+
+// Screens of the layout pack: one slot each, their modes and peaks come from the pack
+_Static_assert(GAUGE_COUNT - GAUGE_LAYOUT_1 == GAUGE_LAYOUT_MAX_SCREENS, "One gauge_type_t per layout screen");
+
+#define LAYOUT_SCREEN(n) \
+    static void layout_build_##n(lv_obj_t *screen, uint8_t mode) { (void)mode; gauge_layout_build(n, screen); } \
+    static void layout_release_##n(void) { gauge_layout_release(n); }
+
+LAYOUT_SCREEN(0)
+LAYOUT_SCREEN(1)
+LAYOUT_SCREEN(2)
+LAYOUT_SCREEN(3)
+
+// One screen per gauge; the single-value gauges morph between normal and racing mode
+static const gauge_screen_ops_t screen_ops[GAUGE_COUNT] = {
+    [GAUGE_OIL_TEMP]     = {oil_temp_gauge_init, oil_temp_gauge_set_mode, oil_temp_gauge_deinit,
+                            MODE_BIT(GAUGE_MODE_NORMAL) | MODE_BIT(GAUGE_MODE_RACING),
+                            GAUGE_PEAK_BIT(GAUGE_PEAK_OIL_TEMP)},
+    [GAUGE_OIL_PRESSURE] = {oil_pressure_gauge_init, oil_pressure_gauge_set_mode, oil_pressure_gauge_deinit,
+                            MODE_BIT(GAUGE_MODE_NORMAL) | MODE_BIT(GAUGE_MODE_RACING),
+                            GAUGE_PEAK_BIT(GAUGE_PEAK_OIL_PRESSURE)},
+    [GAUGE_WATER_TEMP]   = {water_temp_gauge_init, water_temp_gauge_set_mode, water_temp_gauge_deinit,
+                            MODE_BIT(GAUGE_MODE_NORMAL) | MODE_BIT(GAUGE_MODE_RACING),
+                            GAUGE_PEAK_BIT(GAUGE_PEAK_WATER_TEMP)},
+    [GAUGE_MULTI]        = {multi_gauge_build, NULL, multi_gauge_deinit,
+                            MODE_BIT(GAUGE_MODE_RACING),  // Multi gauge is only available in racing mode
+                            GAUGE_PEAK_ALL},
+    [GAUGE_TREND]        = {trend_gauge_build, NULL, trend_gauge_deinit,
+                            MODE_BIT(GAUGE_MODE_NORMAL) | MODE_BIT(GAUGE_MODE_RACING),
+                            GAUGE_PEAK_BIT(TREND_GAUGE_PEAK)},
+    [GAUGE_RPM]          = {rpm_gauge_build, NULL, rpm_gauge_deinit,
+                            MODE_BIT(GAUGE_MODE_NORMAL) | MODE_BIT(GAUGE_MODE_RACING),
+                            0},
+    [GAUGE_PEDALS]       = {pedal_gauge_build, NULL, pedal_gauge_deinit,
+                            MODE_BIT(GAUGE_MODE_NORMAL) | MODE_BIT(GAUGE_MODE_RACING),
+                            0},
+    [GAUGE_LAYOUT_1]     = {layout_build_0, NULL, layout_release_0, 0, 0},
+    [GAUGE_LAYOUT_2]     = {layout_build_1, NULL, layout_release_1, 0, 0},
+    [GAUGE_LAYOUT_3]     = {layout_build_2, NULL, layout_release_2, 0, 0},
+    [GAUGE_LAYOUT_4]     = {layout_build_3, NULL, layout_release_3, 0, 0},
+};
+
 static gauge_type_t current_gauge = DEFAULT_GAUGE;
-static lv_obj_t *gauge_screens[GAUGE_COUNT] = {NULL};
-static lv_obj_t *needle_gauge_screens[GAUGE_COUNT] = {NULL};
+static lv_obj_t *gauge_screens[GAUGE_COUNT] = {NULL};  // Built on first use
+static uint32_t screen_last_used[GAUGE_COUNT] = {0};   // LRU stamps
+static uint32_t screen_use_counter = 0;
+static lv_timer_t *prefetch_timer = NULL;
 static gauge_gesture_callback_t gesture_callback = NULL;
-static uint8_t current_gauge_mode = 1;  // 0 = normal/needle, 1 = racing/arc (default to racing)
+static bool gestures_enabled = false;
+static uint8_t current_gauge_mode = GAUGE_MODE_RACING;  // 0 = normal/needle, 1 = racing/arc (default to racing)
 static bool display_is_rotated_270 = false;  // Display rotation state (affects gesture directions)
+static gauge_model_t channel_models[GAUGE_CHANNEL_COUNT];  // Every channel, evaluated per sample
 
 // ============================================================================
 // PRIVATE FUNCTIONS
@@ -68,122 +152,194 @@ static void internal_gesture_handler(lv_event_t * e) {
     }
 }
 
-// ============================================================================
-// PUBLIC API IMPLEMENTATION
-// ============================================================================
+static uint8_t screen_modes(gauge_type_t gauge) {
+    if (gauge >= GAUGE_LAYOUT_1) return gauge_layout_screen_modes((uint8_t)(gauge - GAUGE_LAYOUT_1));
+    return screen_ops[gauge].modes;
+}
 
-void gauge_manager_init(bool display_rotation_270) {
-    // Store rotation setting for gesture handling
-    display_is_rotated_270 = display_rotation_270;
+static uint8_t screen_peaks(gauge_type_t gauge) {
+    if (gauge >= GAUGE_LAYOUT_1) return gauge_layout_screen_peaks((uint8_t)(gauge - GAUGE_LAYOUT_1));
+    return screen_ops[gauge].peaks;
+}
 
-    // ========== RACING MODE GAUGES (ARC STYLE) ==========
-
-    // Create screen for oil temp gauge (racing)
-    gauge_screens[GAUGE_OIL_TEMP] = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(gauge_screens[GAUGE_OIL_TEMP], COLOR_SCREEN_BG, 0);
-    lv_scr_load(gauge_screens[GAUGE_OIL_TEMP]);
-    oil_temp_gauge_init();
-
-    // Create screen for water temp gauge (racing)
-    gauge_screens[GAUGE_WATER_TEMP] = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(gauge_screens[GAUGE_WATER_TEMP], COLOR_SCREEN_BG, 0);
-    lv_scr_load(gauge_screens[GAUGE_WATER_TEMP]);
-    water_temp_gauge_init();
-
-    // Create screen for multi gauge (racing)
-    gauge_screens[GAUGE_MULTI] = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(gauge_screens[GAUGE_MULTI], COLOR_SCREEN_BG, 0);
-    lv_scr_load(gauge_screens[GAUGE_MULTI]);
-    multi_gauge_init();
-
-    // Create screen for oil pressure gauge (racing)
-    gauge_screens[GAUGE_OIL_PRESSURE] = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(gauge_screens[GAUGE_OIL_PRESSURE], COLOR_SCREEN_BG, 0);
-    lv_scr_load(gauge_screens[GAUGE_OIL_PRESSURE]);
-    oil_pressure_gauge_init();
-
-    // ========== NORMAL MODE GAUGES (NEEDLE STYLE) ==========
-
-    // Create screen for oil temp needle gauge (normal)
-    needle_gauge_screens[GAUGE_OIL_TEMP] = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(needle_gauge_screens[GAUGE_OIL_TEMP], COLOR_SCREEN_BG, 0);
-    lv_scr_load(needle_gauge_screens[GAUGE_OIL_TEMP]);
-    oil_temp_needle_gauge_init();
-
-    // Create screen for water temp needle gauge (normal)
-    needle_gauge_screens[GAUGE_WATER_TEMP] = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(needle_gauge_screens[GAUGE_WATER_TEMP], COLOR_SCREEN_BG, 0);
-    lv_scr_load(needle_gauge_screens[GAUGE_WATER_TEMP]);
-    water_temp_needle_gauge_init();
-
-    // Create screen for oil pressure needle gauge (normal)
-    needle_gauge_screens[GAUGE_OIL_PRESSURE] = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(needle_gauge_screens[GAUGE_OIL_PRESSURE], COLOR_SCREEN_BG, 0);
-    lv_scr_load(needle_gauge_screens[GAUGE_OIL_PRESSURE]);
-    oil_pressure_needle_gauge_init();
-
-    // Note: Multi gauge is only available in racing mode
-    needle_gauge_screens[GAUGE_MULTI] = NULL;
-
-    // Load the default gauge (configured via DEFAULT_GAUGE build flag)
-    // Start with racing mode by default
-    lv_scr_load(gauge_screens[DEFAULT_GAUGE]);
-    current_gauge = DEFAULT_GAUGE;
-    current_gauge_mode = 1;  // Racing mode
+/**
+ * @brief Tap: list the held values of the visible gauge; long press: clear them
+ */
+static void peak_recall_handler(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_LONG_PRESSED) {
+        gauge_peaks_reset();
+    } else if (lv_indev_get_gesture_dir(lv_indev_get_act()) != LV_DIR_NONE) {
+        return;  // The release that ends a swipe is not a tap
+    }
+    gauge_peaks_recall(screen_peaks(current_gauge));
 }
 
-void gauge_manager_next(void) {
-    // Move to next gauge, wrapping around
-    current_gauge = (gauge_type_t)((current_gauge + 1) % GAUGE_COUNT);
+static bool screen_available(uint8_t mode, gauge_type_t gauge) {
+    return (screen_modes(gauge) & MODE_BIT(mode)) != 0;
+}
+
+/**
+ * @brief Step to the next (+1) or previous (-1) gauge available in a mode
+ */
+static gauge_type_t step_gauge(gauge_type_t gauge, uint8_t mode, int direction) {
+    for (int i = 0; i < GAUGE_COUNT; i++) {
+        gauge = (gauge_type_t)((gauge + GAUGE_COUNT + direction) % GAUGE_COUNT);
+        if (screen_available(mode, gauge)) break;
+    }
+    return gauge;
+}
 
-    // Skip multi gauge if in normal mode (needle gauges don't have multi gauge)
-    if (current_gauge_mode == 0 && current_gauge == GAUGE_MULTI) {
-        current_gauge = (gauge_type_t)((current_gauge + 1) % GAUGE_COUNT);
+static void attach_screen_events(lv_obj_t *screen) {
+    lv_obj_add_event_cb(screen, peak_recall_handler, LV_EVENT_SHORT_CLICKED, NULL);
+    lv_obj_add_event_cb(screen, peak_recall_handler, LV_EVENT_LONG_PRESSED, NULL);
+    if (gestures_enabled) {
+        lv_obj_add_event_cb(screen, internal_gesture_handler, LV_EVENT_GESTURE, NULL);
     }
+    if (gesture_callback) {
+        lv_obj_add_event_cb(screen, gesture_callback, LV_EVENT_GESTURE, NULL);
+    }
+}
 
-    // Load the screen for the new gauge based on mode
-    if (current_gauge_mode == 1) {
-        // Racing mode - use arc gauges
-        if (gauge_screens[current_gauge] != NULL) {
-            lv_scr_load(gauge_screens[current_gauge]);
-        }
-    } else {
-        // Normal mode - use needle gauges
-        if (needle_gauge_screens[current_gauge] != NULL) {
-            lv_scr_load(needle_gauge_screens[current_gauge]);
+static lv_obj_t* build_screen(gauge_type_t gauge) {
+    uint32_t start = lv_tick_get();
+
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, COLOR_SCREEN_BG, 0);
+    screen_ops[gauge].init(screen, current_gauge_mode);
+    attach_screen_events(screen);
+
+    gauge_stats_set_screen_build(lv_tick_elaps(start));
+
+    gauge_screens[gauge] = screen;
+    return screen;
+}
+
+static void release_screen(gauge_type_t gauge) {
+    screen_ops[gauge].deinit();
+    lv_obj_del(gauge_screens[gauge]);
+    gauge_screens[gauge] = NULL;
+    screen_last_used[gauge] = 0;
+}
+
+/**
+ * @brief Delete least recently used screens while the LVGL heap is over budget
+ *
+ * The visible screen is never evicted. Runs through lv_async_call() because a
+ * switch usually comes from a gesture event of the screen that may be evicted.
+ */
+static void evict_screens(void *user_data) {
+    (void)user_data;
+
+    while (gauge_stats_lvgl_mem_used() > GAUGE_SCREEN_MEM_BUDGET) {
+        int lru_gauge = -1;
+
+        for (int g = 0; g < GAUGE_COUNT; g++) {
+            if (!gauge_screens[g] || g == current_gauge) continue;
+            if (lru_gauge < 0 || screen_last_used[g] < screen_last_used[lru_gauge]) {
+                lru_gauge = g;
+            }
         }
+
+        if (lru_gauge < 0) break;  // Only the visible screen is left
+        release_screen((gauge_type_t)lru_gauge);
     }
 }
 
-void gauge_manager_previous(void) {
-    // Move to previous gauge, wrapping around
-    if (current_gauge == 0) {
-        current_gauge = (gauge_type_t)(GAUGE_COUNT - 1);
-    } else {
-        current_gauge = (gauge_type_t)(current_gauge - 1);
+/**
+ * @brief Build the neighbours of the visible gauge while the UI is idle
+ *
+ * Builds at most one screen per run so a swipe never waits for more than one
+ * build, and only while the heap is under budget. Pauses itself when done.
+ */
+static void prefetch_timer_cb(lv_timer_t *timer) {
+    gauge_type_t neighbours[2] = {
+        step_gauge(current_gauge, current_gauge_mode, 1),
+        step_gauge(current_gauge, current_gauge_mode, -1)
+    };
+
+    for (int i = 0; i < 2; i++) {
+        if (gauge_screens[neighbours[i]]) continue;
+        if (gauge_stats_lvgl_mem_used() > GAUGE_SCREEN_MEM_BUDGET) break;
+
+        build_screen(neighbours[i]);
+        return;
     }
 
-    // Skip multi gauge if in normal mode (needle gauges don't have multi gauge)
-    if (current_gauge_mode == 0 && current_gauge == GAUGE_MULTI) {
-        if (current_gauge == 0) {
-            current_gauge = (gauge_type_t)(GAUGE_COUNT - 1);
-        } else {
-            current_gauge = (gauge_type_t)(current_gauge - 1);
-        }
+    lv_timer_pause(timer);
+}
+
+/**
+ * @brief Show the screen for current_gauge in current_gauge_mode, building it if needed
+ *
+ * A screen built earlier in the other mode is morphed in place before it is loaded.
+ */
+static void show_current_gauge(void) {
+    lv_obj_t *screen = gauge_screens[current_gauge];
+    if (!screen) {
+        screen = build_screen(current_gauge);
+    } else if (screen_ops[current_gauge].set_mode) {
+        screen_ops[current_gauge].set_mode(current_gauge_mode);
     }
 
-    // Load the screen for the new gauge based on mode
-    if (current_gauge_mode == 1) {
-        // Racing mode - use arc gauges
-        if (gauge_screens[current_gauge] != NULL) {
-            lv_scr_load(gauge_screens[current_gauge]);
-        }
-    } else {
-        // Normal mode - use needle gauges
-        if (needle_gauge_screens[current_gauge] != NULL) {
-            lv_scr_load(needle_gauge_screens[current_gauge]);
-        }
+    if (lv_scr_act() != screen) {
+        lv_scr_load(screen);
+    }
+    screen_last_used[current_gauge] = ++screen_use_counter;
+
+    lv_async_call(evict_screens, NULL);
+
+    // Restart the idle countdown before building neighbours
+    if (prefetch_timer) {
+        lv_timer_reset(prefetch_timer);
+        lv_timer_resume(prefetch_timer);
+    }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void gauge_manager_init(bool display_rotation_270) {
+    // Store rotation setting for gesture handling
+    display_is_rotated_270 = display_rotation_270;
+
+#if GAUGE_FONT_PARTITION
+    // Map the custom fonts before any style uses them (missing fonts fall back to LV_FONT_DEFAULT)
+    gauge_fonts_mount();
+#endif
+
+    // Single timer that moves every arc, needle and bar towards its target
+    gauge_motion_init();
+
+    // Idle timer that builds the screens next to the visible one
+    prefetch_timer = lv_timer_create(prefetch_timer_cb, GAUGE_PREFETCH_DELAY, NULL);
+    lv_timer_pause(prefetch_timer);
+
+#if GAUGE_LAYOUT_PARTITION
+    // Screens of the layout pack, if one is flashed
+    gauge_layout_mount();
+#endif
+
+    // Only the default gauge is built now (configured via DEFAULT_GAUGE build flag).
+    // Start with racing mode by default; other screens are built on first use.
+    current_gauge = DEFAULT_GAUGE;
+    current_gauge_mode = GAUGE_MODE_RACING;
+    if (!screen_available(current_gauge_mode, current_gauge)) {
+        current_gauge = step_gauge(current_gauge, current_gauge_mode, 1);  // e.g. a layout screen without a pack
     }
+    show_current_gauge();
+}
+
+void gauge_manager_next(void) {
+    // Move to next gauge, wrapping around and skipping gauges without a screen in this mode
+    current_gauge = step_gauge(current_gauge, current_gauge_mode, 1);
+    show_current_gauge();
+}
+
+void gauge_manager_previous(void) {
+    // Move to previous gauge, wrapping around and skipping gauges without a screen in this mode
+    current_gauge = step_gauge(current_gauge, current_gauge_mode, -1);
+    show_current_gauge();
 }
 
 gauge_type_t gauge_manager_get_current(void) {
@@ -191,17 +347,13 @@ gauge_type_t gauge_manager_get_current(void) {
 }
 
 void gauge_manager_enable_gestures(void) {
-    // Attach the internal gesture handler to all gauge screens (racing mode)
-    for (int i = 0; i < GAUGE_COUNT; i++) {
-        if (gauge_screens[i] != NULL) {
-            lv_obj_add_event_cb(gauge_screens[i], internal_gesture_handler, LV_EVENT_GESTURE, NULL);
-        }
-    }
+    gestures_enabled = true;
 
-    // Attach the internal gesture handler to all needle gauge screens (normal mode)
-    for (int i = 0; i < GAUGE_COUNT; i++) {
-        if (needle_gauge_screens[i] != NULL) {
-            lv_obj_add_event_cb(needle_gauge_screens[i], internal_gesture_handler, LV_EVENT_GESTURE, NULL);
+    // Attach the internal gesture handler to the screens built so far;
+    // screens built later get it in build_screen()
+    for (int g = 0; g < GAUGE_COUNT; g++) {
+        if (gauge_screens[g] != NULL) {
+            lv_obj_add_event_cb(gauge_screens[g], internal_gesture_handler, LV_EVENT_GESTURE, NULL);
         }
     }
 }
@@ -209,82 +361,108 @@ void gauge_manager_enable_gestures(void) {
 void gauge_manager_set_gesture_callback(gauge_gesture_callback_t callback) {
     gesture_callback = callback;
 
-    // Attach the custom gesture callback to all gauge screens (racing mode)
-    for (int i = 0; i < GAUGE_COUNT; i++) {
-        if (gauge_screens[i] != NULL) {
-            lv_obj_add_event_cb(gauge_screens[i], callback, LV_EVENT_GESTURE, NULL);
+    // Attach the custom gesture callback to the screens built so far;
+    // screens built later get it in build_screen()
+    for (int g = 0; g < GAUGE_COUNT; g++) {
+        if (gauge_screens[g] != NULL) {
+            lv_obj_add_event_cb(gauge_screens[g], callback, LV_EVENT_GESTURE, NULL);
         }
     }
+}
 
-    // Attach the custom gesture callback to all needle gauge screens (normal mode)
-    for (int i = 0; i < GAUGE_COUNT; i++) {
-        if (needle_gauge_screens[i] != NULL) {
-            lv_obj_add_event_cb(needle_gauge_screens[i], callback, LV_EVENT_GESTURE, NULL);
+void gauge_manager_update(float oilTemp, float waterTemp, float oilPressure, int32_t rpm, uint8_t gaugeMode) {
+    // Update gauge mode if it has changed: the visible gauge is morphed in
+    // place (scale layer only); other built screens follow when shown
+    if (gaugeMode != current_gauge_mode && gaugeMode < GAUGE_MODE_COUNT) {
+        current_gauge_mode = gaugeMode;
+
+        // Multi gauge is not available in normal mode
+        if (!screen_available(current_gauge_mode, current_gauge)) {
+            current_gauge = GAUGE_OIL_TEMP;  // Default to oil temp
         }
+        show_current_gauge();
+    }
+
+    // History and held values follow every sample, whichever gauge is visible
+    trend_gauge_sample(oilTemp, waterTemp);
+    gauge_peaks_sample(oilTemp, waterTemp, oilPressure, rpm);
+
+    // Evaluate every channel (gauge_model.h, no LVGL), then update the current
+    // gauge; each gauge applies what changed on its screen for the active mode
+    const float values[GAUGE_CHANNEL_COUNT] = {
+        [GAUGE_CHANNEL_OIL_TEMP] = oilTemp,
+        [GAUGE_CHANNEL_WATER_TEMP] = waterTemp,
+        [GAUGE_CHANNEL_OIL_PRESSURE] = oilPressure,
+        [GAUGE_CHANNEL_RPM] = (float)rpm,
+    };
+    gauge_model_update_all(gauge_channel_models(), values, channel_models);
+    switch (current_gauge) {
+        case GAUGE_OIL_TEMP:
+            oil_temp_gauge_set_model(&channel_models[GAUGE_CHANNEL_OIL_TEMP]);
+            break;
+        case GAUGE_WATER_TEMP:
+            water_temp_gauge_set_model(&channel_models[GAUGE_CHANNEL_WATER_TEMP]);
+            break;
+        case GAUGE_MULTI:
+            multi_gauge_set_models(channel_models);
+            break;
+        case GAUGE_OIL_PRESSURE:
+            oil_pressure_gauge_set_model(&channel_models[GAUGE_CHANNEL_OIL_PRESSURE]);
+            break;
+        case GAUGE_TREND:
+            break;  // Fed by trend_gauge_sample() above
+        case GAUGE_RPM:
+            break;  // Fed by gauge_manager_post_rpm() from the receive callback
+        case GAUGE_PEDALS:
+            break;  // Fed by gauge_manager_post_pedals() from the receive callback
+        case GAUGE_LAYOUT_1:
+        case GAUGE_LAYOUT_2:
+        case GAUGE_LAYOUT_3:
+        case GAUGE_LAYOUT_4:
+            gauge_layout_update((uint8_t)(current_gauge - GAUGE_LAYOUT_1), values);
+            break;
+        default:
+            break;
     }
 }
 
-void gauge_manager_update(float oilTemp, float waterTemp, float oilPressure, int32_t rpm, uint8_t gaugeMode) {
-    // Update gauge mode if it has changed
-    if (gaugeMode != current_gauge_mode) {
-        current_gauge_mode = gaugeMode;
+void gauge_manager_post_rpm(uint32_t rpm, float speed) {
+    rpm_gauge_post(rpm, speed);
+}
 
-        // Switch to the appropriate screen for the new mode
-        if (current_gauge_mode == 1) {
-            // Racing mode - load arc gauge
-            if (gauge_screens[current_gauge] != NULL) {
-                lv_scr_load(gauge_screens[current_gauge]);
-            }
+void gauge_manager_post_pedals(float brake, float brake_pressure, float throttle, float throttle_pos) {
+    pedal_gauge_post(brake, brake_pressure, throttle, throttle_pos);
+}
+
+bool gauge_manager_load_layout(const void *data, uint32_t size) {
+    // Built layout screens show the old pack: release them, the visible one
+    // only after its replacement is loaded
+    lv_obj_t *visible = NULL;
+    for (int g = GAUGE_LAYOUT_1; g < GAUGE_COUNT; g++) {
+        if (!gauge_screens[g]) continue;
+        if (g == current_gauge) {
+            screen_ops[g].deinit();
+            visible = gauge_screens[g];
+            gauge_screens[g] = NULL;
         } else {
-            // Normal mode - load needle gauge
-            // Skip multi gauge if in normal mode
-            if (current_gauge == GAUGE_MULTI) {
-                current_gauge = GAUGE_OIL_TEMP;  // Default to oil temp
-            }
-            if (needle_gauge_screens[current_gauge] != NULL) {
-                lv_scr_load(needle_gauge_screens[current_gauge]);
-            }
+            release_screen((gauge_type_t)g);
         }
     }
 
-    // Update the appropriate gauge based on mode and current gauge type
-    if (current_gauge_mode == 1) {
-        // Racing mode - update arc gauges
-        switch (current_gauge) {
-            case GAUGE_OIL_TEMP:
-                oil_temp_gauge_set_value((int32_t)oilTemp);
-                break;
-            case GAUGE_WATER_TEMP:
-                water_temp_gauge_set_value((int32_t)waterTemp);
-                break;
-            case GAUGE_MULTI:
-                multi_gauge_set_values((int32_t)waterTemp, (int32_t)oilTemp, oilPressure, rpm);
-                break;
-            case GAUGE_OIL_PRESSURE:
-                oil_pressure_gauge_set_value(oilPressure, rpm);
-                break;
-            default:
-                break;
-        }
-    } else {
-        // Normal mode - update needle gauges
-        switch (current_gauge) {
-            case GAUGE_OIL_TEMP:
-                oil_temp_needle_gauge_set_value((int32_t)oilTemp);
-                break;
-            case GAUGE_WATER_TEMP:
-                water_temp_needle_gauge_set_value((int32_t)waterTemp);
-                break;
-            case GAUGE_OIL_PRESSURE:
-                oil_pressure_needle_gauge_set_value(oilPressure, rpm);
-                break;
-            case GAUGE_MULTI:
-                // Multi gauge not available in normal mode, skip
-                break;
-            default:
-                break;
+    bool loaded = gauge_layout_load(data, size);
+
+    if (visible) {
+        if (!screen_available(current_gauge_mode, current_gauge)) {
+            current_gauge = step_gauge(current_gauge, current_gauge_mode, 1);  // The new pack has fewer screens
         }
+        show_current_gauge();
+        lv_obj_del(visible);
     }
+    return loaded;
+}
+
+void gauge_manager_set_luminosity(uint8_t luminosity) {
+    gauge_theme_set_luminosity(luminosity);
 }
 
 void gauge_manager_update_test_animation(void) {
@@ -332,6 +510,18 @@ void gauge_manager_update_test_animation(void) {
     }
 
     gauge_manager_update(oil_temp, water_temp, oil_pressure, rpm, 1);  // Use racing mode for test
+    gauge_manager_post_rpm((uint32_t)rpm, 0.0f);  // No speed: shift lights use RPM_GAUGE_SHIFT_RPM
+
+    // Pedals: 4 s on the throttle (plate opening ahead of the pedal), then 2 s
+    // braking with a trail-off (pressure up to 80 bar)
+    unsigned long p = millis() % 6000UL;
+    if (p < 4000UL) {
+        float throttle = (float)(p / 40UL);
+        gauge_manager_post_pedals(0.0f, 0.0f, throttle, LV_MIN(throttle * 1.2f, 100.0f));
+    } else {
+        float brake = 100.0f - (float)((p - 4000UL) / 20UL);
+        gauge_manager_post_pedals(brake, brake * 80.0f, 0.0f, 0.0f);
+    }
 }
 
 #ifdef __cplusplus
@@ -16,6 +16,13 @@ typedef enum {
     GAUGE_OIL_PRESSURE = 1,
     GAUGE_WATER_TEMP = 2,
     GAUGE_MULTI = 3,
+    GAUGE_TREND = 4,
+    GAUGE_RPM = 5,
+    GAUGE_PEDALS = 6,
+    GAUGE_LAYOUT_1 = 7,   // Screens of the layout pack (gauge_layout.h), skipped while the pack has none
+    GAUGE_LAYOUT_2 = 8,
+    GAUGE_LAYOUT_3 = 9,
+    GAUGE_LAYOUT_4 = 10,
     GAUGE_COUNT  // Total number of gauges
 } gauge_type_t;
 
@@ -30,7 +37,9 @@ typedef void (*gauge_gesture_callback_t)(lv_event_t * e);
 /**
  * @brief Initialize the gauge manager and all gauges
  *
- * Initializes all gauges but only makes the first one visible.
+ * Builds and shows only the default gauge. Other screens are built on first
+ * use (or pre-built while idle) and the least recently used ones are deleted
+ * while the LVGL heap is above GAUGE_SCREEN_MEM_BUDGET.
  * Should be called once during setup after LVGL is initialized.
  *
  * @param display_rotation_270 Set to true if display is rotated 270° (affects gesture directions)
@@ -100,9 +109,67 @@ gauge_type_t gauge_manager_get_current(void);
  * @param gaugeMode Gauge display mode (0 = normal/needle, 1 = racing/arc)
  *
  * Updates only the currently visible gauge based on the type and mode.
+ * A mode change morphs the visible gauge in place (only its scale layer is
+ * rebuilt); the multi gauge falls back to oil temperature in normal mode.
+ *
+ * Every sample also feeds the trend history (trend_gauge.h) and the held
+ * peak values (gauge_peaks.h), shown as markers on the gauges. A tap on a
+ * gauge lists its held values for a few seconds, a long press clears them.
  */
 void gauge_manager_update(float oilTemp, float waterTemp, float oilPressure, int32_t rpm, uint8_t gaugeMode);
 
+/**
+ * @brief Post engine RPM from the telemetry receive callback
+ *
+ * @param rpm Engine RPM
+ * @param speed Vehicle speed in km/h (gear estimate for the shift points)
+ *
+ * Fast path of the tachometer / shift light gauge: safe to call from the
+ * receive task without the LVGL lock (the sample is only stored). The gauge
+ * applies the latest sample every RPM_GAUGE_PERIOD ms and refreshes at once,
+ * without waiting for gauge_manager_update(). Receive-to-refresh latency is
+ * reported in gauge_stats_t.
+ */
+void gauge_manager_post_rpm(uint32_t rpm, float speed);
+
+/**
+ * @brief Post a brake / throttle sample from the telemetry receive callback
+ *
+ * @param brake Brake pedal in percent (0-100)
+ * @param brake_pressure Brake line pressure in kPa
+ * @param throttle Accelerator pedal in percent (0-100)
+ * @param throttle_pos Throttle plate in percent (0-100)
+ *
+ * Call it for every received packet: safe without the LVGL lock, each sample
+ * is queued in a per-channel ring and becomes one column of the pedal trace.
+ */
+void gauge_manager_post_pedals(float brake, float brake_pressure, float throttle, float throttle_pos);
+
+/**
+ * @brief Replace the layout pack at runtime
+ *
+ * @param data Pack written by scripts/pack_layout.py, not copied: must outlive the
+ *             screens built from it (until the next successful load)
+ * @param size Bytes available at data
+ * @return true if the pack is valid; otherwise the previous layout is kept
+ *
+ * Built screens of the previous layout are released (the visible one after
+ * its replacement is shown); the new screens are built when first shown,
+ * like every other gauge. Must be called with the LVGL lock held.
+ */
+bool gauge_manager_load_layout(const void *data, uint32_t size);
+
+/**
+ * @brief Follow the dash luminosity with the day/night theme
+ *
+ * @param luminosity TelemetryData.luminosity, screen brightness percentage (0-100)
+ *
+ * Switches every gauge to the night palette when the dash is dimmed and back
+ * to day when it brightens (with hysteresis, see gauge_theme.h). A switch
+ * costs one redraw of the visible screen; nothing is rebuilt.
+ */
+void gauge_manager_set_luminosity(uint8_t luminosity);
+
 /**
  * @brief Update gauges with animated test values
  *
@@ -0,0 +1,186 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_model.h"
+#include <string.h>
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Zone of a fixed point value (integer compares only)
+ */
+static uint8_t zone_of(const gauge_model_config_t *config, int32_t value) {
+    if (value < config->zone_green) return GAUGE_ZONE_GREY;
+    if (value < config->zone_orange) return GAUGE_ZONE_GREEN;
+    if (value < config->zone_red) return GAUGE_ZONE_AMBER;
+    return GAUGE_ZONE_RED;
+}
+
+/**
+ * @brief Value too low for the RPM (oil pressure)
+ *
+ * For a 2.0L naturally aspirated engine (MX5 NC), with a divisor of 2000:
+ * - Idle (800 RPM): low_min (~0.5 bar)
+ * - 3000 RPM: ~1.5 bar minimum
+ * - 6000 RPM: ~3.0 bar minimum
+ */
+static bool below_rpm_limit(const gauge_model_config_t *config, int32_t value, float rpm) {
+    if (config->low_rpm_divisor <= 0.0f) return false;
+
+    float limit = rpm / config->low_rpm_divisor;
+    if (limit < config->low_min) limit = config->low_min;
+    return (float)value / (float)gauge_value_scale(config->decimals) < limit;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+int32_t gauge_value_scale(uint8_t decimals) {
+    return decimals == 0 ? 1 : (decimals == 1 ? 10 : 100);
+}
+
+int32_t gauge_value_to_fixed(float value, uint8_t decimals) {
+    float scaled = value * (float)gauge_value_scale(decimals);
+    return (int32_t)(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+}
+
+void gauge_value_format(char *buf, size_t len, int32_t value, uint8_t decimals) {
+    if (len == 0) return;
+
+    // Right to left: digits, the point after `decimals` of them, then the sign
+    char text[GAUGE_MODEL_TEXT_LEN];
+    size_t pos = sizeof(text) - 1;
+    text[pos] = '\0';
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    for (uint8_t digit = 0; magnitude > 0 || digit <= decimals; digit++) {
+        if (digit == decimals && decimals > 0) text[--pos] = '.';
+        text[--pos] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    }
+    if (value < 0) text[--pos] = '-';
+
+    size_t n = sizeof(text) - 1 - pos;
+    if (n > len - 1) n = len - 1;
+    memcpy(buf, &text[pos], n);
+    buf[n] = '\0';
+}
+
+gauge_zone_t gauge_zone_for_value(float value, float zone_green, float zone_orange, float zone_red) {
+    if (value < zone_green) return GAUGE_ZONE_GREY;
+    if (value < zone_orange) return GAUGE_ZONE_GREEN;
+    if (value < zone_red) return GAUGE_ZONE_AMBER;
+    return GAUGE_ZONE_RED;
+}
+
+void gauge_model_reset(gauge_model_t *state) {
+    state->valid = false;
+}
+
+uint8_t gauge_model_update(const gauge_model_config_t *config, float value, float rpm, gauge_model_t *state) {
+    int32_t fixed = gauge_value_to_fixed(value, config->decimals);
+
+    // Arc / needle / bar constrained to the range, readout shows the actual value
+    int32_t position = fixed < config->min ? config->min : (fixed > config->max ? config->max : fixed);
+
+    // Oil pressure is critical both when too low (relative to RPM) and too high
+    bool low = below_rpm_limit(config, fixed, rpm);
+    uint8_t zone = low ? (uint8_t)GAUGE_ZONE_RED : zone_of(config, fixed);
+    bool alert = low || fixed >= config->alert;
+
+    uint8_t changes = 0;
+    if (!state->valid || state->decimals != config->decimals) {
+        changes = GAUGE_MODEL_ALL;
+    } else {
+        if (fixed != state->value) changes |= GAUGE_MODEL_TEXT;
+        if (position != state->position) changes |= GAUGE_MODEL_POSITION;
+        if (zone != state->zone) changes |= GAUGE_MODEL_ZONE;
+        if (low != state->low) changes |= GAUGE_MODEL_LOW;
+        if (alert != state->alert) changes |= GAUGE_MODEL_ALERT;
+    }
+
+    if (changes & GAUGE_MODEL_TEXT) gauge_value_format(state->text, sizeof(state->text), fixed, config->decimals);
+    state->valid = true;
+    state->decimals = config->decimals;
+    state->zone = zone;
+    state->low = low;
+    state->alert = alert;
+    state->value = fixed;
+    state->position = position;
+    return changes;
+}
+
+uint32_t gauge_model_update_all(const gauge_model_config_t *const *configs, const float *values,
+                                gauge_model_t *states) {
+    uint32_t changed = 0;
+    for (int ch = 0; ch < GAUGE_CHANNEL_COUNT; ch++) {
+        if (gauge_model_update(configs[ch], values[ch], values[GAUGE_CHANNEL_RPM], &states[ch])) {
+            changed |= 1UL << ch;
+        }
+    }
+    return changed;
+}
+
+uint8_t gauge_model_sync(gauge_model_t *shown, const gauge_model_t *model) {
+    if (!model->valid) return 0;
+
+    uint8_t changes = 0;
+    if (!shown->valid || shown->decimals != model->decimals) {
+        changes = GAUGE_MODEL_ALL;
+    } else {
+        if (model->value != shown->value) changes |= GAUGE_MODEL_TEXT;
+        if (model->position != shown->position) changes |= GAUGE_MODEL_POSITION;
+        if (model->zone != shown->zone) changes |= GAUGE_MODEL_ZONE;
+        if (model->low != shown->low) changes |= GAUGE_MODEL_LOW;
+        if (model->alert != shown->alert) changes |= GAUGE_MODEL_ALERT;
+    }
+
+    if (changes) *shown = *model;
+    return changes;
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+#if GAUGE_MODEL_BENCHMARK
+void gauge_model_benchmark(const gauge_model_config_t *const *configs, uint32_t samples,
+                           uint32_t (*clock_us)(void), gauge_model_bench_t *result) {
+    gauge_model_t states[GAUGE_CHANNEL_COUNT];
+    memset(states, 0, sizeof(states));
+    uint32_t changed = 0;
+    uint32_t texts = 0;
+
+    uint32_t start = clock_us();
+    for (uint32_t t = 0; t < samples; t++) {
+        // Pressure lags a 1000-7000 RPM sweep: low for the RPM on the way up
+        float rpm = 1000.0f + (float)(t % 600) * 10.0f;
+        const float values[GAUGE_CHANNEL_COUNT] = {
+            [GAUGE_CHANNEL_OIL_TEMP] = 95.0f + (float)(t % 2000) * 0.02f,
+            [GAUGE_CHANNEL_WATER_TEMP] = 88.0f + (float)(t % 40) * 0.02f,
+            [GAUGE_CHANNEL_OIL_PRESSURE] = 1.0f + (float)((t + 450) % 600) * 0.008f,
+            [GAUGE_CHANNEL_RPM] = rpm,
+        };
+        for (int ch = 0; ch < GAUGE_CHANNEL_COUNT; ch++) {
+            uint8_t changes = gauge_model_update(configs[ch], values[ch], rpm, &states[ch]);
+            if (changes) changed++;
+            if (changes & GAUGE_MODEL_TEXT) texts++;
+        }
+    }
+    uint32_t elapsed = clock_us() - start;
+
+    if (result) {
+        result->samples = samples;
+        result->update_us = elapsed;
+        result->changed = changed;
+        result->texts = texts;
+    }
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
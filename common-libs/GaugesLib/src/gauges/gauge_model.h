@@ -0,0 +1,221 @@
+#ifndef GAUGE_MODEL_H
+#define GAUGE_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// GAUGE MODEL
+// ============================================================================
+// What a gauge shows, computed from telemetry without LVGL: the value clamped
+// to the travel of the arc / needle / bar, the color zone, the alerts (with
+// the RPM-dependent oil pressure minimum) and the readout text. The LVGL views
+// (gauge_apply_model(), needle_gauge_apply_model(), the multi gauge rows and
+// the layout elements) only apply what changed.
+//
+// This header and gauge_model.c only need a C compiler: they build and run on
+// a host, where test/test_gauge_model.c covers them (test/run_host_tests.sh).
+// The configurations of the channels are in gauge_channels.c.
+
+// Build gauge_model_benchmark() (cost of evaluating every channel per sample).
+// Defined here rather than in gauges_config.h, which needs LVGL.
+#ifndef GAUGE_MODEL_BENCHMARK
+    #define GAUGE_MODEL_BENCHMARK 0
+#endif
+
+#define GAUGE_MODEL_TEXT_LEN    16      // Readout text, any int32_t with 2 decimals
+
+/**
+ * @brief Values passed to gauge_manager_update(), by index
+ *
+ * Used by the screens that pick their channels at runtime (gauge_layout.h).
+ * The numbering is part of the layout pack format: append only.
+ */
+typedef enum {
+    GAUGE_CHANNEL_OIL_TEMP = 0,     // °C
+    GAUGE_CHANNEL_WATER_TEMP,       // °C
+    GAUGE_CHANNEL_OIL_PRESSURE,     // bar
+    GAUGE_CHANNEL_RPM,
+    GAUGE_CHANNEL_COUNT
+} gauge_channel_t;
+
+/**
+ * @brief Color zone of a gauge value, in increasing severity
+ */
+typedef enum {
+    GAUGE_ZONE_GREY = 0,    // Below the green threshold (cold / not in range yet)
+    GAUGE_ZONE_GREEN,
+    GAUGE_ZONE_AMBER,
+    GAUGE_ZONE_RED,
+    GAUGE_ZONE_COUNT
+} gauge_zone_t;
+
+/**
+ * @brief Fixed point value of a constant, for static configurations
+ */
+#define GAUGE_MODEL_FIXED(value, decimals) \
+    ((int32_t)((value) * ((decimals) == 0 ? 1 : ((decimals) == 1 ? 10 : 100)) + ((value) < 0 ? -0.5f : 0.5f)))
+
+/**
+ * @brief How a gauge turns a value into what it shows
+ *
+ * Values are fixed point: value times 10^decimals, the resolution of the
+ * readout (oil pressure 3.5 bar with decimals = 1 is 35), like the layout pack.
+ */
+typedef struct {
+    uint8_t decimals;           // Digits after the point (0-2)
+    int32_t min;                // Travel of the arc, needle or bar
+    int32_t max;
+    int32_t zone_green;         // GREY below, GREEN from here
+    int32_t zone_orange;        // AMBER from here
+    int32_t zone_red;           // RED from here
+    int32_t alert;              // Alert (blink) at or above
+    float low_rpm_divisor;      // > 0: RED and alert below rpm / divisor (oil pressure), in units
+    float low_min;              // Lowest value of that limit (idle)
+} gauge_model_config_t;
+
+/**
+ * @brief Everything a gauge shows for one value
+ */
+typedef struct {
+    bool valid;                 // false until evaluated / shown: differs from any state
+    uint8_t decimals;           // Of value and position
+    uint8_t zone;               // gauge_zone_t
+    bool low;                   // Below the RPM-dependent minimum
+    bool alert;                 // The gauge blinks (gauge_alert.h)
+    int32_t value;              // Actual value, fixed point (readout)
+    int32_t position;           // Value clamped to [min, max], fixed point (arc, needle, bar)
+    char text[GAUGE_MODEL_TEXT_LEN];  // Readout of value
+} gauge_model_t;
+
+/**
+ * @brief Parts of a gauge_model_t that changed (bit mask)
+ */
+typedef enum {
+    GAUGE_MODEL_POSITION = 1 << 0,
+    GAUGE_MODEL_TEXT     = 1 << 1,
+    GAUGE_MODEL_ZONE     = 1 << 2,
+    GAUGE_MODEL_LOW      = 1 << 3,
+    GAUGE_MODEL_ALERT    = 1 << 4,
+    GAUGE_MODEL_ALL      = 0x1F
+} gauge_model_change_t;
+
+// ============================================================================
+// VALUES
+// ============================================================================
+
+/**
+ * @brief Scale of a fixed point value: 10^decimals (decimals 0 to 2)
+ */
+int32_t gauge_value_scale(uint8_t decimals);
+
+/**
+ * @brief Round a value to fixed point, the resolution it is displayed with
+ * @param value Value in channel units
+ * @param decimals Digits after the point (0 to 2)
+ * @return value times 10^decimals, rounded
+ */
+int32_t gauge_value_to_fixed(float value, uint8_t decimals);
+
+/**
+ * @brief Readout text of a fixed point value ("3.5", "-12", "0.25")
+ *
+ * Formatted by hand (no printf), truncated to len.
+ *
+ * @param buf Output buffer
+ * @param len Size of buf
+ * @param value Fixed point value
+ * @param decimals Digits after the point (0 to 2)
+ */
+void gauge_value_format(char *buf, size_t len, int32_t value, uint8_t decimals);
+
+/**
+ * @brief Zone of a value for the usual green / orange / red thresholds
+ * @return GREY below green, GREEN below orange, AMBER below red, RED otherwise
+ */
+gauge_zone_t gauge_zone_for_value(float value, float zone_green, float zone_orange, float zone_red);
+
+// ============================================================================
+// EVALUATION
+// ============================================================================
+
+/**
+ * @brief Forget a state: the next update or sync reports every part as changed
+ */
+void gauge_model_reset(gauge_model_t *state);
+
+/**
+ * @brief Evaluate a value into a state
+ *
+ * The readout text is only formatted when the fixed point value changes.
+ *
+ * @param config Gauge configuration
+ * @param value Value in channel units
+ * @param rpm Engine RPM, for the low limit (ignored without low_rpm_divisor)
+ * @param state Previous state, updated in place
+ * @return Parts that changed (gauge_model_change_t), GAUGE_MODEL_ALL after a reset
+ */
+uint8_t gauge_model_update(const gauge_model_config_t *config, float value, float rpm, gauge_model_t *state);
+
+/**
+ * @brief Evaluate every channel of a sample
+ * @param configs Configuration per channel
+ * @param values Value per channel (GAUGE_CHANNEL_RPM also feeds the low limits)
+ * @param states State per channel, updated in place
+ * @return Channels that changed, bit (1 << channel)
+ */
+uint32_t gauge_model_update_all(const gauge_model_config_t *const *configs, const float *values,
+                                gauge_model_t *states);
+
+/**
+ * @brief Bring the state shown by a view up to date
+ *
+ * Views keep the state they show and apply only the returned parts; a view
+ * whose widgets were rebuilt starts from a zeroed (invalid) state.
+ *
+ * @param shown State shown by the view, copied from model
+ * @param model Evaluated state
+ * @return Parts that differ (gauge_model_change_t), 0 if model is not valid
+ */
+uint8_t gauge_model_sync(gauge_model_t *shown, const gauge_model_t *model);
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+#if GAUGE_MODEL_BENCHMARK
+/**
+ * @brief Benchmark results, totals over all samples
+ */
+typedef struct {
+    uint32_t samples;
+    uint32_t update_us;         // Evaluation time, every channel of every sample
+    uint32_t changed;           // Channel updates with a visible change
+    uint32_t texts;             // Readouts formatted
+} gauge_model_bench_t;
+
+/**
+ * @brief Time the evaluation of every channel on a synthetic drive
+ *
+ * Temperatures creep, oil pressure follows the engine and RPM changes on every
+ * sample, dipping below the pressure limit now and then. Runs without LVGL.
+ *
+ * @param configs Configuration per channel
+ * @param samples Samples to evaluate
+ * @param clock_us Microsecond clock (micros() on the board, clock_gettime() on a host)
+ * @param result Timing and counters
+ */
+void gauge_model_benchmark(const gauge_model_config_t *const *configs, uint32_t samples,
+                           uint32_t (*clock_us)(void), gauge_model_bench_t *result);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_MODEL_H
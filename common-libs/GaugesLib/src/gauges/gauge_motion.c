@@ -0,0 +1,165 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_motion.h"
+#include "gauges_config.h"
+#include <math.h>
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+static gauge_motion_t *channels[GAUGE_MOTION_MAX_CHANNELS] = {NULL};
+static lv_timer_t *motion_timer = NULL;
+static uint32_t last_tick = 0;
+static bool timer_paused = true;
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+static int32_t round_to_int(float value) {
+    return (int32_t)(value >= 0.0f ? value + 0.5f : value - 0.5f);
+}
+
+/**
+ * @brief Advance every moving channel by one step and apply the results
+ *
+ * Uses the closed-form solution of a critically damped spring, which is exact
+ * for any time step, so a late timer never overshoots or goes unstable:
+ *   x(t) = (x0 + (v0 + w*x0) * t) * e^(-w*t)
+ *   v(t) = (v0 - w * (v0 + w*x0) * t) * e^(-w*t)
+ */
+static void motion_timer_cb(lv_timer_t *timer) {
+    uint32_t elapsed = lv_tick_elaps(last_tick);
+    last_tick = lv_tick_get();
+
+    if (elapsed > GAUGE_MOTION_MAX_STEP) elapsed = GAUGE_MOTION_MAX_STEP;
+    float dt = (float)elapsed / 1000.0f;
+
+    // Same omega and dt for all channels: one exp per frame
+    const float omega = GAUGE_MOTION_OMEGA;
+    float decay = expf(-omega * dt);
+
+    bool any_moving = false;
+
+    for (int i = 0; i < GAUGE_MOTION_MAX_CHANNELS; i++) {
+        gauge_motion_t *m = channels[i];
+        if (!m || m->settled) continue;
+
+        float x0 = m->position - m->target;
+        float tmp = (m->velocity + omega * x0) * dt;
+        float x = (x0 + tmp) * decay;
+        m->velocity = (m->velocity - omega * tmp) * decay;
+        m->position = m->target + x;
+
+        // Snap to rest once the remaining motion is below one display unit
+        if (fabsf(x) < GAUGE_MOTION_REST_DISTANCE && fabsf(m->velocity) < GAUGE_MOTION_REST_VELOCITY) {
+            m->position = m->target;
+            m->velocity = 0.0f;
+            m->settled = true;
+        } else {
+            any_moving = true;
+        }
+
+        int32_t value = round_to_int(m->position);
+        if (value != m->applied) {
+            m->applied = value;
+            m->apply_cb(m->ctx, value);
+        }
+    }
+
+    if (!any_moving) {
+        lv_timer_pause(timer);
+        timer_paused = true;
+    }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void gauge_motion_init(void) {
+    if (motion_timer) return;
+
+    motion_timer = lv_timer_create(motion_timer_cb, GAUGE_MOTION_PERIOD, NULL);
+    lv_timer_pause(motion_timer);
+    timer_paused = true;
+    last_tick = lv_tick_get();
+}
+
+bool gauge_motion_attach(gauge_motion_t *motion, gauge_motion_apply_cb_t apply_cb, void *ctx, int32_t initial) {
+    if (!motion || !apply_cb) return false;
+
+    motion->position = (float)initial;
+    motion->velocity = 0.0f;
+    motion->target = (float)initial;
+    motion->applied = initial;
+    motion->apply_cb = apply_cb;
+    motion->ctx = ctx;
+    motion->settled = true;
+
+    if (!motion->attached) {
+        for (int i = 0; i < GAUGE_MOTION_MAX_CHANNELS; i++) {
+            if (channels[i] == NULL) {
+                channels[i] = motion;
+                motion->attached = true;
+                break;
+            }
+        }
+        if (!motion->attached) {
+            LV_LOG_WARN("gauge_motion: all %d channels in use, value not animated", GAUGE_MOTION_MAX_CHANNELS);
+        }
+    }
+
+    apply_cb(ctx, initial);
+    return motion->attached;
+}
+
+void gauge_motion_detach(gauge_motion_t *motion) {
+    if (!motion) return;
+
+    // The widget is about to be deleted: an unanimated channel stops applying too
+    motion->apply_cb = NULL;
+    if (!motion->attached) return;
+
+    for (int i = 0; i < GAUGE_MOTION_MAX_CHANNELS; i++) {
+        if (channels[i] == motion) {
+            channels[i] = NULL;
+            break;
+        }
+    }
+    motion->attached = false;
+    motion->settled = true;
+}
+
+void gauge_motion_set_target(gauge_motion_t *motion, int32_t target) {
+    if (!motion) return;
+
+    // Not in the table (full): jump instead of freezing
+    if (!motion->attached) {
+        if (motion->apply_cb && target != motion->applied) {
+            motion->position = motion->target = (float)target;
+            motion->applied = target;
+            motion->apply_cb(motion->ctx, target);
+        }
+        return;
+    }
+
+    motion->target = (float)target;
+    if (motion->settled && round_to_int(motion->position) == target) return;
+
+    motion->settled = false;
+
+    // Restart the timer clock so the first step after a pause is not one huge dt
+    if (motion_timer && timer_paused) {
+        last_tick = lv_tick_get();
+        timer_paused = false;
+        lv_timer_resume(motion_timer);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
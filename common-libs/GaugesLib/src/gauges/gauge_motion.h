@@ -0,0 +1,88 @@
+#ifndef GAUGE_MOTION_H
+#define GAUGE_MOTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+// ============================================================================
+// MOTION CHANNEL STRUCTURE
+// ============================================================================
+
+/**
+ * @brief Callback that writes a channel's current value to its widget
+ *
+ * Called from the motion timer only when the rounded value actually changes.
+ *
+ * @param ctx User context given to gauge_motion_attach() (arc, bar, gauge state...)
+ * @param value New value to display
+ */
+typedef void (*gauge_motion_apply_cb_t)(void *ctx, int32_t value);
+
+/**
+ * @brief One dynamic value (arc, needle, bar) driven by the motion engine
+ *
+ * The channel follows its target with a critically damped spring, so a new
+ * target arriving mid-motion keeps the current velocity instead of restarting
+ * an animation from scratch.
+ */
+typedef struct {
+    float position;     // Current (fractional) value
+    float velocity;     // Units per second
+    float target;       // Value the spring is pulling towards
+    int32_t applied;    // Last value written through apply_cb
+    gauge_motion_apply_cb_t apply_cb;
+    void *ctx;
+    bool attached;
+    bool settled;       // True when position == target and velocity == 0
+} gauge_motion_t;
+
+// ============================================================================
+// MOTION ENGINE
+// ============================================================================
+
+/**
+ * @brief Create the shared motion timer
+ *
+ * Must be called once after LVGL is initialized and before any channel is attached.
+ * The timer runs every GAUGE_MOTION_PERIOD ms and pauses itself when all
+ * channels are at rest.
+ */
+void gauge_motion_init(void);
+
+/**
+ * @brief Register a channel with the motion engine
+ *
+ * When all GAUGE_MOTION_MAX_CHANNELS slots are taken, a warning is logged and
+ * the channel jumps to each new target instead of moving (it never freezes).
+ *
+ * @param motion Channel storage (owned by the gauge state)
+ * @param apply_cb Callback writing the value to the widget
+ * @param ctx Context passed to apply_cb
+ * @param initial Initial value (applied immediately)
+ * @return true if the channel is animated, false if the table is full
+ */
+bool gauge_motion_attach(gauge_motion_t *motion, gauge_motion_apply_cb_t apply_cb, void *ctx, int32_t initial);
+
+/**
+ * @brief Remove a channel from the motion engine
+ * @param motion Channel previously attached
+ */
+void gauge_motion_detach(gauge_motion_t *motion);
+
+/**
+ * @brief Set a new target for a channel
+ * @param motion Attached channel
+ * @param target Value to move towards
+ */
+void gauge_motion_set_target(gauge_motion_t *motion, int32_t target);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_MOTION_H
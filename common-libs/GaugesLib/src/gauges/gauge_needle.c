@@ -0,0 +1,107 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_needle.h"
+#include "gauge_common.h"
+#include "gauge_stats.h"
+#include "gauge_raster.h"
+
+#if NEEDLE_SPRITES
+
+// ============================================================================
+// SPRITE CACHE
+// ============================================================================
+
+_Static_assert(GAUGE_RASTER_SIN_SHIFT == LV_TRIGO_SHIFT, "gauge_raster.h expects lv_trigo_sin() sines");
+
+/**
+ * @brief Sprites of one needle length (gauge_raster.h), in a single allocation
+ */
+typedef struct {
+    bool failed;                       // Allocation failed: keep the meter needle line
+    void *buf;
+    gauge_needle_sprites_t sprites;
+} gauge_needle_cache_t;
+
+static gauge_needle_cache_t cache;
+
+typedef struct {
+    lv_draw_ctx_t *draw_ctx;
+    lv_draw_sw_blend_dsc_t dsc;
+} gauge_needle_blend_t;
+
+/**
+ * @brief Blend one sprite row
+ */
+static void needle_blend_run(void *ctx, int32_t x, int32_t y, int32_t len, const uint8_t *mask) {
+    gauge_needle_blend_t *blend = (gauge_needle_blend_t *)ctx;
+    lv_area_t area;
+    lv_area_set(&area, (lv_coord_t)x, (lv_coord_t)y, (lv_coord_t)(x + len - 1), (lv_coord_t)y);
+
+    blend->dsc.mask_buf = (lv_opa_t *)mask;
+    blend->dsc.blend_area = &area;
+    blend->dsc.mask_area = &area;
+    lv_draw_sw_blend(blend->draw_ctx, &blend->dsc);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool gauge_needle_sprites_init(lv_coord_t length) {
+    if (cache.buf) return cache.sprites.length == length;
+    if (cache.failed || length <= 0) return false;
+
+    // First pass sizes the rows and coverage, the second one fills them
+    cache.sprites.length = length;
+    cache.sprites.width = NEEDLE_WIDTH;
+    cache.sprites.steps = NEEDLE_SPRITE_STEPS;
+    uint32_t total = gauge_needle_raster_size(&cache.sprites, lv_trigo_sin);
+    void *buf = gauge_alloc_buffer(total);
+    if (!buf) {
+        LV_LOG_WARN("gauge_needle: out of memory for %u B of sprites, using the meter needle", (unsigned)total);
+        cache.failed = true;
+        return false;
+    }
+
+    cache.buf = buf;
+    gauge_needle_raster_build(&cache.sprites, buf, lv_trigo_sin);
+    gauge_stats_add_needle_sprites((int32_t)total);
+    return true;
+}
+
+void gauge_needle_sprite_area(const lv_point_t *center, int32_t angle, lv_area_t *area) {
+    if (!cache.buf) {
+        lv_area_set(area, center->x, center->y, center->x, center->y);
+        return;
+    }
+
+    int32_t x1, y1, x2, y2;
+    gauge_needle_raster_area(&cache.sprites, angle, &x1, &y1, &x2, &y2);
+    lv_area_set(area, (lv_coord_t)(center->x + x1), (lv_coord_t)(center->y + y1),
+                (lv_coord_t)(center->x + x2), (lv_coord_t)(center->y + y2));
+}
+
+void gauge_needle_sprite_draw(lv_draw_ctx_t *draw_ctx, const lv_point_t *center, int32_t angle, lv_color_t color) {
+    if (!cache.buf) return;
+
+    lv_area_t bounds, visible;
+    gauge_needle_sprite_area(center, angle, &bounds);
+    if (!_lv_area_intersect(&visible, &bounds, draw_ctx->clip_area)) return;
+
+    gauge_needle_blend_t blend;
+    lv_memset_00(&blend, sizeof(blend));
+    blend.draw_ctx = draw_ctx;
+    blend.dsc.color = color;
+    blend.dsc.opa = LV_OPA_COVER;
+    blend.dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    blend.dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    gauge_needle_raster(&cache.sprites, center->x, center->y, angle, visible.y1, visible.y2, needle_blend_run, &blend);
+}
+
+#endif // NEEDLE_SPRITES
+
+#ifdef __cplusplus
+}
+#endif
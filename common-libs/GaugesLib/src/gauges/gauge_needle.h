@@ -0,0 +1,55 @@
+#ifndef GAUGE_NEEDLE_H
+#define GAUGE_NEEDLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+#include "gauges_config.h"
+
+// ============================================================================
+// NEEDLE SPRITES
+// ============================================================================
+
+// Angles are in sprite steps: 1 / NEEDLE_SPRITE_STEPS degree, LVGL orientation
+// (0 = 3 o'clock, clockwise), any value (wrapped to one turn)
+#define GAUGE_NEEDLE_TURN (360 * NEEDLE_SPRITE_STEPS)
+
+/**
+ * @brief Build the shared needle sprites for a needle length
+ *
+ * Renders the anti-aliased NEEDLE_WIDTH needle from the center to `length` px
+ * every sprite step over one quadrant (the other quadrants are drawn
+ * mirrored), as per-row coverage runs in one buffer from gauge_alloc_buffer()
+ * (PSRAM when available). The sprites are built once and kept for the program
+ * lifetime; later calls only check the length.
+ *
+ * @param length Needle length from the center (px)
+ * @return true if sprites of this length are available
+ */
+bool gauge_needle_sprites_init(lv_coord_t length);
+
+/**
+ * @brief Area covered by the needle sprite at an angle
+ * @param center Needle pivot (screen coordinates)
+ * @param angle Angle in sprite steps
+ * @param area Result
+ */
+void gauge_needle_sprite_area(const lv_point_t *center, int32_t angle, lv_area_t *area);
+
+/**
+ * @brief Blend the needle sprite at an angle, one coverage run per row
+ * @param draw_ctx Draw context of the current LV_EVENT_DRAW_MAIN
+ * @param center Needle pivot (screen coordinates)
+ * @param angle Angle in sprite steps
+ * @param color Needle color
+ */
+void gauge_needle_sprite_draw(lv_draw_ctx_t *draw_ctx, const lv_point_t *center, int32_t angle, lv_color_t color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_NEEDLE_H
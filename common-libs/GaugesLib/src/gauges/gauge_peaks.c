@@ -0,0 +1,116 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_peaks.h"
+#include "gauges_config.h"
+#include "gauge_theme.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+static float held_value[GAUGE_PEAK_COUNT];
+static bool held[GAUGE_PEAK_COUNT];
+
+static lv_obj_t *recall_label = NULL;
+static lv_timer_t *recall_timer = NULL;
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+static void hold_max(gauge_peak_t peak, float value) {
+    if (!held[peak] || value > held_value[peak]) {
+        held_value[peak] = value;
+        held[peak] = true;
+    }
+}
+
+static void hold_min(gauge_peak_t peak, float value) {
+    if (!held[peak] || value < held_value[peak]) {
+        held_value[peak] = value;
+        held[peak] = true;
+    }
+}
+
+static void recall_timer_cb(lv_timer_t *timer) {
+    lv_obj_add_flag(recall_label, LV_OBJ_FLAG_HIDDEN);
+    lv_timer_pause(timer);
+}
+
+/**
+ * @brief Append one "MAX 128°C" / "MIN 1.8 bar" line
+ */
+static int recall_line(char *buf, int size, gauge_peak_t peak) {
+    static const char *const names[GAUGE_PEAK_COUNT] = {"OIL MAX", "WATER MAX", "PRES MIN"};
+    if (!held[peak]) return lv_snprintf(buf, size, "%s ---\n", names[peak]);
+
+    float value = held_value[peak];
+    if (peak == GAUGE_PEAK_OIL_PRESSURE) {
+        // One decimal, like the pressure readouts (no float printf)
+        int tenths = (int)(value * 10.0f + 0.5f);
+        return lv_snprintf(buf, size, "%s %d.%d bar\n", names[peak], tenths / 10, tenths % 10);
+    }
+    return lv_snprintf(buf, size, "%s %d°C\n", names[peak], (int)value);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void gauge_peaks_sample(float oil_temp, float water_temp, float oil_pressure, int32_t rpm) {
+    hold_max(GAUGE_PEAK_OIL_TEMP, oil_temp);
+    hold_max(GAUGE_PEAK_WATER_TEMP, water_temp);
+    if (rpm >= GAUGE_PEAK_LOAD_RPM) {
+        hold_min(GAUGE_PEAK_OIL_PRESSURE, oil_pressure);
+    }
+}
+
+bool gauge_peaks_get(gauge_peak_t peak, float *value) {
+    if (peak >= GAUGE_PEAK_COUNT || !held[peak]) return false;
+    if (value) *value = held_value[peak];
+    return true;
+}
+
+void gauge_peaks_reset(void) {
+    for (int peak = 0; peak < GAUGE_PEAK_COUNT; peak++) {
+        held[peak] = false;
+    }
+}
+
+void gauge_peaks_recall(uint8_t peaks) {
+    if (!peaks) return;
+
+    if (!recall_label) {
+        recall_label = lv_label_create(lv_layer_top());
+        lv_obj_set_style_text_font(recall_label, FONT_TEMP_UNIT, 0);
+        lv_obj_set_style_text_align(recall_label, LV_TEXT_ALIGN_CENTER, 0);
+        gauge_theme_add_color(recall_label, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+        lv_obj_set_style_bg_color(recall_label, COLOR_BLACK, 0);
+        lv_obj_set_style_bg_opa(recall_label, LV_OPA_80, 0);
+        lv_obj_set_style_radius(recall_label, GAUGE_PEAK_RECALL_RADIUS, 0);
+        lv_obj_set_style_pad_all(recall_label, GAUGE_PEAK_RECALL_PAD, 0);
+        lv_obj_center(recall_label);
+
+        recall_timer = lv_timer_create(recall_timer_cb, GAUGE_PEAK_RECALL_TIME, NULL);
+    }
+
+    char text[GAUGE_PEAK_COUNT * 24];
+    int len = 0;
+    for (int peak = 0; peak < GAUGE_PEAK_COUNT; peak++) {
+        if (peaks & GAUGE_PEAK_BIT(peak)) {
+            len += recall_line(text + len, (int)sizeof(text) - len, (gauge_peak_t)peak);
+        }
+    }
+    if (len > 0) text[len - 1] = '\0';  // No trailing newline
+
+    lv_label_set_text(recall_label, text);
+    lv_obj_clear_flag(recall_label, LV_OBJ_FLAG_HIDDEN);
+    lv_timer_reset(recall_timer);
+    lv_timer_resume(recall_timer);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,77 @@
+#ifndef GAUGE_PEAKS_H
+#define GAUGE_PEAKS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+// ============================================================================
+// PEAK-HOLD / MIN-RECALL VALUES
+// ============================================================================
+
+/**
+ * @brief Values held for recall
+ *
+ * The temperatures keep their highest sample, the oil pressure its lowest
+ * sample taken at or above GAUGE_PEAK_LOAD_RPM (pressure at idle is expected
+ * to be low and would hide a drop under load).
+ */
+typedef enum {
+    GAUGE_PEAK_OIL_TEMP = 0,      // Maximum
+    GAUGE_PEAK_WATER_TEMP,        // Maximum
+    GAUGE_PEAK_OIL_PRESSURE,      // Minimum under load
+    GAUGE_PEAK_COUNT
+} gauge_peak_t;
+
+#define GAUGE_PEAK_BIT(peak) (1U << (peak))
+#define GAUGE_PEAK_ALL       (GAUGE_PEAK_BIT(GAUGE_PEAK_COUNT) - 1U)
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Feed one telemetry sample
+ *
+ * One comparison per value: no history is kept. The held values live outside
+ * the screens, so they survive screen switches, evictions and mode changes.
+ *
+ * @param oil_temp Oil temperature (°C)
+ * @param water_temp Water temperature (°C)
+ * @param oil_pressure Oil pressure (bar)
+ * @param rpm Engine RPM (gates the pressure minimum)
+ */
+void gauge_peaks_sample(float oil_temp, float water_temp, float oil_pressure, int32_t rpm);
+
+/**
+ * @brief Held value of a channel
+ * @param peak Channel
+ * @param value Result, left untouched if nothing is held yet
+ * @return true if a value is held
+ */
+bool gauge_peaks_get(gauge_peak_t peak, float *value);
+
+/**
+ * @brief Forget every held value (markers hide on the next update)
+ */
+void gauge_peaks_reset(void);
+
+/**
+ * @brief Show the held values for GAUGE_PEAK_RECALL_TIME ms
+ *
+ * A single label on lv_layer_top(), created on first use, lists the requested
+ * channels above whatever screen is loaded. A new recall restarts the timeout.
+ *
+ * @param peaks GAUGE_PEAK_BIT() of the channels to list
+ */
+void gauge_peaks_recall(uint8_t peaks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_PEAKS_H
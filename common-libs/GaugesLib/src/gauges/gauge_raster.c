@@ -0,0 +1,287 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_raster.h"
+#include <string.h>
+
+#define RASTER_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define RASTER_MAX(a, b) ((a) > (b) ? (a) : (b))
+#define RASTER_ABS(a)    ((a) < 0 ? -(a) : (a))
+
+#define NEEDLE_ONE       (1 << GAUGE_RASTER_SIN_SHIFT)
+
+// ============================================================================
+// VALUE ARC SPANS
+// ============================================================================
+
+static int32_t arc_cot(int32_t angle, gauge_raster_sin_t sin_fn) {
+    // Horizontal rays never cross a row: the range is open on that side
+    if (angle % 180 == 0) return GAUGE_ARC_COT_NONE;
+    return (sin_fn((int16_t)(angle + 90)) * (1 << GAUGE_ARC_COT_SHIFT)) / sin_fn((int16_t)angle);
+}
+
+/**
+ * @brief Runs of columns c0..c1 of one ring row: inner edge, solid part, outer edge
+ */
+static void arc_row_runs(const gauge_arc_ring_t *ring, const gauge_arc_span_t *row, int32_t cx, int32_t y,
+                         int32_t c0, int32_t c1, bool left, gauge_raster_run_cb_t cb, void *ctx) {
+    const int32_t bounds[4] = {row->lo, row->s0, row->s1, row->hi};
+    uint8_t mask[UINT8_MAX];
+
+    for (int part = 0; part < 3; part++) {
+        int32_t from = RASTER_MAX(c0, bounds[part]);
+        int32_t to = RASTER_MIN(c1 + 1, bounds[part + 1]);
+        if (from >= to) continue;
+
+        // Left of the center the columns are mirrored
+        int32_t n = to - from;
+        int32_t x = left ? cx - to : cx + from;
+        if (part == 1) {
+            cb(ctx, x, y, n, NULL);
+            continue;
+        }
+
+        int32_t first = row->aa + (part == 0 ? from - row->lo : (row->s0 - row->lo) + from - row->s1);
+        for (int32_t i = 0; i < n; i++) {
+            mask[i] = ring->alpha[first + (left ? n - 1 - i : i)];
+        }
+        cb(ctx, x, y, n, mask);
+    }
+}
+
+int gauge_arc_split(int32_t a0, int32_t a1, gauge_raster_sin_t sin_fn, gauge_arc_part_t parts[3]) {
+    int count = 0;
+    for (int32_t half = (a0 / 180) * 180; half < a1; half += 180) {
+        int32_t from = RASTER_MAX(a0, half);
+        int32_t to = RASTER_MIN(a1, half + 180);
+        if (to <= from) continue;
+
+        // Below the center x decreases as the angle grows, above it increases
+        bool lower = (half / 180) % 2 == 0;
+        parts[count].lower = lower;
+        parts[count].cot_min = arc_cot(lower ? to : from, sin_fn);
+        parts[count].cot_max = arc_cot(lower ? from : to, sin_fn);
+        count++;
+    }
+    return count;
+}
+
+void gauge_arc_raster(const gauge_arc_ring_t *ring, int32_t cx, int32_t cy, int32_t y1, int32_t y2,
+                      const gauge_arc_part_t *parts, int part_count, gauge_raster_run_cb_t cb, void *ctx) {
+    for (int32_t y = y1; y <= y2; y++) {
+        int32_t q = y - cy;                 // Pixel center at q + 0.5 below the ring center
+        int32_t k = q >= 0 ? q : -1 - q;
+        if (k >= ring->radius) continue;
+        const gauge_arc_span_t *row = &ring->rows[k];
+        if (row->lo == row->hi) continue;
+
+        int32_t q2 = 2 * q + 1;             // Doubled, so pixel centers are integers
+        for (int i = 0; i < part_count; i++) {
+            if (parts[i].lower != (q >= 0)) continue;
+
+            // Pixels p whose doubled center 2p + 1 lies between the two rays; the
+            // upper bound is exclusive so that adjacent fills share no pixel
+            int32_t p0 = -ring->radius;
+            int32_t p1 = ring->radius - 1;
+            if (parts[i].cot_min != GAUGE_ARC_COT_NONE) {
+                p0 = RASTER_MAX(p0, ((q2 * parts[i].cot_min) >> GAUGE_ARC_COT_SHIFT) >> 1);
+            }
+            if (parts[i].cot_max != GAUGE_ARC_COT_NONE) {
+                p1 = RASTER_MIN(p1, (((q2 * parts[i].cot_max) >> GAUGE_ARC_COT_SHIFT) - 2) >> 1);
+            }
+            if (p0 > p1) continue;
+
+            // Pixel p >= 0 is column p right of the center, p < 0 column -1 - p left of it
+            if (p1 >= 0) {
+                arc_row_runs(ring, row, cx, y, RASTER_MAX(p0, 0), p1, false, cb, ctx);
+            }
+            if (p0 < 0) {
+                arc_row_runs(ring, row, cx, y, -1 - RASTER_MIN(p1, -1), -1 - p0, true, cb, ctx);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// NEEDLE SPRITES
+// ============================================================================
+
+/**
+ * @brief Needle direction of a first quadrant step (Q15)
+ *
+ * Between whole degrees the sine table is interpolated linearly; the chord is
+ * shorter than the unit circle by less than 0.004%.
+ */
+static void needle_direction(int32_t step, int32_t steps, gauge_raster_sin_t sin_fn,
+                             int32_t *cos_out, int32_t *sin_out) {
+    int32_t deg = step / steps;
+    int32_t frac = step % steps;
+
+    int32_t s0 = sin_fn((int16_t)deg);
+    int32_t s1 = sin_fn((int16_t)(deg + 1));
+    int32_t c0 = sin_fn((int16_t)(deg + 90));
+    int32_t c1 = sin_fn((int16_t)(deg + 91));
+    *sin_out = s0 + ((s1 - s0) * frac) / steps;
+    *cos_out = c0 + ((c1 - c0) * frac) / steps;
+}
+
+/**
+ * @brief Coverage of the pixel (dx, dy) from the pivot
+ *
+ * Distance across the needle axis against half the width, position along it
+ * against the pivot and the tip (butt ends), each with a one pixel ramp.
+ */
+static uint8_t needle_coverage(int32_t dx, int32_t dy, int32_t c, int32_t s, int32_t length, int32_t width) {
+    int32_t along = dx * c + dy * s;
+    int32_t across = RASTER_ABS(dy * c - dx * s);
+
+    int32_t cover = RASTER_MIN(NEEDLE_ONE, ((width + 1) * NEEDLE_ONE) / 2 - across);
+    cover = RASTER_MIN(cover, along + NEEDLE_ONE / 2);
+    cover = RASTER_MIN(cover, length * NEEDLE_ONE + NEEDLE_ONE / 2 - along);
+    return cover <= 0 ? 0 : (uint8_t)((cover * 255) >> GAUGE_RASTER_SIN_SHIFT);
+}
+
+/**
+ * @brief Rasterize one sprite
+ *
+ * Only the pixels near the needle are visited: per row, the x range within
+ * half a width of the axis and between both ends (one pixel of margin).
+ * With `write` false only the row and coverage counts are accumulated.
+ */
+static void needle_rasterize(gauge_needle_sprites_t *sprites, int32_t step, gauge_raster_sin_t sin_fn,
+                             gauge_needle_sprite_t *sprite, bool write) {
+    const int32_t length = sprites->length;
+    const int32_t width = sprites->width;
+    const int32_t half = ((width + 1) * NEEDLE_ONE) / 2;
+    const int32_t reach = length + width + 2;
+    int32_t c, s;
+    needle_direction(step, sprites->steps, sin_fn, &c, &s);
+
+    sprite->rows = 0;
+    sprite->row = sprites->row_count;
+    sprite->alpha = sprites->alpha_count;
+    sprite->x_min = INT16_MAX;
+    sprite->x_max = INT16_MIN;
+
+    for (int32_t dy = -(width + 2); dy <= reach; dy++) {
+        int32_t lo = -reach;
+        int32_t hi = reach;
+        if (s > 0) {
+            lo = RASTER_MAX(lo, (dy * c - half) / s - 1);
+            hi = RASTER_MIN(hi, (dy * c + half) / s + 1);
+        }
+        if (c > 0) {
+            lo = RASTER_MAX(lo, (-NEEDLE_ONE / 2 - dy * s) / c - 1);
+            hi = RASTER_MIN(hi, (length * NEEDLE_ONE + NEEDLE_ONE / 2 - dy * s) / c + 1);
+        }
+        while (lo <= hi && needle_coverage(lo, dy, c, s, length, width) == 0) lo++;
+        while (hi >= lo && needle_coverage(hi, dy, c, s, length, width) == 0) hi--;
+
+        if (lo > hi) {
+            if (sprite->rows) break;  // Past the last row (the needle is convex)
+            continue;
+        }
+        if (!sprite->rows) sprite->y0 = (int16_t)dy;
+
+        uint16_t len = (uint16_t)(hi - lo + 1);
+        if (write) {
+            sprites->row[sprites->row_count] = (gauge_needle_row_t){(int16_t)lo, len};
+            for (int32_t dx = lo; dx <= hi; dx++) {
+                sprites->alpha[sprites->alpha_count + (dx - lo)] = needle_coverage(dx, dy, c, s, length, width);
+            }
+        }
+        if (len > sprites->max_len) sprites->max_len = len;
+        if (lo < sprite->x_min) sprite->x_min = (int16_t)lo;
+        if (hi > sprite->x_max) sprite->x_max = (int16_t)hi;
+        sprite->rows++;
+        sprites->row_count++;
+        sprites->alpha_count += len;
+    }
+}
+
+/**
+ * @brief First quadrant sprite of an angle, and the mirrors that map it there
+ */
+static const gauge_needle_sprite_t* needle_lookup(const gauge_needle_sprites_t *sprites, int32_t angle,
+                                                  bool *mirror_x, bool *mirror_y) {
+    const int32_t quarter = 90 * sprites->steps;
+    int32_t a = angle % (4 * quarter);
+    if (a < 0) a += 4 * quarter;
+
+    *mirror_x = (a > quarter && a <= 3 * quarter);
+    *mirror_y = (a > 2 * quarter);
+    if (a <= quarter) return &sprites->sprite[a];
+    if (a <= 2 * quarter) return &sprites->sprite[2 * quarter - a];
+    if (a <= 3 * quarter) return &sprites->sprite[a - 2 * quarter];
+    return &sprites->sprite[4 * quarter - a];
+}
+
+uint32_t gauge_needle_raster_size(gauge_needle_sprites_t *sprites, gauge_raster_sin_t sin_fn) {
+    const int32_t count = 90 * sprites->steps + 1;
+    gauge_needle_sprite_t sprite;
+    sprites->row_count = 0;
+    sprites->alpha_count = 0;
+    sprites->max_len = 0;
+    for (int32_t step = 0; step < count; step++) {
+        needle_rasterize(sprites, step, sin_fn, &sprite, false);
+    }
+
+    return count * sizeof(gauge_needle_sprite_t) + sprites->row_count * sizeof(gauge_needle_row_t) +
+           sprites->alpha_count + sprites->max_len;
+}
+
+void gauge_needle_raster_build(gauge_needle_sprites_t *sprites, void *buf, gauge_raster_sin_t sin_fn) {
+    const int32_t count = 90 * sprites->steps + 1;
+    uint8_t *bytes = (uint8_t *)buf;
+    uint32_t sprite_bytes = count * sizeof(gauge_needle_sprite_t);
+    uint32_t row_bytes = sprites->row_count * sizeof(gauge_needle_row_t);
+
+    sprites->sprite = (gauge_needle_sprite_t *)bytes;
+    sprites->row = (gauge_needle_row_t *)(bytes + sprite_bytes);
+    sprites->alpha = bytes + sprite_bytes + row_bytes;
+    sprites->mirror = sprites->alpha + sprites->alpha_count;
+
+    sprites->row_count = 0;
+    sprites->alpha_count = 0;
+    for (int32_t step = 0; step < count; step++) {
+        needle_rasterize(sprites, step, sin_fn, &sprites->sprite[step], true);
+    }
+}
+
+void gauge_needle_raster_area(const gauge_needle_sprites_t *sprites, int32_t angle,
+                              int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2) {
+    bool mirror_x, mirror_y;
+    const gauge_needle_sprite_t *sprite = needle_lookup(sprites, angle, &mirror_x, &mirror_y);
+    int32_t y_last = sprite->y0 + sprite->rows - 1;
+
+    *x1 = mirror_x ? -sprite->x_max : sprite->x_min;
+    *x2 = mirror_x ? -sprite->x_min : sprite->x_max;
+    *y1 = mirror_y ? -y_last : sprite->y0;
+    *y2 = mirror_y ? -sprite->y0 : y_last;
+}
+
+void gauge_needle_raster(const gauge_needle_sprites_t *sprites, int32_t cx, int32_t cy, int32_t angle,
+                         int32_t y1, int32_t y2, gauge_raster_run_cb_t cb, void *ctx) {
+    bool mirror_x, mirror_y;
+    const gauge_needle_sprite_t *sprite = needle_lookup(sprites, angle, &mirror_x, &mirror_y);
+
+    const gauge_needle_row_t *row = &sprites->row[sprite->row];
+    const uint8_t *alpha = &sprites->alpha[sprite->alpha];
+    for (uint16_t r = 0; r < sprite->rows; r++, alpha += row->len, row++) {
+        int32_t dy = sprite->y0 + r;
+        int32_t y = mirror_y ? cy - dy : cy + dy;
+        if (y < y1 || y > y2) continue;
+
+        if (mirror_x) {
+            for (uint16_t i = 0; i < row->len; i++) sprites->mirror[i] = alpha[row->len - 1 - i];
+            cb(ctx, cx - (row->x0 + row->len - 1), y, row->len, sprites->mirror);
+        } else {
+            cb(ctx, cx + row->x0, y, row->len, alpha);
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,167 @@
+#ifndef GAUGE_RASTER_H
+#define GAUGE_RASTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// GAUGE RASTERIZERS
+// ============================================================================
+// The pixel work of the value arc span fill (gauge_common.c) and of the needle
+// sprites (gauge_needle.c), without LVGL: both hand out horizontal coverage
+// runs that the caller blends (lv_draw_sw_blend on the device). Like
+// gauge_model.c this only needs a C compiler, so test/bench_raster.c times it
+// on a host (test/run_host_tests.sh --bench).
+
+#define GAUGE_RASTER_SIN_SHIFT  15      // Q15 sines, like lv_trigo_sin()
+
+/**
+ * @brief Sine of a whole degree in Q15 (lv_trigo_sin() on the device)
+ */
+typedef int16_t (*gauge_raster_sin_t)(int16_t angle);
+
+/**
+ * @brief One run of pixels on row y from x to x + len - 1
+ * @param mask len coverage bytes, NULL when every pixel is fully covered
+ */
+typedef void (*gauge_raster_run_cb_t)(void *ctx, int32_t x, int32_t y, int32_t len, const uint8_t *mask);
+
+// ============================================================================
+// VALUE ARC SPANS
+// ============================================================================
+
+/**
+ * @brief One scanline of a ring quadrant (see scripts/gen_gauge_geometry.py)
+ *
+ * Column c of row k is the pixel whose center is (c + 0.5, k + 0.5) from the
+ * ring center, which lies between the four middle pixels of the object.
+ */
+typedef struct {
+    uint8_t lo;     // First covered column
+    uint8_t s0;     // First fully covered column
+    uint8_t s1;     // End of the fully covered columns
+    uint8_t hi;     // End of the covered columns
+    uint16_t aa;    // Coverage of lo..s0-1 then s1..hi-1 in alpha
+} gauge_arc_span_t;
+
+/**
+ * @brief Ring of a screen profile (gauge_arc_spans.h)
+ */
+typedef struct {
+    const gauge_arc_span_t *rows;   // radius rows, from the center outwards
+    const uint8_t *alpha;           // Edge coverage
+    int32_t radius;
+} gauge_arc_ring_t;
+
+#define GAUGE_ARC_COT_SHIFT 12
+#define GAUGE_ARC_COT_NONE  INT32_MAX
+
+/**
+ * @brief Part of a fill within the lower (0-180) or the upper (180-360) half
+ *
+ * A ray at angle a crosses the row at height y at x = y * cot(a). In one half
+ * the angle is monotonic along a row, so the part covers one x range per row,
+ * bounded by the rays of its two end angles.
+ */
+typedef struct {
+    bool lower;         // Rows below the center
+    int32_t cot_min;    // Ray giving the smallest x (GAUGE_ARC_COT_NONE: no bound)
+    int32_t cot_max;    // Ray giving the largest x (GAUGE_ARC_COT_NONE: no bound)
+} gauge_arc_part_t;
+
+/**
+ * @brief Split the fill a0..a1 (degrees, LVGL orientation, unwrapped, below 540) at every half turn
+ * @return Number of parts (at most 3)
+ */
+int gauge_arc_split(int32_t a0, int32_t a1, gauge_raster_sin_t sin_fn, gauge_arc_part_t parts[3]);
+
+/**
+ * @brief Runs of the ring between the split angles on rows y1..y2
+ *
+ * Per row: the x range of each part (one multiply per bound), cut against the
+ * row's ring spans, then at most three runs per side. The edges along the ring
+ * are anti-aliased from the table, the radial cuts are not. Pixels on a shared
+ * ray go to exactly one of two adjacent fills.
+ *
+ * @param cx, cy Ring center: the pixel right of and below it
+ */
+void gauge_arc_raster(const gauge_arc_ring_t *ring, int32_t cx, int32_t cy, int32_t y1, int32_t y2,
+                      const gauge_arc_part_t *parts, int part_count, gauge_raster_run_cb_t cb, void *ctx);
+
+// ============================================================================
+// NEEDLE SPRITES
+// ============================================================================
+
+/**
+ * @brief Needle at one angle of the first quadrant (pointing right and down)
+ */
+typedef struct {
+    int16_t y0;          // First row, relative to the pivot
+    uint16_t rows;
+    int16_t x_min;       // Horizontal extent, relative to the pivot
+    int16_t x_max;
+    uint32_t row;        // First entry in the row table
+    uint32_t alpha;      // First coverage byte
+} gauge_needle_sprite_t;
+
+/**
+ * @brief Covered pixels of one sprite row
+ */
+typedef struct {
+    int16_t x0;          // First pixel, relative to the pivot
+    uint16_t len;        // Pixels, one coverage byte each
+} gauge_needle_row_t;
+
+/**
+ * @brief Sprites of one needle, one per step over the first quadrant
+ */
+typedef struct {
+    int32_t length;                    // From the pivot (px)
+    int32_t width;                     // Needle width (px)
+    int32_t steps;                     // Sprites per degree
+    gauge_needle_sprite_t *sprite;     // 90 * steps + 1 entries
+    gauge_needle_row_t *row;
+    uint8_t *alpha;
+    uint8_t *mirror;                   // Scratch row (max_len) for horizontally mirrored sprites
+    uint32_t row_count;
+    uint32_t alpha_count;
+    uint16_t max_len;                  // Longest row
+} gauge_needle_sprites_t;
+
+/**
+ * @brief Size the sprites of sprites->length / width / steps
+ *
+ * Fills row_count, alpha_count and max_len, the other pointers are untouched.
+ *
+ * @return Bytes of the buffer gauge_needle_raster_build() needs
+ */
+uint32_t gauge_needle_raster_size(gauge_needle_sprites_t *sprites, gauge_raster_sin_t sin_fn);
+
+/**
+ * @brief Render the sprites into a buffer of gauge_needle_raster_size() bytes
+ */
+void gauge_needle_raster_build(gauge_needle_sprites_t *sprites, void *buf, gauge_raster_sin_t sin_fn);
+
+/**
+ * @brief Extent of the sprite at an angle, relative to the pivot (inclusive)
+ * @param angle In sprite steps, LVGL orientation (0 = 3 o'clock, clockwise), any value
+ */
+void gauge_needle_raster_area(const gauge_needle_sprites_t *sprites, int32_t angle,
+                              int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2);
+
+/**
+ * @brief Runs of the sprite at an angle on rows y1..y2, one per row
+ * @param cx, cy Pivot
+ */
+void gauge_needle_raster(const gauge_needle_sprites_t *sprites, int32_t cx, int32_t cy, int32_t angle,
+                         int32_t y1, int32_t y2, gauge_raster_run_cb_t cb, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_RASTER_H
@@ -0,0 +1,95 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_stats.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+static gauge_stats_t stats = {0};
+static bool input_pending = false;
+static uint32_t input_tick = 0;
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void gauge_stats_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+    (void)disp_drv;
+
+    stats.frames++;
+    stats.render_time_ms += time;
+    stats.rendered_px += px;
+    if (time > stats.render_time_max) stats.render_time_max = time;
+
+    if (input_pending) {
+        uint32_t latency = lv_tick_elaps(input_tick);
+        stats.latency_samples++;
+        stats.latency_total_ms += latency;
+        if (latency > stats.latency_max) stats.latency_max = latency;
+        if (latency > RPM_GAUGE_LATENCY_BUDGET) stats.latency_over_budget++;
+        input_pending = false;
+    }
+}
+
+void gauge_stats_mark_input(uint32_t tick) {
+    if (input_pending) return;  // Keep the oldest
+    input_tick = tick;
+    input_pending = true;
+}
+
+void gauge_stats_add_scale_cache(int32_t bytes) {
+    stats.scale_cache_bytes += bytes;
+}
+
+void gauge_stats_add_digit_atlas(int32_t bytes) {
+    stats.digit_atlas_bytes += bytes;
+}
+
+void gauge_stats_add_needle_sprites(int32_t bytes) {
+    stats.needle_sprite_bytes += bytes;
+}
+
+void gauge_stats_add_style_refresh(void) {
+    stats.style_refreshes++;
+}
+
+void gauge_stats_set_zone_style_bytes(uint32_t bytes) {
+    stats.zone_style_bytes = bytes;
+}
+
+void gauge_stats_set_mode_heap(uint8_t mode, uint32_t bytes) {
+    if (mode < GAUGE_MODE_COUNT) stats.mode_heap_bytes[mode] = bytes;
+}
+
+void gauge_stats_set_screen_build(uint32_t ms) {
+    stats.screen_build_ms = ms;
+}
+
+uint32_t gauge_stats_lvgl_mem_used(void) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+void gauge_stats_get(gauge_stats_t *out, bool reset) {
+    if (out) *out = stats;
+
+    if (reset) {
+        stats.frames = 0;
+        stats.render_time_ms = 0;
+        stats.render_time_max = 0;
+        stats.rendered_px = 0;
+        stats.style_refreshes = 0;
+        stats.latency_samples = 0;
+        stats.latency_total_ms = 0;
+        stats.latency_max = 0;
+        stats.latency_over_budget = 0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+#ifndef GAUGE_STATS_H
+#define GAUGE_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+#include "gauges_config.h"
+
+// ============================================================================
+// RENDER STATISTICS
+// ============================================================================
+
+/**
+ * @brief Rendering and memory counters shared by all gauges
+ *
+ * Frame counters are accumulated between two calls to gauge_stats_get() with
+ * reset = true, so the caller decides the reporting window (e.g. one second).
+ * Memory counters are absolute.
+ */
+typedef struct {
+    uint32_t frames;             // Refreshes that rendered at least one pixel
+    uint32_t render_time_ms;     // Total render + flush time of those frames
+    uint32_t render_time_max;    // Slowest frame (ms)
+    uint32_t rendered_px;        // Total pixels rendered
+    uint32_t scale_cache_bytes;  // Memory held by cached static scales
+    uint32_t mode_heap_bytes[GAUGE_MODE_COUNT];  // LVGL heap of the last scale layer built per mode
+    uint32_t screen_build_ms;    // Time taken by the last gauge screen build
+    uint32_t digit_atlas_bytes;  // Memory held by numeric readout glyph atlases
+    uint32_t style_refreshes;    // Zone changes that refreshed an object's style
+    uint32_t zone_style_bytes;   // Style memory per zone-colored object (styles are shared)
+    uint32_t needle_sprite_bytes;  // Memory held by the pre-rotated needle sprites
+    uint32_t latency_samples;      // Inputs measured from receive to the end of their refresh
+    uint32_t latency_total_ms;
+    uint32_t latency_max;          // Slowest input (ms)
+    uint32_t latency_over_budget;  // Inputs slower than RPM_GAUGE_LATENCY_BUDGET
+} gauge_stats_t;
+
+/**
+ * @brief LVGL display monitor callback
+ *
+ * Assign to lv_disp_drv_t.monitor_cb in the board support package. LVGL calls
+ * it after every refresh with the elapsed time and the number of pixels drawn.
+ */
+void gauge_stats_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+
+/**
+ * @brief Account memory allocated (positive) or released (negative) by scale caches
+ * @param bytes Size delta in bytes
+ */
+void gauge_stats_add_scale_cache(int32_t bytes);
+
+/**
+ * @brief Account memory allocated (positive) or released (negative) by digit glyph atlases
+ * @param bytes Size delta in bytes
+ */
+void gauge_stats_add_digit_atlas(int32_t bytes);
+
+/**
+ * @brief Account memory allocated by the needle sprite cache
+ * @param bytes Size delta in bytes
+ */
+void gauge_stats_add_needle_sprites(int32_t bytes);
+
+/**
+ * @brief Measure an input to the end of the next refresh
+ *
+ * Call when a received sample has just invalidated the screen, before the
+ * refresh. The next gauge_stats_monitor_cb() records the time since `tick`.
+ * If several inputs are pending, the oldest one is measured.
+ *
+ * @param tick lv_tick_get() when the sample was received
+ */
+void gauge_stats_mark_input(uint32_t tick);
+
+/**
+ * @brief Count one style refresh caused by a zone change
+ */
+void gauge_stats_add_style_refresh(void);
+
+/**
+ * @brief Record the style memory each zone-colored object holds
+ * @param bytes Bytes per object
+ */
+void gauge_stats_set_zone_style_bytes(uint32_t bytes);
+
+/**
+ * @brief Record the LVGL heap taken by a freshly built scale layer
+ * @param mode GAUGE_MODE_NORMAL or GAUGE_MODE_RACING
+ * @param bytes Heap used by the layer
+ */
+void gauge_stats_set_mode_heap(uint8_t mode, uint32_t bytes);
+
+/**
+ * @brief Record how long the last gauge screen took to build
+ * @param ms Build time in milliseconds
+ */
+void gauge_stats_set_screen_build(uint32_t ms);
+
+/**
+ * @brief Bytes currently allocated from the LVGL heap
+ */
+uint32_t gauge_stats_lvgl_mem_used(void);
+
+/**
+ * @brief Copy the current counters
+ * @param out Destination
+ * @param reset Clear the frame counters after copying
+ */
+void gauge_stats_get(gauge_stats_t *out, bool reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_STATS_H
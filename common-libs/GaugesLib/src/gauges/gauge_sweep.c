@@ -0,0 +1,153 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_sweep.h"
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Value drawn in a column, GAUGE_SWEEP_NO_DATA for empty and gap columns
+ */
+static int16_t column_value(const gauge_sweep_t *sweep, const gauge_sweep_trace_t *trace, uint16_t col) {
+    uint16_t ahead = (uint16_t)((col + sweep->columns - sweep->head) % sweep->columns);
+    return ahead < sweep->gap ? GAUGE_SWEEP_NO_DATA : trace->values[col];
+}
+
+static lv_coord_t value_y(const gauge_sweep_t *sweep, const lv_area_t *coords, int32_t value) {
+    return (lv_coord_t)lv_map(value, sweep->value_min, sweep->value_max,
+                              coords->y2 - sweep->line_width / 2,
+                              coords->y1 + sweep->line_width / 2);
+}
+
+static void blend_rect(lv_draw_ctx_t *draw_ctx, lv_draw_sw_blend_dsc_t *blend_dsc, const lv_area_t *clip,
+                       lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2) {
+    lv_area_t area, visible;
+    lv_area_set(&area, x1, y1, x2, y2);
+    if (!_lv_area_intersect(&visible, &area, clip)) return;
+
+    blend_dsc->blend_area = &visible;
+    lv_draw_sw_blend(draw_ctx, blend_dsc);
+}
+
+/**
+ * @brief Draw the grid lines and the columns inside the clip area
+ *
+ * Each column of a trace is a vertical run joining the previous column's
+ * value to its own (so steep changes stay connected), over an optional faint
+ * fill down to the bottom. A new column costs two blends per trace.
+ */
+static void gauge_sweep_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    gauge_sweep_t *sweep = (gauge_sweep_t *)lv_event_get_user_data(e);
+
+    if (code == LV_EVENT_DELETE) {
+        if (sweep->obj == obj) sweep->obj = NULL;
+        return;
+    }
+    if (code != LV_EVENT_DRAW_MAIN) return;
+
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    lv_area_t coords, clip;
+    lv_obj_get_coords(obj, &coords);
+    if (!_lv_area_intersect(&clip, &coords, draw_ctx->clip_area)) return;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+
+    // Grid, one pixel rows across the plot
+    blend_dsc.opa = sweep->grid_opa;
+    for (uint8_t i = 0; i < sweep->grid_count; i++) {
+        lv_coord_t y = value_y(sweep, &coords, sweep->grid[i].value);
+        blend_dsc.color = gauge_theme_color(sweep->grid[i].role);
+        blend_rect(draw_ctx, &blend_dsc, &clip, clip.x1, y, clip.x2, y);
+    }
+
+    for (lv_coord_t x = clip.x1; x <= clip.x2; x++) {
+        uint16_t col = (uint16_t)(x - coords.x1);
+        uint16_t prev_col = (uint16_t)((col + sweep->columns - 1) % sweep->columns);
+
+        for (uint8_t t = 0; t < sweep->trace_count; t++) {
+            const gauge_sweep_trace_t *trace = &sweep->trace[t];
+            int16_t value = column_value(sweep, trace, col);
+            if (value == GAUGE_SWEEP_NO_DATA) continue;
+
+            int16_t prev = column_value(sweep, trace, prev_col);
+            lv_coord_t y = value_y(sweep, &coords, value);
+            lv_coord_t y_prev = prev == GAUGE_SWEEP_NO_DATA ? y : value_y(sweep, &coords, prev);
+            lv_coord_t top = LV_MIN(y, y_prev) - sweep->line_width / 2;
+            lv_coord_t bottom = LV_MAX(y, y_prev) + (sweep->line_width - 1) / 2;
+
+            blend_dsc.color = trace->color_cb ? trace->color_cb(value) : gauge_theme_color(trace->role);
+            if (trace->fill_opa > LV_OPA_TRANSP) {
+                blend_dsc.opa = trace->fill_opa;
+                blend_rect(draw_ctx, &blend_dsc, &clip, x, bottom + 1, x, coords.y2);
+            }
+            blend_dsc.opa = LV_OPA_COVER;
+            blend_rect(draw_ctx, &blend_dsc, &clip, x, top, x, bottom);
+        }
+    }
+}
+
+/**
+ * @brief Invalidate columns first..last of the plot (last >= first, not wrapped)
+ */
+static void invalidate_columns(lv_obj_t *obj, uint16_t first, uint16_t last) {
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    area.x2 = (lv_coord_t)(area.x1 + last);
+    area.x1 = (lv_coord_t)(area.x1 + first);
+    lv_obj_invalidate_area(obj, &area);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void gauge_sweep_reset(gauge_sweep_t *sweep) {
+    for (uint8_t t = 0; t < sweep->trace_count; t++) {
+        for (uint16_t col = 0; col < sweep->columns; col++) {
+            sweep->trace[t].values[col] = GAUGE_SWEEP_NO_DATA;
+        }
+    }
+    sweep->head = 0;
+    if (sweep->obj) lv_obj_invalidate(sweep->obj);
+}
+
+lv_obj_t* gauge_sweep_create(lv_obj_t *parent, gauge_sweep_t *sweep, lv_coord_t height) {
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);  // Taps reach the screen
+    lv_obj_set_size(obj, sweep->columns, height);
+    lv_obj_add_event_cb(obj, gauge_sweep_event_cb, LV_EVENT_ALL, sweep);
+
+    sweep->obj = obj;
+    return obj;
+}
+
+void gauge_sweep_push(gauge_sweep_t *sweep, const int16_t *values) {
+    uint16_t col = sweep->head;
+    for (uint8_t t = 0; t < sweep->trace_count; t++) {
+        sweep->trace[t].values[col] = values[t];
+    }
+    sweep->head = (uint16_t)((col + 1) % sweep->columns);
+
+    // The new column and the one that just entered the gap
+    if (!sweep->obj) return;
+    uint16_t last = (uint16_t)(col + sweep->gap);
+    if (last < sweep->columns) {
+        invalidate_columns(sweep->obj, col, last);
+    } else {
+        invalidate_columns(sweep->obj, col, (uint16_t)(sweep->columns - 1));
+        invalidate_columns(sweep->obj, 0, (uint16_t)(last - sweep->columns));
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,101 @@
+#ifndef GAUGE_SWEEP_H
+#define GAUGE_SWEEP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+#include "gauge_theme.h"
+
+// ============================================================================
+// SWEEP PLOT
+// ============================================================================
+
+// A plot of one value per pixel column for one or more traces. New columns
+// are written at a cursor that sweeps left to right ahead of a blank gap (like
+// a patient monitor), so a new column only invalidates itself and the column
+// entering the gap: nothing already drawn moves.
+
+#define GAUGE_SWEEP_NO_DATA      INT16_MIN
+#define GAUGE_SWEEP_MAX_TRACES   4
+#define GAUGE_SWEEP_MAX_GRID     4
+
+/**
+ * @brief One trace of a sweep plot
+ */
+typedef struct {
+    int16_t *values;                          // One per column, owned by the caller
+    lv_color_t (*color_cb)(int32_t value);    // Color of a column by value, NULL to use role
+    gauge_color_t role;
+    lv_opa_t fill_opa;                        // Fill below the line, LV_OPA_TRANSP for none
+} gauge_sweep_trace_t;
+
+/**
+ * @brief Horizontal grid line at a value
+ */
+typedef struct {
+    int16_t value;
+    gauge_color_t role;
+} gauge_sweep_grid_t;
+
+/**
+ * @brief Sweep plot state, owned by the caller so the history outlives the screen
+ */
+typedef struct {
+    uint16_t columns;             // Plot width and length of every values array
+    uint16_t head;                // Column written next
+    uint16_t gap;                 // Blank columns ahead of the cursor
+    lv_coord_t line_width;
+    int32_t value_min;            // Bottom of the plot
+    int32_t value_max;            // Top of the plot
+    uint8_t trace_count;
+    gauge_sweep_trace_t trace[GAUGE_SWEEP_MAX_TRACES];   // Drawn in order
+    uint8_t grid_count;
+    gauge_sweep_grid_t grid[GAUGE_SWEEP_MAX_GRID];
+    lv_opa_t grid_opa;
+    lv_obj_t *obj;                // Plot object while its screen exists
+} gauge_sweep_t;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Empty every trace and put the cursor back on the left edge
+ * @param sweep Configured plot state
+ */
+void gauge_sweep_reset(gauge_sweep_t *sweep);
+
+/**
+ * @brief Create the plot object of a sweep
+ *
+ * A plain object (sweep->columns px wide) that draws the traces straight from
+ * the values arrays in LV_EVENT_DRAW_MAIN, visiting only the clipped columns.
+ * It is not clickable, so taps and gestures reach the screen. sweep->obj is
+ * cleared when the object is deleted.
+ *
+ * @param parent Parent object
+ * @param sweep Plot state, must outlive the object
+ * @param height Plot height (px)
+ * @return Plot object
+ */
+lv_obj_t* gauge_sweep_create(lv_obj_t *parent, gauge_sweep_t *sweep, lv_coord_t height);
+
+/**
+ * @brief Write one column at the cursor and advance it
+ *
+ * Invalidates only the new column and the one entering the gap (nothing if
+ * the plot object does not exist or its screen is not loaded).
+ *
+ * @param sweep Plot state
+ * @param values One value per trace, GAUGE_SWEEP_NO_DATA for a hole
+ */
+void gauge_sweep_push(gauge_sweep_t *sweep, const int16_t *values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_SWEEP_H
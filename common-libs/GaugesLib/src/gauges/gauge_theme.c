@@ -0,0 +1,165 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_theme.h"
+#include "gauges_config.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+/**
+ * @brief A style color property that follows the theme
+ */
+typedef struct {
+    lv_style_t *style;
+    lv_style_prop_t prop;
+    gauge_color_t role;
+} gauge_theme_binding_t;
+
+/**
+ * @brief Shared single-color style owned by the theme
+ */
+typedef struct {
+    lv_style_t style;
+    lv_style_prop_t prop;
+    gauge_color_t role;
+} gauge_theme_style_t;
+
+static lv_color_t palettes[GAUGE_THEME_COUNT][GAUGE_COLOR_COUNT];
+static const lv_opa_t img_dim[GAUGE_THEME_COUNT] = {LV_OPA_TRANSP, GAUGE_THEME_NIGHT_IMG_DIM};
+
+_Static_assert(GAUGE_THEME_MAX_BINDINGS <= UINT8_MAX && GAUGE_THEME_MAX_STYLES <= UINT8_MAX,
+               "Theme table counts are uint8_t");
+
+static gauge_theme_binding_t bindings[GAUGE_THEME_MAX_BINDINGS];
+static uint8_t binding_count = 0;
+
+static gauge_theme_style_t theme_styles[GAUGE_THEME_MAX_STYLES];
+static uint8_t theme_style_count = 0;
+static lv_style_t style_img;
+
+static gauge_theme_t current_theme = GAUGE_THEME_DAY;
+static bool theme_initialized = false;
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+static void gauge_theme_init(void) {
+    if (theme_initialized) return;
+
+    // lv_color_hex() is not a constant expression: fill the palettes once here
+    lv_color_t *day = palettes[GAUGE_THEME_DAY];
+    day[GAUGE_COLOR_TEXT]       = COLOR_VALUE_TEXT;
+    day[GAUGE_COLOR_ACCENT]     = COLOR_AMBER;
+    day[GAUGE_COLOR_MUTED]      = COLOR_GREY;
+    day[GAUGE_COLOR_GOOD]       = COLOR_GREEN;
+    day[GAUGE_COLOR_ALERT]      = COLOR_RED;
+    day[GAUGE_COLOR_SCALE]      = COLOR_MARKER;
+    day[GAUGE_COLOR_MINOR_TICK] = COLOR_NEEDLE_MINOR_TICK;
+
+    lv_color_t *night = palettes[GAUGE_THEME_NIGHT];
+    night[GAUGE_COLOR_TEXT]       = NIGHT_COLOR_WHITE;
+    night[GAUGE_COLOR_ACCENT]     = NIGHT_COLOR_AMBER;
+    night[GAUGE_COLOR_MUTED]      = NIGHT_COLOR_GREY;
+    night[GAUGE_COLOR_GOOD]       = NIGHT_COLOR_GREEN;
+    night[GAUGE_COLOR_ALERT]      = NIGHT_COLOR_RED;
+    night[GAUGE_COLOR_SCALE]      = NIGHT_COLOR_WHITE;
+    night[GAUGE_COLOR_MINOR_TICK] = NIGHT_COLOR_MINOR_TICK;
+
+    lv_style_init(&style_img);
+    lv_style_set_img_recolor(&style_img, COLOR_BLACK);
+    lv_style_set_img_recolor_opa(&style_img, img_dim[current_theme]);
+
+    theme_initialized = true;
+}
+
+static void apply_binding(const gauge_theme_binding_t *binding) {
+    lv_style_value_t value = {.color = palettes[current_theme][binding->role]};
+    lv_style_set_prop(binding->style, binding->prop, value);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+lv_color_t gauge_theme_color(gauge_color_t role) {
+    gauge_theme_init();
+    return palettes[current_theme][role < GAUGE_COLOR_COUNT ? role : GAUGE_COLOR_TEXT];
+}
+
+void gauge_theme_bind(lv_style_t *style, lv_style_prop_t prop, gauge_color_t role) {
+    gauge_theme_init();
+    if (!style || role >= GAUGE_COLOR_COUNT) return;
+
+    LV_ASSERT_MSG(binding_count < GAUGE_THEME_MAX_BINDINGS, "GAUGE_THEME_MAX_BINDINGS too small");
+    if (binding_count < GAUGE_THEME_MAX_BINDINGS) {
+        bindings[binding_count++] = (gauge_theme_binding_t){style, prop, role};
+    }
+    apply_binding(&(gauge_theme_binding_t){style, prop, role});
+}
+
+void gauge_theme_add_color(lv_obj_t *obj, lv_style_prop_t prop, gauge_color_t role, lv_style_selector_t selector) {
+    if (!obj) return;
+
+    for (uint8_t i = 0; i < theme_style_count; i++) {
+        if (theme_styles[i].prop == prop && theme_styles[i].role == role) {
+            lv_obj_add_style(obj, &theme_styles[i].style, selector);
+            return;
+        }
+    }
+
+    LV_ASSERT_MSG(theme_style_count < GAUGE_THEME_MAX_STYLES, "GAUGE_THEME_MAX_STYLES too small");
+    if (theme_style_count >= GAUGE_THEME_MAX_STYLES) {
+        lv_obj_set_local_style_prop(obj, prop, (lv_style_value_t){.color = gauge_theme_color(role)}, selector);
+        return;
+    }
+
+    gauge_theme_style_t *shared = &theme_styles[theme_style_count++];
+    shared->prop = prop;
+    shared->role = role;
+    lv_style_init(&shared->style);
+    gauge_theme_bind(&shared->style, prop, role);
+    lv_obj_add_style(obj, &shared->style, selector);
+}
+
+void gauge_theme_add_image(lv_obj_t *img) {
+    if (!img) return;
+    gauge_theme_init();
+    lv_obj_add_style(img, &style_img, LV_PART_MAIN);
+}
+
+void gauge_theme_set(gauge_theme_t theme) {
+    gauge_theme_init();
+    if (theme >= GAUGE_THEME_COUNT || theme == current_theme) return;
+    current_theme = theme;
+
+    // Properties already exist in every bound style: set_prop overwrites them in place
+    for (uint8_t i = 0; i < binding_count; i++) {
+        apply_binding(&bindings[i]);
+    }
+    lv_style_set_img_recolor_opa(&style_img, img_dim[current_theme]);
+
+    // Colors are read from the styles when drawing and change neither layout nor
+    // layers, so no style refresh is needed: one redraw of the screen is enough.
+    // Hidden cached screens pick the new colors up when they are shown.
+    lv_obj_invalidate(lv_scr_act());
+}
+
+void gauge_theme_set_luminosity(uint8_t luminosity) {
+    if (luminosity < GAUGE_THEME_NIGHT_BELOW) {
+        gauge_theme_set(GAUGE_THEME_NIGHT);
+    } else if (luminosity > GAUGE_THEME_DAY_ABOVE) {
+        gauge_theme_set(GAUGE_THEME_DAY);
+    }
+}
+
+gauge_theme_t gauge_theme_get(void) {
+    return current_theme;
+}
+
+#ifdef __cplusplus
+}
+#endif
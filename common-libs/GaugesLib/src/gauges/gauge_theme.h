@@ -0,0 +1,104 @@
+#ifndef GAUGE_THEME_H
+#define GAUGE_THEME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+
+// ============================================================================
+// THEMES AND COLOR ROLES
+// ============================================================================
+
+typedef enum {
+    GAUGE_THEME_DAY = 0,
+    GAUGE_THEME_NIGHT,
+    GAUGE_THEME_COUNT
+} gauge_theme_t;
+
+/**
+ * @brief What a color is used for; each theme has one color per role
+ */
+typedef enum {
+    GAUGE_COLOR_TEXT = 0,   // Values, labels (white)
+    GAUGE_COLOR_ACCENT,     // Units, icons, warning zone (amber)
+    GAUGE_COLOR_MUTED,      // Borders, cold zone (grey)
+    GAUGE_COLOR_GOOD,       // Normal zone (green)
+    GAUGE_COLOR_ALERT,      // Redline, alert zone, alert blink (red)
+    GAUGE_COLOR_SCALE,      // Scale border, ticks and tick labels
+    GAUGE_COLOR_MINOR_TICK, // Needle gauge minor ticks
+    GAUGE_COLOR_COUNT
+} gauge_color_t;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Color of a role in the current theme
+ *
+ * For elements drawn without styles (draw callbacks, meter ticks and needles).
+ */
+lv_color_t gauge_theme_color(gauge_color_t role);
+
+/**
+ * @brief Make a color property of a shared style follow the theme
+ *
+ * Sets the property to the role's color now and again on every theme change.
+ * The style must live as long as the program (static shared styles).
+ *
+ * @param style Shared style
+ * @param prop Color property, e.g. LV_STYLE_TEXT_COLOR
+ * @param role Color role
+ */
+void gauge_theme_bind(lv_style_t *style, lv_style_prop_t prop, gauge_color_t role);
+
+/**
+ * @brief Give an object a themed color
+ *
+ * Adds the theme's shared style for this property and role instead of a
+ * local style, so objects with the same color share one style.
+ *
+ * @param obj Object
+ * @param prop Color property, e.g. LV_STYLE_TEXT_COLOR
+ * @param role Color role
+ * @param selector Part and state, as for lv_obj_add_style()
+ */
+void gauge_theme_add_color(lv_obj_t *obj, lv_style_prop_t prop, gauge_color_t role, lv_style_selector_t selector);
+
+/**
+ * @brief Dim a pre-rendered image at night
+ * @param img Image object (e.g. a cached scale)
+ */
+void gauge_theme_add_image(lv_obj_t *img);
+
+/**
+ * @brief Switch theme
+ *
+ * Rewrites the colors of the bound styles in place (no allocation, no object
+ * is restyled) and invalidates the active screen once.
+ */
+void gauge_theme_set(gauge_theme_t theme);
+
+/**
+ * @brief Pick the theme from the dash luminosity (TelemetryData.luminosity)
+ *
+ * Night below GAUGE_THEME_NIGHT_BELOW, day above GAUGE_THEME_DAY_ABOVE, no
+ * change in between.
+ *
+ * @param luminosity Screen brightness percentage (0-100)
+ */
+void gauge_theme_set_luminosity(uint8_t luminosity);
+
+/**
+ * @brief Current theme
+ */
+gauge_theme_t gauge_theme_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_THEME_H
@@ -0,0 +1,102 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gauge_zones.h"
+#include "gauge_stats.h"
+#include "gauge_theme.h"
+#include "gauges_config.h"
+
+// ============================================================================
+// SHARED STYLES
+// ============================================================================
+
+// One style per zone and per colored property, shared by every bound object
+static lv_style_t style_bar[GAUGE_ZONE_COUNT];
+static lv_style_t style_text[GAUGE_ZONE_COUNT];
+static bool styles_initialized = false;
+
+static const gauge_color_t zone_roles[GAUGE_ZONE_COUNT] = {
+    GAUGE_COLOR_MUTED,
+    GAUGE_COLOR_GOOD,
+    GAUGE_COLOR_ACCENT,
+    GAUGE_COLOR_ALERT,
+};
+
+static const lv_state_t zone_states[GAUGE_ZONE_COUNT] = {
+    LV_STATE_DEFAULT,
+    GAUGE_STATE_ZONE_GREEN,
+    GAUGE_STATE_ZONE_AMBER,
+    GAUGE_STATE_ZONE_RED,
+};
+
+static void gauge_zones_init_styles(void) {
+    if (styles_initialized) return;
+
+    for (int zone = 0; zone < GAUGE_ZONE_COUNT; zone++) {
+        lv_style_init(&style_bar[zone]);
+        gauge_theme_bind(&style_bar[zone], LV_STYLE_BG_COLOR, zone_roles[zone]);
+
+        lv_style_init(&style_text[zone]);
+        gauge_theme_bind(&style_text[zone], LV_STYLE_TEXT_COLOR, zone_roles[zone]);
+    }
+
+    styles_initialized = true;
+}
+
+static void gauge_zones_bind(lv_obj_t *obj, lv_style_t *styles, lv_part_t part) {
+    if (!obj) return;
+    gauge_zones_init_styles();
+
+    lv_obj_clear_state(obj, GAUGE_STATE_ZONE_MASK);
+    for (int zone = 0; zone < GAUGE_ZONE_COUNT; zone++) {
+        lv_obj_add_style(obj, &styles[zone], part | zone_states[zone]);
+    }
+
+    // The styles are shared: an object only holds one style list entry per zone
+    gauge_stats_set_zone_style_bytes(GAUGE_ZONE_COUNT * sizeof(_lv_obj_style_t));
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+lv_color_t gauge_zone_color(gauge_zone_t zone) {
+    return gauge_theme_color(zone_roles[zone < GAUGE_ZONE_COUNT ? zone : GAUGE_ZONE_GREY]);
+}
+
+void gauge_zones_bind_bar(lv_obj_t *obj) {
+    gauge_zones_bind(obj, style_bar, LV_PART_INDICATOR);
+}
+
+void gauge_zones_bind_text(lv_obj_t *obj) {
+    gauge_zones_bind(obj, style_text, LV_PART_MAIN);
+}
+
+void gauge_zones_set(lv_obj_t *obj, gauge_zone_t zone) {
+    if (!obj || zone >= GAUGE_ZONE_COUNT) return;
+
+    lv_state_t current = lv_obj_get_state(obj) & GAUGE_STATE_ZONE_MASK;
+    lv_state_t wanted = zone_states[zone];
+    if (current == wanted) return;
+
+    // States are cumulative: one of the two sets contains the other
+    if (wanted > current) {
+        lv_obj_add_state(obj, wanted & ~current);
+    } else {
+        lv_obj_clear_state(obj, current & ~wanted);
+    }
+    gauge_stats_add_style_refresh();
+}
+
+gauge_zone_t gauge_zones_get(const lv_obj_t *obj) {
+    lv_state_t current = obj ? (lv_obj_get_state(obj) & GAUGE_STATE_ZONE_MASK) : LV_STATE_DEFAULT;
+    for (int zone = GAUGE_ZONE_COUNT - 1; zone > 0; zone--) {
+        if (current == zone_states[zone]) return (gauge_zone_t)zone;
+    }
+    return GAUGE_ZONE_GREY;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,76 @@
+#ifndef GAUGE_ZONES_H
+#define GAUGE_ZONES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+#include "gauge_model.h"
+
+// ============================================================================
+// ZONES AND STATES
+// ============================================================================
+
+// gauge_zone_t is defined with the model (gauge_model.h).
+
+// Zones map to cumulative custom LVGL states (AMBER also has the GREEN bit, RED
+// both), so moving between any two zones sets or clears bits in one direction:
+// a zone change is a single lv_obj_add_state() or lv_obj_clear_state() call.
+#define GAUGE_STATE_ZONE_GREEN  LV_STATE_USER_1
+#define GAUGE_STATE_ZONE_AMBER  (LV_STATE_USER_1 | LV_STATE_USER_2)
+#define GAUGE_STATE_ZONE_RED    (LV_STATE_USER_1 | LV_STATE_USER_2 | LV_STATE_USER_3)
+#define GAUGE_STATE_ZONE_MASK   GAUGE_STATE_ZONE_RED
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Color of a zone in the current theme, for widgets drawn without
+ *        styles (meter needles, arc zone segments)
+ */
+lv_color_t gauge_zone_color(gauge_zone_t zone);
+
+/**
+ * @brief Color the bar indicator of an object by zone
+ *
+ * Adds the shared zone styles (background color) to the LV_PART_INDICATOR of
+ * the object and puts it in GAUGE_ZONE_GREY. No local style is created.
+ *
+ * @param obj Bar object
+ */
+void gauge_zones_bind_bar(lv_obj_t *obj);
+
+/**
+ * @brief Color the text of an object by zone
+ *
+ * Same as gauge_zones_bind_bar() for the text color of the main part, for
+ * readouts that follow the zone of their value.
+ *
+ * @param obj Label or readout object
+ */
+void gauge_zones_bind_text(lv_obj_t *obj);
+
+/**
+ * @brief Move a bound object to a zone
+ *
+ * Does nothing (no style refresh, no invalidation) if the object is already in
+ * that zone, otherwise flips its zone state bits with one LVGL call.
+ *
+ * @param obj Object bound with gauge_zones_bind_bar() or gauge_zones_bind_text()
+ * @param zone New zone
+ */
+void gauge_zones_set(lv_obj_t *obj, gauge_zone_t zone);
+
+/**
+ * @brief Current zone of a bound object
+ */
+gauge_zone_t gauge_zones_get(const lv_obj_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUGE_ZONES_H
@@ -11,48 +11,26 @@ extern "C" {
 // SCREEN PROFILE SELECTION - PICK ONE
 // ============================================================================
 
-#if !defined(USE_SCREEN_466PX) && !defined(USE_SCREEN_240PX)
-    #define USE_SCREEN_466PX 
-    #warning "No screen profile defined in build flags. Defaulting to 466px."
+// Select the panel with -D GAUGE_SCREEN_RES=<px> (any profile listed in
+// screen_profiles.json). USE_SCREEN_466PX / USE_SCREEN_240PX still work.
+#ifndef GAUGE_SCREEN_RES
+    #if defined(USE_SCREEN_240PX)
+        #define GAUGE_SCREEN_RES 240
+    #elif defined(USE_SCREEN_466PX)
+        #define GAUGE_SCREEN_RES 466
+    #else
+        #define GAUGE_SCREEN_RES 466
+        #warning "No screen profile defined in build flags. Defaulting to 466px."
+    #endif
 #endif
 
 // ============================================================================
 // SCREEN PROFILE DEFINITIONS
 // ============================================================================
 
-#ifdef USE_SCREEN_466PX
-    // 466px display - Original configuration (baseline, no scaling)
-    #define LCD_RES 466
-    #define GAUGE_SCALE 1.0f
-    // Fonts for 466px display (using custom fonts)
-    // Custom font declarations (defined in gauge_common.c)
-    extern const lv_font_t montserrat_bold_numbers_120;
-    extern const lv_font_t montserrat_bold_80;
-    extern const lv_font_t fa_icons_54;
-    #define FONT_TEMP_MAIN          &montserrat_bold_numbers_120  // Main temperature number (120px)
-    #define FONT_TEMP_UNIT          &lv_font_montserrat_48        // °C unit (48px)
-    #define FONT_MARKERS            &lv_font_montserrat_24        // Gauge markers (24px)
-    #define FONT_ICON               &fa_icons_54                  // Bottom icon (54px)
-    #define FONT_NEEDLE_VALUE       &montserrat_bold_80           // Needle gauge value label (80px)
-    #define USE_CUSTOM_TEMP_FONT 1
-    #define USE_CUSTOM_ICON_FONT 1
-#endif
-
-#ifdef USE_SCREEN_240PX
-    // 240px display - Scaled down from 466px baseline
-    #define LCD_RES 240
-    #define GAUGE_SCALE 0.515f  // 240/466 ≈ 0.515
-    // Fonts for 240px display (using LVGL built-in fonts)
-    // Note: For optimal display, consider generating custom fonts at scaled sizes
-    extern const lv_font_t fa_icons_32;
-    #define FONT_TEMP_MAIN          &lv_font_montserrat_48     // Main temperature number (scaled from 120px)
-    #define FONT_TEMP_UNIT          &lv_font_montserrat_24     // °C unit (scaled from 48px)
-    #define FONT_MARKERS            &lv_font_montserrat_14     // Gauge markers (scaled from 24px)
-    #define FONT_ICON               &fa_icons_32               // Bottom icon (scaled from 54px)
-    #define FONT_NEEDLE_VALUE       &lv_font_montserrat_48     // Needle gauge value label (scaled from 80px)
-    #define USE_CUSTOM_TEMP_FONT 0
-    #define USE_CUSTOM_ICON_FONT 1
-#endif
+// LCD_RES, fonts, every scaled dimension and the arc scale marker table of the
+// selected profile, as integer constants generated by scripts/gen_gauge_geometry.py
+#include "gauge_geometry.h"
 
 // ============================================================================
 // COLOR PALETTE
@@ -86,6 +64,36 @@ extern "C" {
 #define COLOR_NEEDLE_MAJOR_TICK COLOR_WHITE             // Major tick marks
 #define COLOR_NEEDLE_LABEL      COLOR_WHITE             // Needle gauge scale labels
 
+// Night palette: same hues as the base colors, dimmer, for driving in the dark
+#define NIGHT_COLOR_WHITE       lv_color_hex(0x8C8C8C)
+#define NIGHT_COLOR_GREY        lv_color_hex(0x4A4A4A)
+#define NIGHT_COLOR_GREEN       lv_color_hex(0x007A32)
+#define NIGHT_COLOR_AMBER       lv_color_hex(0x9C6C00)
+#define NIGHT_COLOR_RED         lv_color_hex(0xA82826)
+#define NIGHT_COLOR_MINOR_TICK  lv_color_hex(0x3A3A3A)
+
+// ============================================================================
+// DAY / NIGHT THEME
+// ============================================================================
+
+// The theme follows TelemetryData.luminosity (dash brightness, 0-100 %), with
+// hysteresis so a value hovering around one threshold does not flicker.
+#define GAUGE_THEME_NIGHT_BELOW         30      // Switch to night below this luminosity
+#define GAUGE_THEME_DAY_ABOVE           40      // Switch back to day above this luminosity
+
+// Pre-rendered images (cached needle scale) are dimmed by recoloring them
+// towards black with this opacity at night instead of being rendered again
+#define GAUGE_THEME_NIGHT_IMG_DIM       LV_OPA_40
+
+// Style colors that follow the theme: the styles the gauges bind themselves
+// (dual gauge 5, zone bars and texts 8, shift lights 5) plus one per shared
+// style. Running out asserts, as the last bound colors would stay in one theme.
+#define GAUGE_THEME_GAUGE_BINDINGS      18
+// Shared color styles owned by the theme, one per prop/role pair passed to
+// gauge_theme_add_color(): 8 across the gauges, 9 with a layout pack
+#define GAUGE_THEME_MAX_STYLES          12
+#define GAUGE_THEME_MAX_BINDINGS        (GAUGE_THEME_GAUGE_BINDINGS + GAUGE_THEME_MAX_STYLES)
+
 // ============================================================================
 // ICON SYMBOLS AND TEXT LABELS
 // ============================================================================
@@ -112,16 +120,14 @@ extern "C" {
 #define ARC_START_ANGLE  135
 #define ARC_END_ANGLE    405  // 135 + 270 degrees
 
-// Visual styling (scaled based on GAUGE_SCALE)
-#define ARC_WIDTH        ((int)(24 * GAUGE_SCALE))
-#define LINE_WIDTH       ((int)(4 * GAUGE_SCALE))
+// Visual styling: ARC_WIDTH, LINE_WIDTH (gauge_geometry.h)
 #define ARC_SIZE         (GAUGE_DIMENSION - (LINE_WIDTH * 12))
 
-// Positioning offsets (scaled based on GAUGE_SCALE)
-#define MARKER_LABEL_OFFSET     ((int)(40 * GAUGE_SCALE))   // Distance from arc to marker labels
-#define TEMP_LABEL_Y_OFFSET     ((int)(-15 * GAUGE_SCALE))  // Y offset for main temperature label
-#define TEMP_UNIT_Y_OFFSET      ((int)(55 * GAUGE_SCALE))   // Y offset for unit label
-#define ICON_Y_OFFSET           ((int)(-10 * GAUGE_SCALE))  // Y offset for icon from bottom
+// Positioning offsets (gauge_geometry.h):
+// MARKER_LABEL_OFFSET  - Distance from arc to marker labels
+// TEMP_LABEL_Y_OFFSET  - Y offset for main temperature label
+// TEMP_UNIT_Y_OFFSET   - Y offset for unit label
+// ICON_Y_OFFSET        - Y offset for icon from bottom
 
 // ============================================================================
 // OIL TEMPERATURE GAUGE CONFIGURATION
@@ -167,8 +173,7 @@ extern "C" {
 // ============================================================================
 
 // Meter size (slightly smaller than screen to add padding)
-#define NEEDLE_METER_SIZE        (GAUGE_DIMENSION - (int)(30 * GAUGE_SCALE))
-#define NEEDLE_WIDTH             ((int)(5 * GAUGE_SCALE))
+#define NEEDLE_METER_SIZE        (GAUGE_DIMENSION - NEEDLE_METER_PADDING)
 #define NEEDLE_CENTER_SIZE       (NEEDLE_METER_SIZE / 10)
 
 // Needle angle range: Start at very bottom (6 o'clock) and sweep 270° clockwise
@@ -181,34 +186,104 @@ extern "C" {
 #define NEEDLE_MINOR_TICK_MULTIPLIER    2       // Multiplier for pressure gauges (decimal places)
 #define NEEDLE_MINOR_TICK_DIVISOR       10      // Divisor for temperature gauges (integer)
 
-// Tick styling (scaled)
-#define NEEDLE_MINOR_TICK_LENGTH        ((int)(8 * GAUGE_SCALE))
+// Tick styling (lengths and label distance from gauge_geometry.h)
 #define NEEDLE_MINOR_TICK_WIDTH         1
 #define NEEDLE_MINOR_TICK_COLOR         COLOR_NEEDLE_MINOR_TICK  // Minor tick color
 
 #define NEEDLE_MAJOR_TICK_WIDTH         3
-#define NEEDLE_MAJOR_TICK_LENGTH        ((int)(18 * GAUGE_SCALE))
-#define NEEDLE_MAJOR_TICK_LABEL_DIST    ((int)(29 * GAUGE_SCALE))
-
-// Red zone arc styling (scaled)
-#define NEEDLE_RED_ZONE_WIDTH           ((int)(18 * GAUGE_SCALE))
-#define NEEDLE_RED_ZONE_OFFSET          ((int)(0 * GAUGE_SCALE))
 
-// Needle styling (scaled)
-#define NEEDLE_OFFSET                   ((int)(-20 * GAUGE_SCALE))
+// Red zone arc, needle width and needle offset: gauge_geometry.h
 
-// Center knob styling (scaled)
+// Center knob styling
 #define NEEDLE_CENTER_BG_COLOR          lv_color_hex(0x151515)
 #define NEEDLE_CENTER_BORDER_COLOR      lv_color_hex(0x444444)
 #define NEEDLE_CENTER_BORDER_WIDTH      2
 
-// Label positioning (scaled)
-#define NEEDLE_VALUE_LABEL_X_OFFSET     0 // ((int)(15/2 * GAUGE_SCALE))
-#define NEEDLE_VALUE_LABEL_Y_OFFSET     ((int)(160 * GAUGE_SCALE))
-#define NEEDLE_UNIT_LABEL_X_OFFSET      ((int)(140 * GAUGE_SCALE))
-#define NEEDLE_UNIT_LABEL_Y_OFFSET      ((int)(100 * GAUGE_SCALE))
+// Static scale cache: render ticks, labels and red zone once into an image so
+// only the needle and value label are drawn at runtime. Costs 2 bytes per pixel
+// of the meter per needle gauge (~380 KB at 466px, ~100 KB at 240px), so it is
+// enabled by default only on boards with PSRAM. Requires LV_USE_SNAPSHOT and LV_USE_IMG.
+#ifndef NEEDLE_SCALE_CACHE
+    #ifdef BOARD_HAS_PSRAM
+        #define NEEDLE_SCALE_CACHE 1
+    #else
+        #define NEEDLE_SCALE_CACHE 0
+    #endif
+#endif
+
+#if NEEDLE_SCALE_CACHE && !(LV_USE_SNAPSHOT && LV_USE_IMG)
+    #error "NEEDLE_SCALE_CACHE requires LV_USE_SNAPSHOT and LV_USE_IMG in lv_conf.h"
+#endif
+
+// Draw the needle from pre-rendered anti-aliased sprites (gauge_needle.c), one
+// per 1/NEEDLE_SPRITE_STEPS degree, instead of lv_meter's masked needle line: a
+// needle move blends one coverage run per row. Only one quadrant is stored
+// (the others are mirrored), shared by every needle gauge and kept once built.
+// With 2 steps per degree that is about 330 KB at 466px, so the sprites are
+// enabled by default only on boards with PSRAM. On the C3 they fit at 240px
+// with NEEDLE_SPRITE_STEPS 1 (about 60 KB of heap).
+#ifndef NEEDLE_SPRITES
+    #ifdef BOARD_HAS_PSRAM
+        #define NEEDLE_SPRITES 1
+    #else
+        #define NEEDLE_SPRITES 0
+    #endif
+#endif
+
+#ifndef NEEDLE_SPRITE_STEPS
+    #define NEEDLE_SPRITE_STEPS 2   // Sprites per degree (2 = every 0.5°)
+#endif
+
+// Build needle_gauge_benchmark() (meter needle line vs sprite update cost)
+#ifndef NEEDLE_BENCHMARK
+    #define NEEDLE_BENCHMARK 0
+#endif
+
+// Label positioning (Y offsets and unit position from gauge_geometry.h)
+#define NEEDLE_VALUE_LABEL_X_OFFSET     0
 #define NEEDLE_ICON_PADDING_DIVISOR     2       // Used for: (int)15 / NEEDLE_ICON_PADDING_DIVISOR
-#define NEEDLE_ICON_Y_OFFSET            ((int)(-80 * GAUGE_SCALE))
+
+// ============================================================================
+// FONT PARTITION
+// ============================================================================
+
+// 1: the custom fonts are not compiled in but mapped at runtime from the "fonts"
+// data partition (scripts/pack_fonts.py builds it, scripts/pio_fonts.py flashes
+// it with the firmware; `pio run -t upload_fonts` flashes only the fonts).
+// On the host the pack is mapped from GAUGE_FONTS_HOST_FILE.
+#ifndef GAUGE_FONT_PARTITION
+    #define GAUGE_FONT_PARTITION 0
+#endif
+#define GAUGE_FONTS_PARTITION_LABEL     "fonts"
+#define GAUGE_FONTS_PARTITION_SUBTYPE   0x40    // First custom data subtype
+#define GAUGE_FONTS_HOST_FILE           "fonts.bin"
+#define GAUGE_FONTS_MAX                 8       // Fonts per pack
+#define GAUGE_FONTS_MAX_CMAPS           4       // Character maps per font
+
+#if GAUGE_FONT_PARTITION
+    #include "gauge_fonts.h"
+    #define GAUGE_CUSTOM_FONT(name)     gauge_fonts_get(#name)
+#else
+    #define GAUGE_CUSTOM_FONT(name)     (&name)
+#endif
+
+// ============================================================================
+// NUMERIC READOUT CONFIGURATION
+// ============================================================================
+
+// The big value readouts (gauge_digits) blend pre-expanded glyphs from a per-font
+// atlas of 8-bit alpha boxes (~50 KB for the 120px numerals, ~26 KB for the 80px
+// font, from PSRAM when available). 0 draws them with lv_draw_label instead.
+#ifndef GAUGE_DIGIT_ATLAS
+    #define GAUGE_DIGIT_ATLAS 1
+#endif
+#define GAUGE_DIGITS_MAX_LEN            8       // Characters per readout
+#define GAUGE_DIGITS_MAX_FONTS          4       // Fonts with an atlas (others use the fallback)
+
+// Build gauge_digits_benchmark() (lv_label vs readout update cost)
+#ifndef GAUGE_DIGITS_BENCHMARK
+    #define GAUGE_DIGITS_BENCHMARK 0
+#endif
 
 // ============================================================================
 // ARC GAUGE CONFIGURATION
@@ -219,55 +294,220 @@ extern "C" {
 #define ARC_ANGLE_OFFSET_START          2       // Arc start angle adjustment
 #define ARC_ANGLE_OFFSET_END            1       // Arc end angle adjustment
 #define ARC_MARKER_ANGLE_OFFSET         1       // Marker angle offset
+#define GAUGE_SCALE_MAX_MARKERS         GAUGE_GEOMETRY_MAX_MARKERS  // Max markers (ticks + labels) per scale
 
 // Border sizing multipliers
 #define ARC_BORDER_WIDTH_MULTIPLIER     2       // For: ARC_WIDTH * 2
 #define ARC_BORDER_LINE_MULTIPLIER      2       // For: LINE_WIDTH * 2
 
-// Math constants
-#define MATH_PI                         3.14159f
-#define DEGREES_TO_RADIANS              180.0f
-
 // Redline styling
 #define ARC_REDLINE_WIDTH_MULTIPLIER    2       // For: LINE_WIDTH * 2
 
+// Value arc: the fill is drawn as fixed zone segments (grey/green/amber/red by
+// position on the scale), so crossing a zone boundary repaints nothing and a
+// value change only invalidates the swept angle. With GAUGE_ARC_GRADIENT the
+// zone colors blend over GAUGE_ARC_GRADIENT_BLEND degrees around each boundary
+// (colors from a per-arc lookup table, drawn in GAUGE_ARC_GRADIENT_STEP slices).
+#ifndef GAUGE_ARC_GRADIENT
+    #define GAUGE_ARC_GRADIENT          0
+#endif
+#define GAUGE_ARC_GRADIENT_STEP         3       // Degrees per gradient slice
+#define GAUGE_ARC_GRADIENT_BLEND        12      // Degrees of blend around a zone boundary
+#define GAUGE_ARC_INV_PAD               2       // Pixels added around invalidated sectors (anti-aliasing)
+
+// 1 fills the value arc from the scanline table of the screen profile
+// (gauge_arc_spans.h): a few span blends per row instead of lv_draw_arc's
+// angle and radius masks. 0 draws it with lv_draw_arc.
+#ifndef GAUGE_ARC_SPANS
+    #define GAUGE_ARC_SPANS             1
+#endif
+
+// Build gauge_arc_benchmark() (span rasterizer vs lv_draw_arc redraw cost)
+#ifndef GAUGE_ARC_BENCHMARK
+    #define GAUGE_ARC_BENCHMARK 0
+#endif
+
 // ============================================================================
 // MULTI GAUGE BAR CONFIGURATION
 // ============================================================================
 
-#define MULTI_GAUGE_LEFT_PADDING        ((int)(30 * GAUGE_SCALE))  // Left edge padding
-#define MULTI_GAUGE_BAR_WIDTH           ((int)(185 * GAUGE_SCALE))
-#define MULTI_GAUGE_BAR_HEIGHT          ((int)(40 * GAUGE_SCALE))
-#define MULTI_GAUGE_ROW_SPACING         ((int)(85 * GAUGE_SCALE))
-#define MULTI_GAUGE_ICON_SIZE           ((int)(48 * GAUGE_SCALE))
-#define MULTI_GAUGE_VALUE_WIDTH         ((int)(110 * GAUGE_SCALE))
-#define MULTI_GAUGE_ICON_BAR_GAP        ((int)(100 * GAUGE_SCALE))  // Gap between icon and bar start
+// Channels of the rows, top to bottom: 2 to MULTI_GAUGE_MAX_ROWS gauge_channel_t
+// values (gauge_channels.h), a channel may appear twice. Range, zones, unit
+// and decimals come from the channel.
+#ifndef MULTI_GAUGE_ROWS
+    #define MULTI_GAUGE_ROWS    GAUGE_CHANNEL_OIL_PRESSURE, GAUGE_CHANNEL_OIL_TEMP, GAUGE_CHANNEL_WATER_TEMP
+#endif
+#define MULTI_GAUGE_MAX_ROWS            6
+
+// Row layout (padding, bar/icon/value sizes, spacing): gauge_geometry.h
+// Above three rows the row spacing and bar height shrink so the rows keep the
+// height of three; icons and values fall back to FONT_MARKERS when too tall.
 
 // Bar styling
 #define MULTI_GAUGE_BAR_BG_COLOR        lv_color_hex(0x1A1A1A)
-#define MULTI_GAUGE_BAR_BORDER_WIDTH    ((int)(2 * GAUGE_SCALE))
-#define MULTI_GAUGE_BAR_RADIUS          ((int)(4 * GAUGE_SCALE))
-#define MULTI_GAUGE_INDICATOR_RADIUS    ((int)(2 * GAUGE_SCALE))
-
-// Label spacing
-#define MULTI_GAUGE_VALUE_X_OFFSET      ((int)(25 * GAUGE_SCALE))
-#define MULTI_GAUGE_UNIT_SPACING        ((int)(3 * GAUGE_SCALE))
+// Border width, radii and label spacing: gauge_geometry.h
 
 // Oil pressure calculation constants
 #define OIL_PRESSURE_RPM_DIVISOR        2000.0f  // Pressure = RPM / 2000
 #define OIL_PRESSURE_MIN_IDLE           0.5f     // Minimum pressure at idle (bar)
-#define OIL_PRESSURE_RESOLUTION_MULT    10.0f    // Multiplier for bar resolution
-#define OIL_PRESSURE_DECIMAL_MULT       10       // For decimal place calculation
+
+// Build multi_gauge_benchmark() (per-tick LVGL work with 3 and 6 rows)
+#ifndef MULTI_GAUGE_BENCHMARK
+    #define MULTI_GAUGE_BENCHMARK 0
+#endif
+
+// ============================================================================
+// PEAK HOLD CONFIGURATION
+// ============================================================================
+
+// Highest oil / water temperature and lowest oil pressure under load are held
+// (gauge_peaks.c) and shown as a thin marker on the arc, needle scale or bar.
+// A tap on a gauge lists the held values, a long press clears them.
+#ifndef GAUGE_PEAK_LOAD_RPM
+    #define GAUGE_PEAK_LOAD_RPM         3000    // Pressure minimum only counts at or above this RPM
+#endif
+#define GAUGE_PEAK_MARKER_WIDTH         LINE_WIDTH  // Needle scale and bar markers (arc: one degree of the ring)
+#define GAUGE_PEAK_RECALL_TIME          3000    // ms - Held values stay listed after a tap
+#define GAUGE_PEAK_RECALL_PAD           (LINE_WIDTH * 4)
+#define GAUGE_PEAK_RECALL_RADIUS        (LINE_WIDTH * 4)
+
+// ============================================================================
+// TREND GAUGE CONFIGURATION
+// ============================================================================
+
+// Last TREND_GAUGE_MINUTES of one channel (trend_gauge.c), one plot column per
+// TREND_GAUGE_MINUTES / TREND_GAUGE_PLOT_WIDTH (the mean of its samples).
+// The newest column is written at a cursor that sweeps left to right ahead of
+// a blank gap, so a new column repaints only itself and the gap, never the
+// whole plot. Colors follow the channel's zones.
+#define TREND_CHANNEL_OIL_TEMP          0
+#define TREND_CHANNEL_WATER_TEMP        1
+#ifndef TREND_GAUGE_CHANNEL
+    #define TREND_GAUGE_CHANNEL         TREND_CHANNEL_OIL_TEMP
+#endif
+#ifndef TREND_GAUGE_MINUTES
+    #define TREND_GAUGE_MINUTES         10
+#endif
+
+// Layout, from the screen size (the plot corners stay inside the round panel)
+#define TREND_GAUGE_PLOT_WIDTH          ((GAUGE_DIMENSION * 2) / 3)   // Also the history length
+#define TREND_GAUGE_PLOT_HEIGHT         (GAUGE_DIMENSION / 3)
+#define TREND_GAUGE_PLOT_Y_OFFSET       (GAUGE_DIMENSION / 16)
+#define TREND_GAUGE_VALUE_Y_OFFSET      (-(GAUGE_DIMENSION / 5))
+#define TREND_GAUGE_UNIT_X_OFFSET       (GAUGE_DIMENSION / 6)
+#define TREND_GAUGE_ICON_Y_OFFSET       (-(GAUGE_DIMENSION / 3))
+#define TREND_GAUGE_LABEL_GAP           (LINE_WIDTH * 2)
+#define TREND_GAUGE_LINE_WIDTH          LINE_WIDTH
+#define TREND_GAUGE_GAP                 (LINE_WIDTH * 3)   // Blank columns ahead of the cursor
+#define TREND_GAUGE_FILL_OPA            LV_OPA_30
+#define TREND_GAUGE_GRID_OPA            LV_OPA_50
+
+// ============================================================================
+// RPM / SHIFT LIGHT GAUGE CONFIGURATION
+// ============================================================================
+
+// Tachometer with shift lights (rpm_gauge.c). RPM does not go through the
+// loop() update: the receive callback posts it (gauge_manager_post_rpm()) and
+// a RPM_GAUGE_PERIOD timer applies the latest sample and refreshes at once.
+#define RPM_GAUGE_MAX                   8000
+#define RPM_GAUGE_ZONE_ORANGE           5500
+#define RPM_GAUGE_REDLINE               7200
+#define RPM_GAUGE_PERIOD                16      // ms - Sample poll / redraw period (~60 Hz)
+#define RPM_GAUGE_TIMEOUT               1000    // ms - Without samples the tachometer drops to 0
+#define RPM_GAUGE_READOUT_STEP          10      // RPM - Digital readout resolution
+
+// Receive-to-refresh latency above this counts as over budget in gauge_stats
+#ifndef RPM_GAUGE_LATENCY_BUDGET
+    #define RPM_GAUGE_LATENCY_BUDGET    33      // ms - Two frames at 60 Hz
+#endif
+
+// Gear estimate from RPM / speed (there is no gear in TelemetryData): RPM per
+// km/h x10 for each gear (MX-5 NC 6-speed, 4.10 final drive, 205/45R17),
+// matched within RPM_GAUGE_GEAR_TOLERANCE percent above RPM_GAUGE_GEAR_MIN_SPEED
+#define RPM_GAUGE_GEAR_RPM_PER_KMH      {1347, 798, 579, 415, 353, 294}
+#define RPM_GAUGE_GEAR_TOLERANCE        8       // %
+#define RPM_GAUGE_GEAR_MIN_SPEED        5       // km/h
+
+// Shift points per gear, and for an unknown gear (stopped, clutch in)
+#ifndef RPM_GAUGE_SHIFT_POINTS
+    #define RPM_GAUGE_SHIFT_POINTS      {6800, 7000, 7000, 7000, 7000, 7000}
+#endif
+#ifndef RPM_GAUGE_SHIFT_RPM
+    #define RPM_GAUGE_SHIFT_RPM         7000
+#endif
+
+// Shift lights: the row fills over the band below the shift point, then flashes
+#define RPM_GAUGE_LIGHTS                10
+#define RPM_GAUGE_SHIFT_BAND            1500    // RPM
+#define RPM_GAUGE_FLASH_PERIOD          80      // ms - Half period of the shift flash
+#define RPM_GAUGE_LIGHT_SIZE            (GAUGE_DIMENSION / 26)
+#define RPM_GAUGE_LIGHT_PITCH           (GAUGE_DIMENSION / 19)
+#define RPM_GAUGE_LIGHTS_Y_OFFSET       (-(GAUGE_DIMENSION / 4))
+#define RPM_GAUGE_READOUT_Y_OFFSET      (GAUGE_DIMENSION / 5)
+
+// ============================================================================
+// PEDAL TRACE GAUGE CONFIGURATION
+// ============================================================================
+
+// Brake pedal, brake pressure, accelerator pedal and throttle plate traces for
+// driver coaching (pedal_gauge.c). The receive callback posts every sample into
+// a per-channel ring (gauge_manager_post_pedals()) and each sample becomes one
+// plot column, so the plot shows the last PEDAL_GAUGE_PLOT_WIDTH samples at the
+// incoming rate (~3.5 s at 100 Hz on the 466px panel). A PEDAL_GAUGE_PERIOD
+// timer moves the new samples into the sweep plot, which repaints only the new
+// columns.
+#ifndef PEDAL_GAUGE_RING_SIZE
+    #define PEDAL_GAUGE_RING_SIZE       64      // Samples per channel, power of 2 (640 ms at 100 Hz)
+#endif
+#define PEDAL_GAUGE_PERIOD              16      // ms - Ring drain period
+#ifndef PEDAL_GAUGE_BRAKE_PRESSURE_MAX
+    #define PEDAL_GAUGE_BRAKE_PRESSURE_MAX  10000   // kPa - Top of the brake pressure trace (100 bar)
+#endif
+
+// Layout, from the screen size (the plot corners stay inside the round panel)
+#define PEDAL_GAUGE_PLOT_WIDTH          ((GAUGE_DIMENSION * 3) / 4)   // Also the history length
+#define PEDAL_GAUGE_PLOT_HEIGHT         (GAUGE_DIMENSION / 3)
+#define PEDAL_GAUGE_PLOT_Y_OFFSET       (GAUGE_DIMENSION / 12)
+#define PEDAL_GAUGE_VALUE_X_OFFSET      (GAUGE_DIMENSION / 6)
+#define PEDAL_GAUGE_VALUE_Y_OFFSET      (-(GAUGE_DIMENSION / 5))
+#define PEDAL_GAUGE_NAME_Y_OFFSET       (-((GAUGE_DIMENSION * 2) / 7))
+#define PEDAL_GAUGE_LINE_WIDTH          LINE_WIDTH
+#define PEDAL_GAUGE_GAP                 (LINE_WIDTH * 3)   // Blank columns ahead of the cursor
+#define PEDAL_GAUGE_THROTTLE_FILL_OPA   LV_OPA_20
+#define PEDAL_GAUGE_GRID_OPA            LV_OPA_50
+
+// ============================================================================
+// RUNTIME LAYOUT CONFIGURATION
+// ============================================================================
+
+// Screens described by a layout pack (gauge_layout.h) instead of code, shown
+// after the built-in gauges as GAUGE_LAYOUT_1..GAUGE_LAYOUT_4. With
+// GAUGE_LAYOUT_PARTITION 1 the pack of the "layouts" data partition
+// (scripts/pack_layout.py) is loaded at startup; on the host the file
+// GAUGE_LAYOUT_HOST_FILE. gauge_manager_load_layout() swaps the layout at runtime.
+#ifndef GAUGE_LAYOUT_PARTITION
+    #define GAUGE_LAYOUT_PARTITION 0
+#endif
+#define GAUGE_LAYOUT_PARTITION_LABEL    "layouts"
+#define GAUGE_LAYOUT_PARTITION_SUBTYPE  0x41    // Next custom data subtype after the fonts
+#define GAUGE_LAYOUT_HOST_FILE          "layout.bin"
+#define GAUGE_LAYOUT_MAX_SCREENS        4       // One gauge_type_t slot each
+#define GAUGE_LAYOUT_MAX_ELEMENTS       6       // Per screen
+#define GAUGE_LAYOUT_LABEL_GAP          (LINE_WIDTH * 2)
 
 // ============================================================================
 // DEFAULT GAUGE SELECTION
 // ============================================================================
 
-// Define which gauge to show on startup
+// Define which gauge to show on startup (gauge_type_t in gauge_manager.h)
 // 0 = Oil Temperature Gauge
-// 1 = Water Temperature Gauge
-// 2 = Multi Gauge (shows all three: water temp, oil temp, oil pressure)
-// 3 = Oil Pressure Gauge
+// 1 = Oil Pressure Gauge
+// 2 = Water Temperature Gauge
+// 3 = Multi Gauge (the MULTI_GAUGE_ROWS channels as bars)
+// 4 = Trend Gauge (TREND_GAUGE_CHANNEL over the last TREND_GAUGE_MINUTES)
+// 5 = RPM / Shift Light Gauge
+// 6 = Pedal Trace Gauge (brake pedal, brake pressure, accelerator, throttle plate)
+// 7-10 = Screens 1-4 of the loaded layout pack (falls back to the next gauge if none)
 #ifndef DEFAULT_GAUGE
     #define DEFAULT_GAUGE 0  // Default to oil temp gauge
 #endif
@@ -276,9 +516,67 @@ extern "C" {
 // ANIMATION CONFIGURATION
 // ============================================================================
 
-#define GAUGE_ANIM_TIME       200   // ms - Gauge needle animation
-#define BLINK_ANIM_TIME       250   // ms - Alert blink animation
-#define BLINK_PLAYBACK_TIME   250   // ms - Alert blink reverse animation
+#define BLINK_ANIM_TIME       250   // ms - Alert blink half period (shared alert timer)
+
+// Alert presentation (gauge_alert.h): 0 = full-screen background, 1 = outer
+// ring, 2 = panel invert, 3 = panel dim. The panel styles need the board hook
+// (gauge_alert_set_panel_hook()) and fall back to the ring without it.
+#ifndef GAUGE_ALERT_STYLE
+    #define GAUGE_ALERT_STYLE 1
+#endif
+#define GAUGE_ALERT_RING_WIDTH          (LINE_WIDTH * 3)
+#define GAUGE_ALERT_RING_SEGMENTS       24      // Areas refreshed per ring toggle (multiple of 4)
+#define GAUGE_ALERT_MAX_ACTIVE          8       // Gauges in alert at the same time
+#define GAUGE_ALERT_DIM_BRIGHTNESS      0x30    // Panel brightness of the dimmed phase (board hook)
+
+// Build gauge_alert_benchmark() (bytes flushed per alert second, per style)
+#ifndef GAUGE_ALERT_BENCHMARK
+    #define GAUGE_ALERT_BENCHMARK 0
+#endif
+
+// ============================================================================
+// MOTION ENGINE CONFIGURATION
+// ============================================================================
+
+// All dynamic values (arcs, needles, bars) are advanced by a single LVGL timer
+// using a critically damped spring instead of one lv_anim per update.
+#define GAUGE_MOTION_PERIOD          16      // ms - Motion timer period (~60 Hz)
+#define GAUGE_MOTION_MAX_STEP        50      // ms - Largest time step integrated at once
+#define GAUGE_MOTION_OMEGA           20.0f   // rad/s - Spring stiffness (settles in ~4/omega s)
+#define GAUGE_MOTION_REST_DISTANCE   0.25f   // Units - Snap to target below this distance
+#define GAUGE_MOTION_REST_VELOCITY   2.0f    // Units/s - ...and below this speed
+// Every screen may stay built (screen cache): one value per dial screen (oil
+// temp, oil pressure, water temp), one per multi gauge row and one per layout
+// element, plus one for the benchmarks
+#define GAUGE_MOTION_MAX_CHANNELS    (3 + MULTI_GAUGE_MAX_ROWS + GAUGE_LAYOUT_MAX_SCREENS * GAUGE_LAYOUT_MAX_ELEMENTS + 1)
+
+// ============================================================================
+// DISPLAY MODES
+// ============================================================================
+
+// Presentation of the single-value gauges, selected by TelemetryData.gaugeType.
+// Both modes share one widget tree; a mode change only swaps the scale layer.
+#define GAUGE_MODE_NORMAL        0       // Needle gauges
+#define GAUGE_MODE_RACING        1       // Arc gauges
+#define GAUGE_MODE_COUNT         2
+
+// ============================================================================
+// SCREEN MANAGEMENT
+// ============================================================================
+
+// Screens are built on first use. After each switch, the least recently used
+// screens are deleted while the LVGL heap use is above this budget (bytes).
+#ifndef GAUGE_SCREEN_MEM_BUDGET
+    #if LV_MEM_CUSTOM == 0
+        #define GAUGE_SCREEN_MEM_BUDGET  ((LV_MEM_SIZE * 3U) / 4U)
+    #else
+        #define GAUGE_SCREEN_MEM_BUDGET  UINT32_MAX  // No pool to watch
+    #endif
+#endif
+
+// Idle time after a switch before the neighbouring screens are pre-built,
+// so the next swipe only has to load an existing screen
+#define GAUGE_PREFETCH_DELAY     500     // ms
 
 // ============================================================================
 // GESTURE CONFIGURATION
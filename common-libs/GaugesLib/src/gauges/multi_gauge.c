@@ -3,247 +3,302 @@ extern "C" {
 #endif
 
 #include "multi_gauge.h"
+#include <string.h>
 #include "gauges_config.h"
+#include "gauge_channels.h"
+#include "gauge_digits.h"
+#include "gauge_motion.h"
+#include "gauge_peaks.h"
+#include "gauge_stats.h"
+#include "gauge_theme.h"
+#include "gauge_zones.h"
 
 // ============================================================================
 // PRIVATE STATE
 // ============================================================================
 
+/**
+ * @brief One bar row: caption, bar, readout and unit
+ *
+ * Rows show the channel models (gauge_model.h): fixed point at the channel's
+ * display resolution, so "changed" means "changed on screen".
+ */
 typedef struct {
+    gauge_channel_t channel;
     lv_obj_t *bar;
-    lv_obj_t *value_label;
-    lv_obj_t *unit_label;
-    lv_obj_t *icon_label;
-    float min_value;
-    float max_value;
-    float zone_green;
-    float zone_orange;
-    float zone_red;
-} bar_gauge_t;
-
-static bar_gauge_t water_temp_bar;
-static bar_gauge_t oil_temp_bar;
-static bar_gauge_t oil_pressure_bar;
+    lv_obj_t *value;        // gauge_digits readout
+    gauge_model_t shown;    // Model state on screen (gauge_model_sync())
+    gauge_motion_t motion;  // Drives the bar value (see gauge_motion.h)
+    lv_obj_t *marker;       // Held value marker (gauge_peaks.h), child of the bar
+    lv_coord_t marker_x;    // Marker offset in the bar, -1 while hidden
+} bar_row_t;
+
+typedef struct {
+    bar_row_t rows[MULTI_GAUGE_MAX_ROWS];
+    uint8_t row_count;
+    uint32_t rows_updated;  // Rows that changed on screen (benchmark counters)
+    uint32_t lvgl_calls;    // Widget updates issued for them
+} multi_gauge_t;
+
+static const gauge_channel_t row_channels[] = {MULTI_GAUGE_ROWS};
+#define ROW_COUNT (sizeof(row_channels) / sizeof(row_channels[0]))
+_Static_assert(ROW_COUNT >= 2 && ROW_COUNT <= MULTI_GAUGE_MAX_ROWS, "MULTI_GAUGE_ROWS must list 2 to 6 channels");
+
+static multi_gauge_t multi;
 
 // ============================================================================
 // PRIVATE FUNCTIONS
 // ============================================================================
 
 /**
- * @brief Get color based on value and thresholds
+ * @brief Motion apply callback for bar value changes
  */
-static lv_color_t get_color_for_value(float value, float zone_green, float zone_orange, float zone_red) {
-    if (value >= zone_red) {
-        return COLOR_RED;
-    } else if (value >= zone_orange) {
-        return COLOR_AMBER;
-    } else if (value >= zone_green) {
-        return COLOR_GREEN;
-    } else {
-        return COLOR_GREY;
-    }
+static void bar_motion_apply_cb(void *bar, int32_t value) {
+    lv_bar_set_value((lv_obj_t *)bar, value, LV_ANIM_OFF);
+}
+
+/**
+ * @brief Vertical distance between rows: the rows keep the height of three
+ */
+static lv_coord_t row_pitch(uint8_t row_count) {
+    return row_count <= 3 ? MULTI_GAUGE_ROW_SPACING : (lv_coord_t)(MULTI_GAUGE_ROW_SPACING * 3 / row_count);
 }
 
 /**
  * @brief Create a horizontal bar gauge row
+ *
+ * Range, caption and unit are set here once; updates only touch the bar value,
+ * the zone and the readout text.
  */
-static void create_bar_gauge_row(bar_gauge_t *gauge, int32_t y_pos, const char *icon_symbol,
-                                  const char *text_label,
-                                  float min_val, float max_val,
-                                  float zone_green, float zone_orange, float zone_red) {
-    // Store configuration
-    gauge->min_value = min_val;
-    gauge->max_value = max_val;
-    gauge->zone_green = zone_green;
-    gauge->zone_orange = zone_orange;
-    gauge->zone_red = zone_red;
-
-    // Create icon/label
-    gauge->icon_label = lv_label_create(lv_scr_act());
-
-    #if USE_CUSTOM_ICON_FONT
-    lv_label_set_text(gauge->icon_label, icon_symbol);
-    lv_obj_set_style_text_font(gauge->icon_label, FONT_ICON, 0);
-    #else
-    lv_label_set_text(gauge->icon_label, text_label);
-    lv_obj_set_style_text_font(gauge->icon_label, FONT_MARKERS, 0);
-    #endif
-
-    lv_obj_set_style_text_color(gauge->icon_label, COLOR_WHITE, 0);
-    lv_obj_align(gauge->icon_label, LV_ALIGN_LEFT_MID, MULTI_GAUGE_LEFT_PADDING, y_pos);
+static void create_bar_row(lv_obj_t *parent, bar_row_t *row, gauge_channel_t channel,
+                           lv_coord_t y_pos, lv_coord_t pitch) {
+    const gauge_channel_info_t *info = gauge_channel_info(channel);
+    const gauge_model_config_t *model = &info->model;
+
+    row->channel = channel;
+    gauge_model_reset(&row->shown);
+
+    // Create icon/label, the text label when the icon is taller than the row
+    const lv_font_t *caption_font;
+    const char *caption = gauge_channel_caption(channel, &caption_font);
+    if (lv_font_get_line_height(caption_font) > pitch) {
+        caption = info->text_label;
+        caption_font = FONT_MARKERS;
+    }
+    lv_obj_t *icon_label = lv_label_create(parent);
+    lv_label_set_text(icon_label, caption);
+    lv_obj_set_style_text_font(icon_label, caption_font, 0);
+    gauge_theme_add_color(icon_label, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+    lv_obj_align(icon_label, LV_ALIGN_LEFT_MID, MULTI_GAUGE_LEFT_PADDING, y_pos);
 
     // Create horizontal bar
-    gauge->bar = lv_bar_create(lv_scr_act());
-    lv_obj_set_size(gauge->bar, MULTI_GAUGE_BAR_WIDTH, MULTI_GAUGE_BAR_HEIGHT);
-    lv_obj_align(gauge->bar, LV_ALIGN_LEFT_MID, MULTI_GAUGE_LEFT_PADDING + MULTI_GAUGE_ICON_BAR_GAP, y_pos);
+    row->bar = lv_bar_create(parent);
+    lv_obj_set_size(row->bar, MULTI_GAUGE_BAR_WIDTH, MULTI_GAUGE_BAR_HEIGHT * pitch / MULTI_GAUGE_ROW_SPACING);
+    lv_obj_align(row->bar, LV_ALIGN_LEFT_MID, MULTI_GAUGE_LEFT_PADDING + MULTI_GAUGE_ICON_BAR_GAP, y_pos);
+    lv_obj_clear_flag(row->bar, LV_OBJ_FLAG_CLICKABLE);  // Taps reach the screen (peak recall)
 
     // Style the bar
-    lv_obj_set_style_bg_color(gauge->bar, MULTI_GAUGE_BAR_BG_COLOR, LV_PART_MAIN);
-    lv_obj_set_style_border_width(gauge->bar, MULTI_GAUGE_BAR_BORDER_WIDTH, LV_PART_MAIN);
-    lv_obj_set_style_border_color(gauge->bar, COLOR_GREY, LV_PART_MAIN);
-    lv_obj_set_style_radius(gauge->bar, MULTI_GAUGE_BAR_RADIUS, LV_PART_MAIN);
-
-    // Set bar range (cast to int32_t for LVGL)
-    lv_bar_set_range(gauge->bar, (int32_t)min_val, (int32_t)max_val);
-    lv_bar_set_value(gauge->bar, (int32_t)min_val, LV_ANIM_OFF);
-
-    // Style the indicator (the filled part)
-    lv_obj_set_style_bg_color(gauge->bar, COLOR_GREEN, LV_PART_INDICATOR);
-    lv_obj_set_style_radius(gauge->bar, MULTI_GAUGE_INDICATOR_RADIUS, LV_PART_INDICATOR);
-
-    // Create value label (numeric value only)
-    gauge->value_label = lv_label_create(lv_scr_act());
-    lv_label_set_text(gauge->value_label, "---");
-    lv_obj_set_style_text_color(gauge->value_label, COLOR_WHITE, 0);
-    lv_obj_set_style_text_font(gauge->value_label, FONT_TEMP_UNIT, 0);  // Larger font for number
-    lv_obj_align(gauge->value_label, LV_ALIGN_LEFT_MID,
+    lv_obj_set_style_bg_color(row->bar, MULTI_GAUGE_BAR_BG_COLOR, LV_PART_MAIN);
+    lv_obj_set_style_border_width(row->bar, MULTI_GAUGE_BAR_BORDER_WIDTH, LV_PART_MAIN);
+    gauge_theme_add_color(row->bar, LV_STYLE_BORDER_COLOR, GAUGE_COLOR_MUTED, LV_PART_MAIN);
+    lv_obj_set_style_radius(row->bar, MULTI_GAUGE_BAR_RADIUS, LV_PART_MAIN);
+
+    lv_bar_set_range(row->bar, model->min, model->max);
+    gauge_motion_attach(&row->motion, bar_motion_apply_cb, row->bar, model->min);
+
+    // Style the indicator (the filled part); its color follows the zone state
+    gauge_zones_bind_bar(row->bar);
+    lv_obj_set_style_radius(row->bar, MULTI_GAUGE_INDICATOR_RADIUS, LV_PART_INDICATOR);
+
+    // Held value marker: a thin line across the indicator, hidden until a value is held
+    row->marker = lv_obj_create(row->bar);
+    lv_obj_remove_style_all(row->marker);
+    lv_obj_clear_flag(row->marker, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(row->marker, GAUGE_PEAK_MARKER_WIDTH, LV_PCT(100));
+    lv_obj_align(row->marker, LV_ALIGN_LEFT_MID, 0, 0);
+    lv_obj_set_style_bg_opa(row->marker, LV_OPA_COVER, 0);
+    gauge_theme_add_color(row->marker, LV_STYLE_BG_COLOR, GAUGE_COLOR_TEXT, 0);
+    lv_obj_add_flag(row->marker, LV_OBJ_FLAG_HIDDEN);
+    row->marker_x = -1;
+
+    // Value readout, left aligned once: a longer value grows to the right
+    const lv_font_t *value_font = FONT_TEMP_UNIT;
+    if (lv_font_get_line_height(value_font) > pitch) value_font = FONT_MARKERS;
+    row->value = gauge_digits_create(parent);
+    lv_obj_set_style_text_font(row->value, value_font, 0);
+    gauge_theme_add_color(row->value, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+    lv_obj_align(row->value, LV_ALIGN_LEFT_MID,
                  MULTI_GAUGE_LEFT_PADDING + MULTI_GAUGE_ICON_BAR_GAP + MULTI_GAUGE_BAR_WIDTH + MULTI_GAUGE_VALUE_X_OFFSET,
                  y_pos);
 
-    // Create unit label (smaller font for units)
-    gauge->unit_label = lv_label_create(lv_scr_act());
-    lv_label_set_text(gauge->unit_label, "");
-    lv_obj_set_style_text_color(gauge->unit_label, COLOR_WHITE, 0);
-    lv_obj_set_style_text_font(gauge->unit_label, FONT_MARKERS, 0);  // Smaller font for unit
-    // Position will be updated relative to value_label after text is set
-}
+    // Unit placed once after the widest value of the range, so it never moves
+    char widest[16], text[16];
+    gauge_value_format(widest, sizeof(widest), model->min, model->decimals);
+    gauge_value_format(text, sizeof(text), model->max, model->decimals);
+    gauge_digits_set_text(row->value, strlen(text) > strlen(widest) ? text : widest);
 
-/**
- * @brief Update a bar gauge with a new value
- */
-static void update_bar_gauge(bar_gauge_t *gauge, int32_t value, const char *unit) {
-    // Store the actual value for display
-    int32_t display_value = value;
-
-    // Constrain bar value to range (for visual indicator only)
-    int32_t bar_value = value;
-    if (bar_value < (int32_t)gauge->min_value) bar_value = (int32_t)gauge->min_value;
-    if (bar_value > (int32_t)gauge->max_value) bar_value = (int32_t)gauge->max_value;
-
-    // Update bar value with animation (constrained to range)
-    lv_bar_set_value(gauge->bar, bar_value, LV_ANIM_ON);
+    lv_obj_t *unit_label = lv_label_create(parent);
+    lv_label_set_text(unit_label, info->unit_text);
+    gauge_theme_add_color(unit_label, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+    lv_obj_set_style_text_font(unit_label, FONT_MARKERS, 0);  // Smaller font for unit
+    lv_obj_align_to(unit_label, row->value, LV_ALIGN_OUT_RIGHT_MID, MULTI_GAUGE_UNIT_SPACING, 0);
 
-    // Update bar color based on constrained value
-    lv_color_t color = get_color_for_value(bar_value, gauge->zone_green, gauge->zone_orange, gauge->zone_red);
-    lv_obj_set_style_bg_color(gauge->bar, color, LV_PART_INDICATOR);
+    gauge_digits_set_text(row->value, "---");
+}
 
-    // Update value label with actual value (not constrained)
-    char buf[16];
-    lv_snprintf(buf, sizeof(buf), "%d", (int)display_value);
-    lv_label_set_text(gauge->value_label, buf);
+static void create_rows(multi_gauge_t *gauge, lv_obj_t *screen, const gauge_channel_t *channels, uint8_t count) {
+    lv_coord_t pitch = row_pitch(count);
 
-    // Update unit label
-    lv_label_set_text(gauge->unit_label, unit);
+    // Rows centered on the screen
+    gauge->row_count = count;
+    for (uint8_t i = 0; i < count; i++) {
+        lv_coord_t y_pos = (lv_coord_t)((2 * i - (count - 1)) * pitch / 2);
+        create_bar_row(screen, &gauge->rows[i], channels[i], y_pos, pitch);
+    }
+}
 
-    // Position unit label to the right of value label
-    lv_obj_align_to(gauge->unit_label, gauge->value_label, LV_ALIGN_OUT_RIGHT_MID, MULTI_GAUGE_UNIT_SPACING, 0);
+static void release_rows(multi_gauge_t *gauge) {
+    for (uint8_t i = 0; i < gauge->row_count; i++) {
+        gauge_motion_detach(&gauge->rows[i].motion);
+    }
+    memset(gauge, 0, sizeof(*gauge));
 }
 
 /**
- * @brief Calculate minimum safe oil pressure based on RPM
- *
- * For a 2.0L naturally aspirated engine (MX5 NC):
- * - Idle (800 RPM): ~0.5 bar minimum
- * - 3000 RPM: ~1.5 bar minimum
- * - 6000 RPM: ~3.0 bar minimum
- *
- * @param rpm Engine RPM
- * @return Minimum safe pressure in bar
+ * @brief Move the held value marker of a bar (no-op while it stays on the same pixel)
  */
-static float calculate_min_oil_pressure(int32_t rpm) {
-    // Conservative formula: 0.5 bar per 1000 RPM
-    float min_pressure = (float)rpm / OIL_PRESSURE_RPM_DIVISOR;
-
-    // Ensure minimum of 0.5 bar at idle
-    if (min_pressure < OIL_PRESSURE_MIN_IDLE) {
-        min_pressure = OIL_PRESSURE_MIN_IDLE;
+static void update_bar_marker(multi_gauge_t *gauge, bar_row_t *row) {
+    int8_t peak = gauge_channel_info(row->channel)->peak;
+    float value;
+    lv_coord_t x = -1;
+    if (peak >= 0 && gauge_peaks_get((gauge_peak_t)peak, &value)) {
+        const gauge_model_config_t *model = &gauge_channel_info(row->channel)->model;
+        int32_t fixed = gauge_value_to_fixed(value, model->decimals);
+        if (fixed < model->min) fixed = model->min;
+        if (fixed > model->max) fixed = model->max;
+        // The content area is the indicator's full extent
+        lv_coord_t travel = lv_obj_get_content_width(row->bar) - GAUGE_PEAK_MARKER_WIDTH;
+        x = (lv_coord_t)(((fixed - model->min) * travel) / (model->max - model->min));
     }
+    if (x == row->marker_x) return;
 
-    return min_pressure;
+    if (x < 0) {
+        lv_obj_add_flag(row->marker, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_set_x(row->marker, x);
+        if (row->marker_x < 0) lv_obj_clear_flag(row->marker, LV_OBJ_FLAG_HIDDEN);
+    }
+    row->marker_x = x;
+    gauge->lvgl_calls++;
 }
 
 /**
- * @brief Update oil pressure bar gauge (handles float values)
+ * @brief Show the model of a row's channel (no LVGL call while its readout and zone are unchanged)
  */
-static void update_pressure_bar_gauge(bar_gauge_t *gauge, float value, int32_t rpm) {
-    // Constrain value to range
-    if (value < gauge->min_value) value = gauge->min_value;
-    if (value > gauge->max_value) value = gauge->max_value;
-
-    // Update bar value with animation (convert float to int for bar)
-    int32_t bar_value = (int32_t)(value * OIL_PRESSURE_RESOLUTION_MULT); // Scale for better resolution
-    int32_t bar_max = (int32_t)(gauge->max_value * OIL_PRESSURE_RESOLUTION_MULT);
-    lv_bar_set_range(gauge->bar, 0, bar_max);
-    lv_bar_set_value(gauge->bar, bar_value, LV_ANIM_ON);
-
-    // Calculate dynamic minimum pressure threshold based on RPM
-    float min_safe_pressure = calculate_min_oil_pressure(rpm);
-
-    // Update bar color based on value with RPM-dependent low threshold
-    // Oil pressure is critical both when too low (relative to RPM) and too high
-    lv_color_t color;
-    if (value < min_safe_pressure) {
-        color = COLOR_RED;   // Too low for current RPM - dangerous!
-    } else if (value >= gauge->zone_red) {
-        color = COLOR_RED;   // Too high - dangerous!
-    } else if (value >= gauge->zone_orange) {
-        color = COLOR_AMBER; // Getting high - warning
-    } else {
-        color = COLOR_GREEN; // Good range
+static void update_bar_row(multi_gauge_t *gauge, bar_row_t *row, const gauge_model_t *model) {
+    // No alert on the rows: the zone shows it
+    uint8_t changes = gauge_model_sync(&row->shown, model) &
+                      (GAUGE_MODEL_POSITION | GAUGE_MODEL_TEXT | GAUGE_MODEL_ZONE);
+    if (!changes) return;
+    gauge->rows_updated++;
+
+    // Bar constrained to the range, readout shows the actual value
+    if (changes & GAUGE_MODEL_POSITION) {
+        gauge_motion_set_target(&row->motion, model->position);
+        gauge->lvgl_calls++;
     }
-    lv_obj_set_style_bg_color(gauge->bar, color, LV_PART_INDICATOR);
-
-    // Update value label with one decimal place (number only)
-    char buf[16];
-    lv_snprintf(buf, sizeof(buf), "%d.%d", (int)value, (int)((value - (int)value) * OIL_PRESSURE_DECIMAL_MULT));
-    lv_label_set_text(gauge->value_label, buf);
-
-    // Update unit label
-    lv_label_set_text(gauge->unit_label, "bar");
+    if (changes & GAUGE_MODEL_TEXT) {
+        gauge_digits_set_text(row->value, model->text);
+        gauge->lvgl_calls++;
+    }
+    if (changes & GAUGE_MODEL_ZONE) {
+        gauge_zones_set(row->bar, (gauge_zone_t)model->zone);
+        gauge->lvgl_calls++;
+    }
+}
 
-    // Position unit label to the right of value label
-    lv_obj_align_to(gauge->unit_label, gauge->value_label, LV_ALIGN_OUT_RIGHT_MID, MULTI_GAUGE_UNIT_SPACING, 0);
+static void update_rows(multi_gauge_t *gauge, const gauge_model_t *models) {
+    for (uint8_t i = 0; i < gauge->row_count; i++) {
+        update_bar_row(gauge, &gauge->rows[i], &models[gauge->rows[i].channel]);
+        update_bar_marker(gauge, &gauge->rows[i]);
+    }
 }
 
 // ============================================================================
 // PUBLIC API IMPLEMENTATION
 // ============================================================================
 
-void multi_gauge_init(void) {
-    // Calculate vertical positions for three rows, centered on screen
-    int32_t screen_center_y = 0;
-    int32_t row1_y = screen_center_y - MULTI_GAUGE_ROW_SPACING;
-    int32_t row2_y = screen_center_y;
-    int32_t row3_y = screen_center_y + MULTI_GAUGE_ROW_SPACING;
-
-    // Create oil pressure row (top)
-    create_bar_gauge_row(
-        &oil_pressure_bar, row1_y, OIL_PRESSURE_SYMBOL, OIL_PRES_TEXT_LABEL,
-        OIL_PRESSURE_MIN, OIL_PRESSURE_MAX,
-        OIL_PRESSURE_ZONE_GREEN, OIL_PRESSURE_ZONE_ORANGE, OIL_PRESSURE_ZONE_RED
-    );
-
-    // Create oil temperature row (middle)
-    create_bar_gauge_row(
-        &oil_temp_bar, row2_y, OIL_TEMP_SYMBOL, OIL_TEMP_TEXT_LABEL,
-        OIL_TEMP_MIN, OIL_TEMP_MAX,
-        OIL_TEMP_ZONE_GREEN, OIL_TEMP_ZONE_ORANGE, OIL_TEMP_ZONE_RED
-    );
-
-    // Create water temperature row (bottom)
-    create_bar_gauge_row(
-        &water_temp_bar, row3_y, WATER_SYMBOL, WATER_TEXT_LABEL,
-        WATER_TEMP_MIN, WATER_TEMP_MAX,
-        WATER_TEMP_ZONE_GREEN, WATER_TEMP_ZONE_ORANGE, WATER_TEMP_ZONE_RED
-    );
+void multi_gauge_init(lv_obj_t *screen) {
+    create_rows(&multi, screen, row_channels, (uint8_t)ROW_COUNT);
+}
+
+void multi_gauge_deinit(void) {
+    release_rows(&multi);
 }
 
-void multi_gauge_set_values(int32_t water_temp, int32_t oil_temp, float oil_pressure, int32_t rpm) {
-    update_bar_gauge(&water_temp_bar, water_temp, "°C");
-    update_bar_gauge(&oil_temp_bar, oil_temp, "°C");
-    update_pressure_bar_gauge(&oil_pressure_bar, oil_pressure, rpm);
+void multi_gauge_set_models(const gauge_model_t *models) {
+    if (multi.row_count == 0) return;  // Screen not built
+
+    update_rows(&multi, models);
 }
 
+#if MULTI_GAUGE_BENCHMARK
+void multi_gauge_benchmark(uint32_t ticks, multi_gauge_bench_t *result) {
+    static const gauge_channel_t bench_channels[MULTI_GAUGE_MAX_ROWS] = {
+        GAUGE_CHANNEL_OIL_PRESSURE, GAUGE_CHANNEL_OIL_TEMP, GAUGE_CHANNEL_WATER_TEMP,
+        GAUGE_CHANNEL_RPM, GAUGE_CHANNEL_OIL_TEMP, GAUGE_CHANNEL_WATER_TEMP
+    };
+    static const uint8_t bench_rows[MULTI_GAUGE_BENCH_RUNS] = {3, MULTI_GAUGE_MAX_ROWS};
+
+    lv_obj_t *prev_screen = lv_scr_act();
+    gauge_stats_t stats;
+
+    for (int r = 0; r < MULTI_GAUGE_BENCH_RUNS; r++) {
+        lv_obj_t *screen = lv_obj_create(NULL);
+        lv_obj_set_style_bg_color(screen, COLOR_SCREEN_BG, 0);
+        lv_scr_load(screen);
+
+        multi_gauge_t bench;
+        memset(&bench, 0, sizeof(bench));
+        gauge_model_t models[GAUGE_CHANNEL_COUNT];
+        memset(models, 0, sizeof(models));
+        create_rows(&bench, screen, bench_channels, bench_rows[r]);
+        lv_refr_now(NULL);  // Also builds the readout atlases outside the timed loop
+        gauge_stats_get(&stats, true);
+
+        // Warm car at a steady cruise: the temperatures creep, pressure
+        // follows the engine and RPM changes on every tick
+        uint32_t start = lv_tick_get();
+        for (uint32_t t = 0; t < ticks; t++) {
+            const float values[GAUGE_CHANNEL_COUNT] = {
+                [GAUGE_CHANNEL_OIL_TEMP] = 95.0f + (float)t * 0.05f,
+                [GAUGE_CHANNEL_WATER_TEMP] = 88.0f + (float)(t % 40) * 0.02f,
+                [GAUGE_CHANNEL_OIL_PRESSURE] = 3.0f + (float)(t % 20) * 0.01f,
+                [GAUGE_CHANNEL_RPM] = 3000.0f + (float)(t % 50) * 10.0f,
+            };
+            gauge_model_update_all(gauge_channel_models(), values, models);
+            update_rows(&bench, models);
+            lv_refr_now(NULL);
+        }
+
+        if (result) {
+            multi_gauge_bench_run_t *run = &result->runs[r];
+            run->rows = bench_rows[r];
+            run->ticks = ticks;
+            run->update_ms = lv_tick_elaps(start);
+            run->rows_updated = bench.rows_updated;
+            run->lvgl_calls = bench.lvgl_calls;
+            gauge_stats_get(&stats, true);
+            run->flushed_bytes = stats.rendered_px * sizeof(lv_color_t);  // Needs gauge_stats_monitor_cb registered
+        }
+
+        release_rows(&bench);
+        lv_scr_load(prev_screen);
+        lv_obj_del(screen);
+    }
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,33 +7,73 @@ extern "C" {
 
 #include <stdint.h>
 #include "lvgl.h"
+#include "gauges_config.h"
+#include "gauge_model.h"
 
 /**
  * @brief Initialize the multi-gauge display
  *
- * Creates a screen showing three horizontal bar gauges:
- * - Water temperature
- * - Oil temperature
- * - Oil pressure
+ * Creates a screen of horizontal bar gauges, one row per channel of
+ * MULTI_GAUGE_ROWS (2 to 6, oil pressure, oil temperature and water
+ * temperature by default).
  *
- * Each gauge displays an icon, colored horizontal bar, and numeric value.
- * Should be called once during setup after LVGL is initialized.
+ * Each row displays an icon, colored horizontal bar, numeric value and unit.
+ * Range, caption and unit are set once here.
+ *
+ * @param screen Screen to build the gauge on
+ */
+void multi_gauge_init(lv_obj_t *screen);
+
+/**
+ * @brief Release the multi-gauge before its screen is deleted
  */
-void multi_gauge_init(void);
+void multi_gauge_deinit(void);
 
 /**
- * @brief Update all values in the multi-gauge display
+ * @brief Show the channel models in the multi-gauge display
  *
- * @param water_temp Water temperature in °C
- * @param oil_temp Oil temperature in °C
- * @param oil_pressure Oil pressure in bar
- * @param rpm Engine RPM (used for dynamic oil pressure thresholds)
+ * Only rows whose displayed value (at the channel's resolution) or zone
+ * changed are touched. The oil pressure zone includes the RPM-dependent
+ * minimum (gauge_model.h).
  *
- * Updates all three gauges with new values, including bar colors
- * and value displays. Oil pressure color thresholds are calculated
- * dynamically based on RPM.
+ * @param models One state per gauge_channel_t, from gauge_model_update_all()
+ */
+void multi_gauge_set_models(const gauge_model_t *models);
+
+#if MULTI_GAUGE_BENCHMARK
+#define MULTI_GAUGE_BENCH_RUNS 2
+
+/**
+ * @brief Results of one row count, totals over all ticks
  */
-void multi_gauge_set_values(int32_t water_temp, int32_t oil_temp, float oil_pressure, int32_t rpm);
+typedef struct {
+    uint32_t rows;
+    uint32_t ticks;
+    uint32_t update_ms;      // Update + refresh time
+    uint32_t rows_updated;   // Rows whose value or zone changed on screen
+    uint32_t lvgl_calls;     // Widget updates issued (bar target, readout, zone, marker)
+    uint32_t flushed_bytes;  // Pixel data flushed to the panel
+} multi_gauge_bench_run_t;
+
+typedef struct {
+    multi_gauge_bench_run_t runs[MULTI_GAUGE_BENCH_RUNS];  // 3 rows, 6 rows
+} multi_gauge_bench_t;
+
+/**
+ * @brief Measure the per-tick LVGL work of the multi gauge with 3 and 6 rows
+ *
+ * Shows a temporary screen per row count and feeds it `ticks` samples of a
+ * steady cruise (creeping temperatures, RPM changing on every tick), forcing
+ * a refresh (lv_refr_now) after each. Bars move on the motion timer, which
+ * does not run here. Flushed bytes come from gauge_stats_monitor_cb (zero if
+ * not registered); the stats frame counters are reset. Must be called with
+ * the LVGL lock held.
+ *
+ * @param ticks Samples per row count
+ * @param result Work counters, timings and flushed bytes
+ */
+void multi_gauge_benchmark(uint32_t ticks, multi_gauge_bench_t *result);
+#endif
 
 #ifdef __cplusplus
 }
@@ -3,8 +3,14 @@ extern "C" {
 #endif
 
 #include "needle_gauge_common.h"
-#include <stdio.h>
-#include <math.h>
+#include "gauge_alert.h"
+#include "gauge_common.h"
+#include "gauge_digits.h"
+#include "gauge_needle.h"
+#include "gauge_stats.h"
+#include "gauge_theme.h"
+#include "gauge_zones.h"
+#include <string.h>
 
 // Note: Custom fonts are already declared in gauge_common.c and gauges_config.h
 // We don't need to include them again here to avoid multiple definition errors
@@ -13,18 +19,105 @@ extern "C" {
 // ANIMATION CALLBACKS
 // ============================================================================
 
-void needle_gauge_set_value_anim(void *indic, int32_t value) {
-    lv_meter_set_indicator_value((lv_obj_t *)((void **)indic)[0],
-                                  (lv_meter_indicator_t *)((void **)indic)[1],
-                                  value);
+/**
+ * @brief Needle pivot, computed like lv_meter does for its scale
+ */
+static void needle_gauge_pivot(lv_obj_t *meter, lv_point_t *center, lv_coord_t *r_edge) {
+    lv_area_t content;
+    lv_obj_get_content_coords(meter, &content);
+    lv_coord_t r = LV_MIN(lv_area_get_width(&content), lv_area_get_height(&content)) / 2;
+    center->x = (lv_coord_t)(content.x1 + r);
+    center->y = (lv_coord_t)(content.y1 + r);
+    if (r_edge) *r_edge = r;
 }
 
-void needle_gauge_bg_blink_cb(void *obj, int32_t value) {
-    if (value == 0) {
-        lv_obj_set_style_bg_color((lv_obj_t *)obj, COLOR_BLACK, LV_PART_MAIN);
-    } else {
-        lv_obj_set_style_bg_color((lv_obj_t *)obj, COLOR_RED, LV_PART_MAIN);
+/**
+ * @brief Ends of the held value marker: across the major tick band at its angle
+ */
+static void needle_gauge_marker_points(needle_gauge_state_t *state, lv_point_t *p1, lv_point_t *p2) {
+    lv_point_t center;
+    lv_coord_t r_edge;
+    needle_gauge_pivot(state->meter, &center, &r_edge);
+
+    int32_t cos_a = lv_trigo_sin((int16_t)(state->marker_angle + 90));
+    int32_t sin_a = lv_trigo_sin((int16_t)state->marker_angle);
+    int32_t r_in = r_edge - NEEDLE_MAJOR_TICK_LENGTH;
+    p1->x = (lv_coord_t)(center.x + ((r_in * cos_a) >> LV_TRIGO_SHIFT));
+    p1->y = (lv_coord_t)(center.y + ((r_in * sin_a) >> LV_TRIGO_SHIFT));
+    p2->x = (lv_coord_t)(center.x + ((r_edge * cos_a) >> LV_TRIGO_SHIFT));
+    p2->y = (lv_coord_t)(center.y + ((r_edge * sin_a) >> LV_TRIGO_SHIFT));
+}
+
+static void needle_gauge_invalidate_marker(needle_gauge_state_t *state) {
+    lv_point_t p1, p2;
+    needle_gauge_marker_points(state, &p1, &p2);
+
+    // Line box, padded by the line width and one pixel of anti-aliasing
+    const lv_coord_t pad = GAUGE_PEAK_MARKER_WIDTH / 2 + 1;
+    lv_area_t area = {
+        (lv_coord_t)(LV_MIN(p1.x, p2.x) - pad), (lv_coord_t)(LV_MIN(p1.y, p2.y) - pad),
+        (lv_coord_t)(LV_MAX(p1.x, p2.x) + pad), (lv_coord_t)(LV_MAX(p1.y, p2.y) + pad)
+    };
+    lv_obj_invalidate_area(state->meter, &area);
+}
+
+static void needle_gauge_marker_event_cb(lv_event_t *e) {
+    needle_gauge_state_t *state = (needle_gauge_state_t *)lv_event_get_user_data(e);
+    if (!state->marker_shown || state->meter != lv_event_get_target(e)) return;
+
+    lv_point_t p1, p2;
+    needle_gauge_marker_points(state, &p1, &p2);
+
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = gauge_theme_color(GAUGE_COLOR_ACCENT);
+    line_dsc.width = GAUGE_PEAK_MARKER_WIDTH;
+    lv_draw_line(lv_event_get_draw_ctx(e), &line_dsc, &p1, &p2);
+}
+
+#if NEEDLE_SPRITES
+// Cleared by needle_gauge_benchmark() to time the needle line
+static bool needle_sprites_enabled = true;
+
+static void needle_gauge_invalidate_sprite(needle_gauge_state_t *state) {
+    lv_point_t center;
+    lv_area_t area;
+    needle_gauge_pivot(state->meter, &center, NULL);
+    gauge_needle_sprite_area(&center, state->needle_angle, &area);
+    lv_obj_invalidate_area(state->meter, &area);
+}
+
+static void needle_gauge_sprite_event_cb(lv_event_t *e) {
+    needle_gauge_state_t *state = (needle_gauge_state_t *)lv_event_get_user_data(e);
+    if (!state->needle_sprites || state->meter != lv_event_get_target(e)) return;
+
+    // Runs after the meter's own drawing and before its children (center knob)
+    lv_point_t center;
+    needle_gauge_pivot(state->meter, &center, NULL);
+    gauge_needle_sprite_draw(lv_event_get_draw_ctx(e), &center, state->needle_angle, state->needle_color);
+}
+#endif
+
+void needle_gauge_set_value_anim(void *state, int32_t value) {
+    needle_gauge_state_t *s = (needle_gauge_state_t *)state;
+
+#if NEEDLE_SPRITES
+    if (s->needle_sprites) {
+        // Same mapping as the meter needle, in sprite steps
+        const lv_meter_scale_t *scale = s->scale;
+        int32_t angle = lv_map(value, scale->min, scale->max, scale->rotation * NEEDLE_SPRITE_STEPS,
+                               (scale->rotation + scale->angle_range) * NEEDLE_SPRITE_STEPS);
+        if (angle == s->needle_angle) return;
+
+        // Old and new sprite boxes only
+        needle_gauge_invalidate_sprite(s);
+        s->needle_angle = angle;
+        needle_gauge_invalidate_sprite(s);
+        return;
     }
+#endif
+
+    lv_meter_set_indicator_value(s->meter, s->needle_indicator, value);
 }
 
 // ============================================================================
@@ -34,43 +127,25 @@ void needle_gauge_bg_blink_cb(void *obj, int32_t value) {
 void needle_gauge_start_blink(needle_gauge_state_t *state) {
     if (!state || !state->screen_bg) return;
 
-    lv_anim_init(&state->blink_anim);
-    lv_anim_set_var(&state->blink_anim, state->screen_bg);
-    lv_anim_set_values(&state->blink_anim, 0, 1);
-    lv_anim_set_time(&state->blink_anim, BLINK_ANIM_TIME);
-    lv_anim_set_playback_time(&state->blink_anim, BLINK_PLAYBACK_TIME);
-    lv_anim_set_repeat_count(&state->blink_anim, LV_ANIM_REPEAT_INFINITE);
-    lv_anim_set_exec_cb(&state->blink_anim, needle_gauge_bg_blink_cb);
-    lv_anim_set_path_cb(&state->blink_anim, lv_anim_path_step);
-    lv_anim_start(&state->blink_anim);
+    gauge_alert_start(state->screen_bg);
 }
 
 void needle_gauge_stop_blink(needle_gauge_state_t *state) {
     if (!state || !state->screen_bg) return;
 
-    lv_anim_del(state->screen_bg, NULL);
-    lv_obj_set_style_bg_color(state->screen_bg, COLOR_BLACK, LV_PART_MAIN);
+    gauge_alert_stop(state->screen_bg);
 }
 
 // ============================================================================
 // UI COMPONENT CREATION
 // ============================================================================
 
-lv_obj_t* needle_gauge_create_background(void) {
-    lv_obj_t *screen_bg = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(screen_bg, LV_PCT(100), LV_PCT(100));
-    lv_obj_set_style_bg_color(screen_bg, COLOR_BLACK, LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(screen_bg, LV_OPA_COVER, LV_PART_MAIN);
-    lv_obj_set_style_border_width(screen_bg, 0, LV_PART_MAIN);
-    lv_obj_move_background(screen_bg);
-    return screen_bg;
-}
-
-lv_obj_t* needle_gauge_create_meter(const needle_gauge_config_t *config, needle_gauge_state_t *state) {
-    // Create meter widget
-    lv_obj_t *meter = lv_meter_create(lv_scr_act());
+// Bare round meter shared by the full meter, the scale snapshot and the needle layer
+static lv_obj_t* needle_gauge_create_meter_base(lv_obj_t *parent) {
+    lv_obj_t *meter = lv_meter_create(parent);
     lv_obj_center(meter);
     lv_obj_set_size(meter, NEEDLE_METER_SIZE, NEEDLE_METER_SIZE);
+    lv_obj_clear_flag(meter, LV_OBJ_FLAG_CLICKABLE);  // Taps reach the screen (peak recall)
 
     // Dark theme styling
     lv_obj_set_style_bg_color(meter, COLOR_BLACK, 0);
@@ -78,9 +153,26 @@ lv_obj_t* needle_gauge_create_meter(const needle_gauge_config_t *config, needle_
     lv_obj_set_style_outline_width(meter, 0, 0);
     lv_obj_set_style_radius(meter, LV_RADIUS_CIRCLE, 0);
 
+    return meter;
+}
+
+// Full-range scale (no ticks) that the needle is positioned on
+static lv_meter_scale_t* needle_gauge_add_scale(lv_obj_t *meter, const needle_gauge_config_t *config) {
+    lv_meter_scale_t *scale = lv_meter_add_scale(meter);
+    lv_meter_set_scale_range(meter, scale,
+                             (int32_t)config->value_min,
+                             (int32_t)config->value_max,
+                             NEEDLE_ANGLE_RANGE,
+                             NEEDLE_ANGLE_START);
+    return scale;
+}
+
+// Static part of the gauge: minor/major ticks, labels and the red zone arc
+static lv_meter_indicator_t* needle_gauge_add_scale_marks(lv_obj_t *meter, lv_meter_scale_t *scale,
+                                                          const needle_gauge_config_t *config) {
     // Font style for labels (white for normal zone)
     lv_obj_set_style_text_font(meter, FONT_MARKERS, 0);
-    lv_obj_set_style_text_color(meter, COLOR_WHITE, 0);
+    gauge_theme_add_color(meter, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_SCALE, 0);
 
     // Calculate range and angles
     int32_t range = (int32_t)(config->value_max - config->value_min);
@@ -100,49 +192,121 @@ lv_obj_t* needle_gauge_create_meter(const needle_gauge_config_t *config, needle_
     // Calculate tick spacing for major ticks
     int32_t ticks_between_major = (minor_tick_count - 1) / (config->major_tick_count - 1);
 
-    // Main scale for needle - full range
-    lv_meter_scale_t *scale = lv_meter_add_scale(meter);
-    lv_meter_set_scale_range(meter, scale,
-                             (int32_t)config->value_min,
-                             (int32_t)config->value_max,
-                             NEEDLE_ANGLE_RANGE,
-                             NEEDLE_ANGLE_START);
-
     // Minor ticks (gray for normal zone, dark red for red zone)
     lv_meter_set_scale_ticks(meter, scale,
                             minor_tick_count,
                             NEEDLE_MINOR_TICK_WIDTH,
                             NEEDLE_MINOR_TICK_LENGTH,
-                            NEEDLE_MINOR_TICK_COLOR);
+                            gauge_theme_color(GAUGE_COLOR_MINOR_TICK));
 
     // Major ticks with labels (white)
     lv_meter_set_scale_major_ticks(meter, scale,
                                    ticks_between_major,
                                    NEEDLE_MAJOR_TICK_WIDTH,
                                    NEEDLE_MAJOR_TICK_LENGTH,
-                                   COLOR_WHITE,
+                                   gauge_theme_color(GAUGE_COLOR_SCALE),
                                    NEEDLE_MAJOR_TICK_LABEL_DIST);
 
     // Add a red arc in the background to indicate the red zone
     lv_meter_indicator_t *red_zone_arc = lv_meter_add_arc(
         meter, scale,
         NEEDLE_RED_ZONE_WIDTH,    // width
-        COLOR_RED,                // color
+        gauge_theme_color(GAUGE_COLOR_ALERT),  // color
         NEEDLE_RED_ZONE_OFFSET);  // negative offset to place behind ticks
     lv_meter_set_indicator_start_value(meter, red_zone_arc, (int32_t)config->zone_red);
     lv_meter_set_indicator_end_value(meter, red_zone_arc, (int32_t)config->value_max);
+    return red_zone_arc;
+}
+
+#if NEEDLE_SCALE_CACHE
+/**
+ * @brief Render the static meter once into an image and replace the meter with it
+ *
+ * On success the meter is deleted and an image showing the same pixels is
+ * created in its place. On failure (out of memory) the meter is left untouched.
+ *
+ * @return Image object, or NULL if the scale could not be cached
+ */
+static lv_obj_t* needle_gauge_cache_scale(lv_obj_t *meter, needle_gauge_state_t *state) {
+    lv_obj_update_layout(meter);
+
+    uint32_t size = lv_snapshot_buf_size_needed(meter, LV_IMG_CF_TRUE_COLOR);
+    void *buf = gauge_alloc_buffer(size);
+    if (!buf) return NULL;
+
+    if (lv_snapshot_take_to_buf(meter, LV_IMG_CF_TRUE_COLOR, &state->scale_dsc, buf, size) != LV_RES_OK) {
+        gauge_free_buffer(buf);
+        return NULL;
+    }
+    state->scale_buf = buf;
+    gauge_stats_add_scale_cache((int32_t)state->scale_dsc.data_size);
+
+    lv_obj_t *img = lv_img_create(lv_obj_get_parent(meter));
+    lv_img_set_src(img, &state->scale_dsc);
+    lv_obj_center(img);
+    gauge_theme_add_image(img);  // Dimmed at night without rendering the scale again
+
+    lv_obj_del(meter);
+    return img;
+}
+#endif
+
+lv_obj_t* needle_gauge_create_meter(lv_obj_t *parent, const needle_gauge_config_t *config, needle_gauge_state_t *state) {
+    // Create meter widget with the static scale
+    lv_obj_t *meter = needle_gauge_create_meter_base(parent);
+    lv_meter_scale_t *scale = needle_gauge_add_scale(meter, config);
+    state->red_zone_arc = needle_gauge_add_scale_marks(meter, scale, config);
+
+#if NEEDLE_SCALE_CACHE
+    // Ticks, labels and the red zone never change: draw them once into an
+    // image and keep only a transparent needle meter on top of it
+    state->scale_img = needle_gauge_cache_scale(meter, state);
+    if (state->scale_img) {
+        meter = needle_gauge_create_meter_base(parent);
+        lv_obj_set_style_bg_opa(meter, LV_OPA_TRANSP, 0);
+        scale = needle_gauge_add_scale(meter, config);
+        state->red_zone_arc = NULL;  // Part of the image now
+    }
+#endif
+
+    lv_meter_indicator_t *needle = NULL;
+    state->needle_sprites = false;
+
+    // Held value marker, drawn below a sprite needle (registered first)
+    state->marker_shown = false;
+    lv_obj_add_event_cb(meter, needle_gauge_marker_event_cb, LV_EVENT_DRAW_MAIN, state);
+
+#if NEEDLE_SPRITES
+    // Blend the needle from the shared sprites, sized like the meter needle
+    // line (scale edge + NEEDLE_OFFSET); keep the line if they are unavailable
+    if (needle_sprites_enabled) {
+        lv_point_t center;
+        lv_coord_t r_edge;
+        lv_obj_update_layout(meter);
+        needle_gauge_pivot(meter, &center, &r_edge);
+        if (gauge_needle_sprites_init((lv_coord_t)(r_edge + NEEDLE_OFFSET))) {
+            state->needle_sprites = true;
+            state->needle_angle = scale->rotation * NEEDLE_SPRITE_STEPS;
+            state->needle_color = gauge_theme_color(GAUGE_COLOR_ACCENT);
+            lv_obj_add_event_cb(meter, needle_gauge_sprite_event_cb, LV_EVENT_DRAW_MAIN, state);
+        }
+    }
+#endif
 
     // Add needle indicator on the full-range scale
-    lv_meter_indicator_t *needle = lv_meter_add_needle_line(
-        meter, scale,
-        NEEDLE_WIDTH,           // width
-        COLOR_AMBER,            // color
-        NEEDLE_OFFSET           // offset to reach end of scale
-    );
+    if (!state->needle_sprites) {
+        needle = lv_meter_add_needle_line(
+            meter, scale,
+            NEEDLE_WIDTH,           // width
+            gauge_theme_color(GAUGE_COLOR_ACCENT),  // color
+            NEEDLE_OFFSET           // offset to reach end of scale
+        );
+    }
 
     // Create center knob decoration
     lv_obj_t *center_knob = lv_obj_create(meter);
     lv_obj_set_size(center_knob, NEEDLE_CENTER_SIZE, NEEDLE_CENTER_SIZE);
+    lv_obj_clear_flag(center_knob, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_center(center_knob);
     lv_obj_set_style_bg_color(center_knob, NEEDLE_CENTER_BG_COLOR, 0);
     lv_obj_set_style_radius(center_knob, LV_RADIUS_CIRCLE, 0);
@@ -153,178 +317,175 @@ lv_obj_t* needle_gauge_create_meter(const needle_gauge_config_t *config, needle_
     state->meter = meter;
     state->scale = scale;  // Use full-range scale for needle
     state->needle_indicator = needle;
+    gauge_model_reset(&state->shown);  // Force the first update to apply everything, zone color included
+    state->theme = gauge_theme_get();
 
-    // Set initial value
-    lv_meter_set_indicator_value(meter, needle, (int32_t)config->value_min);
+    // Set initial value and hand the needle to the motion engine
+    gauge_motion_attach(&state->needle_motion, needle_gauge_set_value_anim,
+                        state, (int32_t)config->value_min);
 
     return meter;
 }
 
-lv_obj_t* needle_gauge_create_value_label(const needle_gauge_config_t *config) {
-    // Create value label (just the number, no unit)
-    static lv_style_t style_value;
-    lv_style_init(&style_value);
-    lv_style_set_text_font(&style_value, FONT_NEEDLE_VALUE);
-    lv_style_set_text_color(&style_value, COLOR_AMBER);
+// ============================================================================
+// TEARDOWN
+// ============================================================================
 
-    lv_obj_t *value_label = lv_label_create(lv_scr_act());
+void needle_gauge_release(needle_gauge_state_t *state) {
+    if (!state) return;
 
-    // Initialize with placeholder number only
-    if (config->decimal_places > 0) {
-        lv_label_set_text(value_label, "0.0");
-    } else {
-        lv_label_set_text(value_label, "0");
-    }
-
-    lv_obj_add_style(value_label, &style_value, 0);
+    if (state->screen_bg) gauge_alert_stop(state->screen_bg);
+    gauge_motion_detach(&state->needle_motion);
 
-    // Position in bottom right area, closer to center
-    lv_obj_align(value_label, LV_ALIGN_CENTER,
-                NEEDLE_VALUE_LABEL_X_OFFSET,
-                NEEDLE_VALUE_LABEL_Y_OFFSET);
+#if NEEDLE_SCALE_CACHE
+    if (state->scale_buf) {
+        // The image cache may still reference the descriptor
+        lv_img_cache_invalidate_src(&state->scale_dsc);
+        gauge_free_buffer(state->scale_buf);
+        gauge_stats_add_scale_cache(-(int32_t)state->scale_dsc.data_size);
+    }
+#endif
 
-    return value_label;
+    memset(state, 0, sizeof(*state));
 }
 
-lv_obj_t* needle_gauge_create_unit_label(const needle_gauge_config_t *config) {
-    // Create unit label with smaller font
-    static lv_style_t style_unit;
-    lv_style_init(&style_unit);
-    lv_style_set_text_font(&style_unit, FONT_MARKERS);  // Smaller font for unit
-    lv_style_set_text_color(&style_unit, COLOR_AMBER);
-
-    lv_obj_t *unit_label = lv_label_create(lv_scr_act());
+// ============================================================================
+// NEEDLE GAUGE UPDATE
+// ============================================================================
 
-    // Set unit text
-    if (config->unit_text) {
-        lv_label_set_text(unit_label, config->unit_text);
-    } else {
-        lv_label_set_text(unit_label, "");
+void needle_gauge_apply_model(needle_gauge_state_t *state, const gauge_model_t *model) {
+    if (!state || !state->meter || (!state->needle_indicator && !state->needle_sprites)) return;
+
+    // Ticks and the red zone arc are meter data, not styles: recolor them once
+    // after a theme change (the theme has already invalidated the screen)
+    if (state->theme != gauge_theme_get()) {
+        state->theme = gauge_theme_get();
+        state->shown.zone = GAUGE_ZONE_COUNT;  // Recolor the needle below
+        if (!state->scale_img) {
+            state->scale->tick_color = gauge_theme_color(GAUGE_COLOR_MINOR_TICK);
+            state->scale->tick_major_color = gauge_theme_color(GAUGE_COLOR_SCALE);
+        }
+        if (state->red_zone_arc) {
+            state->red_zone_arc->type_data.arc.color = gauge_theme_color(GAUGE_COLOR_ALERT);
+        }
+        lv_obj_invalidate(state->meter);  // Merged with the theme's screen invalidation
     }
 
-    lv_obj_add_style(unit_label, &style_unit, 0);
+    uint8_t changes = gauge_model_sync(&state->shown, model);
 
-    // Position next to value label (will be adjusted after value is set)
-    lv_obj_align(unit_label, LV_ALIGN_CENTER,
-                NEEDLE_UNIT_LABEL_X_OFFSET,
-                NEEDLE_UNIT_LABEL_Y_OFFSET);
+    // Move needle towards new clamped value on the shared motion timer
+    if (changes & GAUGE_MODEL_POSITION) {
+        gauge_motion_set_target(&state->needle_motion, model->position / gauge_value_scale(model->decimals));
+    }
 
-    return unit_label;
-}
+    // Recolor the needle only when the zone changes. The color lives on the
+    // indicator itself, so no style change (and no full-meter redraw) is needed;
+    // re-setting the current value invalidates just the needle bounding box.
+    if (changes & GAUGE_MODEL_ZONE) {
+        if (state->needle_indicator) {
+            state->needle_indicator->type_data.needle_line.color = gauge_zone_color((gauge_zone_t)model->zone);
+            lv_meter_set_indicator_value(state->meter, state->needle_indicator,
+                                         state->needle_indicator->end_value);
+        }
+#if NEEDLE_SPRITES
+        else {
+            state->needle_color = gauge_zone_color((gauge_zone_t)model->zone);
+            needle_gauge_invalidate_sprite(state);
+        }
+#endif
+    }
 
-lv_obj_t* needle_gauge_create_icon_label(const needle_gauge_config_t *config) {
-    // Create icon/text label centered above gauge
-    static lv_style_t style_icon;
-    lv_style_init(&style_icon);
-    lv_style_set_text_color(&style_icon, COLOR_AMBER);
-
-    lv_obj_t *icon_label = lv_label_create(lv_scr_act());
-
-    #if USE_CUSTOM_ICON_FONT
-        // Use Font Awesome icon symbol
-        lv_style_set_text_font(&style_icon, FONT_ICON);
-        lv_label_set_text(icon_label, config->icon_symbol);
-    #else
-        // Use text fallback with smaller font
-        lv_style_set_text_font(&style_icon, FONT_MARKERS);
-        if (config->icon_symbol == OIL_TEMP_SYMBOL) {
-            lv_label_set_text(icon_label, OIL_TEMP_TEXT_LABEL);
-        } else if (config->icon_symbol == OIL_PRESSURE_SYMBOL) {
-            lv_label_set_text(icon_label, OIL_PRES_TEXT_LABEL);
-        } else if (config->icon_symbol == WATER_SYMBOL) {
-            lv_label_set_text(icon_label, WATER_TEXT_LABEL);
+    if (changes & GAUGE_MODEL_ALERT) {
+        if (model->alert) {
+            needle_gauge_start_blink(state);
         } else {
-            lv_label_set_text(icon_label, "---");
+            needle_gauge_stop_blink(state);
         }
-    #endif
-
-    lv_obj_add_style(icon_label, &style_icon, 0);
+    }
 
-    // Position at top of meter gauge
-    int padding_offset_value = (int)15 / NEEDLE_ICON_PADDING_DIVISOR;
-    lv_obj_align(icon_label, LV_ALIGN_CENTER,
-                padding_offset_value,
-                NEEDLE_ICON_Y_OFFSET);
+    // Value label with the actual value (not clamped) - number only, no unit
+    if ((changes & GAUGE_MODEL_TEXT) && state->value_label) {
+        gauge_digits_set_text(state->value_label, model->text);
+    }
+}
 
-    return icon_label;
+void needle_gauge_set_marker(needle_gauge_state_t *state, bool show, float value) {
+    if (!state || !state->meter || !state->scale) return;
+
+    // Clamp to the scale, then map like the needle (in float: the pressure
+    // scale has whole-bar units)
+    const lv_meter_scale_t *scale = state->scale;
+    if (value < (float)scale->min) value = (float)scale->min;
+    if (value > (float)scale->max) value = (float)scale->max;
+    int16_t angle = (int16_t)(scale->rotation + (int32_t)(((value - (float)scale->min) * scale->angle_range) /
+                                                          (float)(scale->max - scale->min)));
+    if (show == state->marker_shown && (!show || angle == state->marker_angle)) return;
+
+    // Old and new marker boxes only
+    if (state->marker_shown) needle_gauge_invalidate_marker(state);
+    state->marker_shown = show;
+    state->marker_angle = angle;
+    if (show) needle_gauge_invalidate_marker(state);
 }
 
 // ============================================================================
-// NEEDLE GAUGE UPDATE
+// BENCHMARK
 // ============================================================================
 
-void needle_gauge_update_value(needle_gauge_state_t *state, const needle_gauge_config_t *config, float value) {
-    if (!state || !state->meter || !state->needle_indicator) return;
-
-    // Store actual raw value (not clamped)
-    float actual_value = value;
-
-    // Store current value for animation
-    float old_value = state->current_value;
-    state->current_value = value;
-
-    // Clamp value to range ONLY for needle display
-    float clamped_value = value;
-    if (clamped_value < config->value_min) clamped_value = config->value_min;
-    if (clamped_value > config->value_max) clamped_value = config->value_max;
-
-    // Animate needle to new clamped value
-    lv_anim_t a;
-    lv_anim_init(&a);
-
-    // Store both meter and indicator in an array for the animation callback
-    static void *anim_vars[2];
-    anim_vars[0] = state->meter;
-    anim_vars[1] = state->needle_indicator;
-
-    // Clamp old value for animation as well
-    float old_clamped = old_value;
-    if (old_clamped < config->value_min) old_clamped = config->value_min;
-    if (old_clamped > config->value_max) old_clamped = config->value_max;
-
-    lv_anim_set_var(&a, anim_vars);
-    lv_anim_set_values(&a, (int32_t)old_clamped, (int32_t)clamped_value);
-    lv_anim_set_time(&a, GAUGE_ANIM_TIME);
-    lv_anim_set_exec_cb(&a, needle_gauge_set_value_anim);
-    lv_anim_set_path_cb(&a, lv_anim_path_linear);
-    lv_anim_start(&a);
-
-    // Update needle color based on ACTUAL value zones (not clamped)
-    lv_color_t needle_color;
-    if (actual_value < config->zone_green) {
-        needle_color = COLOR_GREY;
-    } else if (actual_value < config->zone_orange) {
-        needle_color = COLOR_GREEN;
-    } else if (actual_value < config->zone_red) {
-        needle_color = COLOR_AMBER;
-    } else {
-        needle_color = COLOR_RED;
-    }
-
-    // Update needle color
-    lv_obj_set_style_line_color(state->meter, needle_color, LV_PART_ITEMS);
+#if NEEDLE_BENCHMARK
+void needle_gauge_benchmark(uint32_t iterations, needle_gauge_bench_t *result) {
+    lv_obj_t *prev_screen = lv_scr_act();
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, COLOR_SCREEN_BG, 0);
+    lv_scr_load(screen);
+
+    static const needle_gauge_config_t bench_config = {
+        .value_min = 0, .value_max = 100,
+        .zone_red = 75,
+        .major_tick_count = 11,
+        .unit_text = "",
+        .decimal_places = 0
+    };
+
+    // Run 0 draws the meter needle line, run 1 the sprites
+    uint32_t time_ms[2];
+    for (int run = 0; run < 2; run++) {
+#if NEEDLE_SPRITES
+        needle_sprites_enabled = (run == 1);
+#endif
+        static needle_gauge_state_t state;
+        memset(&state, 0, sizeof(state));
+        lv_obj_t *layer = lv_obj_create(screen);
+        lv_obj_remove_style_all(layer);
+        lv_obj_set_size(layer, LV_PCT(100), LV_PCT(100));
+        needle_gauge_create_meter(layer, &bench_config, &state);
+        lv_refr_now(NULL);  // Also builds the sprites outside the timed loop
+
+        // Sweep up and down the scale in 1-unit steps (2.7 degrees)
+        uint32_t start = lv_tick_get();
+        for (uint32_t i = 0; i < iterations; i++) {
+            int32_t step = (int32_t)(i % 200);
+            needle_gauge_set_value_anim(&state, step < 100 ? step : 200 - step);
+            lv_refr_now(NULL);
+        }
+        time_ms[run] = lv_tick_elaps(start);
 
-    // Handle alert animation based on ACTUAL value (not clamped)
-    if (actual_value >= config->alert_threshold && !state->is_blinking) {
-        needle_gauge_start_blink(state);
-        state->is_blinking = true;
-    } else if (actual_value < config->alert_threshold && state->is_blinking) {
-        needle_gauge_stop_blink(state);
-        state->is_blinking = false;
+        needle_gauge_release(&state);
+        lv_obj_del(layer);
     }
+#if NEEDLE_SPRITES
+    needle_sprites_enabled = true;
+#endif
 
-    // Update value label with ACTUAL value (not clamped) - number only, no unit
-    if (state->value_label) {
-        char text[32];
-        if (config->decimal_places > 0) {
-            snprintf(text, sizeof(text), "%.*f",
-                    config->decimal_places, actual_value);
-        } else {
-            snprintf(text, sizeof(text), "%d", (int)actual_value);
-        }
-        lv_label_set_text(state->value_label, text);
+    if (result) {
+        result->line_ms = time_ms[0];
+        result->sprite_ms = time_ms[1];
     }
+
+    lv_scr_load(prev_screen);
+    lv_obj_del(screen);
 }
+#endif
 
 #ifdef __cplusplus
 }
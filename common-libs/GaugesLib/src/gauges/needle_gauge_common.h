@@ -8,6 +8,8 @@ extern "C" {
 #include <stdint.h>
 #include "lvgl.h"
 #include "gauges_config.h"
+#include "gauge_motion.h"
+#include "gauge_model.h"
 
 // ============================================================================
 // NEEDLE GAUGE CONTEXT STRUCTURE
@@ -23,14 +25,9 @@ typedef struct {
     float value_min;
     float value_max;
 
-    // Color zones (for needle color)
-    float zone_green;
-    float zone_orange;
+    // Start of the red zone arc (the needle color follows gauge_model_t)
     float zone_red;
 
-    // Alert configuration
-    float alert_threshold;
-
     // Display configuration
     int32_t major_tick_count;  // Number of major ticks with labels
     const char *icon_symbol;
@@ -47,13 +44,27 @@ typedef struct {
     lv_obj_t *screen_bg;
     lv_obj_t *meter;
     lv_meter_scale_t *scale;
-    lv_meter_indicator_t *needle_indicator;
-    lv_obj_t *value_label;
-    lv_obj_t *unit_label;
+    lv_meter_indicator_t *needle_indicator;  // NULL when the needle is drawn from sprites
+    lv_obj_t *value_label;      // Numeric readout (gauge_digits)
     lv_obj_t *icon_label;
-    lv_anim_t blink_anim;
-    bool is_blinking;
-    float current_value;
+    gauge_motion_t needle_motion;  // Drives the needle value (see gauge_motion.h)
+    gauge_model_t shown;           // Model state on screen, zone = needle color (gauge_model_sync())
+    uint8_t theme;                 // Theme the meter colors were set for (gauge_theme_t)
+    lv_meter_indicator_t *red_zone_arc;  // NULL when drawn into the cached scale
+
+    // Held value marker (gauge_peaks.h)
+    bool marker_shown;
+    int16_t marker_angle;          // Scale angle of the marker (degrees, LVGL orientation)
+
+    // Pre-rotated needle sprites (NEEDLE_SPRITES)
+    bool needle_sprites;           // Needle drawn from the sprite cache instead of a needle line
+    int32_t needle_angle;          // Current sprite angle (gauge_needle.h steps)
+    lv_color_t needle_color;
+
+    // Static scale cache (NEEDLE_SCALE_CACHE)
+    lv_obj_t *scale_img;           // Image showing the pre-rendered scale, NULL if not cached
+    lv_img_dsc_t scale_dsc;        // Descriptor of the pre-rendered scale
+    void *scale_buf;               // Pixel buffer (PSRAM when available)
 } needle_gauge_state_t;
 
 // ============================================================================
@@ -61,26 +72,23 @@ typedef struct {
 // ============================================================================
 
 /**
- * @brief Animation callback for needle value changes
- */
-void needle_gauge_set_value_anim(void *indic, int32_t value);
-
-/**
- * @brief Animation callback for background blink effect
+ * @brief Motion apply callback for needle value changes
+ *
+ * Pass to gauge_motion_attach() with the needle gauge state as context.
  */
-void needle_gauge_bg_blink_cb(void *obj, int32_t value);
+void needle_gauge_set_value_anim(void *state, int32_t value);
 
 // ============================================================================
 // ANIMATION CONTROL
 // ============================================================================
 
 /**
- * @brief Start the alert blink animation
+ * @brief Start the alert blink (gauge_alert.h, shared timer and style)
  */
 void needle_gauge_start_blink(needle_gauge_state_t *state);
 
 /**
- * @brief Stop the alert blink animation
+ * @brief Stop the alert blink and restore the screen
  */
 void needle_gauge_stop_blink(needle_gauge_state_t *state);
 
@@ -88,51 +96,90 @@ void needle_gauge_stop_blink(needle_gauge_state_t *state);
 // UI COMPONENT CREATION
 // ============================================================================
 
-/**
- * @brief Create the needle gauge background
- */
-lv_obj_t* needle_gauge_create_background(void);
-
 /**
  * @brief Create the meter gauge with needle
+ *
+ * Also attaches the needle to the motion engine. With NEEDLE_SCALE_CACHE the
+ * ticks, labels and red zone are rendered once into an image and the returned
+ * meter only draws the needle. With NEEDLE_SPRITES the needle is blended from
+ * the shared sprite cache instead of an lv_meter needle line.
+ *
+ * @param parent Scale layer the gauge is built on
  * @param config Gauge configuration
  * @param state Gauge state (will be populated)
  * @return Meter object
  */
-lv_obj_t* needle_gauge_create_meter(const needle_gauge_config_t *config, needle_gauge_state_t *state);
+lv_obj_t* needle_gauge_create_meter(lv_obj_t *parent, const needle_gauge_config_t *config, needle_gauge_state_t *state);
+
+// ============================================================================
+// TEARDOWN
+// ============================================================================
 
 /**
- * @brief Create the value display label (number only)
- * @param config Gauge configuration
- * @return Value label object
+ * @brief Release a needle gauge before its screen is deleted
+ *
+ * Stops the alert blink, detaches the needle from the motion engine,
+ * frees the cached scale image and clears the state. The widgets themselves
+ * are deleted with their screen.
+ *
+ * @param state Gauge state
  */
-lv_obj_t* needle_gauge_create_value_label(const needle_gauge_config_t *config);
+void needle_gauge_release(needle_gauge_state_t *state);
+
+// ============================================================================
+// NEEDLE GAUGE UPDATE
+// ============================================================================
 
 /**
- * @brief Create the unit label (smaller font)
- * @param config Gauge configuration (for unit text)
- * @return Unit label object
+ * @brief Show an evaluated value (gauge_model.h): LVGL calls for the changed parts only
+ *
+ * Only the needle (old and new bounding boxes) and the value label are
+ * invalidated; the needle color is rewritten only when the zone changes.
+ * The needle moves in whole units of the configuration (position / 10^decimals).
+ *
+ * @param state Gauge state
+ * @param model Value evaluated for the channel of this gauge
  */
-lv_obj_t* needle_gauge_create_unit_label(const needle_gauge_config_t *config);
+void needle_gauge_apply_model(needle_gauge_state_t *state, const gauge_model_t *model);
 
 /**
- * @brief Create the icon/text label centered above gauge
- * @param config Gauge configuration (for icon symbol)
- * @return Icon label object
+ * @brief Show a held value (peak / minimum) as a short line across the major ticks
+ *
+ * Drawn in the accent color by the meter. Invalidates the old and new marker
+ * boxes only when the marker moves to another degree or is shown / hidden.
+ *
+ * @param state Needle gauge state
+ * @param show false hides the marker
+ * @param value Marker value, in the units of the gauge configuration
  */
-lv_obj_t* needle_gauge_create_icon_label(const needle_gauge_config_t *config);
+void needle_gauge_set_marker(needle_gauge_state_t *state, bool show, float value);
 
 // ============================================================================
-// NEEDLE GAUGE UPDATE
+// BENCHMARK
 // ============================================================================
 
+#if NEEDLE_BENCHMARK
 /**
- * @brief Update needle gauge value with animation and color changes
- * @param state Gauge state
- * @param config Gauge configuration
- * @param value New value
+ * @brief Benchmark results, totals over all iterations
  */
-void needle_gauge_update_value(needle_gauge_state_t *state, const needle_gauge_config_t *config, float value);
+typedef struct {
+    uint32_t line_ms;        // lv_meter needle line: move + refresh time
+    uint32_t sprite_ms;      // Needle sprites: move + refresh time
+} needle_gauge_bench_t;
+
+/**
+ * @brief Compare per-move cost of the meter needle line and the sprites
+ *
+ * Builds a temporary needle gauge each way and moves the needle across the
+ * scale, forcing a refresh (lv_refr_now) `iterations` times. With
+ * NEEDLE_SPRITES 0 both runs use the needle line. Must be called with the
+ * LVGL lock held.
+ *
+ * @param iterations Needle moves per renderer
+ * @param result Timings
+ */
+void needle_gauge_benchmark(uint32_t iterations, needle_gauge_bench_t *result);
+#endif
 
 #ifdef __cplusplus
 }
@@ -3,127 +3,74 @@ extern "C" {
 #endif
 
 #include "oil_pressure_gauge.h"
-#include "gauge_common.h"
-#include <stdio.h>
+#include "dual_gauge.h"
 
 // ============================================================================
 // PRIVATE STATE
 // ============================================================================
 
-static gauge_state_t pressure_gauge_state = {0};
+static dual_gauge_t pressure_gauge = {0};
 
 // Scale factor: multiply bar values by 10 for better arc resolution
-// This means 0-8 bar becomes 0-80 internal units
+// This means 0-8 bar becomes 0-80 internal units (the channel's fixed point, 1 decimal)
 #define PRESSURE_SCALE 10
 
 static const gauge_config_t pressure_gauge_config = {
     .temp_min = (int32_t)(OIL_PRESSURE_MIN * PRESSURE_SCALE),
     .temp_max = (int32_t)(OIL_PRESSURE_MAX * PRESSURE_SCALE),
-    .zone_green = (int32_t)(OIL_PRESSURE_ZONE_GREEN * PRESSURE_SCALE),
+    // Green from the bottom of the scale: low pressure depends on the RPM and
+    // turns the whole arc red instead (gauge_arc_set_alert)
+    .zone_green = (int32_t)(OIL_PRESSURE_MIN * PRESSURE_SCALE),
     .zone_orange = (int32_t)(OIL_PRESSURE_ZONE_ORANGE * PRESSURE_SCALE),
     .zone_red = (int32_t)(OIL_PRESSURE_ZONE_RED * PRESSURE_SCALE),
     .redline = (int32_t)(OIL_PRESSURE_REDLINE * PRESSURE_SCALE),
-    .alert_threshold = (int32_t)(OIL_PRESSURE_ALERT_HIGH * PRESSURE_SCALE),  // High alert
     .marker_interval = 10,  // Markers every 1 bar (10 internal units)
     .icon_symbol = OIL_PRESSURE_SYMBOL,
     .value_scale = PRESSURE_SCALE  // Scale factor for display values
 };
 
-// Store current RPM for dynamic threshold calculation
-static int32_t current_rpm = 0;
+static const needle_gauge_config_t pressure_needle_config = {
+    .value_min = OIL_PRESSURE_MIN,
+    .value_max = OIL_PRESSURE_MAX,
+    .zone_red = OIL_PRESSURE_ZONE_RED,
+    .major_tick_count = 9,  // 0, 1, 2, 3, 4, 5, 6, 7, 8
+    .icon_symbol = OIL_PRESSURE_SYMBOL,
+    .unit_text = "bar",
+    .decimal_places = 1  // Show one decimal place for pressure
+};
+
+static const dual_gauge_config_t pressure_config = {
+    .racing = &pressure_gauge_config,
+    .normal = &pressure_needle_config
+};
+
+static gauge_model_t last_model;  // Re-applied after a mode change
 
 // ============================================================================
-// PRIVATE FUNCTIONS
+// PUBLIC API IMPLEMENTATION
 // ============================================================================
 
-/**
- * @brief Calculate minimum safe oil pressure based on RPM
- * (Same formula as multi-gauge)
- */
-static float calculate_min_oil_pressure(int32_t rpm) {
-    float min_pressure = (float)rpm / 2000.0f;
-    if (min_pressure < 0.5f) {
-        min_pressure = 0.5f;
-    }
-    return min_pressure;
+void oil_pressure_gauge_init(lv_obj_t *screen, uint8_t mode) {
+    dual_gauge_create(&pressure_gauge, &pressure_config, screen, mode);
 }
 
-/**
- * @brief Update pressure gauge with custom logic for RPM-dependent thresholds
- */
-static void oil_pressure_gauge_update_custom(float pressure, int32_t rpm) {
-    if (!pressure_gauge_state.arc || !pressure_gauge_state.label) return;
-
-    // Convert pressure to internal scaled value
-    int32_t scaled_pressure = (int32_t)(pressure * PRESSURE_SCALE);
-
-    // Animate arc to new value
-    lv_anim_t a;
-    lv_anim_init(&a);
-    lv_anim_set_var(&a, pressure_gauge_state.arc);
-    lv_anim_set_values(&a, lv_arc_get_value(pressure_gauge_state.arc), scaled_pressure);
-    lv_anim_set_time(&a, GAUGE_ANIM_TIME);
-    lv_anim_set_exec_cb(&a, gauge_arc_anim_cb);
-    lv_anim_set_path_cb(&a, lv_anim_path_linear);
-    lv_anim_start(&a);
-
-    // Calculate dynamic minimum safe pressure
-    float min_safe_pressure = calculate_min_oil_pressure(rpm);
-
-    // Set color based on pressure zones with RPM-dependent low threshold
-    if (pressure < min_safe_pressure) {
-        // Too low for current RPM - RED
-        lv_obj_set_style_arc_color(pressure_gauge_state.arc, COLOR_RED, LV_PART_INDICATOR);
-    } else if (pressure >= OIL_PRESSURE_ZONE_RED) {
-        // Too high - RED
-        lv_obj_set_style_arc_color(pressure_gauge_state.arc, COLOR_RED, LV_PART_INDICATOR);
-    } else if (pressure >= OIL_PRESSURE_ZONE_ORANGE) {
-        // Getting high - AMBER
-        lv_obj_set_style_arc_color(pressure_gauge_state.arc, COLOR_AMBER, LV_PART_INDICATOR);
-    } else {
-        // Good range - GREEN
-        lv_obj_set_style_arc_color(pressure_gauge_state.arc, COLOR_GREEN, LV_PART_INDICATOR);
+void oil_pressure_gauge_set_mode(uint8_t mode) {
+    if (dual_gauge_set_mode(&pressure_gauge, &pressure_config, mode)) {
+        dual_gauge_apply_model(&pressure_gauge, &last_model);
     }
-
-    // Handle alert animation (both too low and too high are dangerous)
-    bool should_alert = (pressure < min_safe_pressure) || (pressure >= OIL_PRESSURE_ALERT_HIGH);
-
-    if (should_alert && !pressure_gauge_state.is_blinking) {
-        gauge_start_blink(&pressure_gauge_state);
-        pressure_gauge_state.is_blinking = true;
-    } else if (!should_alert && pressure_gauge_state.is_blinking) {
-        gauge_stop_blink(&pressure_gauge_state);
-        pressure_gauge_state.is_blinking = false;
-    }
-
-    // Update digital display with one decimal place
-    static char pressure_text[16];
-    int whole = (int)pressure;
-    int decimal = (int)((pressure - whole) * 10);
-    snprintf(pressure_text, sizeof(pressure_text), "%d.%d", whole, decimal);
-    lv_label_set_text(pressure_gauge_state.label, pressure_text);
 }
 
-// ============================================================================
-// PUBLIC API IMPLEMENTATION
-// ============================================================================
-
-void oil_pressure_gauge_init(void) {
-    // Initialize state
-    pressure_gauge_state.is_blinking = false;
-
-    // Create UI components using common utilities
-    pressure_gauge_state.screen_bg = gauge_create_background();
-    pressure_gauge_state.arc = gauge_create_arc(&pressure_gauge_config);
-    gauge_create_border_and_markers(&pressure_gauge_config);
-    gauge_create_redline(&pressure_gauge_config);
-    pressure_gauge_state.label = gauge_create_digital_display();
-    pressure_gauge_state.icon = gauge_create_icon(pressure_gauge_config.icon_symbol);
+void oil_pressure_gauge_deinit(void) {
+    dual_gauge_release(&pressure_gauge);
 }
 
-void oil_pressure_gauge_set_value(float pressure, int32_t rpm) {
-    current_rpm = rpm;
-    oil_pressure_gauge_update_custom(pressure, rpm);
+void oil_pressure_gauge_set_model(const gauge_model_t *model) {
+    last_model = *model;
+
+    // Both faces show the RPM-dependent minimum: a red fill on the arc, the
+    // red zone color on the needle, and the alert blink
+    dual_gauge_apply_model(&pressure_gauge, model);
+    dual_gauge_show_peak(&pressure_gauge, &pressure_config, GAUGE_PEAK_OIL_PRESSURE);
 }
 
 #ifdef __cplusplus
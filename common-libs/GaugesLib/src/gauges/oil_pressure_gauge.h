@@ -7,33 +7,49 @@ extern "C" {
 
 #include <stdint.h>
 #include "lvgl.h"
+#include "gauge_model.h"
 
 /**
  * @brief Initialize the oil pressure gauge display
  *
- * Creates all UI components for the oil pressure gauge including:
- * - Background screen
- * - Pressure arc with color zones
- * - Border and markers
- * - Redline indicator
- * - Digital pressure display
- * - Oil icon
+ * @param screen Screen to build the gauge on
+ * @param mode Initial display mode (GAUGE_MODE_NORMAL or GAUGE_MODE_RACING)
+ *
+ * Creates the widgets shared by both modes (background, digital pressure
+ * display, unit, icon) and the scale layer of the requested mode:
+ * - Racing: pressure arc with color zones, border and markers, redline
+ * - Normal: meter scale with zone-colored needle
+ */
+void oil_pressure_gauge_init(lv_obj_t *screen, uint8_t mode);
+
+/**
+ * @brief Switch the gauge between normal (needle) and racing (arc) mode
+ *
+ * Only the scale layer is rebuilt; the shared widgets are restyled in place
+ * and the last value is re-applied. Does nothing if the mode is unchanged.
+ *
+ * @param mode GAUGE_MODE_NORMAL or GAUGE_MODE_RACING
+ */
+void oil_pressure_gauge_set_mode(uint8_t mode);
+
+/**
+ * @brief Release the oil pressure gauge before its screen is deleted
  */
-void oil_pressure_gauge_init(void);
+void oil_pressure_gauge_deinit(void);
 
 /**
- * @brief Update the oil pressure gauge value
+ * @brief Show the pressure evaluated for GAUGE_CHANNEL_OIL_PRESSURE
  *
- * @param pressure Pressure value in bar (0-8 bar)
- * @param rpm Engine RPM (used for dynamic minimum threshold)
+ * @param model State from gauge_model_update() with the channel configuration
+ *              and the current RPM (dynamic minimum threshold)
  *
- * Updates the gauge display with the new pressure value, including:
- * - Arc indicator position (animated)
- * - Color based on pressure zones and RPM (grey/green/orange/red)
+ * Applies only what changed since the last call:
+ * - Arc or needle position (animated)
+ * - Color based on pressure zones and RPM (green/orange/red)
  * - Digital pressure readout
  * - Alert animation if pressure is too low or too high
  */
-void oil_pressure_gauge_set_value(float pressure, int32_t rpm);
+void oil_pressure_gauge_set_model(const gauge_model_t *model);
 
 #ifdef __cplusplus
 }
@@ -3,13 +3,14 @@ extern "C" {
 #endif
 
 #include "oil_temp_gauge.h"
-#include "gauge_common.h"
+#include "dual_gauge.h"
 
 // ============================================================================
 // PRIVATE STATE
 // ============================================================================
 
-static gauge_state_t oil_gauge_state = {0};
+static dual_gauge_t oil_gauge = {0};
+static gauge_model_t last_model;  // Re-applied after a mode change
 
 static const gauge_config_t oil_gauge_config = {
     .temp_min = OIL_TEMP_MIN,
@@ -18,31 +19,49 @@ static const gauge_config_t oil_gauge_config = {
     .zone_orange = OIL_TEMP_ZONE_ORANGE,
     .zone_red = OIL_TEMP_ZONE_RED,
     .redline = OIL_TEMP_REDLINE,
-    .alert_threshold = OIL_TEMP_ALERT_THRESHOLD,
     .marker_interval = OIL_TEMP_MARKER_INTERVAL,
     .icon_symbol = OIL_TEMP_SYMBOL,
     .value_scale = 1  // No scaling for temperature
 };
 
+static const needle_gauge_config_t oil_needle_config = {
+    .value_min = (float)OIL_TEMP_MIN,
+    .value_max = (float)OIL_TEMP_MAX,
+    .zone_red = (float)OIL_TEMP_ZONE_RED,
+    .major_tick_count = 6,  // 60, 80, 100, 120, 140, 160
+    .icon_symbol = OIL_TEMP_SYMBOL,
+    .unit_text = "°C",
+    .decimal_places = 0
+};
+
+static const dual_gauge_config_t oil_config = {
+    .racing = &oil_gauge_config,
+    .normal = &oil_needle_config
+};
+
 // ============================================================================
 // PUBLIC API IMPLEMENTATION
 // ============================================================================
 
-void oil_temp_gauge_init(void) {
-    // Initialize state
-    oil_gauge_state.is_blinking = false;
-
-    // Create UI components using common utilities
-    oil_gauge_state.screen_bg = gauge_create_background();
-    oil_gauge_state.arc = gauge_create_arc(&oil_gauge_config);
-    gauge_create_border_and_markers(&oil_gauge_config);
-    gauge_create_redline(&oil_gauge_config);
-    oil_gauge_state.label = gauge_create_digital_display();
-    oil_gauge_state.icon = gauge_create_icon(oil_gauge_config.icon_symbol);
+void oil_temp_gauge_init(lv_obj_t *screen, uint8_t mode) {
+    dual_gauge_create(&oil_gauge, &oil_config, screen, mode);
 }
 
-void oil_temp_gauge_set_value(int32_t temperature) {
-    gauge_update_value(&oil_gauge_state, &oil_gauge_config, temperature);
+void oil_temp_gauge_set_mode(uint8_t mode) {
+    if (dual_gauge_set_mode(&oil_gauge, &oil_config, mode)) {
+        dual_gauge_apply_model(&oil_gauge, &last_model);
+    }
+}
+
+void oil_temp_gauge_deinit(void) {
+    dual_gauge_release(&oil_gauge);
+}
+
+void oil_temp_gauge_set_model(const gauge_model_t *model) {
+    last_model = *model;
+
+    dual_gauge_apply_model(&oil_gauge, model);
+    dual_gauge_show_peak(&oil_gauge, &oil_config, GAUGE_PEAK_OIL_TEMP);
 }
 
 #ifdef __cplusplus
@@ -7,32 +7,48 @@ extern "C" {
 
 #include <stdint.h>
 #include "lvgl.h"
+#include "gauge_model.h"
 
 /**
  * @brief Initialize the oil temperature gauge display
  *
- * Creates all UI components for the oil temperature gauge including:
- * - Background screen
- * - Temperature arc with color zones
- * - Border and markers
- * - Redline indicator
- * - Digital temperature display
- * - Oil icon
+ * @param screen Screen to build the gauge on
+ * @param mode Initial display mode (GAUGE_MODE_NORMAL or GAUGE_MODE_RACING)
+ *
+ * Creates the widgets shared by both modes (background, digital temperature
+ * display, unit, icon) and the scale layer of the requested mode:
+ * - Racing: temperature arc with color zones, border and markers, redline
+ * - Normal: meter scale with zone-colored needle
+ */
+void oil_temp_gauge_init(lv_obj_t *screen, uint8_t mode);
+
+/**
+ * @brief Switch the gauge between normal (needle) and racing (arc) mode
+ *
+ * Only the scale layer is rebuilt; the shared widgets are restyled in place
+ * and the last value is re-applied. Does nothing if the mode is unchanged.
+ *
+ * @param mode GAUGE_MODE_NORMAL or GAUGE_MODE_RACING
+ */
+void oil_temp_gauge_set_mode(uint8_t mode);
+
+/**
+ * @brief Release the oil temperature gauge before its screen is deleted
  */
-void oil_temp_gauge_init(void);
+void oil_temp_gauge_deinit(void);
 
 /**
- * @brief Update the oil temperature gauge value
+ * @brief Show the temperature evaluated for GAUGE_CHANNEL_OIL_TEMP
  *
- * @param temperature Temperature value in Celsius (60-160°C)
+ * @param model State from gauge_model_update() with the channel configuration
  *
- * Updates the gauge display with the new temperature value, including:
- * - Arc indicator position (animated)
- * - Color based on temperature zones (grey/green/orange/red)
+ * Applies only what changed since the last call:
+ * - Arc or needle position (animated)
+ * - Needle color from the temperature zone (grey/green/orange/red)
  * - Digital temperature readout
- * - Alert animation if temperature exceeds threshold
+ * - Alert animation while the temperature is at or above the threshold
  */
-void oil_temp_gauge_set_value(int32_t temperature);
+void oil_temp_gauge_set_model(const gauge_model_t *model);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,190 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pedal_gauge.h"
+#include "gauges_config.h"
+#include "gauge_digits.h"
+#include "gauge_sweep.h"
+#include "gauge_theme.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+#if (PEDAL_GAUGE_RING_SIZE & (PEDAL_GAUGE_RING_SIZE - 1)) != 0
+    #error "PEDAL_GAUGE_RING_SIZE must be a power of 2"
+#endif
+
+// Plotted as percent of full scale; drawn in this order, the brake on top
+typedef enum {
+    PEDAL_THROTTLE = 0,   // Accelerator pedal (%), filled
+    PEDAL_THROTTLE_POS,   // Throttle plate (%)
+    PEDAL_BRAKE_PRESSURE, // Brake line pressure (% of PEDAL_GAUGE_BRAKE_PRESSURE_MAX)
+    PEDAL_BRAKE,          // Brake pedal (%)
+    PEDAL_CHANNEL_COUNT
+} pedal_channel_t;
+
+/**
+ * @brief Samples of one channel, written by the receive task
+ *
+ * Single producer, single consumer: the value is stored before the head is
+ * published, and the gauge timer only reads up to the published head.
+ */
+typedef struct {
+    uint8_t value[PEDAL_GAUGE_RING_SIZE];
+    uint32_t head;        // Samples written so far (wraps)
+} pedal_ring_t;
+
+static pedal_ring_t rings[PEDAL_CHANNEL_COUNT];
+static uint32_t ring_tail = 0;          // Samples moved into the plot so far
+
+static int16_t columns[PEDAL_CHANNEL_COUNT][PEDAL_GAUGE_PLOT_WIDTH];
+static gauge_sweep_t sweep;
+static bool sweep_started = false;
+
+static lv_obj_t *readouts[PEDAL_CHANNEL_COUNT];
+static lv_timer_t *pedal_timer = NULL;
+
+static const gauge_color_t channel_roles[PEDAL_CHANNEL_COUNT] = {
+    GAUGE_COLOR_GOOD, GAUGE_COLOR_TEXT, GAUGE_COLOR_ACCENT, GAUGE_COLOR_ALERT
+};
+static const char *const channel_names[PEDAL_CHANNEL_COUNT] = {"THR", "TPS", "BAR", "BRK"};
+
+// Pedals large next to the center, throttle on the right and brake on the left
+// like the pedals; plate and pressure smaller on the outside
+static const int8_t channel_side[PEDAL_CHANNEL_COUNT] = {1, 2, -2, -1};
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+static void ring_put(pedal_ring_t *ring, float value) {
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    ring->value[head & (PEDAL_GAUGE_RING_SIZE - 1)] = (uint8_t)LV_CLAMP(0.0f, value, 100.0f);
+    __atomic_store_n(&ring->head, head + 1U, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Configure the sweep and empty it (once, it outlives the screen)
+ */
+static void sweep_start(void) {
+    if (sweep_started) return;
+
+    sweep.columns = PEDAL_GAUGE_PLOT_WIDTH;
+    sweep.gap = PEDAL_GAUGE_GAP;
+    sweep.line_width = PEDAL_GAUGE_LINE_WIDTH;
+    sweep.value_min = 0;
+    sweep.value_max = 100;
+    sweep.trace_count = PEDAL_CHANNEL_COUNT;
+    for (int ch = 0; ch < PEDAL_CHANNEL_COUNT; ch++) {
+        sweep.trace[ch] = (gauge_sweep_trace_t){columns[ch], NULL, channel_roles[ch],
+                                                ch == PEDAL_THROTTLE ? PEDAL_GAUGE_THROTTLE_FILL_OPA : LV_OPA_TRANSP};
+    }
+
+    sweep.grid_count = 3;
+    for (uint8_t i = 0; i < 3; i++) {
+        sweep.grid[i] = (gauge_sweep_grid_t){(int16_t)(25 * (i + 1)), GAUGE_COLOR_MUTED};
+    }
+    sweep.grid_opa = PEDAL_GAUGE_GRID_OPA;
+
+    gauge_sweep_reset(&sweep);
+    sweep_started = true;
+}
+
+/**
+ * @brief Move every posted sample into the plot, one column each
+ *
+ * At 100 Hz and 16 ms this is one or two columns per run; the refresh then
+ * only renders those columns and the readout digits that changed. If the
+ * timer fell more than a ring behind, the oldest samples are skipped.
+ */
+static void pedal_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+
+    uint32_t head = __atomic_load_n(&rings[0].head, __ATOMIC_ACQUIRE);
+    for (int ch = 1; ch < PEDAL_CHANNEL_COUNT; ch++) {
+        uint32_t ch_head = __atomic_load_n(&rings[ch].head, __ATOMIC_ACQUIRE);
+        if ((int32_t)(ch_head - head) < 0) head = ch_head;
+    }
+    if (head == ring_tail) return;
+    if (head - ring_tail > PEDAL_GAUGE_RING_SIZE) ring_tail = head - PEDAL_GAUGE_RING_SIZE;
+
+    int16_t values[PEDAL_CHANNEL_COUNT];
+    for (; ring_tail != head; ring_tail++) {
+        for (int ch = 0; ch < PEDAL_CHANNEL_COUNT; ch++) {
+            values[ch] = rings[ch].value[ring_tail & (PEDAL_GAUGE_RING_SIZE - 1)];
+        }
+        gauge_sweep_push(&sweep, values);
+    }
+
+    // Brake pressure reads in bar (1 % of full scale is 1 bar at 10000 kPa)
+    values[PEDAL_BRAKE_PRESSURE] = (int16_t)((values[PEDAL_BRAKE_PRESSURE] * PEDAL_GAUGE_BRAKE_PRESSURE_MAX) / 10000);
+
+    char text[8];
+    for (int ch = 0; ch < PEDAL_CHANNEL_COUNT; ch++) {
+        lv_snprintf(text, sizeof(text), "%d", values[ch]);
+        gauge_digits_set_text(readouts[ch], text);
+    }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void pedal_gauge_init(lv_obj_t *screen) {
+    sweep_start();
+
+    for (int ch = 0; ch < PEDAL_CHANNEL_COUNT; ch++) {
+        bool pedal = ch == PEDAL_THROTTLE || ch == PEDAL_BRAKE;
+
+        readouts[ch] = gauge_digits_create(screen);
+        lv_obj_set_style_text_font(readouts[ch], pedal ? FONT_TEMP_UNIT : FONT_MARKERS, 0);
+        gauge_theme_add_color(readouts[ch], LV_STYLE_TEXT_COLOR, channel_roles[ch], 0);
+        lv_obj_align(readouts[ch], LV_ALIGN_CENTER, channel_side[ch] * PEDAL_GAUGE_VALUE_X_OFFSET,
+                     PEDAL_GAUGE_VALUE_Y_OFFSET);
+        gauge_digits_set_text(readouts[ch], "0");
+
+        lv_obj_t *name = lv_label_create(screen);
+        lv_label_set_text(name, channel_names[ch]);
+        lv_obj_set_style_text_font(name, FONT_MARKERS, 0);
+        gauge_theme_add_color(name, LV_STYLE_TEXT_COLOR, channel_roles[ch], 0);
+        if (pedal) {
+            lv_obj_align(name, LV_ALIGN_CENTER, channel_side[ch] * PEDAL_GAUGE_VALUE_X_OFFSET, PEDAL_GAUGE_NAME_Y_OFFSET);
+        } else {
+            lv_obj_align_to(name, readouts[ch], LV_ALIGN_OUT_TOP_MID, 0, 0);
+        }
+    }
+
+    lv_obj_t *plot = gauge_sweep_create(screen, &sweep, PEDAL_GAUGE_PLOT_HEIGHT);
+    lv_obj_align(plot, LV_ALIGN_CENTER, 0, PEDAL_GAUGE_PLOT_Y_OFFSET);
+
+    // Samples posted while the screen did not exist are not replayed
+    ring_tail = __atomic_load_n(&rings[0].head, __ATOMIC_ACQUIRE);
+    for (int ch = 1; ch < PEDAL_CHANNEL_COUNT; ch++) {
+        uint32_t ch_head = __atomic_load_n(&rings[ch].head, __ATOMIC_ACQUIRE);
+        if ((int32_t)(ch_head - ring_tail) < 0) ring_tail = ch_head;
+    }
+    pedal_timer = lv_timer_create(pedal_timer_cb, PEDAL_GAUGE_PERIOD, NULL);
+}
+
+void pedal_gauge_deinit(void) {
+    if (pedal_timer) {
+        lv_timer_del(pedal_timer);
+        pedal_timer = NULL;
+    }
+    for (int ch = 0; ch < PEDAL_CHANNEL_COUNT; ch++) {
+        readouts[ch] = NULL;
+    }
+}
+
+void pedal_gauge_post(float brake, float brake_pressure, float throttle, float throttle_pos) {
+    ring_put(&rings[PEDAL_THROTTLE], throttle);
+    ring_put(&rings[PEDAL_THROTTLE_POS], throttle_pos);
+    ring_put(&rings[PEDAL_BRAKE_PRESSURE], brake_pressure * 100.0f / PEDAL_GAUGE_BRAKE_PRESSURE_MAX);
+    ring_put(&rings[PEDAL_BRAKE], brake);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,46 @@
+#ifndef PEDAL_GAUGE_H
+#define PEDAL_GAUGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/**
+ * @brief Initialize the brake / throttle pedal trace display
+ *
+ * @param screen Screen to build the gauge on
+ *
+ * Creates the four readouts (pedals large, throttle plate and brake pressure
+ * small), the four-trace sweep plot (gauge_sweep.h) and the PEDAL_GAUGE_PERIOD
+ * timer that moves posted samples into the plot.
+ */
+void pedal_gauge_init(lv_obj_t *screen);
+
+/**
+ * @brief Release the pedal trace before its screen is deleted (stops its timer)
+ */
+void pedal_gauge_deinit(void);
+
+/**
+ * @brief Post one pedal sample from any task
+ *
+ * Meant to be called from the telemetry receive callback for every packet:
+ * each value goes into the ring buffer of its channel (no LVGL call, no
+ * lock) and becomes one plot column, so the trace keeps the incoming sample
+ * rate. Posts must come from one task at a time.
+ *
+ * @param brake Brake pedal (%)
+ * @param brake_pressure Brake line pressure (kPa), plotted against PEDAL_GAUGE_BRAKE_PRESSURE_MAX
+ * @param throttle Accelerator pedal (%)
+ * @param throttle_pos Throttle plate (%)
+ */
+void pedal_gauge_post(float brake, float brake_pressure, float throttle, float throttle_pos);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PEDAL_GAUGE_H
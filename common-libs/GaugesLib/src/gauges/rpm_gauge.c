@@ -0,0 +1,293 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rpm_gauge.h"
+#include "gauges_config.h"
+#include "gauge_common.h"
+#include "gauge_digits.h"
+#include "gauge_stats.h"
+#include "gauge_theme.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+static const gauge_config_t rpm_config = {
+    .temp_min = 0,
+    .temp_max = RPM_GAUGE_MAX,
+    .zone_green = 0,
+    .zone_orange = RPM_GAUGE_ZONE_ORANGE,
+    .zone_red = RPM_GAUGE_REDLINE,
+    .redline = RPM_GAUGE_REDLINE,
+    .marker_interval = 1000,
+    .icon_symbol = NULL,
+    .value_scale = 1000   // Scale labels in x1000 RPM
+};
+
+static const uint16_t gear_rpm_per_kmh[] = RPM_GAUGE_GEAR_RPM_PER_KMH;
+static const uint16_t gear_shift_rpm[] = RPM_GAUGE_SHIFT_POINTS;
+#define RPM_GEAR_COUNT (sizeof(gear_rpm_per_kmh) / sizeof(gear_rpm_per_kmh[0]))
+
+// Latest posted sample, written by rpm_gauge_post() from the receive task.
+// A sequence count makes the three words one snapshot: it is odd while a post
+// is being written, and the reader retries if it changed during its read.
+static uint32_t post_seq = 0;
+static uint32_t post_rpm = 0;
+static uint32_t post_speed = 0;   // km/h x10
+static uint32_t post_tick = 0;    // lv_tick_get() at receive time
+
+static lv_obj_t *rpm_screen = NULL;
+static lv_obj_t *rpm_arc = NULL;
+static lv_obj_t *gear_label = NULL;
+static lv_obj_t *rpm_label = NULL;
+static lv_obj_t *lights[RPM_GAUGE_LIGHTS];
+static lv_timer_t *rpm_timer = NULL;
+
+static uint32_t applied_seq = 0;      // Last sample shown
+static uint32_t applied_rpm = 0;
+static uint32_t shown_rpm = 0;
+static uint8_t lit_count = 0;         // Shift lights on (below the shift point)
+static bool flashing = false;         // At or above the shift point
+
+static lv_style_t style_light;
+static lv_style_t style_light_on[3];  // Green, amber, red part of the row
+static lv_style_t style_light_flash;
+static bool styles_initialized = false;
+
+// ============================================================================
+// STYLE INITIALIZATION
+// ============================================================================
+
+/**
+ * @brief Shared shift light styles: off by default, lit with LV_STATE_CHECKED,
+ *        all in the alert color while flashing (LV_STATE_USER_1)
+ */
+static void init_styles(void) {
+    if (styles_initialized) return;
+
+    lv_style_init(&style_light);
+    lv_style_set_radius(&style_light, LV_RADIUS_CIRCLE);
+    lv_style_set_bg_opa(&style_light, LV_OPA_COVER);
+    gauge_theme_bind(&style_light, LV_STYLE_BG_COLOR, GAUGE_COLOR_MUTED);
+
+    static const gauge_color_t on_colors[3] = {GAUGE_COLOR_GOOD, GAUGE_COLOR_ACCENT, GAUGE_COLOR_ALERT};
+    for (int i = 0; i < 3; i++) {
+        lv_style_init(&style_light_on[i]);
+        gauge_theme_bind(&style_light_on[i], LV_STYLE_BG_COLOR, on_colors[i]);
+    }
+
+    lv_style_init(&style_light_flash);
+    gauge_theme_bind(&style_light_flash, LV_STYLE_BG_COLOR, GAUGE_COLOR_ALERT);
+
+    styles_initialized = true;
+}
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Copy the latest posted sample
+ * @return Its sequence count
+ */
+static uint32_t read_post(uint32_t *rpm, uint32_t *speed, uint32_t *tick) {
+    uint32_t seq, check;
+    do {
+        seq = __atomic_load_n(&post_seq, __ATOMIC_ACQUIRE);
+        *rpm = __atomic_load_n(&post_rpm, __ATOMIC_RELAXED);
+        *speed = __atomic_load_n(&post_speed, __ATOMIC_RELAXED);
+        *tick = __atomic_load_n(&post_tick, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        check = __atomic_load_n(&post_seq, __ATOMIC_RELAXED);
+    } while ((seq & 1U) || seq != check);
+    return seq;
+}
+
+/**
+ * @brief Gear whose RPM / speed ratio matches within RPM_GAUGE_GEAR_TOLERANCE
+ * @return Gear index (0 = first), -1 if stopped, clutch in or between ratios
+ */
+static int estimate_gear(uint32_t rpm, uint32_t speed_x10) {
+    if (speed_x10 < RPM_GAUGE_GEAR_MIN_SPEED * 10) return -1;
+
+    uint32_t ratio = (rpm * 100U) / speed_x10;  // RPM per km/h x10
+    for (uint32_t gear = 0; gear < RPM_GEAR_COUNT; gear++) {
+        uint32_t expected = gear_rpm_per_kmh[gear];
+        uint32_t diff = ratio > expected ? ratio - expected : expected - ratio;
+        if (diff * 100U <= expected * RPM_GAUGE_GEAR_TOLERANCE) return (int)gear;
+    }
+    return -1;
+}
+
+/**
+ * @brief Light the shift row; only the lights that change state are touched
+ *
+ * The row fills over the last RPM_GAUGE_SHIFT_BAND RPM before the shift point
+ * of the gear; at the shift point the whole row flashes every
+ * RPM_GAUGE_FLASH_PERIOD ms.
+ */
+static void update_lights(uint32_t rpm, uint32_t shift_rpm) {
+    bool flash = rpm >= shift_rpm;
+    uint8_t count;
+
+    if (flash) {
+        count = ((lv_tick_get() / RPM_GAUGE_FLASH_PERIOD) & 1U) ? 0 : RPM_GAUGE_LIGHTS;
+    } else {
+        count = (uint8_t)lv_map((int32_t)rpm, (int32_t)(shift_rpm - RPM_GAUGE_SHIFT_BAND),
+                                (int32_t)shift_rpm, 0, RPM_GAUGE_LIGHTS);
+    }
+
+    if (flash != flashing) {
+        for (int i = 0; i < RPM_GAUGE_LIGHTS; i++) {
+            if (flash) {
+                lv_obj_add_state(lights[i], LV_STATE_USER_1);
+            } else {
+                lv_obj_clear_state(lights[i], LV_STATE_USER_1);
+            }
+        }
+        flashing = flash;
+    }
+
+    for (int i = LV_MIN(count, lit_count); i < LV_MAX(count, lit_count); i++) {
+        if (i < count) {
+            lv_obj_add_state(lights[i], LV_STATE_CHECKED);
+        } else {
+            lv_obj_clear_state(lights[i], LV_STATE_CHECKED);
+        }
+    }
+    lit_count = count;
+}
+
+/**
+ * @brief Apply the latest posted sample and refresh at once
+ *
+ * Runs every RPM_GAUGE_PERIOD ms in the LVGL task. The arc value is set
+ * directly (no motion smoothing, which would add latency) and the display is
+ * refreshed with lv_refr_now() instead of waiting for the refresh timer. The
+ * receive time of a sample that changed the screen is handed to gauge_stats,
+ * which measures it to the end of that refresh.
+ */
+static void rpm_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (lv_scr_act() != rpm_screen) return;
+
+    uint32_t rpm, speed, tick;
+    uint32_t seq = read_post(&rpm, &speed, &tick);
+
+    // No sample for a while: link lost or engine off
+    bool stale = lv_tick_elaps(tick) > RPM_GAUGE_TIMEOUT;
+    if (stale) {
+        rpm = 0;
+        speed = 0;
+    }
+
+    bool fresh = seq != applied_seq;
+    if (!fresh && !flashing && rpm == applied_rpm) return;
+    applied_seq = seq;
+    applied_rpm = rpm;
+
+    int gear = estimate_gear(rpm, speed);
+    update_lights(rpm, gear >= 0 ? gear_shift_rpm[gear] : RPM_GAUGE_SHIFT_RPM);
+    gauge_arc_set_value(rpm_arc, (int32_t)LV_MIN(rpm, (uint32_t)RPM_GAUGE_MAX));
+
+    char text[12];
+    if (gear >= 0) {
+        lv_snprintf(text, sizeof(text), "%d", gear + 1);
+        gauge_digits_set_text(gear_label, text);
+    } else {
+        gauge_digits_set_text(gear_label, "-");
+    }
+
+    uint32_t readout = (rpm / RPM_GAUGE_READOUT_STEP) * RPM_GAUGE_READOUT_STEP;
+    if (readout != shown_rpm) {
+        lv_snprintf(text, sizeof(text), "%u", (unsigned)readout);
+        gauge_digits_set_text(rpm_label, text);
+        shown_rpm = readout;
+    }
+
+    lv_disp_t *disp = lv_disp_get_default();
+    if (disp && disp->inv_p > 0) {
+        if (fresh && !stale) gauge_stats_mark_input(tick);
+        lv_refr_now(disp);
+    }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void rpm_gauge_init(lv_obj_t *screen) {
+    init_styles();
+    rpm_screen = screen;
+
+    rpm_arc = gauge_create_arc(screen, &rpm_config);
+    gauge_create_border_and_markers(screen, &rpm_config);
+    gauge_create_redline(screen, &rpm_config);
+
+    // Shift light row above the readouts
+    const lv_coord_t row_x = -((RPM_GAUGE_LIGHTS - 1) * RPM_GAUGE_LIGHT_PITCH) / 2;
+    for (int i = 0; i < RPM_GAUGE_LIGHTS; i++) {
+        lv_obj_t *light = lv_obj_create(screen);
+        lv_obj_remove_style_all(light);
+        lv_obj_clear_flag(light, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_set_size(light, RPM_GAUGE_LIGHT_SIZE, RPM_GAUGE_LIGHT_SIZE);
+        lv_obj_align(light, LV_ALIGN_CENTER, row_x + i * RPM_GAUGE_LIGHT_PITCH, RPM_GAUGE_LIGHTS_Y_OFFSET);
+        lv_obj_add_style(light, &style_light, 0);
+        lv_obj_add_style(light, &style_light_on[(i * 3) / RPM_GAUGE_LIGHTS], LV_STATE_CHECKED);
+        lv_obj_add_style(light, &style_light_flash, LV_STATE_CHECKED | LV_STATE_USER_1);
+        lights[i] = light;
+    }
+
+    gear_label = gauge_digits_create(screen);
+    lv_obj_set_style_text_font(gear_label, FONT_TEMP_MAIN, 0);
+    gauge_theme_add_color(gear_label, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+    lv_obj_align(gear_label, LV_ALIGN_CENTER, 0, TEMP_LABEL_Y_OFFSET);
+    gauge_digits_set_text(gear_label, "-");
+
+    rpm_label = gauge_digits_create(screen);
+    lv_obj_set_style_text_font(rpm_label, FONT_TEMP_UNIT, 0);
+    gauge_theme_add_color(rpm_label, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_ACCENT, 0);
+    lv_obj_align(rpm_label, LV_ALIGN_CENTER, 0, RPM_GAUGE_READOUT_Y_OFFSET);
+    gauge_digits_set_text(rpm_label, "0");
+
+    lv_obj_t *unit = lv_label_create(screen);
+    lv_label_set_text(unit, "RPM");
+    lv_obj_set_style_text_font(unit, FONT_MARKERS, 0);
+    gauge_theme_add_color(unit, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_SCALE, 0);
+    lv_obj_align_to(unit, rpm_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
+
+    applied_seq = post_seq - 2U;  // Show the latest sample on the first run
+    applied_rpm = 0;
+    shown_rpm = 0;
+    lit_count = 0;
+    flashing = false;
+    rpm_timer = lv_timer_create(rpm_timer_cb, RPM_GAUGE_PERIOD, NULL);
+}
+
+void rpm_gauge_deinit(void) {
+    if (rpm_timer) {
+        lv_timer_del(rpm_timer);
+        rpm_timer = NULL;
+    }
+    rpm_screen = NULL;
+    rpm_arc = NULL;
+    gear_label = NULL;
+    rpm_label = NULL;
+}
+
+void rpm_gauge_post(uint32_t rpm, float speed) {
+    uint32_t seq = __atomic_load_n(&post_seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&post_seq, seq + 1U, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    __atomic_store_n(&post_rpm, rpm, __ATOMIC_RELAXED);
+    __atomic_store_n(&post_speed, speed > 0.0f ? (uint32_t)(speed * 10.0f) : 0U, __ATOMIC_RELAXED);
+    __atomic_store_n(&post_tick, lv_tick_get(), __ATOMIC_RELAXED);
+
+    __atomic_store_n(&post_seq, seq + 2U, __ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+}
+#endif
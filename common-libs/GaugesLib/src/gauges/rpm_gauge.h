@@ -0,0 +1,45 @@
+#ifndef RPM_GAUGE_H
+#define RPM_GAUGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/**
+ * @brief Initialize the tachometer / shift light display
+ *
+ * @param screen Screen to build the gauge on
+ *
+ * Creates the RPM arc and scale (0-8 x1000), the shift light row, the gear
+ * and RPM readouts, and the RPM_GAUGE_PERIOD timer that applies posted
+ * samples while the screen is loaded.
+ */
+void rpm_gauge_init(lv_obj_t *screen);
+
+/**
+ * @brief Release the tachometer before its screen is deleted (stops its timer)
+ */
+void rpm_gauge_deinit(void);
+
+/**
+ * @brief Post an RPM sample from any task
+ *
+ * Meant to be called from the telemetry receive callback: it only stores the
+ * sample with its receive time (no LVGL call, no lock), so the tachometer
+ * does not wait for the loop() update cadence. The gauge timer picks up the
+ * latest sample, redraws what changed and refreshes the display at once.
+ * Posts must come from one task at a time.
+ *
+ * @param rpm Engine RPM
+ * @param speed Vehicle speed (km/h), used to estimate the gear (0 if unknown)
+ */
+void rpm_gauge_post(uint32_t rpm, float speed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RPM_GAUGE_H
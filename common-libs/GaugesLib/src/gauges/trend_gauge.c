@@ -0,0 +1,190 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "trend_gauge.h"
+#include "gauge_digits.h"
+#include "gauge_sweep.h"
+#include "gauge_theme.h"
+#include "gauge_zones.h"
+
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+#define TREND_COLUMNS        TREND_GAUGE_PLOT_WIDTH
+#define TREND_COLUMN_PERIOD  ((TREND_GAUGE_MINUTES * 60000UL) / TREND_COLUMNS)   // ms per column
+#define TREND_NO_DATA        GAUGE_SWEEP_NO_DATA
+
+/**
+ * @brief Plotted channel: range, zones and labels
+ */
+typedef struct {
+    int16_t value_min;
+    int16_t value_max;
+    int16_t zone_green;
+    int16_t zone_orange;
+    int16_t zone_red;
+    const char *icon_symbol;
+    const char *text_label;
+} trend_channel_t;
+
+#if TREND_GAUGE_CHANNEL == TREND_CHANNEL_WATER_TEMP
+static const trend_channel_t channel = {
+    WATER_TEMP_MIN, WATER_TEMP_MAX,
+    WATER_TEMP_ZONE_GREEN, WATER_TEMP_ZONE_ORANGE, WATER_TEMP_ZONE_RED,
+    WATER_SYMBOL, WATER_TEXT_LABEL
+};
+#else
+static const trend_channel_t channel = {
+    OIL_TEMP_MIN, OIL_TEMP_MAX,
+    OIL_TEMP_ZONE_GREEN, OIL_TEMP_ZONE_ORANGE, OIL_TEMP_ZONE_RED,
+    OIL_TEMP_SYMBOL, OIL_TEMP_TEXT_LABEL
+};
+#endif
+
+// History, one value per plot column: the column index is the screen x, the
+// newest value sits just behind the cursor and the oldest just past the gap
+static int16_t history[TREND_COLUMNS];
+static gauge_sweep_t sweep;
+static bool history_started = false;
+static uint32_t column_start = 0;       // lv_tick_get() at the start of the current period
+static int32_t column_sum = 0;          // Samples of the current period
+static uint32_t column_count = 0;
+
+static lv_obj_t *plot = NULL;
+static lv_obj_t *value_label = NULL;
+
+// ============================================================================
+// PRIVATE FUNCTIONS
+// ============================================================================
+
+static lv_color_t trend_zone_color(int32_t value) {
+    return gauge_zone_color(gauge_zone_for_value((float)value, channel.zone_green,
+                                                 channel.zone_orange, channel.zone_red));
+}
+
+/**
+ * @brief Configure the sweep and empty the history (once, it outlives the screen)
+ */
+static void history_start(void) {
+    if (history_started) return;
+
+    sweep.columns = TREND_COLUMNS;
+    sweep.gap = TREND_GAUGE_GAP;
+    sweep.line_width = TREND_GAUGE_LINE_WIDTH;
+    sweep.value_min = channel.value_min;
+    sweep.value_max = channel.value_max;
+    sweep.trace_count = 1;
+    sweep.trace[0] = (gauge_sweep_trace_t){history, trend_zone_color, GAUGE_COLOR_TEXT, TREND_GAUGE_FILL_OPA};
+
+    // Zone thresholds, in their zone colors
+    sweep.grid_count = 3;
+    sweep.grid[0] = (gauge_sweep_grid_t){channel.zone_green, GAUGE_COLOR_GOOD};
+    sweep.grid[1] = (gauge_sweep_grid_t){channel.zone_orange, GAUGE_COLOR_ACCENT};
+    sweep.grid[2] = (gauge_sweep_grid_t){channel.zone_red, GAUGE_COLOR_ALERT};
+    sweep.grid_opa = TREND_GAUGE_GRID_OPA;
+
+    gauge_sweep_reset(&sweep);
+    column_start = lv_tick_get();
+    history_started = true;
+}
+
+static lv_obj_t* create_range_label(lv_obj_t *parent, int32_t value, lv_align_t align) {
+    lv_obj_t *label = lv_label_create(parent);
+    lv_label_set_text_fmt(label, "%d", (int)value);
+    lv_obj_set_style_text_font(label, FONT_MARKERS, 0);
+    gauge_theme_add_color(label, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_SCALE, 0);
+    lv_obj_align_to(label, plot, align, -TREND_GAUGE_LABEL_GAP, 0);
+    return label;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void trend_gauge_init(lv_obj_t *screen) {
+    history_start();
+
+    lv_obj_t *icon = lv_label_create(screen);
+    #if USE_CUSTOM_ICON_FONT
+    lv_label_set_text(icon, channel.icon_symbol);
+    lv_obj_set_style_text_font(icon, FONT_ICON, 0);
+    #else
+    lv_label_set_text(icon, channel.text_label);
+    lv_obj_set_style_text_font(icon, FONT_MARKERS, 0);
+    #endif
+    gauge_theme_add_color(icon, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_ACCENT, 0);
+    lv_obj_align(icon, LV_ALIGN_CENTER, 0, TREND_GAUGE_ICON_Y_OFFSET);
+
+    value_label = gauge_digits_create(screen);
+    lv_obj_set_style_text_font(value_label, FONT_TEMP_UNIT, 0);
+    gauge_theme_add_color(value_label, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_TEXT, 0);
+    lv_obj_align(value_label, LV_ALIGN_CENTER, 0, TREND_GAUGE_VALUE_Y_OFFSET);
+    gauge_digits_set_text(value_label, "0");
+
+    lv_obj_t *unit = lv_label_create(screen);
+    lv_label_set_text(unit, "°C");
+    lv_obj_set_style_text_font(unit, FONT_MARKERS, 0);
+    gauge_theme_add_color(unit, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_ACCENT, 0);
+    lv_obj_align(unit, LV_ALIGN_CENTER, TREND_GAUGE_UNIT_X_OFFSET, TREND_GAUGE_VALUE_Y_OFFSET);
+
+    // Plot: one pixel column per history entry (gauge_sweep.h)
+    plot = gauge_sweep_create(screen, &sweep, TREND_GAUGE_PLOT_HEIGHT);
+    lv_obj_align(plot, LV_ALIGN_CENTER, 0, TREND_GAUGE_PLOT_Y_OFFSET);
+
+    create_range_label(screen, channel.value_max, LV_ALIGN_OUT_LEFT_TOP);
+    create_range_label(screen, channel.value_min, LV_ALIGN_OUT_LEFT_BOTTOM);
+
+    lv_obj_t *span = lv_label_create(screen);
+    lv_label_set_text_fmt(span, "%d min", TREND_GAUGE_MINUTES);
+    lv_obj_set_style_text_font(span, FONT_MARKERS, 0);
+    gauge_theme_add_color(span, LV_STYLE_TEXT_COLOR, GAUGE_COLOR_SCALE, 0);
+    lv_obj_align_to(span, plot, LV_ALIGN_OUT_BOTTOM_MID, 0, TREND_GAUGE_LABEL_GAP);
+}
+
+void trend_gauge_deinit(void) {
+    plot = NULL;
+    value_label = NULL;
+}
+
+void trend_gauge_sample(float oil_temp, float water_temp) {
+#if TREND_GAUGE_CHANNEL == TREND_CHANNEL_WATER_TEMP
+    int32_t value = (int32_t)water_temp;
+    (void)oil_temp;
+#else
+    int32_t value = (int32_t)oil_temp;
+    (void)water_temp;
+#endif
+
+    history_start();
+
+    uint32_t elapsed = lv_tick_elaps(column_start);
+    if (elapsed >= TREND_COLUMN_PERIOD) {
+        int16_t mean = column_count ? (int16_t)(column_sum / (int32_t)column_count) : TREND_NO_DATA;
+        gauge_sweep_push(&sweep, &mean);
+
+        // Whole periods without samples leave empty columns (at most one sweep)
+        const int16_t empty = TREND_NO_DATA;
+        uint32_t missed = elapsed / TREND_COLUMN_PERIOD - 1;
+        for (uint32_t i = 0; i < LV_MIN(missed, (uint32_t)TREND_COLUMNS); i++) {
+            gauge_sweep_push(&sweep, &empty);
+        }
+        column_start += (missed + 1) * TREND_COLUMN_PERIOD;
+        column_sum = 0;
+        column_count = 0;
+    }
+
+    column_sum += LV_CLAMP(channel.value_min, value, channel.value_max);
+    column_count++;
+
+    if (value_label) {
+        char text[12];
+        lv_snprintf(text, sizeof(text), "%d", (int)value);
+        gauge_digits_set_text(value_label, text);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
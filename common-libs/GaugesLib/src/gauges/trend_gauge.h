@@ -0,0 +1,55 @@
+#ifndef TREND_GAUGE_H
+#define TREND_GAUGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+#include "gauges_config.h"
+#include "gauge_peaks.h"
+
+// Held value a tap on the trend screen recalls (the plotted channel)
+#if TREND_GAUGE_CHANNEL == TREND_CHANNEL_WATER_TEMP
+    #define TREND_GAUGE_PEAK GAUGE_PEAK_WATER_TEMP
+#else
+    #define TREND_GAUGE_PEAK GAUGE_PEAK_OIL_TEMP
+#endif
+
+/**
+ * @brief Initialize the trend gauge display
+ *
+ * @param screen Screen to build the gauge on
+ *
+ * Creates the icon, the current value readout, the plot of the last
+ * TREND_GAUGE_MINUTES of TREND_GAUGE_CHANNEL and its range labels. The plot
+ * draws the recorded history directly: nothing is replayed when the screen is
+ * built again after an eviction.
+ */
+void trend_gauge_init(lv_obj_t *screen);
+
+/**
+ * @brief Release the trend gauge before its screen is deleted (the history is kept)
+ */
+void trend_gauge_deinit(void);
+
+/**
+ * @brief Feed one telemetry sample
+ *
+ * Called for every sample, whichever gauge is visible. The samples of one plot
+ * column period are averaged; when a period ends the mean is written at the
+ * sweep cursor and only that column and the blank gap ahead of it are
+ * invalidated. Periods without any sample (telemetry lost) stay empty.
+ * The value readout is updated if the screen is built.
+ *
+ * @param oil_temp Oil temperature (°C)
+ * @param water_temp Water temperature (°C)
+ */
+void trend_gauge_sample(float oil_temp, float water_temp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREND_GAUGE_H
@@ -3,13 +3,14 @@ extern "C" {
 #endif
 
 #include "water_temp_gauge.h"
-#include "gauge_common.h"
+#include "dual_gauge.h"
 
 // ============================================================================
 // PRIVATE STATE
 // ============================================================================
 
-static gauge_state_t water_gauge_state = {0};
+static dual_gauge_t water_gauge = {0};
+static gauge_model_t last_model;  // Re-applied after a mode change
 
 static const gauge_config_t water_gauge_config = {
     .temp_min = WATER_TEMP_MIN,
@@ -18,31 +19,49 @@ static const gauge_config_t water_gauge_config = {
     .zone_orange = WATER_TEMP_ZONE_ORANGE,
     .zone_red = WATER_TEMP_ZONE_RED,
     .redline = WATER_TEMP_REDLINE,
-    .alert_threshold = WATER_TEMP_ALERT_THRESHOLD,
     .marker_interval = WATER_TEMP_MARKER_INTERVAL,
     .icon_symbol = WATER_SYMBOL,
     .value_scale = 1  // No scaling for temperature
 };
 
+static const needle_gauge_config_t water_needle_config = {
+    .value_min = (float)WATER_TEMP_MIN,
+    .value_max = (float)WATER_TEMP_MAX,
+    .zone_red = (float)WATER_TEMP_ZONE_RED,
+    .major_tick_count = 5,  // 60, 80, 100, 120, 140
+    .icon_symbol = WATER_SYMBOL,
+    .unit_text = "°C",
+    .decimal_places = 0
+};
+
+static const dual_gauge_config_t water_config = {
+    .racing = &water_gauge_config,
+    .normal = &water_needle_config
+};
+
 // ============================================================================
 // PUBLIC API IMPLEMENTATION
 // ============================================================================
 
-void water_temp_gauge_init(void) {
-    // Initialize state
-    water_gauge_state.is_blinking = false;
-
-    // Create UI components using common utilities
-    water_gauge_state.screen_bg = gauge_create_background();
-    water_gauge_state.arc = gauge_create_arc(&water_gauge_config);
-    gauge_create_border_and_markers(&water_gauge_config);
-    gauge_create_redline(&water_gauge_config);
-    water_gauge_state.label = gauge_create_digital_display();
-    water_gauge_state.icon = gauge_create_icon(water_gauge_config.icon_symbol);
+void water_temp_gauge_init(lv_obj_t *screen, uint8_t mode) {
+    dual_gauge_create(&water_gauge, &water_config, screen, mode);
 }
 
-void water_temp_gauge_set_value(int32_t temperature) {
-    gauge_update_value(&water_gauge_state, &water_gauge_config, temperature);
+void water_temp_gauge_set_mode(uint8_t mode) {
+    if (dual_gauge_set_mode(&water_gauge, &water_config, mode)) {
+        dual_gauge_apply_model(&water_gauge, &last_model);
+    }
+}
+
+void water_temp_gauge_deinit(void) {
+    dual_gauge_release(&water_gauge);
+}
+
+void water_temp_gauge_set_model(const gauge_model_t *model) {
+    last_model = *model;
+
+    dual_gauge_apply_model(&water_gauge, model);
+    dual_gauge_show_peak(&water_gauge, &water_config, GAUGE_PEAK_WATER_TEMP);
 }
 
 #ifdef __cplusplus
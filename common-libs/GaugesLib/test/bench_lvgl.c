@@ -0,0 +1,98 @@
+// Host benchmark of the gauge drawing against LVGL's own renderer
+//
+//     LVGL_DIR=<lvgl 8.4 checkout> test/run_host_tests.sh --bench
+//
+// Links LVGL 8.4 and the gauge library (src/gauges) for one screen profile
+// (-DGAUGE_SCREEN_RES=466 / 240), with the board's lv_conf.h (test/lv_conf.h).
+// The display is a frame buffer in memory whose flush only reports ready, so
+// the times are LVGL's software rendering alone. The device benchmarks run
+// unchanged: gauge_arc_benchmark() times the span fill against lv_draw_arc,
+// gauge_digits_benchmark() a readout update against lv_label_set_text.
+
+#define _XOPEN_SOURCE 700     // clock_gettime()
+
+#include "lvgl.h"
+#include "gauges_config.h"
+#include "gauge_common.h"
+#include "gauge_digits.h"
+#include "gauge_manager.h"
+#include "gauge_stats.h"
+#include <stdio.h>
+#include <time.h>
+
+#define ARC_ITERATIONS     1000
+#define DIGITS_ITERATIONS  2000
+
+static lv_color_t frame[LCD_RES * LCD_RES];
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+
+// ============================================================================
+// HOST HOOKS
+// ============================================================================
+
+uint32_t bench_tick_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+// gauge_manager.c outside Arduino
+unsigned long millis(void) {
+    return bench_tick_ms();
+}
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * @brief Time per iteration (us) of a benchmark total in ms
+ */
+static double per_iteration_us(uint32_t total_ms, uint32_t iterations) {
+    return total_ms * 1000.0 / iterations;
+}
+
+int main(void) {
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, frame, NULL, LCD_RES * LCD_RES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = LCD_RES;
+    disp_drv.ver_res = LCD_RES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.monitor_cb = gauge_stats_monitor_cb;
+    lv_disp_drv_register(&disp_drv);
+
+    // Same order as the boards' setup(): the gauges first, then the benchmarks
+    gauge_manager_init(false);
+    printf("=== %d px profile, LVGL %d.%d.%d ===\n", LCD_RES, LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR,
+           LVGL_VERSION_PATCH);
+
+#if GAUGE_ARC_BENCHMARK
+    gauge_arc_bench_t arc;
+    gauge_arc_benchmark(ARC_ITERATIONS, &arc);
+    double refresh_us = per_iteration_us(arc.refresh_ms, ARC_ITERATIONS);
+    double spans_us = per_iteration_us(arc.spans_ms, ARC_ITERATIONS) - refresh_us;
+    double draw_arc_us = per_iteration_us(arc.draw_arc_ms, ARC_ITERATIONS) - refresh_us;
+    printf("value arc, %d full redraws: refresh only %u ms, span rasterizer %u ms, lv_draw_arc %u ms\n",
+           ARC_ITERATIONS, (unsigned)arc.refresh_ms, (unsigned)arc.spans_ms, (unsigned)arc.draw_arc_ms);
+    printf("value arc drawing per redraw: spans %.1f us, lv_draw_arc %.1f us (x%.1f)\n",
+           spans_us, draw_arc_us, spans_us > 0 ? draw_arc_us / spans_us : 0.0);
+#endif
+
+#if GAUGE_DIGITS_BENCHMARK
+    gauge_digits_bench_t digits;
+    gauge_digits_benchmark(DIGITS_ITERATIONS, &digits);
+    printf("readout, %d updates: lv_label %u ms / %u B flushed, gauge_digits %u ms / %u B flushed\n",
+           DIGITS_ITERATIONS, (unsigned)digits.label_ms, (unsigned)digits.label_bytes,
+           (unsigned)digits.digits_ms, (unsigned)digits.digits_bytes);
+    printf("readout per update: lv_label %.1f us, gauge_digits %.1f us\n",
+           per_iteration_us(digits.label_ms, DIGITS_ITERATIONS),
+           per_iteration_us(digits.digits_ms, DIGITS_ITERATIONS));
+#endif
+
+    return 0;
+}
@@ -0,0 +1,322 @@
+// Host benchmark of the value arc span fill and the needle sprites
+// (src/gauges/gauge_raster.c) against per-pixel mask rendering
+//
+//     test/run_host_tests.sh --bench
+//
+// Built once per screen profile (-DGAUGE_SCREEN_RES=466 / 240). Both sides
+// blend into the same RGB565 frame buffer with the same blend, so the
+// difference is the coverage work. LVGL is not needed: the baseline models
+// the LVGL 8 mask pipeline used by lv_draw_arc and lv_draw_line. For each
+// row of the bounding box, a mask line is set to opaque, the radius or line
+// masks and the angle masks are applied per pixel, and the whole row is
+// blended with the mask. It does not reproduce LVGL's band splitting or its
+// circle cache, so the ratio is an estimate; bench_lvgl.c times the span fill
+// against the real lv_draw_arc with an LVGL build.
+
+#define _XOPEN_SOURCE 700     // clock_gettime(), M_PI
+
+#include "gauge_raster.h"
+#include "gauge_arc_spans.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Needle of the profile (gauge_geometry.h: NEEDLE_WIDTH; the length is the
+// scale radius (GAUGE_DIMENSION - NEEDLE_METER_PADDING) / 2 plus NEEDLE_OFFSET)
+#if GAUGE_SCREEN_RES == 466
+    #define BENCH_NEEDLE_WIDTH   5
+    #define BENCH_NEEDLE_LENGTH  ((466 - 30) / 2 - 20)
+#elif GAUGE_SCREEN_RES == 240
+    #define BENCH_NEEDLE_WIDTH   2
+    #define BENCH_NEEDLE_LENGTH  ((240 - 15) / 2 - 10)
+#else
+    #error "bench_raster.c: add the needle of this GAUGE_SCREEN_RES"
+#endif
+
+#define RES             GAUGE_SCREEN_RES
+#define SPRITE_STEPS    2               // NEEDLE_SPRITE_STEPS default
+#define ARC_ITERATIONS  200
+#define NEEDLE_SWEEPS   20
+#define ONE             (1 << GAUGE_RASTER_SIN_SHIFT)
+
+// Four zones over the 135-405 degree scale, at full scale
+static const int32_t zone_angles[] = {135, 203, 270, 338, 405};
+static const uint16_t zone_colors[] = {0x7BEF, 0x07E0, 0xFD20, 0xF800};
+#define ZONE_COUNT 4
+
+static uint16_t frame[RES * RES];
+
+static const gauge_arc_span_t ring_rows[GAUGE_ARC_SPAN_RADIUS] = GAUGE_ARC_SPAN_ROWS;
+static const uint8_t ring_alpha[] = GAUGE_ARC_SPAN_ALPHA;
+static const gauge_arc_ring_t ring = {ring_rows, ring_alpha, GAUGE_ARC_SPAN_RADIUS};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Q15 sine of a whole degree, like lv_trigo_sin()
+ */
+static int16_t host_sin(int16_t angle) {
+    int32_t a = angle % 360;
+    if (a < 0) a += 360;
+    return (int16_t)lround(sin(a * M_PI / 180.0) * 32767.0);
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static uint16_t mix565(uint16_t fg, uint16_t bg, uint8_t a) {
+    uint32_t r = (((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * (255 - a)) / 255;
+    uint32_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (255 - a)) / 255;
+    uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (255 - a)) / 255;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/**
+ * @brief Blend a run like lv_draw_sw_blend: skip 0, copy 255, mix the rest
+ */
+static void blend(int32_t x, int32_t y, int32_t len, const uint8_t *mask, uint16_t color) {
+    if (y < 0 || y >= RES) return;
+    uint16_t *dst = &frame[y * RES];
+    for (int32_t i = 0; i < len; i++) {
+        int32_t px = x + i;
+        if (px < 0 || px >= RES) continue;
+        uint8_t a = mask ? mask[i] : 255;
+        if (a == 255) dst[px] = color;
+        else if (a) dst[px] = mix565(color, dst[px], a);
+    }
+}
+
+typedef struct {
+    uint16_t color;
+} bench_ctx_t;
+
+static void blend_run(void *ctx, int32_t x, int32_t y, int32_t len, const uint8_t *mask) {
+    blend(x, y, len, mask, ((bench_ctx_t *)ctx)->color);
+}
+
+static void clear_frame(void) {
+    memset(frame, 0, sizeof(frame));
+}
+
+static uint32_t frame_checksum(void) {
+    uint32_t sum = 0;
+    for (int i = 0; i < RES * RES; i++) sum = sum * 31 + frame[i];
+    return sum;
+}
+
+/**
+ * @brief Pixels of two frames that differ by more than a quarter of a channel's range
+ */
+static int32_t frame_diff(const uint16_t *a, const uint16_t *b) {
+    int32_t count = 0;
+    for (int i = 0; i < RES * RES; i++) {
+        int dr = abs(((a[i] >> 11) & 0x1F) - ((b[i] >> 11) & 0x1F));
+        int dg = abs(((a[i] >> 5) & 0x3F) - ((b[i] >> 5) & 0x3F));
+        int db = abs((a[i] & 0x1F) - (b[i] & 0x1F));
+        if (dr > 8 || dg > 16 || db > 8) count++;
+    }
+    return count;
+}
+
+// ============================================================================
+// ARC
+// ============================================================================
+
+static const int32_t arc_cx = RES / 2;
+static const int32_t arc_cy = RES / 2;
+
+static void arc_spans(void) {
+    for (int z = 0; z < ZONE_COUNT; z++) {
+        gauge_arc_part_t parts[3];
+        int count = gauge_arc_split(zone_angles[z], zone_angles[z + 1], host_sin, parts);
+        bench_ctx_t ctx = {zone_colors[z]};
+        gauge_arc_raster(&ring, arc_cx, arc_cy, arc_cy - ring.radius, arc_cy + ring.radius - 1,
+                         parts, count, blend_run, &ctx);
+    }
+}
+
+/**
+ * @brief Mask model of lv_draw_arc: radius masks and angle mask per pixel of the bounding box
+ */
+static void arc_masks(void) {
+    static uint8_t mask[RES];
+    const double r_out = ring.radius;
+    const double r_in = ring.radius - GAUGE_ARC_SPAN_WIDTH;
+
+    for (int z = 0; z < ZONE_COUNT; z++) {
+        double a0 = zone_angles[z] * M_PI / 180.0;
+        double a1 = zone_angles[z + 1] * M_PI / 180.0;
+        int32_t c0 = (int32_t)lround(cos(a0) * ONE), s0 = (int32_t)lround(sin(a0) * ONE);
+        int32_t c1 = (int32_t)lround(cos(a1) * ONE), s1 = (int32_t)lround(sin(a1) * ONE);
+
+        // Bounding box: both ends and every axis the segment crosses, at the outer radius
+        double x_min = fmin(cos(a0), cos(a1)), x_max = fmax(cos(a0), cos(a1));
+        double y_min = fmin(sin(a0), sin(a1)), y_max = fmax(sin(a0), sin(a1));
+        for (int32_t q = 0; q < 720; q += 90) {
+            if (q > zone_angles[z] && q < zone_angles[z + 1]) {
+                double a = q * M_PI / 180.0;
+                x_min = fmin(x_min, cos(a)); x_max = fmax(x_max, cos(a));
+                y_min = fmin(y_min, sin(a)); y_max = fmax(y_max, sin(a));
+            }
+        }
+        int32_t bx1 = arc_cx + (int32_t)floor(x_min * r_out), bx2 = arc_cx + (int32_t)ceil(x_max * r_out) - 1;
+        int32_t by1 = arc_cy + (int32_t)floor(y_min * r_out), by2 = arc_cy + (int32_t)ceil(y_max * r_out) - 1;
+
+        for (int32_t y = by1; y <= by2; y++) {
+            int32_t w = bx2 - bx1 + 1;
+            memset(mask, 255, w);
+            double fy = y - arc_cy + 0.5;
+            for (int32_t i = 0; i < w; i++) {
+                double fx = bx1 + i - arc_cx + 0.5;
+
+                // Radius masks: outer and inner circle, one pixel ramp
+                double d = sqrt(fx * fx + fy * fy);
+                double cover = fmin(1.0, fmin(r_out + 0.5 - d, d - r_in + 0.5));
+                if (cover <= 0.0) { mask[i] = 0; continue; }
+                mask[i] = (uint8_t)(mask[i] * cover);
+
+                // Angle mask: between the start and the end ray (segments under 180 degrees)
+                int64_t px = (int64_t)((2 * (bx1 + i - arc_cx) + 1));
+                int64_t py = (int64_t)((2 * (y - arc_cy) + 1));
+                if (c0 * py - s0 * px < 0 || c1 * py - s1 * px >= 0) mask[i] = 0;
+            }
+            blend(bx1, y, w, mask, zone_colors[z]);
+        }
+    }
+}
+
+// ============================================================================
+// NEEDLE
+// ============================================================================
+
+static gauge_needle_sprites_t sprites;
+static const int32_t needle_cx = RES / 2;
+static const int32_t needle_cy = RES / 2;
+
+static void needle_sprites(int32_t angle) {
+    int32_t x1, y1, x2, y2;
+    gauge_needle_raster_area(&sprites, angle, &x1, &y1, &x2, &y2);
+    bench_ctx_t ctx = {0xFFFF};
+    gauge_needle_raster(&sprites, needle_cx, needle_cy, angle, needle_cy + y1, needle_cy + y2, blend_run, &ctx);
+}
+
+/**
+ * @brief Mask model of lv_draw_line: line mask per pixel of the needle's bounding box
+ */
+static void needle_masks(int32_t angle) {
+    static uint8_t mask[RES];
+    double a = angle * M_PI / (180.0 * SPRITE_STEPS);
+    int32_t c = (int32_t)lround(cos(a) * ONE);
+    int32_t s = (int32_t)lround(sin(a) * ONE);
+    int32_t half = ((BENCH_NEEDLE_WIDTH + 1) * ONE) / 2;
+
+    // Bounding box of the line with its width
+    int32_t tip_x = (BENCH_NEEDLE_LENGTH * c) / ONE, tip_y = (BENCH_NEEDLE_LENGTH * s) / ONE;
+    int32_t m = BENCH_NEEDLE_WIDTH + 1;
+    int32_t bx1 = needle_cx + (tip_x < 0 ? tip_x : 0) - m, bx2 = needle_cx + (tip_x > 0 ? tip_x : 0) + m;
+    int32_t by1 = needle_cy + (tip_y < 0 ? tip_y : 0) - m, by2 = needle_cy + (tip_y > 0 ? tip_y : 0) + m;
+
+    for (int32_t y = by1; y <= by2; y++) {
+        int32_t w = bx2 - bx1 + 1;
+        memset(mask, 255, w);
+        int32_t dy = y - needle_cy;
+        for (int32_t i = 0; i < w; i++) {
+            int32_t dx = bx1 + i - needle_cx;
+            int32_t along = dx * c + dy * s;
+            int32_t across = abs(dy * c - dx * s);
+            int32_t cover = ONE;
+            if (half - across < cover) cover = half - across;
+            if (along + ONE / 2 < cover) cover = along + ONE / 2;
+            if (BENCH_NEEDLE_LENGTH * ONE + ONE / 2 - along < cover) cover = BENCH_NEEDLE_LENGTH * ONE + ONE / 2 - along;
+            mask[i] = cover <= 0 ? 0 : (uint8_t)((mask[i] * cover) >> GAUGE_RASTER_SIN_SHIFT);
+        }
+        blend(bx1, y, w, mask, 0xFFFF);
+    }
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    static uint16_t reference[RES * RES];
+    printf("=== %d px profile ===\n", RES);
+
+    // Arc: same four-zone fill, spans against masks
+    clear_frame();
+    arc_spans();
+    memcpy(reference, frame, sizeof(frame));
+    clear_frame();
+    arc_masks();
+    printf("arc: %d of %d pixels differ by more than 1/4 of a channel (radial cuts, edge rounding)\n",
+           (int)frame_diff(reference, frame), RES * RES);
+
+    double start = now_us();
+    for (int i = 0; i < ARC_ITERATIONS; i++) arc_spans();
+    double spans_us = (now_us() - start) / ARC_ITERATIONS;
+    uint32_t sink = frame_checksum();
+
+    start = now_us();
+    for (int i = 0; i < ARC_ITERATIONS; i++) arc_masks();
+    double masks_us = (now_us() - start) / ARC_ITERATIONS;
+    sink += frame_checksum();
+
+    printf("arc fill (270 deg, 4 zones): spans %.1f us, per-pixel masks %.1f us (x%.1f)\n",
+           spans_us, masks_us, masks_us / spans_us);
+
+    // Needle: build the cache, then sweep the 270 degree scale in sprite steps
+    sprites.length = BENCH_NEEDLE_LENGTH;
+    sprites.width = BENCH_NEEDLE_WIDTH;
+    sprites.steps = SPRITE_STEPS;
+    start = now_us();
+    uint32_t bytes = gauge_needle_raster_size(&sprites, host_sin);
+    void *buf = malloc(bytes);
+    if (!buf) return 1;
+    gauge_needle_raster_build(&sprites, buf, host_sin);
+    double build_us = now_us() - start;
+    printf("needle sprites (%d px long, %d px wide, %d steps/deg): %u B, built in %.0f us\n",
+           BENCH_NEEDLE_LENGTH, BENCH_NEEDLE_WIDTH, SPRITE_STEPS, (unsigned)bytes, build_us);
+
+    const int32_t first = 135 * SPRITE_STEPS;
+    const int32_t last = 405 * SPRITE_STEPS;
+    int32_t worst = 0;
+    for (int32_t angle = first; angle <= last; angle += 7) {
+        clear_frame();
+        needle_sprites(angle);
+        memcpy(reference, frame, sizeof(frame));
+        clear_frame();
+        needle_masks(angle);
+        int32_t diff = frame_diff(reference, frame);
+        if (diff > worst) worst = diff;
+    }
+    printf("needle: at most %d pixels differ by more than 1/4 of a channel (sine interpolation)\n", (int)worst);
+
+    int32_t draws = 0;
+    start = now_us();
+    for (int sweep = 0; sweep < NEEDLE_SWEEPS; sweep++) {
+        for (int32_t angle = first; angle <= last; angle++, draws++) needle_sprites(angle);
+    }
+    double sprite_us = (now_us() - start) / draws;
+    sink += frame_checksum();
+
+    start = now_us();
+    for (int sweep = 0; sweep < NEEDLE_SWEEPS; sweep++) {
+        for (int32_t angle = first; angle <= last; angle++) needle_masks(angle);
+    }
+    double line_us = (now_us() - start) / draws;
+    sink += frame_checksum();
+
+    printf("needle draw (mean over the scale): sprites %.2f us, per-pixel line mask %.2f us (x%.1f)\n",
+           sprite_us, line_us, line_us / sprite_us);
+    printf("(checksum %08x)\n", (unsigned)sink);
+
+    free(buf);
+    return 0;
+}
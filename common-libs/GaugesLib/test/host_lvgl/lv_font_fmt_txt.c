@@ -0,0 +1,78 @@
+// Glyph lookup of the LVGL 8.4 built-in font format for host tests (see lvgl.h
+// here): the character maps pack_fonts.py writes, no kerning, no compression.
+
+#include "lvgl.h"
+
+const lv_font_t lv_font_montserrat_14;
+
+/**
+ * @brief Index of a codepoint in a sparse list, -1 if absent
+ */
+static int32_t sparse_index(const lv_font_fmt_txt_cmap_t *cmap, uint32_t rcp) {
+    for (uint16_t i = 0; i < cmap->list_length; i++) {
+        if (cmap->unicode_list[i] == rcp) return i;
+    }
+    return -1;
+}
+
+static uint32_t glyph_id(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t letter) {
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if (letter < cmap->range_start || rcp >= cmap->range_length) continue;
+
+        int32_t index;
+        switch (cmap->type) {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                return cmap->glyph_id_start + rcp;
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                return cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+                index = sparse_index(cmap, rcp);
+                if (index >= 0) return cmap->glyph_id_start + (uint32_t)index;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+                index = sparse_index(cmap, rcp);
+                if (index >= 0) return cmap->glyph_id_start + ((const uint16_t *)cmap->glyph_id_ofs_list)[index];
+                break;
+        }
+    }
+    return 0;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next) {
+    (void)unicode_letter_next;
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = glyph_id(fdsc, unicode_letter);
+    if (!gid) return false;
+
+    const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+    dsc_out->adv_w = (uint16_t)((gdsc->adv_w + (1 << 3)) >> 4);
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->bpp = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    return true;
+}
+
+const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter) {
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = glyph_id(fdsc, letter);
+    if (!gid) return NULL;
+    return &fdsc->glyph_bitmap[fdsc->glyph_dsc[gid].bitmap_index];
+}
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                           uint32_t letter_next) {
+    dsc_out->resolved_font = NULL;
+    if (!font->get_glyph_dsc(font, dsc_out, letter, letter_next)) return false;
+    dsc_out->resolved_font = font;
+    return true;
+}
+
+const uint8_t * lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter) {
+    return font->get_glyph_bitmap(font, letter);
+}
@@ -0,0 +1,120 @@
+#ifndef HOST_LVGL_H
+#define HOST_LVGL_H
+
+// ============================================================================
+// Font part of the LVGL 8.4 API for host tests
+// ============================================================================
+// Just enough of lvgl.h to build the font pack loader (gauge_fonts.c) without
+// an LVGL checkout: the lv_font_t / lv_font_fmt_txt types with LVGL's layout
+// (LV_FONT_FMT_TXT_LARGE = 0, LV_USE_USER_DATA = 1) and, in lv_font_fmt_txt.c
+// here, the glyph lookup of the formats pack_fonts.py writes. Nothing else of
+// LVGL is declared, so a gauge source that needs more does not build with it.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define LVGL_VERSION_MAJOR 8
+#define LVGL_VERSION_MINOR 4
+#define LVGL_VERSION_PATCH 0
+
+#define LV_LOG_WARN(...)    do {} while (0)
+
+typedef int16_t lv_coord_t;
+
+// ============================================================================
+// lv_font.h
+// ============================================================================
+
+typedef struct {
+    const struct _lv_font_t *resolved_font;
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t bpp: 4;
+    uint8_t is_placeholder: 1;
+} lv_font_glyph_dsc_t;
+
+enum {
+    LV_FONT_SUBPX_NONE,
+    LV_FONT_SUBPX_HOR,
+    LV_FONT_SUBPX_VER,
+    LV_FONT_SUBPX_BOTH,
+};
+
+typedef struct _lv_font_t {
+    bool (*get_glyph_dsc)(const struct _lv_font_t *, lv_font_glyph_dsc_t *, uint32_t letter, uint32_t letter_next);
+    const uint8_t * (*get_glyph_bitmap)(const struct _lv_font_t *, uint32_t);
+    lv_coord_t line_height;
+    lv_coord_t base_line;
+    uint8_t subpx: 2;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    const void *dsc;
+    const struct _lv_font_t *fallback;
+    void *user_data;
+} lv_font_t;
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                           uint32_t letter_next);
+const uint8_t * lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter);
+
+extern const lv_font_t lv_font_montserrat_14;
+#define LV_FONT_DEFAULT &lv_font_montserrat_14
+
+// ============================================================================
+// lv_font_fmt_txt.h
+// ============================================================================
+
+typedef struct {
+    uint32_t bitmap_index : 20;
+    uint32_t adv_w : 12;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+} lv_font_fmt_txt_glyph_dsc_t;
+
+enum _lv_font_fmt_txt_cmap_type_t {
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_FULL,
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+};
+typedef uint8_t lv_font_fmt_txt_cmap_type_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    const uint16_t *unicode_list;
+    const void *glyph_id_ofs_list;
+    uint16_t list_length;
+    lv_font_fmt_txt_cmap_type_t type;
+} lv_font_fmt_txt_cmap_t;
+
+typedef struct {
+    uint32_t last_letter;
+    uint32_t last_glyph_id;
+} lv_font_fmt_txt_glyph_cache_t;
+
+typedef struct {
+    const uint8_t *glyph_bitmap;
+    const lv_font_fmt_txt_glyph_dsc_t *glyph_dsc;
+    const lv_font_fmt_txt_cmap_t *cmaps;
+    const void *kern_dsc;
+    uint16_t kern_scale;
+    uint16_t cmap_num : 9;
+    uint16_t bpp : 4;
+    uint16_t kern_classes : 1;
+    uint16_t bitmap_format : 2;
+    lv_font_fmt_txt_glyph_cache_t *cache;
+} lv_font_fmt_txt_dsc_t;
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next);
+const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter);
+
+#endif // HOST_LVGL_H
@@ -0,0 +1,49 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+// ============================================================================
+// Minimal host test helpers
+// ============================================================================
+// The modules that do not need LVGL or the board (gauge_model.c,
+// burn_in_shift.cpp, and gauge_fonts.c with the font API of host_lvgl/) are
+// tested on the development machine with its own compiler: see
+// run_host_tests.sh here and in waveshare-oled-143/test. A failed check prints
+// its location and the test binary exits non-zero.
+
+#include <stdio.h>
+#include <string.h>
+
+static int host_test_failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+        host_test_failures++; \
+    } \
+} while (0)
+
+#define CHECK_EQ(actual, expected) do { \
+    long long a_ = (long long)(actual), e_ = (long long)(expected); \
+    if (a_ != e_) { \
+        printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+        host_test_failures++; \
+    } \
+} while (0)
+
+#define CHECK_STR(actual, expected) do { \
+    const char *a_ = (actual), *e_ = (expected); \
+    if (strcmp(a_, e_) != 0) { \
+        printf("%s:%d: %s is \"%s\", expected \"%s\"\n", __FILE__, __LINE__, #actual, a_, e_); \
+        host_test_failures++; \
+    } \
+} while (0)
+
+#define RUN_TEST(fn) do { \
+    int before_ = host_test_failures; \
+    fn(); \
+    printf("%s %s\n", host_test_failures == before_ ? "PASS" : "FAIL", #fn); \
+} while (0)
+
+#define HOST_TEST_RESULT() (host_test_failures == 0 ? 0 : 1)
+
+#endif // HOST_TEST_H
@@ -0,0 +1,48 @@
+#ifndef HOST_LV_CONF_H
+#define HOST_LV_CONF_H
+
+// ============================================================================
+// LVGL configuration of the host LVGL benchmark (bench_lvgl.c)
+// ============================================================================
+// The lv_conf.h of the board that runs the screen profile, so LVGL draws with
+// the same color format, draw options and caches as on the device. Only the
+// hooks that need the board are moved to the host: the tick, the heap (64-bit
+// objects do not fit the board's pool) and the assert handler. The performance
+// monitor is off so nothing is drawn over the benchmark screens.
+
+#if GAUGE_SCREEN_RES == 240
+    #include "../../../esp-tft-128-2424S01c/include/lv_conf.h"
+#else
+    #include "../../../waveshare-oled-143/include/lv_conf.h"
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+uint32_t bench_tick_ms(void);
+
+#undef LV_TICK_CUSTOM
+#undef LV_TICK_CUSTOM_INCLUDE
+#undef LV_TICK_CUSTOM_SYS_TIME_EXPR
+#define LV_TICK_CUSTOM 1
+#define LV_TICK_CUSTOM_INCLUDE <stdint.h>
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (bench_tick_ms())
+
+#undef LV_MEM_CUSTOM
+#undef LV_MEM_CUSTOM_INCLUDE
+#undef LV_MEM_CUSTOM_ALLOC
+#undef LV_MEM_CUSTOM_FREE
+#undef LV_MEM_CUSTOM_REALLOC
+#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM_INCLUDE <stdlib.h>
+#define LV_MEM_CUSTOM_ALLOC   malloc
+#define LV_MEM_CUSTOM_FREE    free
+#define LV_MEM_CUSTOM_REALLOC realloc
+
+#undef LV_ASSERT_HANDLER
+#define LV_ASSERT_HANDLER abort();
+
+#undef LV_USE_PERF_MONITOR
+#define LV_USE_PERF_MONITOR 0
+
+#endif // HOST_LV_CONF_H
@@ -0,0 +1,60 @@
+#!/bin/sh
+# Build and run the host tests of the gauge library: the modules that need
+# neither LVGL nor the board, compiled with the development machine's C compiler.
+# With LVGL_DIR the benchmarks also build LVGL to time the real renderer.
+#
+#     common-libs/GaugesLib/test/run_host_tests.sh        (CC=clang to change compiler)
+#     common-libs/GaugesLib/test/run_host_tests.sh --bench   (also time the rasterizers)
+#     LVGL_DIR=<lvgl 8.4 checkout> .../run_host_tests.sh --bench   (also against LVGL)
+#
+# Exits non-zero if a test fails to build or a check fails.
+set -e
+[ -n "$LVGL_DIR" ] && LVGL_DIR=$(cd "$LVGL_DIR" && pwd)
+cd "$(dirname "$0")"
+
+CC=${CC:-cc}
+CFLAGS="-std=c11 -O2 -Wall -Wextra -Werror -I. -I../src/gauges"
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+# LVGL with the board's lv_conf.h (lv_conf.h here) and the whole gauge library,
+# once per profile since the configuration differs
+run_lvgl() {
+    res=$1
+    obj="$BUILD/lvgl_$res"
+    flags="-std=gnu11 -O2 -DLV_CONF_INCLUDE_SIMPLE -DGAUGE_SCREEN_RES=$res -DGAUGE_ARC_BENCHMARK=1 -DGAUGE_DIGITS_BENCHMARK=1 -I. -I$LVGL_DIR -I../src/gauges"
+    mkdir -p "$obj"
+    find "$LVGL_DIR/src" -name '*.c' | while read -r src; do
+        $CC $flags -w -c "$src" -o "$obj/$(echo "$src" | tr / _).o"
+    done
+    $CC $flags -Wall bench_lvgl.c ../src/gauges/*.c "$obj"/*.o -o "$BUILD/bench_lvgl_$res" -lm
+    "$BUILD/bench_lvgl_$res"
+}
+
+run() {
+    name=$1
+    shift
+    $CC $CFLAGS "$@" -o "$BUILD/$name" -lm
+    "$BUILD/$name"
+}
+
+run test_gauge_model test_gauge_model.c ../src/gauges/gauge_model.c
+
+# Font pack loader: the host mmap path, on a pack of src/fonts and damaged copies
+python3 ../scripts/pack_fonts.py "$BUILD/fonts.bin" > /dev/null
+$CC $CFLAGS -D_DEFAULT_SOURCE -DGAUGE_SCREEN_RES=466 -DGAUGE_FONT_PARTITION=1 -Ihost_lvgl -o "$BUILD/test_gauge_fonts" \
+    test_gauge_fonts.c ../src/gauges/gauge_fonts.c host_lvgl/lv_font_fmt_txt.c
+"$BUILD/test_gauge_fonts" "$BUILD/fonts.bin"
+
+if [ "$1" = "--bench" ]; then
+    for res in 466 240; do
+        run bench_raster_$res -DGAUGE_SCREEN_RES=$res bench_raster.c ../src/gauges/gauge_raster.c
+    done
+    if [ -n "$LVGL_DIR" ]; then
+        for res in 466 240; do
+            run_lvgl $res
+        done
+    else
+        echo "bench_lvgl skipped: set LVGL_DIR to an LVGL 8.4 checkout"
+    fi
+fi
@@ -0,0 +1,304 @@
+// Host tests of the font pack loader (src/gauges/gauge_fonts.c, host mmap path)
+//
+//     test/run_host_tests.sh
+//
+// The script packs src/fonts with scripts/pack_fonts.py and passes the file.
+// The loader is built with GAUGE_FONT_PARTITION = 1 against the font part of
+// the LVGL API in host_lvgl/. Damaged packs are written next to the pack.
+
+#include "host_test.h"
+#include "gauge_fonts.h"
+#include <stdlib.h>
+
+static const char *pack_path;
+static char scratch_path[512];
+
+static uint8_t *pack;           // The pack as written by pack_fonts.py
+static uint32_t pack_len;
+
+// ============================================================================
+// FIXTURES
+// ============================================================================
+
+static bool read_pack(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    pack = malloc((size_t)len);
+    bool ok = pack && len > 0 && fread(pack, 1, (size_t)len, f) == (size_t)len;
+    fclose(f);
+    pack_len = (uint32_t)len;
+    return ok;
+}
+
+static const gauge_fonts_pack_header_t *pack_header(const uint8_t *data) {
+    return (const gauge_fonts_pack_header_t *)data;
+}
+
+static const gauge_fonts_entry_t *pack_entry(const uint8_t *data, uint16_t index) {
+    return (const gauge_fonts_entry_t *)(data + sizeof(gauge_fonts_pack_header_t)) + index;
+}
+
+static const gauge_fonts_font_header_t *font_header(const uint8_t *data, uint16_t index) {
+    return (const gauge_fonts_font_header_t *)(data + pack_entry(data, index)->offset);
+}
+
+/**
+ * @brief Writable copy of the pack, to damage and mount with mount_copy()
+ */
+static uint8_t *copy_pack(void) {
+    uint8_t *copy = malloc(pack_len);
+    if (copy) memcpy(copy, pack, pack_len);
+    return copy;
+}
+
+static bool write_scratch(const uint8_t *data, uint32_t len) {
+    FILE *f = fopen(scratch_path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(data, 1, len, f) == len;
+    fclose(f);
+    return ok;
+}
+
+/**
+ * @brief Mount a damaged copy, leaves it mounted if valid
+ */
+static bool mount_copy(const uint8_t *data, uint32_t len) {
+    gauge_fonts_unmount();
+    CHECK(write_scratch(data, len));
+    return gauge_fonts_mount_file(scratch_path);
+}
+
+// ============================================================================
+// MOUNT
+// ============================================================================
+
+static void test_mount_missing_file(void) {
+    gauge_fonts_unmount();
+    CHECK(!gauge_fonts_mount_file("/nonexistent/fonts.bin"));
+    CHECK(gauge_fonts_find("montserrat_bold_80") == NULL);
+}
+
+static void test_mount_registers_every_font(void) {
+    gauge_fonts_unmount();
+    CHECK(gauge_fonts_mount_file(pack_path));
+    CHECK(gauge_fonts_mount_file(pack_path));  // Already mounted
+
+    const gauge_fonts_pack_header_t *hdr = pack_header(pack);
+    CHECK(hdr->font_count > 0);
+    for (uint16_t i = 0; i < hdr->font_count; i++) {
+        const lv_font_t *font = gauge_fonts_find(pack_entry(pack, i)->name);
+        CHECK(font != NULL);
+        if (!font) continue;
+        CHECK(gauge_fonts_get(pack_entry(pack, i)->name) == font);
+        CHECK_EQ(font->line_height, font_header(pack, i)->line_height);
+        CHECK_EQ(font->base_line, font_header(pack, i)->base_line);
+        CHECK(font->fallback == NULL);
+    }
+}
+
+static void test_unknown_font(void) {
+    gauge_fonts_unmount();
+    CHECK(gauge_fonts_mount_file(pack_path));
+    CHECK(gauge_fonts_find("montserrat_bold_81") == NULL);
+    CHECK(gauge_fonts_find("") == NULL);
+    CHECK(gauge_fonts_find(NULL) == NULL);
+    CHECK(gauge_fonts_get("montserrat_bold_81") == LV_FONT_DEFAULT);
+}
+
+static void test_unmount_forgets_fonts(void) {
+    CHECK(gauge_fonts_mount_file(pack_path));
+    gauge_fonts_unmount();
+    CHECK(gauge_fonts_find(pack_entry(pack, 0)->name) == NULL);
+    CHECK(gauge_fonts_get(pack_entry(pack, 0)->name) == LV_FONT_DEFAULT);
+    gauge_fonts_unmount();  // Twice is harmless
+}
+
+// ============================================================================
+// ZERO COPY
+// ============================================================================
+
+/**
+ * @brief Every glyph of every character map resolves to data inside the mapping
+ *
+ * The mapping's address is not exported: it is recovered from the first
+ * font's bitmap pointer, then every descriptor, list and bitmap of every font
+ * must point at its pack offset from there, and the bytes there must be the
+ * file's.
+ */
+static void test_glyphs_resolve_into_mapping(void) {
+    gauge_fonts_unmount();
+    CHECK(gauge_fonts_mount_file(pack_path));
+
+    const gauge_fonts_pack_header_t *hdr = pack_header(pack);
+    const lv_font_t *first = gauge_fonts_find(pack_entry(pack, 0)->name);
+    CHECK(first != NULL);
+    if (!first) return;
+    const uint8_t *base = ((const lv_font_fmt_txt_dsc_t *)first->dsc)->glyph_bitmap - font_header(pack, 0)->bitmap_offset;
+    CHECK(base != pack);
+    CHECK(memcmp(base, pack, hdr->size) == 0);
+
+    uint32_t glyphs = 0;
+    for (uint16_t i = 0; i < hdr->font_count; i++) {
+        const gauge_fonts_font_header_t *fh = font_header(pack, i);
+        const lv_font_t *font = gauge_fonts_find(pack_entry(pack, i)->name);
+        if (!font) continue;
+        const lv_font_fmt_txt_dsc_t *dsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+        CHECK(dsc->glyph_bitmap == base + fh->bitmap_offset);
+        CHECK((const uint8_t *)dsc->glyph_dsc == base + fh->glyph_dsc_offset);
+        CHECK_EQ(dsc->bpp, fh->bpp);
+        CHECK_EQ(dsc->cmap_num, fh->cmap_count);
+
+        const gauge_fonts_cmap_t *cmaps = (const gauge_fonts_cmap_t *)(fh + 1);
+        uint32_t font_glyphs = 0;
+        for (uint8_t c = 0; c < fh->cmap_count; c++) {
+            if (cmaps[c].unicode_list_offset) {
+                CHECK((const uint8_t *)dsc->cmaps[c].unicode_list == base + cmaps[c].unicode_list_offset);
+            }
+            uint32_t count = cmaps[c].unicode_list_offset ? cmaps[c].list_length : cmaps[c].range_length;
+            for (uint32_t k = 0; k < count; k++) {
+                uint32_t letter = cmaps[c].range_start;
+                if (cmaps[c].unicode_list_offset) {
+                    letter += ((const uint16_t *)(pack + cmaps[c].unicode_list_offset))[k];
+                } else {
+                    letter += k;
+                }
+
+                lv_font_glyph_dsc_t g;
+                CHECK(lv_font_get_glyph_dsc(font, &g, letter, 0));
+                const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, letter);
+                uint32_t bytes = ((uint32_t)g.box_w * g.box_h * fh->bpp + 7) / 8;
+                CHECK(bitmap >= base + fh->bitmap_offset);
+                CHECK(bitmap + bytes <= base + fh->bitmap_offset + fh->bitmap_size);
+                font_glyphs++;
+            }
+        }
+        CHECK_EQ(font_glyphs, fh->glyph_count - 1);  // Every glyph but the reserved 0
+        glyphs += font_glyphs;
+    }
+    CHECK(glyphs > 0);
+
+    // The digits of the readout font, and nothing else
+    const lv_font_t *digits = gauge_fonts_find("montserrat_bold_numbers_120");
+    CHECK(digits != NULL);
+    if (digits) {
+        lv_font_glyph_dsc_t g;
+        CHECK(lv_font_get_glyph_dsc(digits, &g, '7', 0));
+        CHECK(g.box_w > 0 && g.box_h > 0);
+        CHECK(!lv_font_get_glyph_dsc(digits, &g, 'A', 0));
+        CHECK(lv_font_get_glyph_bitmap(digits, 'A') == NULL);
+    }
+}
+
+// ============================================================================
+// DAMAGED PACKS
+// ============================================================================
+
+static void test_rejects_bad_magic_and_version(void) {
+    uint8_t *copy = copy_pack();
+    if (!copy) return;
+    gauge_fonts_pack_header_t *hdr = (gauge_fonts_pack_header_t *)copy;
+
+    hdr->magic ^= 1;
+    CHECK(!mount_copy(copy, pack_len));
+    CHECK(gauge_fonts_find(pack_entry(pack, 0)->name) == NULL);
+    hdr->magic ^= 1;
+
+    hdr->version++;
+    CHECK(!mount_copy(copy, pack_len));
+    hdr->version--;
+
+    CHECK(mount_copy(copy, pack_len));  // Restored
+    gauge_fonts_unmount();
+    free(copy);
+}
+
+static void test_rejects_truncated_pack(void) {
+    // File shorter than the size in the header
+    CHECK(!mount_copy(pack, pack_len / 2));
+    CHECK(!mount_copy(pack, sizeof(gauge_fonts_pack_header_t) - 1));
+    CHECK(gauge_fonts_find(pack_entry(pack, 0)->name) == NULL);
+
+    // Header size cutting into the font data: every font is out of bounds
+    uint8_t *copy = copy_pack();
+    if (!copy) return;
+    gauge_fonts_pack_header_t *hdr = (gauge_fonts_pack_header_t *)copy;
+    uint32_t first_font = pack_entry(pack, 0)->offset;
+    for (uint16_t i = 1; i < hdr->font_count; i++) {
+        if (pack_entry(pack, i)->offset < first_font) first_font = pack_entry(pack, i)->offset;
+    }
+    hdr->size = first_font + sizeof(gauge_fonts_font_header_t);
+    CHECK(!mount_copy(copy, pack_len));
+
+    // Directory longer than the pack
+    memcpy(copy, pack, pack_len);
+    hdr->font_count = 0xFFFF;
+    CHECK(!mount_copy(copy, pack_len));
+
+    gauge_fonts_unmount();
+    free(copy);
+}
+
+static void test_rejects_damaged_font_only(void) {
+    uint8_t *copy = copy_pack();
+    if (!copy) return;
+    const char *damaged = pack_entry(pack, 0)->name;
+    gauge_fonts_font_header_t *fh = (gauge_fonts_font_header_t *)(copy + pack_entry(pack, 0)->offset);
+
+    // A glyph bitmap past the font's bitmap block
+    lv_font_fmt_txt_glyph_dsc_t *glyphs = (lv_font_fmt_txt_glyph_dsc_t *)(copy + fh->glyph_dsc_offset);
+    glyphs[fh->glyph_count - 1].bitmap_index = fh->bitmap_size;
+    CHECK(mount_copy(copy, pack_len) == (pack_header(pack)->font_count > 1));
+    CHECK(gauge_fonts_find(damaged) == NULL);
+    if (pack_header(pack)->font_count > 1) CHECK(gauge_fonts_find(pack_entry(pack, 1)->name) != NULL);
+
+    // Font header outside the pack, unsupported bpp, no character map
+    memcpy(copy, pack, pack_len);
+    ((gauge_fonts_entry_t *)(copy + sizeof(gauge_fonts_pack_header_t)))->offset = pack_len;
+    mount_copy(copy, pack_len);
+    CHECK(gauge_fonts_find(damaged) == NULL);
+
+    memcpy(copy, pack, pack_len);
+    fh->bpp = 3;
+    mount_copy(copy, pack_len);
+    CHECK(gauge_fonts_find(damaged) == NULL);
+
+    memcpy(copy, pack, pack_len);
+    fh->cmap_count = 0;
+    mount_copy(copy, pack_len);
+    CHECK(gauge_fonts_find(damaged) == NULL);
+
+    // A name without its terminator is skipped
+    memcpy(copy, pack, pack_len);
+    memset(((gauge_fonts_entry_t *)(copy + sizeof(gauge_fonts_pack_header_t)))->name, 'x', GAUGE_FONTS_NAME_LEN);
+    mount_copy(copy, pack_len);
+    CHECK(gauge_fonts_find(damaged) == NULL);
+
+    gauge_fonts_unmount();
+    free(copy);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2 || !read_pack(argv[1])) {
+        printf("usage: %s <pack from scripts/pack_fonts.py>\n", argv[0]);
+        return 1;
+    }
+    pack_path = argv[1];
+    snprintf(scratch_path, sizeof(scratch_path), "%s.damaged", pack_path);
+
+    RUN_TEST(test_mount_missing_file);
+    RUN_TEST(test_mount_registers_every_font);
+    RUN_TEST(test_unknown_font);
+    RUN_TEST(test_unmount_forgets_fonts);
+    RUN_TEST(test_glyphs_resolve_into_mapping);
+    RUN_TEST(test_rejects_bad_magic_and_version);
+    RUN_TEST(test_rejects_truncated_pack);
+    RUN_TEST(test_rejects_damaged_font_only);
+
+    gauge_fonts_unmount();
+    remove(scratch_path);
+    free(pack);
+    return HOST_TEST_RESULT();
+}
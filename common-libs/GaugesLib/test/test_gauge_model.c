@@ -0,0 +1,353 @@
+// Host tests of the LVGL-free gauge model (src/gauges/gauge_model.c)
+//
+//     test/run_host_tests.sh
+
+#include "host_test.h"
+#include "gauge_model.h"
+#include <stdint.h>
+
+// ============================================================================
+// FIXTURES
+// ============================================================================
+
+// Temperature: grey below 80, green, amber from 120, red from 130, alert from 135
+static const gauge_model_config_t temp_config = {
+    .decimals = 0, .min = 60, .max = 160,
+    .zone_green = 80, .zone_orange = 120, .zone_red = 130,
+    .alert = 135, .low_rpm_divisor = 0.0f, .low_min = 0.0f
+};
+
+// Oil pressure in tenths of a bar, too low below rpm / 2000 (0.5 bar at idle)
+static const gauge_model_config_t pressure_config = {
+    .decimals = 1, .min = 0, .max = 80,
+    .zone_green = 0, .zone_orange = 50, .zone_red = 70,
+    .alert = 75, .low_rpm_divisor = 2000.0f, .low_min = 0.5f
+};
+
+static const gauge_model_config_t rpm_config = {
+    .decimals = 0, .min = 0, .max = 8000,
+    .zone_green = 0, .zone_orange = 6000, .zone_red = 7000,
+    .alert = 7000, .low_rpm_divisor = 0.0f, .low_min = 0.0f
+};
+
+static gauge_model_t fresh_state(void) {
+    gauge_model_t state;
+    memset(&state, 0, sizeof(state));
+    return state;
+}
+
+// ============================================================================
+// VALUES
+// ============================================================================
+
+static void test_value_format_decimals(void) {
+    char buf[GAUGE_MODEL_TEXT_LEN];
+
+    gauge_value_format(buf, sizeof(buf), 0, 0);
+    CHECK_STR(buf, "0");
+    gauge_value_format(buf, sizeof(buf), 95, 0);
+    CHECK_STR(buf, "95");
+    gauge_value_format(buf, sizeof(buf), 35, 1);
+    CHECK_STR(buf, "3.5");
+    gauge_value_format(buf, sizeof(buf), 0, 1);
+    CHECK_STR(buf, "0.0");
+    gauge_value_format(buf, sizeof(buf), 5, 1);
+    CHECK_STR(buf, "0.5");
+    gauge_value_format(buf, sizeof(buf), 25, 2);
+    CHECK_STR(buf, "0.25");
+    gauge_value_format(buf, sizeof(buf), 7, 2);
+    CHECK_STR(buf, "0.07");
+    gauge_value_format(buf, sizeof(buf), 12345, 2);
+    CHECK_STR(buf, "123.45");
+}
+
+static void test_value_format_negative(void) {
+    char buf[GAUGE_MODEL_TEXT_LEN];
+
+    gauge_value_format(buf, sizeof(buf), -12, 0);
+    CHECK_STR(buf, "-12");
+    gauge_value_format(buf, sizeof(buf), -5, 1);
+    CHECK_STR(buf, "-0.5");
+    gauge_value_format(buf, sizeof(buf), -1234, 2);
+    CHECK_STR(buf, "-12.34");
+
+    // Magnitude of INT32_MIN does not fit an int32_t
+    gauge_value_format(buf, sizeof(buf), INT32_MIN, 0);
+    CHECK_STR(buf, "-2147483648");
+    gauge_value_format(buf, sizeof(buf), INT32_MIN, 2);
+    CHECK_STR(buf, "-21474836.48");
+    gauge_value_format(buf, sizeof(buf), INT32_MAX, 1);
+    CHECK_STR(buf, "214748364.7");
+}
+
+static void test_value_format_truncation(void) {
+    char buf[8];
+
+    // Keeps the leading characters, always terminated
+    gauge_value_format(buf, 4, 12345, 0);
+    CHECK_STR(buf, "123");
+    gauge_value_format(buf, 4, -1234, 2);
+    CHECK_STR(buf, "-12");
+    gauge_value_format(buf, 1, 7, 0);
+    CHECK_STR(buf, "");
+
+    // Nothing written without room for the terminator
+    memcpy(buf, "xyz", 4);
+    gauge_value_format(buf, 0, 7, 0);
+    CHECK_STR(buf, "xyz");
+}
+
+static void test_value_to_fixed_rounds(void) {
+    CHECK_EQ(gauge_value_to_fixed(3.46f, 1), 35);
+    CHECK_EQ(gauge_value_to_fixed(3.44f, 1), 34);
+    CHECK_EQ(gauge_value_to_fixed(-3.46f, 1), -35);
+    CHECK_EQ(gauge_value_to_fixed(89.5f, 0), 90);
+    CHECK_EQ(gauge_value_to_fixed(0.249f, 2), 25);
+    CHECK_EQ(GAUGE_MODEL_FIXED(3.5, 1), 35);
+    CHECK_EQ(GAUGE_MODEL_FIXED(-0.25, 2), -25);
+}
+
+static void test_zone_for_value(void) {
+    CHECK_EQ(gauge_zone_for_value(79.9f, 80, 120, 130), GAUGE_ZONE_GREY);
+    CHECK_EQ(gauge_zone_for_value(80.0f, 80, 120, 130), GAUGE_ZONE_GREEN);
+    CHECK_EQ(gauge_zone_for_value(120.0f, 80, 120, 130), GAUGE_ZONE_AMBER);
+    CHECK_EQ(gauge_zone_for_value(130.0f, 80, 120, 130), GAUGE_ZONE_RED);
+}
+
+// ============================================================================
+// EVALUATION
+// ============================================================================
+
+static void test_update_first_and_unchanged(void) {
+    gauge_model_t state = fresh_state();
+
+    CHECK_EQ(gauge_model_update(&temp_config, 90.0f, 0.0f, &state), GAUGE_MODEL_ALL);
+    CHECK(state.valid);
+    CHECK_EQ(state.value, 90);
+    CHECK_EQ(state.position, 90);
+    CHECK_EQ(state.zone, GAUGE_ZONE_GREEN);
+    CHECK(!state.alert && !state.low);
+    CHECK_STR(state.text, "90");
+
+    // Same value, and noise below the display resolution: nothing to apply
+    CHECK_EQ(gauge_model_update(&temp_config, 90.0f, 0.0f, &state), 0);
+    CHECK_EQ(gauge_model_update(&temp_config, 90.4f, 0.0f, &state), 0);
+    CHECK_EQ(gauge_model_update(&temp_config, 89.6f, 0.0f, &state), 0);
+
+    // One display unit: readout and position, same zone
+    CHECK_EQ(gauge_model_update(&temp_config, 91.0f, 0.0f, &state), GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION);
+    CHECK_STR(state.text, "91");
+}
+
+static void test_update_text_formatted_only_on_change(void) {
+    gauge_model_t state = fresh_state();
+    gauge_model_update(&temp_config, 100.0f, 0.0f, &state);
+
+    // A value that rounds to the same readout keeps the text untouched
+    memcpy(state.text, "kept", 5);
+    gauge_model_update(&temp_config, 100.2f, 0.0f, &state);
+    CHECK_STR(state.text, "kept");
+
+    gauge_model_update(&temp_config, 101.0f, 0.0f, &state);
+    CHECK_STR(state.text, "101");
+}
+
+static void test_update_zone_thresholds(void) {
+    gauge_model_t state = fresh_state();
+    gauge_model_update(&temp_config, 119.0f, 0.0f, &state);
+    CHECK_EQ(state.zone, GAUGE_ZONE_GREEN);
+
+    // Zones change exactly at the threshold, in both directions. Values are
+    // compared at the display resolution: 119.4 rounds to 119 and stays green,
+    // 119.5 rounds to 120 and is amber.
+    CHECK_EQ(gauge_model_update(&temp_config, 119.4f, 0.0f, &state), 0);
+    CHECK_EQ(gauge_model_update(&temp_config, 119.5f, 0.0f, &state),
+             GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ZONE);
+    CHECK_EQ(state.zone, GAUGE_ZONE_AMBER);
+    CHECK_EQ(gauge_model_update(&temp_config, 121.0f, 0.0f, &state), GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION);
+    CHECK_EQ(gauge_model_update(&temp_config, 119.0f, 0.0f, &state),
+             GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ZONE);
+    CHECK_EQ(state.zone, GAUGE_ZONE_GREEN);
+
+    gauge_model_update(&temp_config, 70.0f, 0.0f, &state);
+    CHECK_EQ(state.zone, GAUGE_ZONE_GREY);
+    gauge_model_update(&temp_config, 130.0f, 0.0f, &state);
+    CHECK_EQ(state.zone, GAUGE_ZONE_RED);
+    CHECK(!state.alert);
+}
+
+static void test_update_alert(void) {
+    gauge_model_t state = fresh_state();
+    gauge_model_update(&temp_config, 134.0f, 0.0f, &state);
+    CHECK(!state.alert);
+
+    CHECK_EQ(gauge_model_update(&temp_config, 135.0f, 0.0f, &state),
+             GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ALERT);
+    CHECK(state.alert);
+    CHECK_EQ(gauge_model_update(&temp_config, 134.0f, 0.0f, &state),
+             GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ALERT);
+    CHECK(!state.alert);
+}
+
+static void test_update_clamps_position(void) {
+    gauge_model_t state = fresh_state();
+
+    // Readout shows the actual value, the arc / needle / bar stays on the scale
+    gauge_model_update(&temp_config, 170.0f, 0.0f, &state);
+    CHECK_EQ(state.value, 170);
+    CHECK_EQ(state.position, 160);
+    CHECK_EQ(gauge_model_update(&temp_config, 175.0f, 0.0f, &state), GAUGE_MODEL_TEXT);
+    CHECK_EQ(state.position, 160);
+
+    gauge_model_update(&temp_config, 20.0f, 0.0f, &state);
+    CHECK_EQ(state.position, 60);
+    CHECK_STR(state.text, "20");
+}
+
+static void test_update_low_pressure_for_rpm(void) {
+    gauge_model_t state = fresh_state();
+
+    // Idle: the limit is low_min (0.5 bar)
+    gauge_model_update(&pressure_config, 0.6f, 800.0f, &state);
+    CHECK(!state.low);
+    CHECK_EQ(state.zone, GAUGE_ZONE_GREEN);
+    CHECK_STR(state.text, "0.6");
+
+    // 3000 RPM: 1.5 bar minimum, the same 0.6 bar is too low
+    CHECK_EQ(gauge_model_update(&pressure_config, 0.6f, 3000.0f, &state),
+             GAUGE_MODEL_ZONE | GAUGE_MODEL_LOW | GAUGE_MODEL_ALERT);
+    CHECK(state.low && state.alert);
+    CHECK_EQ(state.zone, GAUGE_ZONE_RED);
+
+    CHECK_EQ(gauge_model_update(&pressure_config, 1.6f, 3000.0f, &state),
+             GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ZONE | GAUGE_MODEL_LOW | GAUGE_MODEL_ALERT);
+    CHECK(!state.low && !state.alert);
+    CHECK_STR(state.text, "1.6");
+
+    // Too high still alerts without being low
+    gauge_model_update(&pressure_config, 7.6f, 3000.0f, &state);
+    CHECK(state.alert && !state.low);
+    CHECK_EQ(state.zone, GAUGE_ZONE_RED);
+
+    // No divisor: RPM is ignored
+    gauge_model_t temp = fresh_state();
+    gauge_model_update(&temp_config, 90.0f, 9000.0f, &temp);
+    CHECK(!temp.low);
+}
+
+static void test_update_after_reset_or_new_decimals(void) {
+    gauge_model_t state = fresh_state();
+    gauge_model_update(&temp_config, 90.0f, 0.0f, &state);
+
+    gauge_model_reset(&state);
+    CHECK_EQ(gauge_model_update(&temp_config, 90.0f, 0.0f, &state), GAUGE_MODEL_ALL);
+
+    // Same state used with another resolution (layout pack reloaded)
+    gauge_model_config_t tenths = temp_config;
+    tenths.decimals = 1;
+    CHECK_EQ(gauge_model_update(&tenths, 90.0f, 0.0f, &state), GAUGE_MODEL_ALL);
+    CHECK_EQ(state.value, 900);
+    CHECK_STR(state.text, "90.0");
+}
+
+static void test_update_all_channels(void) {
+    const gauge_model_config_t *configs[GAUGE_CHANNEL_COUNT] = {
+        [GAUGE_CHANNEL_OIL_TEMP] = &temp_config,
+        [GAUGE_CHANNEL_WATER_TEMP] = &temp_config,
+        [GAUGE_CHANNEL_OIL_PRESSURE] = &pressure_config,
+        [GAUGE_CHANNEL_RPM] = &rpm_config,
+    };
+    gauge_model_t states[GAUGE_CHANNEL_COUNT];
+    memset(states, 0, sizeof(states));
+
+    float values[GAUGE_CHANNEL_COUNT] = {100.0f, 90.0f, 2.0f, 3000.0f};
+    CHECK_EQ(gauge_model_update_all(configs, values, states), (1u << GAUGE_CHANNEL_COUNT) - 1);
+    CHECK_EQ(gauge_model_update_all(configs, values, states), 0);
+
+    // Only the water temperature moves
+    values[GAUGE_CHANNEL_WATER_TEMP] = 91.0f;
+    CHECK_EQ(gauge_model_update_all(configs, values, states), 1u << GAUGE_CHANNEL_WATER_TEMP);
+
+    // RPM rises: the oil pressure limit follows (4.0 bar at 8000 RPM)
+    values[GAUGE_CHANNEL_RPM] = 8000.0f;
+    CHECK_EQ(gauge_model_update_all(configs, values, states),
+             (1u << GAUGE_CHANNEL_OIL_PRESSURE) | (1u << GAUGE_CHANNEL_RPM));
+    CHECK(states[GAUGE_CHANNEL_OIL_PRESSURE].low);
+}
+
+// ============================================================================
+// SYNC
+// ============================================================================
+
+static void test_sync_reports_only_changes(void) {
+    gauge_model_t model = fresh_state();
+    gauge_model_t shown = fresh_state();
+
+    // Nothing evaluated yet: the view keeps what it shows
+    CHECK_EQ(gauge_model_sync(&shown, &model), 0);
+    CHECK(!shown.valid);
+
+    gauge_model_update(&temp_config, 100.0f, 0.0f, &model);
+    CHECK_EQ(gauge_model_sync(&shown, &model), GAUGE_MODEL_ALL);
+    CHECK(shown.valid);
+    CHECK_STR(shown.text, "100");
+    CHECK_EQ(gauge_model_sync(&shown, &model), 0);
+
+    // Several updates between two syncs: the net difference only
+    gauge_model_update(&temp_config, 125.0f, 0.0f, &model);
+    gauge_model_update(&temp_config, 100.0f, 0.0f, &model);
+    CHECK_EQ(gauge_model_sync(&shown, &model), 0);
+
+    gauge_model_update(&temp_config, 121.0f, 0.0f, &model);
+    CHECK_EQ(gauge_model_sync(&shown, &model), GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ZONE);
+    CHECK_EQ(shown.zone, GAUGE_ZONE_AMBER);
+    CHECK_STR(shown.text, "121");
+
+    // Beyond the scale: the readout changes, the position does not
+    gauge_model_update(&temp_config, 170.0f, 0.0f, &model);
+    gauge_model_sync(&shown, &model);
+    gauge_model_update(&temp_config, 180.0f, 0.0f, &model);
+    CHECK_EQ(gauge_model_sync(&shown, &model), GAUGE_MODEL_TEXT);
+
+    // A view rebuilt from a zeroed state gets everything again
+    gauge_model_t rebuilt = fresh_state();
+    CHECK_EQ(gauge_model_sync(&rebuilt, &model), GAUGE_MODEL_ALL);
+}
+
+static void test_sync_per_view(void) {
+    gauge_model_t model = fresh_state();
+    gauge_model_t arc_view = fresh_state();
+    gauge_model_t bar_view = fresh_state();
+
+    gauge_model_update(&pressure_config, 2.0f, 800.0f, &model);
+    gauge_model_sync(&arc_view, &model);
+    gauge_model_sync(&bar_view, &model);
+
+    // The arc view misses one sample: each view gets its own difference
+    gauge_model_update(&pressure_config, 0.4f, 800.0f, &model);
+    CHECK_EQ(gauge_model_sync(&bar_view, &model),
+             GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ZONE | GAUGE_MODEL_LOW | GAUGE_MODEL_ALERT);
+    gauge_model_update(&pressure_config, 2.0f, 800.0f, &model);
+    CHECK_EQ(gauge_model_sync(&arc_view, &model), 0);
+    CHECK_EQ(gauge_model_sync(&bar_view, &model),
+             GAUGE_MODEL_TEXT | GAUGE_MODEL_POSITION | GAUGE_MODEL_ZONE | GAUGE_MODEL_LOW | GAUGE_MODEL_ALERT);
+}
+
+int main(void) {
+    RUN_TEST(test_value_format_decimals);
+    RUN_TEST(test_value_format_negative);
+    RUN_TEST(test_value_format_truncation);
+    RUN_TEST(test_value_to_fixed_rounds);
+    RUN_TEST(test_zone_for_value);
+    RUN_TEST(test_update_first_and_unchanged);
+    RUN_TEST(test_update_text_formatted_only_on_change);
+    RUN_TEST(test_update_zone_thresholds);
+    RUN_TEST(test_update_alert);
+    RUN_TEST(test_update_clamps_position);
+    RUN_TEST(test_update_low_pressure_for_rpm);
+    RUN_TEST(test_update_after_reset_or_new_decimals);
+    RUN_TEST(test_update_all_channels);
+    RUN_TEST(test_sync_reports_only_changes);
+    RUN_TEST(test_sync_per_view);
+    return HOST_TEST_RESULT();
+}
@@ -351,6 +351,9 @@
 
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
  *https://fonts.google.com/specimen/Montserrat*/
+/*Built-in fonts. GaugesLib/scripts/pio_fonts.py defines GAUGE_FONT_ENABLES and enables
+ *only the fonts an environment uses; this full list applies to builds without it.*/
+#ifndef GAUGE_FONT_ENABLES
 #define LV_FONT_MONTSERRAT_8  1
 #define LV_FONT_MONTSERRAT_10 1
 #define LV_FONT_MONTSERRAT_12 1
@@ -382,6 +385,7 @@
 /*Pixel perfect monospace fonts*/
 #define LV_FONT_UNSCII_8  0
 #define LV_FONT_UNSCII_16 0
+#endif /*GAUGE_FONT_ENABLES*/
 
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
@@ -1,6 +1,7 @@
 #include "lcd_bsp.h"
 #include "lcd_config.h"
 #include <Arduino.h>
+#include "gauges/gauge_stats.h"
 
 // LVGL display buffer
 static lv_disp_draw_buf_t draw_buf;
@@ -23,6 +24,7 @@ bool lcd_init(void)
   disp_drv.ver_res = LCD_HEIGHT;
   disp_drv.flush_cb = lcd_flush_cb;
   disp_drv.draw_buf = &draw_buf;
+  disp_drv.monitor_cb = gauge_stats_monitor_cb; // Per-frame render time for the stats report
   lv_disp_drv_register(&disp_drv);
 
   return true;
@@ -50,3 +52,9 @@ uint32_t lcd_get_height(void)
 {
   return LCD_HEIGHT;
 }
+
+void lcd_set_invert(bool invert)
+{
+  // Relative to the panel's configured inversion (cfg.invert)
+  tft.invertDisplay(invert);
+}
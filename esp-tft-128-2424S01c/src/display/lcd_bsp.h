@@ -28,4 +28,11 @@ uint32_t lcd_get_width(void);
  */
 uint32_t lcd_get_height(void);
 
+/**
+ * Invert the panel colors (one command, no pixel data)
+ * Used by the alert flash (gauge_alert.h)
+ * @param invert true to invert, false to restore
+ */
+void lcd_set_invert(bool invert);
+
 #endif // LCD_BSP_H
@@ -1,11 +1,19 @@
 #include "Arduino.h"
 #include <lvgl.h>
 #include <Ticker.h>
+#include <inttypes.h>
 #include "CST816D.h"
 
 #include "display/lcd_bsp.h"
 #include "display/lcd_config.h"
 #include "gauges/gauge_manager.h"
+#include "gauges/gauge_stats.h"
+#include "gauges/gauge_digits.h"
+#include "gauges/gauge_common.h"
+#include "gauges/needle_gauge_common.h"
+#include "gauges/multi_gauge.h"
+#include "gauges/gauge_channels.h"
+#include "gauges/gauge_alert.h"
 #include <esp_now_receiver.h>
 
 // Touch Pin Definitions
@@ -16,6 +24,11 @@
 
 #define off_pin 35
 
+// Loop timing: gauge values are pushed every GAUGE_UPDATE_PERIOD ms, LVGL
+// timers run in between (at most LVGL_LOOP_MAX_DELAY ms apart)
+#define GAUGE_UPDATE_PERIOD 70
+#define LVGL_LOOP_MAX_DELAY 5
+
 // Create touch instance
 CST816D touch(I2C_SDA, I2C_SCL, TP_RST, TP_INT);
 
@@ -50,6 +63,17 @@ void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
 }
 
 Ticker ticker;
+static unsigned long last_stats_report = 0;
+static unsigned long last_gauge_update = 0;
+
+// RPM and pedal fast path: runs in the ESP-NOW receive task for every packet and
+// only posts the samples, so the tachometer does not wait for the gauge update
+// below and the pedal trace gets every sample
+void on_telemetry_received(const TelemetryData *data)
+{
+  gauge_manager_post_rpm(data->engineRPM, data->speed);
+  gauge_manager_post_pedals((float)data->brakePercent, data->brakePressure, data->accelPos, data->throttlePos);
+}
 
 // Periodic function to check memory usage
 void tcr1s()
@@ -57,6 +81,40 @@ void tcr1s()
   Serial.printf("SRAM free size: %d\n", heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
 }
 
+// Print render time and LVGL memory usage once per second (runs in loop, next to lv_timer_handler)
+void report_stats()
+{
+  if (millis() - last_stats_report < 1000) return;
+  last_stats_report = millis();
+
+  gauge_stats_t stats;
+  lv_mem_monitor_t mem;
+  gauge_stats_get(&stats, true);
+  lv_mem_monitor(&mem);
+
+  Serial.printf("STATS - frames: %" PRIu32 ", avg render: %" PRIu32 " ms, max render: %" PRIu32 " ms, px: %" PRIu32 ", scale cache: %" PRIu32 " B, LVGL mem used: %" PRIu32 " B, "
+                "layer heap normal: %" PRIu32 " B, racing: %" PRIu32 " B, last screen build: %" PRIu32 " ms, digit atlas: %" PRIu32 " B, "
+                "zone style refreshes: %" PRIu32 ", zone style: %" PRIu32 " B/obj, needle sprites: %" PRIu32 " B, "
+                "rpm latency avg: %" PRIu32 " ms, max: %" PRIu32 " ms, over budget: %" PRIu32 "/%" PRIu32 "\n",
+                stats.frames,
+                stats.frames ? stats.render_time_ms / stats.frames : 0,
+                stats.render_time_max,
+                stats.rendered_px,
+                stats.scale_cache_bytes,
+                mem.total_size - mem.free_size,
+                stats.mode_heap_bytes[GAUGE_MODE_NORMAL],
+                stats.mode_heap_bytes[GAUGE_MODE_RACING],
+                stats.screen_build_ms,
+                stats.digit_atlas_bytes,
+                stats.style_refreshes,
+                stats.zone_style_bytes,
+                stats.needle_sprite_bytes,
+                stats.latency_samples ? stats.latency_total_ms / stats.latency_samples : 0,
+                stats.latency_max,
+                stats.latency_over_budget,
+                stats.latency_samples);
+}
+
 void setup()
 {
   pinMode(3, OUTPUT);
@@ -89,10 +147,54 @@ void setup()
   lv_indev_drv_register(&indev_drv);
 
   // Initialize your custom gauge manager
-  gauge_manager_init();
+  gauge_manager_init(false);
   gauge_manager_enable_gestures();
+  gauge_alert_set_panel_hook(GAUGE_ALERT_PANEL_INVERT, lcd_set_invert);  // No backlight control: no dim hook
+
+#if GAUGE_DIGITS_BENCHMARK
+  gauge_digits_bench_t bench;
+  gauge_digits_benchmark(200, &bench);
+  Serial.printf("DIGITS BENCHMARK - 200 updates: lv_label %" PRIu32 " ms / %" PRIu32 " B flushed, gauge_digits %" PRIu32 " ms / %" PRIu32 " B flushed\n",
+                bench.label_ms, bench.label_bytes, bench.digits_ms, bench.digits_bytes);
+#endif
+#if GAUGE_ARC_BENCHMARK
+  gauge_arc_bench_t arc_bench;
+  gauge_arc_benchmark(100, &arc_bench);
+  Serial.printf("ARC BENCHMARK - 100 full redraws: refresh only %" PRIu32 " ms, span rasterizer %" PRIu32 " ms, lv_draw_arc %" PRIu32 " ms\n",
+                arc_bench.refresh_ms, arc_bench.spans_ms, arc_bench.draw_arc_ms);
+#endif
+#if NEEDLE_BENCHMARK
+  needle_gauge_bench_t needle_bench;
+  needle_gauge_benchmark(100, &needle_bench);
+  Serial.printf("NEEDLE BENCHMARK - 100 needle moves: needle line %" PRIu32 " ms, sprites %" PRIu32 " ms\n",
+                needle_bench.line_ms, needle_bench.sprite_ms);
+#endif
+#if GAUGE_ALERT_BENCHMARK
+  gauge_alert_bench_t alert_bench;
+  gauge_alert_benchmark(&alert_bench);
+  Serial.printf("ALERT BENCHMARK - per alert second: full screen %" PRIu32 " B, ring %" PRIu32 " B, invert %" PRIu32 " B / %" PRIu32 " cmds, dim %" PRIu32 " B / %" PRIu32 " cmds\n",
+                alert_bench.flushed_bytes[GAUGE_ALERT_FULL_SCREEN], alert_bench.flushed_bytes[GAUGE_ALERT_RING],
+                alert_bench.flushed_bytes[GAUGE_ALERT_PANEL_INVERT], alert_bench.panel_commands[GAUGE_ALERT_PANEL_INVERT],
+                alert_bench.flushed_bytes[GAUGE_ALERT_PANEL_DIM], alert_bench.panel_commands[GAUGE_ALERT_PANEL_DIM]);
+#endif
+#if MULTI_GAUGE_BENCHMARK
+  multi_gauge_bench_t multi_bench;
+  multi_gauge_benchmark(200, &multi_bench);
+  for (int r = 0; r < MULTI_GAUGE_BENCH_RUNS; r++) {
+    const multi_gauge_bench_run_t *run = &multi_bench.runs[r];
+    Serial.printf("MULTI BENCHMARK - %" PRIu32 " rows, %" PRIu32 " ticks: %" PRIu32 " rows updated, %" PRIu32 " widget updates, %" PRIu32 " ms / %" PRIu32 " B flushed\n",
+                  run->rows, run->ticks, run->rows_updated, run->lvgl_calls, run->update_ms, run->flushed_bytes);
+  }
+#endif
+#if GAUGE_MODEL_BENCHMARK
+  gauge_model_bench_t model_bench;
+  gauge_model_benchmark(gauge_channel_models(), 10000, [] { return (uint32_t)micros(); }, &model_bench);
+  Serial.printf("MODEL BENCHMARK - %" PRIu32 " samples x %d channels: %" PRIu32 " us, %" PRIu32 " visible changes, %" PRIu32 " texts formatted\n",
+                model_bench.samples, GAUGE_CHANNEL_COUNT, model_bench.update_us, model_bench.changed, model_bench.texts);
+#endif
 
   espnow_receiver_init();
+  espnow_set_receive_callback(on_telemetry_received);
 
   // Note: Performance monitor is automatically created by LVGL 8 when LV_USE_PERF_MONITOR is enabled
   // Position is set by LV_USE_PERF_MONITOR_POS in lv_conf.h
@@ -102,25 +204,34 @@ void setup()
 
 void loop()
 {
-  lv_timer_handler(); /* Process LVGL timers and GUI updates */
-
-  // Check timeout and update telemetry (sets values to -1 if no data in 5s)
-  espnow_check_timeout();
+  // LVGL runs every few ms (RPM gauge timer, refresh); the other gauges are
+  // updated every GAUGE_UPDATE_PERIOD ms as before
+  uint32_t next_timer = lv_timer_handler(); /* Process LVGL timers and GUI updates */
 
-  // Update gauges
-  Serial.print("DEBUG - oilTemp: ");
-  Serial.print(latestData.oilTemp);
-  Serial.print(", waterTemp: ");
-  Serial.print(latestData.waterTemp);
-  Serial.print(", oilPressure: ");
-  Serial.print(latestData.oilPressure);
-  Serial.print(", RPM: ");
-  Serial.println(latestData.engineRPM);
-
-  gauge_manager_update(latestData.oilTemp, latestData.waterTemp, latestData.oilPressure, latestData.engineRPM);
-
-  // Uncomment for testing without ESP-NOW
-  // gauge_manager_update_test_animation(); // Update gauge values with test animation
+  if (millis() - last_gauge_update >= GAUGE_UPDATE_PERIOD)
+  {
+    last_gauge_update = millis();
+
+    // Check timeout and update telemetry (sets values to -1 if no data in 5s)
+    espnow_check_timeout();
+
+    // Update gauges
+    Serial.print("DEBUG - oilTemp: ");
+    Serial.print(latestData.oilTemp);
+    Serial.print(", waterTemp: ");
+    Serial.print(latestData.waterTemp);
+    Serial.print(", oilPressure: ");
+    Serial.print(latestData.oilPressure);
+    Serial.print(", RPM: ");
+    Serial.println(latestData.engineRPM);
+
+    if (dataReceived) gauge_manager_set_luminosity(latestData.luminosity);  // Day/night theme
+    gauge_manager_update(latestData.oilTemp, latestData.waterTemp, latestData.oilPressure, latestData.engineRPM, latestData.gaugeType);
+    report_stats();
+
+    // Uncomment for testing without ESP-NOW
+    // gauge_manager_update_test_animation(); // Update gauge values with test animation
+  }
 
-  delay(70); // Small delay to prevent hogging CPU
-}
\ No newline at end of file
+  delay(next_timer < LVGL_LOOP_MAX_DELAY ? next_timer : LVGL_LOOP_MAX_DELAY); // Sleep until the next LVGL timer is due
+}
@@ -361,6 +361,9 @@
 
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
  *https://fonts.google.com/specimen/Montserrat*/
+/*Built-in fonts. GaugesLib/scripts/pio_fonts.py defines GAUGE_FONT_ENABLES and enables
+ *only the fonts an environment uses; this full list applies to builds without it.*/
+#ifndef GAUGE_FONT_ENABLES
 #define LV_FONT_MONTSERRAT_8  1
 #define LV_FONT_MONTSERRAT_10 1
 #define LV_FONT_MONTSERRAT_12 1
@@ -392,6 +395,7 @@
 /*Pixel perfect monospace fonts*/
 #define LV_FONT_UNSCII_8  0
 #define LV_FONT_UNSCII_16 0
+#endif /*GAUGE_FONT_ENABLES*/
 
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
@@ -485,7 +489,7 @@
 
 #define LV_USE_DROPDOWN   0
 
-#define LV_USE_IMG        0
+#define LV_USE_IMG        1   /*Shows the cached needle gauge scale (NEEDLE_SCALE_CACHE)*/
 
 #define LV_USE_LABEL      1
 #if LV_USE_LABEL
@@ -702,7 +706,7 @@
  *----------*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1   /*Renders the needle gauge scale once (NEEDLE_SCALE_CACHE)*/
 
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY 0
@@ -0,0 +1,91 @@
+#include "burn_in_shift.h"
+#include <string.h>
+#include "lcd_config.h"
+
+// Center first, then around it: consecutive positions are at most one step apart
+static const int8_t orbit[][2] = {
+  { 0,  0}, { 1,  0}, { 1,  1}, { 0,  1}, {-1,  1},
+  {-1,  0}, {-1, -1}, { 0, -1}, { 1, -1},
+};
+
+#define ORBIT_LENGTH (sizeof(orbit) / sizeof(orbit[0]))
+
+static_assert(BURN_IN_SHIFT_PX % 2 == 0, "BURN_IN_SHIFT_PX must be even (panel window alignment)");
+
+void burn_in_shift_offset(uint32_t step, int *dx, int *dy)
+{
+  *dx = orbit[step % ORBIT_LENGTH][0] * BURN_IN_SHIFT_PX;
+  *dy = orbit[step % ORBIT_LENGTH][1] * BURN_IN_SHIFT_PX;
+}
+
+bool burn_in_shift_clip(const burn_in_area_t *area, int dx, int dy, int width, int height, burn_in_clip_t *clip)
+{
+  // Keep x + dx in [0, width - 1] and y + dy in [0, height - 1]
+  int x1 = area->x1 < -dx ? -dx : area->x1;
+  int y1 = area->y1 < -dy ? -dy : area->y1;
+  int x2 = area->x2 > width - 1 - dx ? width - 1 - dx : area->x2;
+  int y2 = area->y2 > height - 1 - dy ? height - 1 - dy : area->y2;
+  if (x1 > x2 || y1 > y2) return false;
+
+  clip->window.x1 = x1;
+  clip->window.y1 = y1;
+  clip->window.x2 = x2;
+  clip->window.y2 = y2;
+  clip->skip_cols = x1 - area->x1;
+  clip->skip_rows = y1 - area->y1;
+  clip->src_width = area->x2 - area->x1 + 1;
+  return true;
+}
+
+void burn_in_shift_pack(uint16_t *dst, const uint16_t *src, const burn_in_clip_t *clip)
+{
+  int width = clip->window.x2 - clip->window.x1 + 1;
+  int rows = clip->window.y2 - clip->window.y1 + 1;
+  if (dst == src && width == clip->src_width && clip->skip_rows == 0) return; // Nothing clipped
+
+  // memmove: in place, a row may overlap its own source
+  for (int row = 0; row < rows; row++) {
+    memmove(dst + row * width,
+            src + (row + clip->skip_rows) * clip->src_width + clip->skip_cols,
+            width * sizeof(uint16_t));
+  }
+}
+
+void burn_in_shift_store(uint16_t *frame, int frame_width, const burn_in_area_t *area, const uint16_t *pixels)
+{
+  int width = area->x2 - area->x1 + 1;
+  for (int y = area->y1; y <= area->y2; y++) {
+    memcpy(frame + y * frame_width + area->x1, pixels, width * sizeof(uint16_t));
+    pixels += width;
+  }
+}
+
+int burn_in_shift_uncovered(int dx, int dy, int width, int height, burn_in_area_t strips[2])
+{
+  int count = 0;
+
+  // Columns the image left: on the left when it moved right, and the other way round
+  if (dx != 0) {
+    strips[count].x1 = dx > 0 ? 0 : width + dx;
+    strips[count].x2 = dx > 0 ? dx - 1 : width - 1;
+    strips[count].y1 = 0;
+    strips[count].y2 = height - 1;
+    count++;
+  }
+  if (dy != 0) {
+    strips[count].x1 = 0;
+    strips[count].x2 = width - 1;
+    strips[count].y1 = dy > 0 ? 0 : height + dy;
+    strips[count].y2 = dy > 0 ? dy - 1 : height - 1;
+    count++;
+  }
+  return count;
+}
+
+void burn_in_shift_touch(int dx, int dy, int width, int height, uint16_t *x, uint16_t *y)
+{
+  int tx = (int)*x - dx;
+  int ty = (int)*y - dy;
+  *x = (uint16_t)(tx < 0 ? 0 : (tx > width - 1 ? width - 1 : tx));
+  *y = (uint16_t)(ty < 0 ? 0 : (ty > height - 1 ? height - 1 : ty));
+}
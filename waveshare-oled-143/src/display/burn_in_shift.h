@@ -0,0 +1,81 @@
+#ifndef BURN_IN_SHIFT_H
+#define BURN_IN_SHIFT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// OLED burn-in shift: window arithmetic
+// ============================================================================
+// The whole image is moved by a few pixels through the panel window offset
+// (esp_lcd_panel_set_gap() -> CASET / RASET), so LVGL keeps drawing at the
+// same coordinates. Nothing here touches the panel or LVGL: lcd_bsp.cpp
+// applies the results, and the functions can be run on the host.
+// Areas are inclusive and in unrotated panel pixels, pixels are RGB565.
+
+typedef struct {
+  int x1;
+  int y1;
+  int x2;
+  int y2;
+} burn_in_area_t;
+
+/**
+ * Part of a flushed area that stays on the panel once shifted
+ */
+typedef struct {
+  burn_in_area_t window;  // Window to send (before the offset is added)
+  int skip_cols;          // Leading pixels of each source row to drop
+  int skip_rows;          // Leading source rows to drop
+  int src_width;          // Row length of the source pixels
+} burn_in_clip_t;
+
+/**
+ * Offset of an orbit position: the center, then the 8 neighbours at
+ * BURN_IN_SHIFT_PX (even: the panel takes even window starts and widths)
+ * @param step Position, any value (wraps)
+ * @param dx, dy Offset in pixels
+ */
+void burn_in_shift_offset(uint32_t step, int *dx, int *dy);
+
+/**
+ * Clip a flushed area to what remains on a width x height panel after the shift
+ * @return false if the whole area falls outside the panel
+ */
+bool burn_in_shift_clip(const burn_in_area_t *area, int dx, int dy, int width, int height, burn_in_clip_t *clip);
+
+/**
+ * Copy the pixels a clip keeps into rows of the clipped window width
+ * dst may be src: rows only move towards the start, so a chunk is packed in place
+ * @param src Pixels of the clipped area, clip->src_width per row
+ */
+void burn_in_shift_pack(uint16_t *dst, const uint16_t *src, const burn_in_clip_t *clip);
+
+/**
+ * Store a flushed area into a copy of the whole image, so it can be sent
+ * again at a new offset without rendering
+ * @param frame frame_width pixels per row
+ */
+void burn_in_shift_store(uint16_t *frame, int frame_width, const burn_in_area_t *area, const uint16_t *pixels);
+
+/**
+ * Panel strips the shifted image no longer covers, to clear once per shift
+ * @param strips Up to 2 strips (one column band, one row band), panel coordinates
+ * @return Number of strips
+ */
+int burn_in_shift_uncovered(int dx, int dy, int width, int height, burn_in_area_t strips[2]);
+
+/**
+ * Map a touch point from the panel back to LVGL coordinates (clamped)
+ */
+void burn_in_shift_touch(int dx, int dy, int width, int height, uint16_t *x, uint16_t *y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -3,6 +3,8 @@
 #include "lcd_config.h"
 #include "../touch/FT3168.h"
 #include "read_lcd_id_bsp.h"
+#include "burn_in_shift.h"
+#include "gauges/gauge_stats.h"
 
 
 static SemaphoreHandle_t lvgl_mux = NULL; //mutex semaphores
@@ -12,6 +14,19 @@ static SemaphoreHandle_t lvgl_mux = NULL; //mutex semaphores
 #define CO5300_ID 0xff
 static uint8_t READ_LCD_ID = 0x00;
 static esp_lcd_panel_io_handle_t g_io_handle = NULL; // Global panel I/O handle for brightness control 
+static esp_lcd_panel_handle_t g_panel_handle = NULL; // Global panel handle for color inversion
+static int panel_x_gap = 0;                          // First visible GRAM column (CO5300: 6)
+
+#if BURN_IN_SHIFT_ENABLE
+static int shift_dx = 0;                             // Current image offset on the panel
+static int shift_dy = 0;
+static uint32_t shift_step = 0;                      // Orbit position (burn_in_shift_offset)
+static uint32_t last_shift_ms = 0;
+static volatile uint32_t shift_transfers = 0;        // Queued color transfers of a shift, not LVGL chunks
+static lv_color_t *black_strip = NULL;               // DMA-capable zeroes for the uncovered strips
+static lv_color_t *panel_frame = NULL;               // PSRAM copy of every flushed pixel, sent again on a shift
+static void burn_in_shift_timer_cb(lv_timer_t *timer);
+#endif
 
 static const sh8601_lcd_init_cmd_t sh8601_lcd_init_cmds[] = 
 {
@@ -82,6 +97,11 @@ void lcd_lvgl_Init(void)
   ESP_ERROR_CHECK_WITHOUT_ABORT(esp_lcd_panel_reset(panel_handle));
   ESP_ERROR_CHECK_WITHOUT_ABORT(esp_lcd_panel_init(panel_handle));
   ESP_ERROR_CHECK_WITHOUT_ABORT(esp_lcd_panel_disp_on_off(panel_handle, true));
+  g_panel_handle = panel_handle; // Store globally for color inversion
+
+  // The CO5300 shows GRAM from column 6: part of the window offset, like the burn-in shift
+  panel_x_gap = (READ_LCD_ID == SH8601_ID) ? 0 : 0x06;
+  esp_lcd_panel_set_gap(panel_handle, panel_x_gap, 0);
 
   lv_init();
   lv_color_t *buf1 = (lv_color_t *)heap_caps_malloc(EXAMPLE_LCD_H_RES * EXAMPLE_LVGL_BUF_HEIGHT * sizeof(lv_color_t), MALLOC_CAP_DMA);
@@ -95,6 +115,7 @@ void lcd_lvgl_Init(void)
   disp_drv.rounder_cb = example_lvgl_rounder_cb;
   disp_drv.draw_buf = &disp_buf;
   disp_drv.user_data = panel_handle;
+  disp_drv.monitor_cb = gauge_stats_monitor_cb; // Per-frame render time for the stats report
 
   // Software rotation configuration (configured in lcd_config.h)
   // NOTE: Rotation requires LVGL library patch (automatically applied by scripts/patch_lvgl.py)
@@ -111,6 +132,14 @@ void lcd_lvgl_Init(void)
   indev_drv.read_cb = example_lvgl_touch_cb;
   lv_indev_drv_register(&indev_drv);
 
+#if BURN_IN_SHIFT_ENABLE
+  black_strip = (lv_color_t *)heap_caps_calloc(EXAMPLE_LCD_H_RES * BURN_IN_SHIFT_PX, sizeof(lv_color_t), MALLOC_CAP_DMA);
+  assert(black_strip);
+  panel_frame = (lv_color_t *)heap_caps_calloc(EXAMPLE_LCD_H_RES * EXAMPLE_LCD_V_RES, sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+  assert(panel_frame);
+  lv_timer_create(burn_in_shift_timer_cb, 1000, &disp_drv);
+#endif
+
   const esp_timer_create_args_t lvgl_tick_timer_args = 
   {
     .callback = &example_increase_lvgl_tick,
@@ -167,22 +196,107 @@ static void example_increase_lvgl_tick(void *arg)
 static bool example_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
   lv_disp_drv_t *disp_driver = (lv_disp_drv_t *)user_ctx;
+#if BURN_IN_SHIFT_ENABLE
+  if (shift_transfers > 0) {
+    shift_transfers--; // Part of a shift sent, not an LVGL chunk
+    return false;
+  }
+#endif
   lv_disp_flush_ready(disp_driver);
   return false;
 }
+
+#if BURN_IN_SHIFT_ENABLE
+static_assert(sizeof(lv_color_t) == sizeof(uint16_t), "burn_in_shift.h handles RGB565 pixels");
+
+/**
+ * Wait until the transfers of a shift are on the panel
+ */
+static void burn_in_shift_wait(void)
+{
+  while (shift_transfers > 0) {
+    vTaskDelay(1);
+  }
+}
+
+/**
+ * Move the image to the next orbit position and send the stored frame again
+ * at the new offset. Runs in the LVGL task between frames with nothing on the
+ * bus, so LVGL renders nothing for it and its draw buffer is free to stage rows.
+ */
+static void burn_in_shift_apply(lv_disp_drv_t *drv)
+{
+  esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t) drv->user_data;
+
+  shift_step++;
+  burn_in_shift_offset(shift_step, &shift_dx, &shift_dy);
+  esp_lcd_panel_set_gap(panel_handle, panel_x_gap + shift_dx, shift_dy);
+  last_shift_ms = millis();
+
+  // Clear what the image no longer covers.
+  // Strips are sent at panel coordinates minus the offset the driver adds.
+  burn_in_area_t strips[2];
+  int count = burn_in_shift_uncovered(shift_dx, shift_dy, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, strips);
+  shift_transfers = count;
+  for (int i = 0; i < count; i++) {
+    esp_lcd_panel_draw_bitmap(panel_handle, strips[i].x1 - shift_dx, strips[i].y1 - shift_dy,
+                              strips[i].x2 + 1 - shift_dx, strips[i].y2 + 1 - shift_dy, black_strip);
+  }
+
+  // The panel memory cannot move: send the image again, one draw buffer of rows at a time
+  uint16_t *stage = (uint16_t *)drv->draw_buf->buf1;
+  for (int y = 0; y < EXAMPLE_LCD_V_RES; y += EXAMPLE_LVGL_BUF_HEIGHT) {
+    int y2 = y + EXAMPLE_LVGL_BUF_HEIGHT > EXAMPLE_LCD_V_RES ? EXAMPLE_LCD_V_RES - 1 : y + EXAMPLE_LVGL_BUF_HEIGHT - 1;
+    burn_in_area_t band = {0, y, EXAMPLE_LCD_H_RES - 1, y2};
+    burn_in_clip_t clip;
+    if (!burn_in_shift_clip(&band, shift_dx, shift_dy, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, &clip)) continue;
+
+    burn_in_shift_wait(); // Previous band (or the strips) sent, stage is free
+    burn_in_shift_pack(stage, (const uint16_t *)panel_frame + y * EXAMPLE_LCD_H_RES, &clip);
+    shift_transfers = 1;
+    esp_lcd_panel_draw_bitmap(panel_handle, clip.window.x1, clip.window.y1, clip.window.x2 + 1, clip.window.y2 + 1, stage);
+  }
+  burn_in_shift_wait(); // LVGL may render into the stage again
+}
+
+/**
+ * Apply a due shift once the last chunk of the previous frame is on the panel
+ */
+static void burn_in_shift_timer_cb(lv_timer_t *timer)
+{
+  lv_disp_drv_t *drv = (lv_disp_drv_t *)timer->user_data;
+  if (millis() - last_shift_ms < BURN_IN_SHIFT_PERIOD_MS) return;
+  if (drv->draw_buf->flushing) return; // Still on the bus: next second
+  burn_in_shift_apply(drv);
+}
+#endif
+
 static void example_lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
   esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t) drv->user_data;
-  
-  // Calculate offsets
-  const int offsetx1 = (READ_LCD_ID == SH8601_ID) ? area->x1 : area->x1 + 0x06;
-  const int offsetx2 = (READ_LCD_ID == SH8601_ID) ? area->x2 : area->x2 + 0x06;
-  const int offsety1 = area->y1;
-  const int offsety2 = area->y2;
-
-  // The draw_bitmap function takes (x_start, y_start, x_end, y_end)
-  // With the rounder above, (offsetx2 + 1) - offsetx1 will always be an even number.
-  esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
+
+#if BURN_IN_SHIFT_ENABLE
+  // Keep the unshifted image, a shift sends it again
+  burn_in_area_t chunk = {area->x1, area->y1, area->x2, area->y2};
+  burn_in_shift_store((uint16_t *)panel_frame, EXAMPLE_LCD_H_RES, &chunk, (const uint16_t *)color_map);
+
+  burn_in_clip_t clip;
+  if (!burn_in_shift_clip(&chunk, shift_dx, shift_dy, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, &clip)) {
+    lv_disp_flush_ready(drv); // Entirely shifted off the panel
+    return;
+  }
+
+  // Chunks along the panel edge lose their outer pixels: pack the rest in place
+  burn_in_shift_pack((uint16_t *)color_map, (const uint16_t *)color_map, &clip);
+
+  // The draw_bitmap function takes (x_start, y_start, x_end, y_end) and adds the window offset.
+  // Starts and widths stay even: the rounder aligns the area and the shift is even.
+  esp_lcd_panel_draw_bitmap(panel_handle, clip.window.x1, clip.window.y1, clip.window.x2 + 1, clip.window.y2 + 1, color_map);
+#else
+  // The draw_bitmap function takes (x_start, y_start, x_end, y_end) and adds the window offset.
+  // With the rounder below, (x2 + 1) - x1 will always be an even number.
+  esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1, area->x2 + 1, area->y2 + 1, color_map);
+#endif
 }
 void example_lvgl_rounder_cb(struct _lv_disp_drv_t *disp_drv, lv_area_t *area)
 {
@@ -205,6 +319,9 @@ static void example_lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data)
   uint8_t win = getTouch(&tp_x,&tp_y);
   if(win)
   {
+#if BURN_IN_SHIFT_ENABLE
+    burn_in_shift_touch(shift_dx, shift_dy, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, &tp_x, &tp_y); // Touch follows the image
+#endif
     data->point.x = tp_x;
     data->point.y = tp_y;
     data->state = LV_INDEV_STATE_PRESSED;
@@ -233,3 +350,13 @@ void lcd_set_brightness(uint8_t brightness)
   esp_lcd_panel_io_tx_param(g_io_handle, lcd_cmd, &brightness, 1);
 }
 
+// Invert the panel colors (INVON / INVOFF): one command, no pixel data.
+// Used by the alert flash (gauge_alert.h).
+void lcd_set_invert(bool invert)
+{
+  if (g_panel_handle == NULL) {
+    return; // Not initialized yet
+  }
+
+  esp_lcd_panel_invert_color(g_panel_handle, invert);
+}
@@ -34,6 +34,18 @@
 #define EXAMPLE_LVGL_TASK_STACK_SIZE   (4 * 1024)                 //LVGL runs the task stack
 #define EXAMPLE_LVGL_TASK_PRIORITY     2                          //LVGL Running task priority
 
+// ============================================================================
+// OLED Burn-in Protection
+// ============================================================================
+// Every BURN_IN_SHIFT_PERIOD_MS the image moves to the next position of a small
+// orbit (up to BURN_IN_SHIFT_PX) through the panel window offset; touch follows.
+// The panel memory cannot be moved in place: flushed pixels are also kept in a
+// PSRAM copy of the frame (H_RES x V_RES x 2 B), which is sent again at the new
+// offset while the panel is idle. LVGL renders nothing for a shift.
+#define BURN_IN_SHIFT_ENABLE           1
+#define BURN_IN_SHIFT_PX               2                          // Even: panel window alignment
+#define BURN_IN_SHIFT_PERIOD_MS        (3 * 60 * 1000UL)
+
 #define I2C_ADDR_FT3168 0x38
 #define EXAMPLE_PIN_NUM_TOUCH_SCL 48
 #define EXAMPLE_PIN_NUM_TOUCH_SDA 47
@@ -2,7 +2,73 @@
 #include "./display/lcd_config.h"
 #include "./touch/FT3168.h"
 #include "gauges/gauge_manager.h"
+#include "gauges/gauge_stats.h"
+#include "gauges/gauge_digits.h"
+#include "gauges/gauge_common.h"
+#include "gauges/needle_gauge_common.h"
+#include "gauges/multi_gauge.h"
+#include "gauges/gauge_channels.h"
+#include "gauges/gauge_alert.h"
 #include <esp_now_receiver.h>
+#include <inttypes.h>
+
+static unsigned long last_stats_report = 0;
+static const uint8_t display_brightness = 0xFF;  // Maximum brightness (100%)
+
+/**
+ * Panel dim alert hook (gauge_alert.h): flashes the brightness, nothing is redrawn.
+ */
+static void alert_dim(bool on) {
+  lcd_set_brightness(on ? GAUGE_ALERT_DIM_BRIGHTNESS : display_brightness);
+}
+
+/**
+ * RPM and pedal fast path: runs in the ESP-NOW receive task for every packet
+ * and only posts the samples (no LVGL lock), so the tachometer does not wait
+ * for loop() and the pedal trace gets every sample.
+ */
+static void on_telemetry_received(const TelemetryData *data) {
+  gauge_manager_post_rpm(data->engineRPM, data->speed);
+  gauge_manager_post_pedals((float)data->brakePercent, data->brakePressure, data->accelPos, data->throttlePos);
+}
+
+/**
+ * Print render time and memory usage once per second.
+ * Must be called with the LVGL lock held.
+ */
+static void report_stats() {
+  if (millis() - last_stats_report < 1000) return;
+  last_stats_report = millis();
+
+  gauge_stats_t stats;
+  lv_mem_monitor_t mem;
+  gauge_stats_get(&stats, true);
+  lv_mem_monitor(&mem);
+
+  Serial.printf("STATS - frames: %" PRIu32 ", avg render: %" PRIu32 " ms, max render: %" PRIu32 " ms, px: %" PRIu32 ", "
+                "scale cache: %" PRIu32 " B, LVGL mem used: %" PRIu32 " B, free PSRAM: %" PRIu32 " B, "
+                "layer heap normal: %" PRIu32 " B, racing: %" PRIu32 " B, last screen build: %" PRIu32 " ms, digit atlas: %" PRIu32 " B, "
+                "zone style refreshes: %" PRIu32 ", zone style: %" PRIu32 " B/obj, needle sprites: %" PRIu32 " B, "
+                "rpm latency avg: %" PRIu32 " ms, max: %" PRIu32 " ms, over budget: %" PRIu32 "/%" PRIu32 "\n",
+                stats.frames,
+                stats.frames ? stats.render_time_ms / stats.frames : 0,
+                stats.render_time_max,
+                stats.rendered_px,
+                stats.scale_cache_bytes,
+                mem.total_size - mem.free_size,
+                (uint32_t)heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+                stats.mode_heap_bytes[GAUGE_MODE_NORMAL],
+                stats.mode_heap_bytes[GAUGE_MODE_RACING],
+                stats.screen_build_ms,
+                stats.digit_atlas_bytes,
+                stats.style_refreshes,
+                stats.zone_style_bytes,
+                stats.needle_sprite_bytes,
+                stats.latency_samples ? stats.latency_total_ms / stats.latency_samples : 0,
+                stats.latency_max,
+                stats.latency_over_budget,
+                stats.latency_samples);
+}
 
 void setup() {
   Serial.begin(115200);
@@ -14,7 +80,7 @@ void setup() {
   lcd_lvgl_Init();
 
   // Set brightness (0-255)
-  lcd_set_brightness(0xFF);  // Maximum brightness (100%)
+  lcd_set_brightness(display_brightness);
   // lcd_set_brightness(0x80);  // Medium brightness (50%)
   // lcd_set_brightness(0x40);  // Low brightness (25%)
   // lcd_set_brightness(0x00);  // Minimum brightness (off)
@@ -24,6 +90,50 @@ void setup() {
     // Pass display rotation setting from lcd_config.h to gauge manager
     gauge_manager_init(ENABLE_DISPLAY_ROTATION);
     gauge_manager_enable_gestures();  // Enable swipe gesture to switch gauges
+    gauge_alert_set_panel_hook(GAUGE_ALERT_PANEL_INVERT, lcd_set_invert);
+    gauge_alert_set_panel_hook(GAUGE_ALERT_PANEL_DIM, alert_dim);
+
+#if GAUGE_DIGITS_BENCHMARK
+    gauge_digits_bench_t bench;
+    gauge_digits_benchmark(200, &bench);
+    Serial.printf("DIGITS BENCHMARK - 200 updates: lv_label %" PRIu32 " ms / %" PRIu32 " B flushed, gauge_digits %" PRIu32 " ms / %" PRIu32 " B flushed\n",
+                  bench.label_ms, bench.label_bytes, bench.digits_ms, bench.digits_bytes);
+#endif
+#if GAUGE_ARC_BENCHMARK
+    gauge_arc_bench_t arc_bench;
+    gauge_arc_benchmark(100, &arc_bench);
+    Serial.printf("ARC BENCHMARK - 100 full redraws: refresh only %" PRIu32 " ms, span rasterizer %" PRIu32 " ms, lv_draw_arc %" PRIu32 " ms\n",
+                  arc_bench.refresh_ms, arc_bench.spans_ms, arc_bench.draw_arc_ms);
+#endif
+#if NEEDLE_BENCHMARK
+    needle_gauge_bench_t needle_bench;
+    needle_gauge_benchmark(100, &needle_bench);
+    Serial.printf("NEEDLE BENCHMARK - 100 needle moves: needle line %" PRIu32 " ms, sprites %" PRIu32 " ms\n",
+                  needle_bench.line_ms, needle_bench.sprite_ms);
+#endif
+#if GAUGE_ALERT_BENCHMARK
+    gauge_alert_bench_t alert_bench;
+    gauge_alert_benchmark(&alert_bench);
+    Serial.printf("ALERT BENCHMARK - per alert second: full screen %" PRIu32 " B, ring %" PRIu32 " B, invert %" PRIu32 " B / %" PRIu32 " cmds, dim %" PRIu32 " B / %" PRIu32 " cmds\n",
+                  alert_bench.flushed_bytes[GAUGE_ALERT_FULL_SCREEN], alert_bench.flushed_bytes[GAUGE_ALERT_RING],
+                  alert_bench.flushed_bytes[GAUGE_ALERT_PANEL_INVERT], alert_bench.panel_commands[GAUGE_ALERT_PANEL_INVERT],
+                  alert_bench.flushed_bytes[GAUGE_ALERT_PANEL_DIM], alert_bench.panel_commands[GAUGE_ALERT_PANEL_DIM]);
+#endif
+#if MULTI_GAUGE_BENCHMARK
+    multi_gauge_bench_t multi_bench;
+    multi_gauge_benchmark(200, &multi_bench);
+    for (int r = 0; r < MULTI_GAUGE_BENCH_RUNS; r++) {
+      const multi_gauge_bench_run_t *run = &multi_bench.runs[r];
+      Serial.printf("MULTI BENCHMARK - %" PRIu32 " rows, %" PRIu32 " ticks: %" PRIu32 " rows updated, %" PRIu32 " widget updates, %" PRIu32 " ms / %" PRIu32 " B flushed\n",
+                    run->rows, run->ticks, run->rows_updated, run->lvgl_calls, run->update_ms, run->flushed_bytes);
+    }
+#endif
+#if GAUGE_MODEL_BENCHMARK
+    gauge_model_bench_t model_bench;
+    gauge_model_benchmark(gauge_channel_models(), 10000, [] { return (uint32_t)micros(); }, &model_bench);
+    Serial.printf("MODEL BENCHMARK - %" PRIu32 " samples x %d channels: %" PRIu32 " us, %" PRIu32 " visible changes, %" PRIu32 " texts formatted\n",
+                  model_bench.samples, GAUGE_CHANNEL_COUNT, model_bench.update_us, model_bench.changed, model_bench.texts);
+#endif
     example_lvgl_unlock();
   }
 
@@ -32,6 +142,7 @@ void setup() {
 
   // 3. Initialize ESP-NOW Receiver (Wi-Fi + ESP-NOW)
   espnow_receiver_init();
+  espnow_set_receive_callback(on_telemetry_received);
 }
 
 void loop() {
@@ -49,7 +160,9 @@ void loop() {
     Serial.print(", RPM: ");
     Serial.println(latestData.engineRPM);
 
+    if (dataReceived) gauge_manager_set_luminosity(latestData.luminosity);  // Day/night theme
     gauge_manager_update(latestData.oilTemp, latestData.waterTemp, latestData.oilPressure, latestData.engineRPM, latestData.gaugeType);
+    report_stats();
     example_lvgl_unlock();
   }
 
@@ -0,0 +1,24 @@
+#!/bin/sh
+# Build and run the host tests of the OLED board code that needs neither LVGL
+# nor the panel (burn_in_shift.cpp), with the development machine's compiler.
+# The test helpers are shared with common-libs/GaugesLib/test.
+#
+#     waveshare-oled-143/test/run_host_tests.sh        (CXX=clang++ to change compiler)
+#
+# Exits non-zero if a test fails to build or a check fails.
+set -e
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+CXXFLAGS="-std=c++11 -O2 -Wall -Wextra -Werror -I../../common-libs/GaugesLib/test -I../src/display"
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+run() {
+    name=$1
+    shift
+    $CXX $CXXFLAGS "$@" -o "$BUILD/$name"
+    "$BUILD/$name"
+}
+
+run test_burn_in_shift test_burn_in_shift.cpp ../src/display/burn_in_shift.cpp
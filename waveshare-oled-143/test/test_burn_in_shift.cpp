@@ -0,0 +1,325 @@
+// Host tests of the burn-in shift window arithmetic (src/display/burn_in_shift.cpp)
+//
+//     test/run_host_tests.sh
+
+#include "host_test.h"
+#include "burn_in_shift.h"
+#include "lcd_config.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+// Small panel for the exhaustive checks, even like the real one
+#define TEST_W 12
+#define TEST_H 10
+
+#define ORBIT_LENGTH 9
+
+// ============================================================================
+// OFFSETS
+// ============================================================================
+
+static void test_offset_starts_centered(void) {
+    int dx = -1, dy = -1;
+    burn_in_shift_offset(0, &dx, &dy);
+    CHECK_EQ(dx, 0);
+    CHECK_EQ(dy, 0);
+}
+
+static void test_offset_visits_nine_positions(void) {
+    bool seen[3][3] = {};
+    for (uint32_t step = 0; step < ORBIT_LENGTH; step++) {
+        int dx, dy;
+        burn_in_shift_offset(step, &dx, &dy);
+        CHECK(dx == 0 || dx == BURN_IN_SHIFT_PX || dx == -BURN_IN_SHIFT_PX);
+        CHECK(dy == 0 || dy == BURN_IN_SHIFT_PX || dy == -BURN_IN_SHIFT_PX);
+        CHECK_EQ(dx % 2, 0);
+        CHECK_EQ(dy % 2, 0);
+        seen[dx / BURN_IN_SHIFT_PX + 1][dy / BURN_IN_SHIFT_PX + 1] = true;
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) CHECK(seen[i][j]);
+    }
+}
+
+static void test_offset_moves_one_step_and_wraps(void) {
+    for (uint32_t step = 0; step < 3 * ORBIT_LENGTH; step++) {
+        int dx, dy, next_dx, next_dy, wrapped_dx, wrapped_dy;
+        burn_in_shift_offset(step, &dx, &dy);
+        burn_in_shift_offset(step + 1, &next_dx, &next_dy);
+        burn_in_shift_offset(step + ORBIT_LENGTH, &wrapped_dx, &wrapped_dy);
+        CHECK(abs(next_dx - dx) <= BURN_IN_SHIFT_PX);
+        CHECK(abs(next_dy - dy) <= BURN_IN_SHIFT_PX);
+        CHECK(next_dx != dx || next_dy != dy);
+        CHECK_EQ(wrapped_dx, dx);
+        CHECK_EQ(wrapped_dy, dy);
+    }
+
+    // uint32_t overflow of the step counter lands on a valid position
+    int dx, dy;
+    burn_in_shift_offset(UINT32_MAX, &dx, &dy);
+    CHECK(abs(dx) <= BURN_IN_SHIFT_PX && abs(dy) <= BURN_IN_SHIFT_PX);
+}
+
+// ============================================================================
+// CLIPPING
+// ============================================================================
+
+static void test_clip_inside_is_unchanged(void) {
+    burn_in_area_t area = {4, 2, 7, 5};
+    burn_in_clip_t clip;
+    CHECK(burn_in_shift_clip(&area, 2, -2, TEST_W, TEST_H, &clip));
+    CHECK_EQ(clip.window.x1, 4);
+    CHECK_EQ(clip.window.y1, 2);
+    CHECK_EQ(clip.window.x2, 7);
+    CHECK_EQ(clip.window.y2, 5);
+    CHECK_EQ(clip.skip_cols, 0);
+    CHECK_EQ(clip.skip_rows, 0);
+    CHECK_EQ(clip.src_width, 4);
+}
+
+static void test_clip_edges(void) {
+    burn_in_area_t full = {0, 0, TEST_W - 1, TEST_H - 1};
+    burn_in_clip_t clip;
+
+    // Moved left and up: the first columns and rows fall off
+    CHECK(burn_in_shift_clip(&full, -2, -2, TEST_W, TEST_H, &clip));
+    CHECK_EQ(clip.window.x1, 2);
+    CHECK_EQ(clip.window.y1, 2);
+    CHECK_EQ(clip.window.x2, TEST_W - 1);
+    CHECK_EQ(clip.window.y2, TEST_H - 1);
+    CHECK_EQ(clip.skip_cols, 2);
+    CHECK_EQ(clip.skip_rows, 2);
+    CHECK_EQ(clip.src_width, TEST_W);
+
+    // Moved right and down: the last ones
+    CHECK(burn_in_shift_clip(&full, 2, 2, TEST_W, TEST_H, &clip));
+    CHECK_EQ(clip.window.x1, 0);
+    CHECK_EQ(clip.window.y1, 0);
+    CHECK_EQ(clip.window.x2, TEST_W - 3);
+    CHECK_EQ(clip.window.y2, TEST_H - 3);
+    CHECK_EQ(clip.skip_cols, 0);
+    CHECK_EQ(clip.skip_rows, 0);
+}
+
+static void test_clip_off_panel(void) {
+    burn_in_clip_t clip;
+    burn_in_area_t left = {0, 0, 1, TEST_H - 1};
+    burn_in_area_t bottom = {0, TEST_H - 2, TEST_W - 1, TEST_H - 1};
+    CHECK(!burn_in_shift_clip(&left, -2, 0, TEST_W, TEST_H, &clip));
+    CHECK(!burn_in_shift_clip(&bottom, 0, 2, TEST_W, TEST_H, &clip));
+    CHECK(burn_in_shift_clip(&left, 2, 0, TEST_W, TEST_H, &clip));
+}
+
+// Every pixel of every clipped window lands on the panel, every kept source
+// pixel is the one LVGL drew at that position
+static void test_clip_lands_on_panel(void) {
+    for (uint32_t step = 0; step < ORBIT_LENGTH; step++) {
+        int dx, dy;
+        burn_in_shift_offset(step, &dx, &dy);
+        for (int x1 = 0; x1 < TEST_W; x1 += 2) {
+            for (int x2 = x1 + 1; x2 < TEST_W; x2 += 2) {
+                burn_in_area_t area = {x1, 0, x2, TEST_H - 1};
+                burn_in_clip_t clip;
+                if (!burn_in_shift_clip(&area, dx, dy, TEST_W, TEST_H, &clip)) continue;
+                CHECK(clip.window.x1 + dx >= 0 && clip.window.x2 + dx <= TEST_W - 1);
+                CHECK(clip.window.y1 + dy >= 0 && clip.window.y2 + dy <= TEST_H - 1);
+                CHECK_EQ(area.x1 + clip.skip_cols, clip.window.x1);
+                CHECK_EQ(area.y1 + clip.skip_rows, clip.window.y1);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// PACKING
+// ============================================================================
+
+// Pixel value encodes its LVGL position
+static uint16_t pixel_at(int x, int y) {
+    return (uint16_t)(y * 100 + x);
+}
+
+static void fill_area(uint16_t *pixels, const burn_in_area_t *area) {
+    for (int y = area->y1; y <= area->y2; y++) {
+        for (int x = area->x1; x <= area->x2; x++) *pixels++ = pixel_at(x, y);
+    }
+}
+
+static int check_packed(const uint16_t *pixels, const burn_in_clip_t *clip) {
+    int bad = 0;
+    for (int y = clip->window.y1; y <= clip->window.y2; y++) {
+        for (int x = clip->window.x1; x <= clip->window.x2; x++) {
+            if (*pixels++ != pixel_at(x, y)) bad++;
+        }
+    }
+    return bad;
+}
+
+static void test_pack_in_place(void) {
+    for (uint32_t step = 0; step < ORBIT_LENGTH; step++) {
+        int dx, dy;
+        burn_in_shift_offset(step, &dx, &dy);
+        burn_in_area_t area = {0, 0, TEST_W - 1, TEST_H - 1};
+        uint16_t chunk[TEST_W * TEST_H];
+        fill_area(chunk, &area);
+
+        burn_in_clip_t clip;
+        CHECK(burn_in_shift_clip(&area, dx, dy, TEST_W, TEST_H, &clip));
+        burn_in_shift_pack(chunk, chunk, &clip);
+        CHECK_EQ(check_packed(chunk, &clip), 0);
+    }
+}
+
+static void test_pack_partial_chunk_in_place(void) {
+    // A chunk at the left edge, a few rows down: only its first columns fall off
+    burn_in_area_t area = {0, 4, 5, 7};
+    uint16_t chunk[6 * 4];
+    fill_area(chunk, &area);
+
+    burn_in_clip_t clip;
+    CHECK(burn_in_shift_clip(&area, -2, 2, TEST_W, TEST_H, &clip));
+    CHECK_EQ(clip.skip_cols, 2);
+    CHECK_EQ(clip.skip_rows, 0);
+    CHECK_EQ(clip.window.y2, 7);
+    burn_in_shift_pack(chunk, chunk, &clip);
+    CHECK_EQ(check_packed(chunk, &clip), 0);
+}
+
+static void test_pack_to_other_buffer(void) {
+    burn_in_area_t area = {0, 0, TEST_W - 1, TEST_H - 1};
+    uint16_t frame[TEST_W * TEST_H];
+    uint16_t stage[TEST_W * TEST_H];
+    fill_area(frame, &area);
+
+    burn_in_clip_t clip;
+    CHECK(burn_in_shift_clip(&area, 0, 0, TEST_W, TEST_H, &clip));
+    burn_in_shift_pack(stage, frame, &clip);
+    CHECK_EQ(check_packed(stage, &clip), 0);
+
+    CHECK(burn_in_shift_clip(&area, 2, -2, TEST_W, TEST_H, &clip));
+    burn_in_shift_pack(stage, frame, &clip);
+    CHECK_EQ(check_packed(stage, &clip), 0);
+    burn_in_clip_t whole = {area, 0, 0, TEST_W};
+    CHECK_EQ(check_packed(frame, &whole), 0);  // Source untouched
+}
+
+// ============================================================================
+// FRAME COPY
+// ============================================================================
+
+static void test_store_chunks_rebuild_frame(void) {
+    uint16_t frame[TEST_W * TEST_H] = {};
+
+    // Chunks as LVGL flushes them: bands of rows, one partial area
+    burn_in_area_t chunks[] = {{0, 0, TEST_W - 1, 3}, {0, 4, TEST_W - 1, 7}, {0, 8, TEST_W - 1, TEST_H - 1}, {2, 2, 5, 5}};
+    for (const burn_in_area_t &chunk : chunks) {
+        uint16_t pixels[TEST_W * TEST_H];
+        fill_area(pixels, &chunk);
+        burn_in_shift_store(frame, TEST_W, &chunk, pixels);
+    }
+
+    burn_in_clip_t whole = {{0, 0, TEST_W - 1, TEST_H - 1}, 0, 0, TEST_W};
+    CHECK_EQ(check_packed(frame, &whole), 0);
+}
+
+// ============================================================================
+// UNCOVERED STRIPS
+// ============================================================================
+
+static void test_uncovered_centered(void) {
+    burn_in_area_t strips[2];
+    CHECK_EQ(burn_in_shift_uncovered(0, 0, TEST_W, TEST_H, strips), 0);
+}
+
+static void test_uncovered_strips(void) {
+    burn_in_area_t strips[2];
+    CHECK_EQ(burn_in_shift_uncovered(2, 0, TEST_W, TEST_H, strips), 1);
+    CHECK_EQ(strips[0].x1, 0);
+    CHECK_EQ(strips[0].x2, 1);
+    CHECK_EQ(strips[0].y1, 0);
+    CHECK_EQ(strips[0].y2, TEST_H - 1);
+
+    CHECK_EQ(burn_in_shift_uncovered(-2, -2, TEST_W, TEST_H, strips), 2);
+    CHECK_EQ(strips[0].x1, TEST_W - 2);
+    CHECK_EQ(strips[0].x2, TEST_W - 1);
+    CHECK_EQ(strips[1].x1, 0);
+    CHECK_EQ(strips[1].x2, TEST_W - 1);
+    CHECK_EQ(strips[1].y1, TEST_H - 2);
+    CHECK_EQ(strips[1].y2, TEST_H - 1);
+}
+
+// The shifted image and the strips cover each panel pixel, and the strips
+// never cover the image (they are sent after the set_gap, before the frame)
+static void test_uncovered_complete_panel(void) {
+    for (uint32_t step = 0; step < ORBIT_LENGTH; step++) {
+        int dx, dy;
+        burn_in_shift_offset(step, &dx, &dy);
+        burn_in_area_t strips[2];
+        int count = burn_in_shift_uncovered(dx, dy, TEST_W, TEST_H, strips);
+
+        for (int y = 0; y < TEST_H; y++) {
+            for (int x = 0; x < TEST_W; x++) {
+                bool image = x - dx >= 0 && x - dx < TEST_W && y - dy >= 0 && y - dy < TEST_H;
+                bool strip = false;
+                for (int i = 0; i < count; i++) {
+                    strip |= x >= strips[i].x1 && x <= strips[i].x2 && y >= strips[i].y1 && y <= strips[i].y2;
+                }
+                CHECK(image != strip);
+            }
+        }
+        for (int i = 0; i < count; i++) {
+            CHECK_EQ(strips[i].x1 % 2, 0);
+            CHECK_EQ(strips[i].y1 % 2, 0);
+        }
+    }
+}
+
+// ============================================================================
+// TOUCH
+// ============================================================================
+
+static void test_touch_follows_image(void) {
+    uint16_t x = 100, y = 100;
+    burn_in_shift_touch(2, -2, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, &x, &y);
+    CHECK_EQ(x, 98);
+    CHECK_EQ(y, 102);
+
+    x = 100;
+    y = 100;
+    burn_in_shift_touch(0, 0, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, &x, &y);
+    CHECK_EQ(x, 100);
+    CHECK_EQ(y, 100);
+}
+
+static void test_touch_clamped(void) {
+    uint16_t x = 1, y = EXAMPLE_LCD_V_RES - 1;
+    burn_in_shift_touch(2, -2, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, &x, &y);
+    CHECK_EQ(x, 0);
+    CHECK_EQ(y, EXAMPLE_LCD_V_RES - 1);
+
+    x = EXAMPLE_LCD_H_RES - 1;
+    y = 0;
+    burn_in_shift_touch(-2, 2, EXAMPLE_LCD_H_RES, EXAMPLE_LCD_V_RES, &x, &y);
+    CHECK_EQ(x, EXAMPLE_LCD_H_RES - 1);
+    CHECK_EQ(y, 0);
+}
+
+int main(void) {
+    RUN_TEST(test_offset_starts_centered);
+    RUN_TEST(test_offset_visits_nine_positions);
+    RUN_TEST(test_offset_moves_one_step_and_wraps);
+    RUN_TEST(test_clip_inside_is_unchanged);
+    RUN_TEST(test_clip_edges);
+    RUN_TEST(test_clip_off_panel);
+    RUN_TEST(test_clip_lands_on_panel);
+    RUN_TEST(test_pack_in_place);
+    RUN_TEST(test_pack_partial_chunk_in_place);
+    RUN_TEST(test_pack_to_other_buffer);
+    RUN_TEST(test_store_chunks_rebuild_frame);
+    RUN_TEST(test_uncovered_centered);
+    RUN_TEST(test_uncovered_strips);
+    RUN_TEST(test_uncovered_complete_panel);
+    RUN_TEST(test_touch_follows_image);
+    RUN_TEST(test_touch_clamped);
+    return HOST_TEST_RESULT();
+}